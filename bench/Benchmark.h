@@ -0,0 +1,90 @@
+#ifndef AMO_TOOLS_SUITE_BENCHMARK_H
+#define AMO_TOOLS_SUITE_BENCHMARK_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * Microbenchmarks time a single calculator call, macrobenchmarks time a complete assessment (a whole steam system
+ * model, a full PSAT/fan run, a batch of acceptance test rows, ...).
+ */
+enum class BenchmarkKind {
+    MICRO,
+    MACRO
+};
+
+/**
+ * Timed body of a benchmark. It returns a representative result of the calculation, which keeps the optimizer from
+ * discarding the work and is reported in the JSON output so result drift between versions is visible too.
+ */
+typedef std::function<double()> BenchmarkBody;
+
+/**
+ * A named benchmark. The setup function runs once, untimed, and returns the body that is timed, so inputs
+ * (acceptance data files, curve tables, ...) are prepared outside of the measurement.
+ */
+struct Benchmark {
+    Benchmark(std::string family, std::string name, const BenchmarkKind kind, std::function<BenchmarkBody()> setup)
+            : family(std::move(family)), name(std::move(name)), kind(kind), setup(std::move(setup)) {}
+
+    std::string family;
+    std::string name;
+    BenchmarkKind kind;
+    std::function<BenchmarkBody()> setup;
+};
+
+/**
+ * Holds every benchmark registered by the *.bench.cpp translation units.
+ */
+class BenchmarkRegistry {
+public:
+    static BenchmarkRegistry &instance() {
+        static BenchmarkRegistry registry;
+        return registry;
+    }
+
+    void add(Benchmark benchmark) { benchmarks.push_back(std::move(benchmark)); }
+
+    const std::vector<Benchmark> &getBenchmarks() const { return benchmarks; }
+
+private:
+    BenchmarkRegistry() = default;
+
+    std::vector<Benchmark> benchmarks;
+};
+
+/**
+ * Registers a benchmark during static initialization, declare one per benchmark at namespace scope.
+ */
+struct BenchmarkRegistrar {
+    BenchmarkRegistrar(std::string family, std::string name, const BenchmarkKind kind,
+                       std::function<BenchmarkBody()> setup) {
+        BenchmarkRegistry::instance().add(Benchmark(std::move(family), std::move(name), kind, std::move(setup)));
+    }
+};
+
+/**
+ * Heap allocation counters, incremented by the global operator new replacement in main.bench.cpp.
+ */
+struct AllocationCounter {
+    static std::atomic<std::size_t> allocations;
+    static std::atomic<std::size_t> bytes;
+};
+
+/**
+ * Run time settings shared with the benchmark setup functions.
+ */
+struct BenchmarkSettings {
+    /**
+     * @return std::string &, directory holding the SSMT acceptance test data (tests/at/csv)
+     */
+    static std::string &acceptanceDataDirectory() {
+        static std::string directory;
+        return directory;
+    }
+};
+
+#endif //AMO_TOOLS_SUITE_BENCHMARK_H
@@ -0,0 +1,81 @@
+#include "Benchmark.h"
+#include <chillers/ChillerPlant.h>
+#include <chillers/CoolingTower.h>
+#include <cmath>
+#include <vector>
+
+namespace {
+    // inputs from tests/CoolingTower.unit.cpp
+
+    BenchmarkRegistrar coolingTower("chillers", "CoolingTowerMakeupWaterCalculator::calculate", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            CoolingTowerOperatingConditionsData operatingConditionsData(2500, 10.00, 1000, 1.00);
+            CoolingTowerWaterConservationData waterConservationBaselineData(3, 0.002);
+            CoolingTowerWaterConservationData waterConservationModificationData(3, 0.0001);
+            CoolingTowerMakeupWaterCalculator calculator(operatingConditionsData, waterConservationBaselineData,
+                                                         waterConservationModificationData);
+            return calculator.calculate().waterSavings;
+        });
+    });
+
+    // a year of hours: the dry bulb temperature follows the seasons and the day, the cooling load follows the dry bulb
+    // temperature and the tower is off on cold nights
+    struct Year {
+        std::vector<double> coolingLoad, dryBulbTemperature;
+    };
+
+    Year makeYear() {
+        Year year;
+        const double pi = 3.14159265358979;
+        for (int hour = 0; hour < 8760; hour++) {
+            const double temperature = 55 - 25 * std::cos(2 * pi * hour / 8760) - 10 * std::cos(2 * pi * hour / 24);
+            year.dryBulbTemperature.push_back(temperature);
+            year.coolingLoad.push_back(temperature > 40 ? 2 + 0.15 * (temperature - 40) : 0);
+        }
+        return year;
+    }
+
+    const CoolingTowerHourlySimulation::EvaporationCurve evaporationCurve = {{40, 60, 80, 100}, {0.6, 0.7, 0.85, 1.0}};
+
+    BenchmarkRegistrar coolingTowerHourly("chillers", "CoolingTowerHourlySimulation::calculate/8760-hours", BenchmarkKind::MACRO, [] {
+        const Year year = makeYear();
+        return BenchmarkBody([year] {
+            CoolingTowerHourlySimulation simulation(2500, year.coolingLoad, year.dryBulbTemperature, evaporationCurve);
+            return simulation.calculate({3, 0.002}, {6, 0.0001}).waterSavings;
+        });
+    });
+
+    // cycles of concentration 2 to 10 and 100 drift loss factors over the same year
+    BenchmarkRegistrar coolingTowerSweep("chillers", "CoolingTowerHourlySimulation::calculateTotals/900-scenarios", BenchmarkKind::MACRO, [] {
+        const Year year = makeYear();
+        std::vector<CoolingTowerWaterConservationData> scenarios;
+        for (int cyclesOfConcentration = 2; cyclesOfConcentration <= 10; cyclesOfConcentration++) {
+            for (int i = 1; i <= 100; i++) scenarios.emplace_back(cyclesOfConcentration, 0.00002 * i);
+        }
+        return BenchmarkBody([year, scenarios] {
+            CoolingTowerHourlySimulation simulation(2500, year.coolingLoad, year.dryBulbTemperature, evaporationCurve);
+            double makeupWater = 0;
+            for (auto const &totals : simulation.calculateTotals(scenarios)) makeupWater += totals.makeupWater;
+            return makeupWater;
+        });
+    });
+
+    // three 500 ton chillers with the curves of tests/ChillerPlant.unit.cpp, staged for the lowest plant power, with
+    // condenser water reset; the wet bulb temperature is the dry bulb temperature of the year less 10°F
+    BenchmarkRegistrar chillerPlant("chillers", "ChillerPlant::simulate/8760-hours", BenchmarkKind::MACRO, [] {
+        const Year year = makeYear();
+        std::vector<double> coolingLoad, wetBulbTemperature;
+        for (std::size_t hour = 0; hour < year.coolingLoad.size(); hour++) {
+            coolingLoad.push_back(year.coolingLoad[hour] * 100);
+            wetBulbTemperature.push_back(year.dryBulbTemperature[hour] - 10);
+        }
+        const ChillerPlant::Chiller chiller(500, 0.6, CurveFitVal({0.25, 0.5, 0.75, 1}, {0.19375, 0.375, 0.64375, 1}, 2),
+                                            CurveFitVal({65, 75, 85}, {0.8, 0.9, 1}, 1), 1500, 40, 30);
+        const ChillerPlant plant({chiller, chiller, chiller},
+                                 {7, 85, true, 65, 90, CoolingTowerWaterConservationData(4, 0.0005)},
+                                 ChillerPlant::Staging::LOWEST_POWER, 0.9);
+        return BenchmarkBody([plant, coolingLoad, wetBulbTemperature] {
+            return plant.simulate(coolingLoad, wetBulbTemperature).energy;
+        });
+    });
+}
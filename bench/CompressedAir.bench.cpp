@@ -0,0 +1,206 @@
+#include "Benchmark.h"
+#include <cmath>
+#include <vector>
+#include <calculator/util/CompressedAirCentrifugal.h>
+#include <calculator/util/CompressedAirCentrifugalMap.h>
+#include <calculator/util/CompressedAirLeakSurvey.h>
+#include <calculator/util/CompressedAirLeakSurveyAccumulator.h>
+#include <calculator/util/CompressedAirNetwork.h>
+#include <calculator/util/CompressedAirSequencingOptimizer.h>
+#include <calculator/util/CompressedAirSystemSimulation.h>
+#include <calculator/util/DecibelsLeakRateGrid.h>
+
+namespace {
+    // inputs from tests/CompressedAirCentrifugal.unit.cpp and tests/CompressedAirLeakSurvey.unit.cpp
+
+    CompressedAirLeakSurveyInput makeLeakSurveyInput(const int measurementMethod) {
+        return CompressedAirLeakSurveyInput(8640, 1, 0.12, measurementMethod, EstimateMethodData(0.1),
+                                            DecibelsMethodData(130, 25, 20, 150, 1.04, 1.2, 30, 125, 1.85, 1.65),
+                                            BagMethodData(15, 10, 12), OrificeMethodData(250.0, 14.7, 1.0, 6.0, 6.2, 4),
+                                            CompressorElectricityData(0.40, 0.16), 1);
+    }
+
+    // a 50 x 50 grid of 50 ft, 2 in pipes fed at two corners: 2500 junctions and 4902 pipes
+    CompressedAirNetwork makeNetworkGrid() {
+        const std::size_t size = 50;
+        CompressedAirNetwork network;
+        for (std::size_t i = 0; i < size * size; i++) network.addJunction(0.5 + static_cast<double>(i % 7) / 4);
+        for (std::size_t row = 0; row < size; row++) {
+            for (std::size_t column = 0; column + 1 < size; column++) {
+                network.addPipe(row * size + column, row * size + column + 1, 50, 2);
+            }
+        }
+        for (std::size_t row = 0; row + 1 < size; row++) {
+            for (std::size_t column = 0; column < size; column++) {
+                network.addPipe(row * size + column, (row + 1) * size + column, 50, 2);
+            }
+        }
+        network.addPipe(network.addSupply(110), 0, 100, 6);
+        network.addPipe(network.addSupply(105), size * size - 1, 100, 6);
+        return network;
+    }
+
+    BenchmarkRegistrar centrifugalBlowOff("compressedAir", "CompressedAirCentrifugal_BlowOff::calculateFromPerkW_BlowOff",
+                                          BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return CompressedAirCentrifugal_BlowOff(452.3, 3138, 370.9, 2510).calculateFromPerkW_BlowOff(0.82, 0.6798)
+                    .C_Calc;
+        });
+    });
+
+    BenchmarkRegistrar centrifugalLoadUnload("compressedAir", "CompressedAirCentrifugal_LoadUnload::calculateFromPerkW",
+                                             BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return CompressedAirCentrifugal_LoadUnload(452.3, 3138, 71.3).calculateFromPerkW(0.36).C_Calc;
+        });
+    });
+
+    BenchmarkRegistrar centrifugalModulationUnload("compressedAir",
+                                                   "CompressedAirCentrifugal_ModulationUnload::calculateFromPerkW",
+                                                   BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return CompressedAirCentrifugal_ModulationUnload(452.3, 3138, 71.3, 3005, 411.9, 2731)
+                    .calculateFromPerkW(0.94).C_Calc;
+        });
+    });
+
+    // a year of hourly discharge pressures, refitting the capacity curve at each hour against the performance map
+    BenchmarkRegistrar centrifugalAdjust("compressedAir",
+                                         "CompressedAirCentrifugal_ModulationUnload::AdjustDischargePressure/8760-hours",
+                                         BenchmarkKind::MACRO, [] {
+        return BenchmarkBody([] {
+            const std::vector<double> capacity = {3200, 3138, 2885}, dischargePressure = {91, 100, 117};
+            double energy = 0;
+            for (int hour = 0; hour < 8760; hour++) {
+                CompressedAirCentrifugal_ModulationUnload model(452.3, 3138, 71.3, 3005, 411.9, 2731);
+                model.AdjustDischargePressure(capacity, dischargePressure, 95 + hour % 17, 58.23);
+                energy += model.calculateFromPerC(0.5 + (hour % 50) / 100.0).kW_Calc;
+            }
+            return energy;
+        });
+    });
+
+    BenchmarkRegistrar centrifugalMap("compressedAir", "CompressedAirCentrifugalMap::calculateFromPerC/8760-hours",
+                                      BenchmarkKind::MACRO, [] {
+        auto const map = CompressedAirCentrifugalMap::modulationUnload(452.3, 3138, 71.3, 3005, 411.9, 2731,
+                                                                       {3200, 3138, 2885}, {91, 100, 117}, 58.23);
+        return BenchmarkBody([map] {
+            double energy = 0;
+            for (int hour = 0; hour < 8760; hour++) {
+                energy += map.calculateFromPerC(95 + hour % 17, 0.5 + (hour % 50) / 100.0).kW_Calc;
+            }
+            return energy;
+        });
+    });
+
+    // a survey of 100 leaks spread over the four measurement methods
+    BenchmarkRegistrar leakSurvey("compressedAir", "CompressedAirLeakSurvey::calculate/100-leaks", BenchmarkKind::MACRO,
+                                  [] {
+        std::vector<CompressedAirLeakSurveyInput> inputs;
+        for (int i = 0; i < 100; i++) inputs.push_back(makeLeakSurveyInput(i % 4));
+        return BenchmarkBody([inputs]() mutable {
+            return CompressedAirLeakSurvey(inputs).calculate().annualTotalElectricityCost;
+        });
+    });
+
+    // a site survey of 100000 tagged leaks in 20 areas, totaled in batches
+    BenchmarkRegistrar leakSurveyAccumulator("compressedAir", "CompressedAirLeakSurveyAccumulator::add/100000-leaks",
+                                             BenchmarkKind::MACRO, [] {
+        std::vector<CompressedAirLeakSurveyInput> inputs;
+        for (int i = 0; i < 4; i++) inputs.push_back(makeLeakSurveyInput(i));
+        std::vector<std::string> areas;
+        for (int i = 0; i < 20; i++) areas.push_back("area " + std::to_string(i));
+        return BenchmarkBody([inputs, areas] {
+            CompressedAirLeakSurveyAccumulator accumulator;
+            for (std::size_t i = 0; i < 100000; i++) accumulator.add(inputs[i % 4], areas[i % 20]);
+            return accumulator.getTotals().annualTotalElectricityCost;
+        });
+    });
+
+    // a 12 x 10 detector table looked up for each reading, against a 2 x 2 interpolation per reading
+    BenchmarkRegistrar decibelsLeakRateGrid("compressedAir", "DecibelsLeakRateGrid::calculate/100000-leaks",
+                                            BenchmarkKind::MACRO, [] {
+        std::vector<double> pressures, decibelRatings, leakRates;
+        for (int i = 0; i < 12; i++) pressures.push_back(20 + 15 * i);
+        for (int i = 0; i < 10; i++) decibelRatings.push_back(10 + 5 * i);
+        for (auto const decibels : decibelRatings) {
+            for (auto const pressure : pressures) leakRates.push_back(0.01 * pressure * (1 + decibels / 20));
+        }
+        std::vector<double> linePressures, decibels;
+        for (std::size_t i = 0; i < 100000; i++) {
+            linePressures.push_back(20 + std::fmod(i * 7.31, 165));
+            decibels.push_back(10 + std::fmod(i * 3.17, 45));
+        }
+        const DecibelsLeakRateGrid grid(pressures, decibelRatings, leakRates);
+        return BenchmarkBody([grid, linePressures, decibels] {
+            std::vector<double> results(linePressures.size());
+            grid.calculate(linePressures.size(), linePressures.data(), decibels.data(), results.data());
+            double total = 0;
+            for (auto const leakRate : results) total += leakRate;
+            return total;
+        });
+    });
+
+    // eight compressors against a year of minute demand data
+    BenchmarkRegistrar systemSimulation("compressedAir", "CompressedAirSystemSimulation::simulate/8-compressors-1-year",
+                                        BenchmarkKind::MACRO, [] {
+        using Unit = CompressedAirSystemSimulation::CompressorUnit;
+        std::vector<Unit> compressors;
+        for (int i = 0; i < 8; i++) {
+            if (i % 3 == 0) compressors.push_back(Unit::loadUnload(452.3, 3138, 71.3));
+            if (i % 3 == 1) compressors.push_back(Unit::modulationUnload(452.3, 3138, 71.3, 3005, 411.9, 2731));
+            if (i % 3 == 2) compressors.push_back(Unit::blowOff(452.3, 3138, 370.9, 2510));
+        }
+        std::vector<double> demand(525600);
+        for (std::size_t i = 0; i < demand.size(); i++) {
+            demand[i] = 12000 + 8000 * std::sin(i * 2 * 3.14159265358979 / 1440) + 500 * std::sin(i * 0.7);
+        }
+        const CompressedAirSystemSimulation system(compressors, 1500, 10, 1 / 60.0);
+        return BenchmarkBody([system, demand] {
+            return system.simulate(demand).energy;
+        });
+    });
+
+    // trim assignments, pressure bands and storage additions for eight compressors over a week of minute data
+    BenchmarkRegistrar sequencingOptimizer("compressedAir", "CompressedAirSequencingOptimizer::optimize/81-strategies",
+                                           BenchmarkKind::MACRO, [] {
+        using Unit = CompressedAirSystemSimulation::CompressorUnit;
+        CompressedAirSequencingOptimizer::Inputs inputs;
+        for (int i = 0; i < 8; i++) {
+            if (i % 3 == 0) inputs.compressors.push_back(Unit::loadUnload(452.3, 3138, 71.3));
+            if (i % 3 == 1) inputs.compressors.push_back(Unit::modulationUnload(452.3, 3138, 71.3, 3005, 411.9, 2731));
+            if (i % 3 == 2) inputs.compressors.push_back(Unit::blowOff(452.3, 3138, 370.9, 2510));
+        }
+        for (std::size_t i = 0; i < 10080; i++) {
+            inputs.demand.push_back(12000 + 8000 * std::sin(i * 2 * 3.14159265358979 / 1440) + 500 * std::sin(i * 0.7));
+        }
+        inputs.timeStep = 1 / 60.0;
+        inputs.storageCapacity = 1500;
+        inputs.electricityCost = 0.08;
+        inputs.storageCost = 0.02;
+        inputs.pressureBands = {5, 10, 15};
+        inputs.storageAdditions = {0, 2000, 5000};
+        return BenchmarkBody([inputs] {
+            return CompressedAirSequencingOptimizer::optimize(inputs).strategies.front().totalCost;
+        });
+    });
+
+    BenchmarkRegistrar networkSolve("compressedAir", "CompressedAirNetwork::solve/4902-pipes", BenchmarkKind::MACRO, [] {
+        return BenchmarkBody([] {
+            return makeNetworkGrid().solve().pressures.front();
+        });
+    });
+
+    // one pipe resized between solves of the same network, starting from the last solution
+    BenchmarkRegistrar networkResolve("compressedAir", "CompressedAirNetwork::solve/4902-pipes-resize",
+                                      BenchmarkKind::MACRO, [] {
+        auto network = makeNetworkGrid();
+        network.solve();
+        bool resized = false;
+        return BenchmarkBody([network, resized]() mutable {
+            resized = !resized;
+            network.setPipeDiameter(1200, resized ? 1.5 : 2);
+            return network.solve().pressures.front();
+        });
+    });
+}
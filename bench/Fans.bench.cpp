@@ -0,0 +1,100 @@
+#include "Benchmark.h"
+#include <cmath>
+#include <fans/Fan203.h>
+#include <fans/FanCurve.h>
+#include <fans/FanEnergyIndex.h>
+#include <results/Results.h>
+
+namespace {
+    // inputs from tests/Fan.unit.cpp and tests/Results.unit.cpp ("Fan Output existing")
+
+    Fan203 makeFan203() {
+        FanRatedInfo fanRatedInfo(1191, 1191, 1170, 0.05, 26.28);
+
+        std::vector<std::vector<double> > traverseHoleData = {
+                {0.701, 0.703, 0.6675, 0.815, 0.979, 1.09, 1.155, 1.320, 1.578, 2.130},
+                {0.690, 0.648, 0.555, 0.760, 0.988, 1.060, 1.100, 1.110, 1.458, 1.865},
+                {0.691, 0.621, 0.610, 0.774, 0.747, 0.835, 0.8825, 1.23, 1.210, 1.569}
+        };
+
+        const double area = (143.63 * 32.63 * 2) / 144.0;
+        FlangePlane fanInletFlange(area, 123, 26.57);
+        FlangePlane fanOrEvaseOutletFlange(70 * 78 / 144.0, 132.7, 26.57);
+
+        TraversePlane flowTraverse(143.63 * 32.63 / 144.0, 123.0, 26.57, -18.1, std::sqrt(0.762), traverseHoleData);
+
+        traverseHoleData = {
+                {0.662, 0.568, 0.546, 0.564, 0.463, 0.507, 0.865, 1.017, 1.247, 1.630},
+                {0.639, 0.542, 0.530, 0.570, 0.603, 0.750, 0.965, 1.014, 1.246, 1.596},
+                {0.554, 0.452, 0.453, 0.581, 0.551, 0.724, 0.844, 1.077, 1.323, 1.620}
+        };
+
+        std::vector<TraversePlane> addlTravPlanes({
+                {143.63 * 32.63 / 144.0, 123.0, 26.57, -17.0, std::sqrt(0.762), traverseHoleData}
+        });
+
+        MstPlane inletMstPlane(area, 123.0, 26.57, -17.55);
+        MstPlane outletMstPlane(55.42 * 60.49 / 144.0, 132.7, 26.57, 1.8);
+
+        auto planeData = PlaneData(fanInletFlange, fanOrEvaseOutletFlange, flowTraverse, addlTravPlanes, inletMstPlane,
+                                   outletMstPlane, 0, 0.627, true);
+
+        BaseGasDensity baseGasDensity(123, -17.6, 26.57, 0.0547, BaseGasDensity::GasType::AIR);
+
+        auto const motorShaftPower = FanShaftPower::calculateMotorShaftPower(4200, 205, 0.88) / 746.0;
+        auto fanShaftPower = FanShaftPower(motorShaftPower, 95.0, 100, 100, 0);
+
+        return Fan203(fanRatedInfo, planeData, baseGasDensity, fanShaftPower);
+    }
+
+    FanCurve makeFanCurve() {
+        double density = 0.0308, n = 1180, densityC = 0.0332, nC = 1187, pb = 29.36;
+        double pbC = 29.36, pt1F = -0.93736, gamma = 1.4, gammaC = 1.4, a1 = 34, a2 = 12.7;
+
+        std::vector<FanCurveData::BaseCurve> baseCurveData = {
+                {0, 22.3, 115}, {14410, 22.5, 154}, {28820, 22.3, 194}, {43230, 21.8, 241}, {57640, 21.2, 293},
+                {72050, 20.3, 349}, {86460, 19.3, 406}, {100871, 18, 462}, {115281, 16.5, 515}, {129691, 14.8, 566},
+                {144101, 12.7, 615}, {158511, 10.2, 667}, {172921, 7.3, 725}, {187331, 3.7, 789}, {201741, -0.8, 861}
+        };
+
+        return FanCurve(density, densityC, n, nC, pb, pbC, pt1F, gamma, gammaC, a1, a2,
+                        FanCurveData(FanCurveType::FanStaticPressure, baseCurveData));
+    }
+
+    BenchmarkRegistrar fanEnergyIndex("fans", "FanEnergyIndex::calculateEnergyIndex", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return FanEnergyIndex(129691, -16, 1, 0.07024, 450).calculateEnergyIndex();
+        });
+    });
+
+    BenchmarkRegistrar baseGasDensity("fans", "BaseGasDensity/relative-humidity", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return BaseGasDensity(70, 26.62, 29.92, 60, BaseGasDensity::GasType::AIR,
+                                  BaseGasDensity::InputType::RelativeHumidity, 1).getGasDensity();
+        });
+    });
+
+    BenchmarkRegistrar fan203("fans", "Fan203::calculate", BenchmarkKind::MACRO, [] {
+        return BenchmarkBody([] {
+            return makeFan203().calculate().fanEfficiencyTotalPressure;
+        });
+    });
+
+    BenchmarkRegistrar fanCurve("fans", "FanCurve::calculate", BenchmarkKind::MACRO, [] {
+        return BenchmarkBody([] {
+            return makeFanCurve().calculate().back().power;
+        });
+    });
+
+    BenchmarkRegistrar fanResultExisting("fans", "FanResult::calculateExisting", BenchmarkKind::MACRO, [] {
+        return BenchmarkBody([] {
+            Fan::Input fanInput = {1180, 0.07024, Motor::Drive::DIRECT_DRIVE, 1.00};
+            Motor motor = {Motor::LineFrequency::FREQ60, 600, 1180, Motor::EfficiencyClass::ENERGY_EFFICIENT, 96, 460,
+                           683.2505707137};
+            Fan::FieldDataBaseline fanFieldData = {460, 460, 660, 129691, -16.36, 1.1, 0.988,
+                                                   Motor::LoadEstimationMethod::POWER};
+            FanResult result = {fanInput, motor, 8760, 0.06};
+            return result.calculateExisting(fanFieldData).annualCost;
+        });
+    });
+}
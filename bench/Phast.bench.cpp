@@ -0,0 +1,250 @@
+#include "Benchmark.h"
+#include <cmath>
+#include <vector>
+#include <calculator/furnace/EAFHeatBalance.h>
+#include <calculator/furnace/FurnaceEfficiencyOptimizer.h>
+#include <calculator/furnace/MultiZoneFurnace.h>
+#include <calculator/furnace/O2Enrichment.h>
+#include <calculator/losses/Atmosphere.h>
+#include <calculator/losses/GasFlueGasMaterial.h>
+#include <calculator/losses/LeakageLosses.h>
+#include <calculator/losses/LoadChargeEnthalpy.h>
+#include <calculator/losses/OpeningLosses.h>
+#include <calculator/losses/SolidLiquidFlueGasMaterial.h>
+#include <calculator/losses/SolidLoadChargeMaterial.h>
+#include <calculator/losses/WallLosses.h>
+
+namespace {
+    // inputs from the PHAST loss unit tests (tests/Atmosphere.unit.cpp, tests/WallLosses.unit.cpp,
+    // tests/OpeningLosses.unit.cpp, tests/GasFlueGasMaterial.unit.cpp, ...)
+
+    GasCompositions makeGasComposition() {
+        return GasCompositions("unit test gas", 94.1, 2.4, 1.41, 0.03, 0.49, 0.29, 0, 0.42, 0.71, 0, 0);
+    }
+
+    BenchmarkRegistrar atmosphere("phast", "Atmosphere::getTotalHeat", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return Atmosphere(100.0, 1400.0, 1200.0, 1.0, 0.02).getTotalHeat();
+        });
+    });
+
+    BenchmarkRegistrar wallLosses("phast", "WallLosses::getHeatLoss", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return WallLosses(500.0, 80.0, 225.0, 10.0, 0.9, 1.394, 1.0).getHeatLoss();
+        });
+    });
+
+    BenchmarkRegistrar openingLossesCircular("phast", "OpeningLosses::getHeatLoss/circular", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return OpeningLosses(0.95, 12.0, 9.0, 1.33, 75.0, 1600.0, 100.0, 0.70).getHeatLoss();
+        });
+    });
+
+    BenchmarkRegistrar openingLossesQuad("phast", "OpeningLosses::getHeatLoss/quadrilateral", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return OpeningLosses(0.95, 48.0, 15.0, 9.0, 1.67, 75.0, 1600.0, 20.0, 0.64).getHeatLoss();
+        });
+    });
+
+    BenchmarkRegistrar viewFactor("phast", "OpeningLosses::calculateViewFactor/quadrilateral", BenchmarkKind::MICRO, [] {
+        OpeningLosses opening;
+        return BenchmarkBody([opening]() mutable {
+            return opening.calculateViewFactor(2.0, 10.0, 5.0);
+        });
+    });
+
+    BenchmarkRegistrar viewFactorInterpolated("phast", "OpeningLosses::interpolateViewFactor/quadrilateral",
+                                              BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return OpeningLosses::interpolateViewFactor(2.0, 10.0, 5.0);
+        });
+    });
+
+    BenchmarkRegistrar leakageLosses("phast", "LeakageLosses::getExfiltratedGasesHeatContent", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return LeakageLosses(0.1, 3.0, 1600.0, 80.0, 0.8052, 1.02, 1.0).getExfiltratedGasesHeatContent();
+        });
+    });
+
+    BenchmarkRegistrar solidLoadCharge("phast", "SolidLoadChargeMaterial::getTotalHeat", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return SolidLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC, 0.247910198232625,
+                                           169.0, 0.260090757105326, 1214.996, 10000.0, 2.0, 1.0, 70.0, 1500.0, 250.0,
+                                           10.0, 10.0, 100.0, 0).getTotalHeat();
+        });
+    });
+
+    // the heat taken up by one charge over the 1440 steps of a continuous furnace zone model
+    BenchmarkRegistrar solidLoadChargeSteps("phast", "SolidLoadChargeMaterial::getTotalHeat/1440-steps",
+                                            BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            double total = 0;
+            for (int i = 0; i < 1440; i++) {
+                total += SolidLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC,
+                                                 0.247910198232625, 169.0, 0.260090757105326, 1214.996, 10000.0, 0.0,
+                                                 0.0, 70.0 + i, 71.0 + i, 250.0, 10.0, 0.0, 100.0, 0).getTotalHeat();
+            }
+            return total;
+        });
+    });
+
+    BenchmarkRegistrar loadChargeEnthalpySteps("phast", "LoadChargeEnthalpy::getHeatRequired/1440-steps",
+                                               BenchmarkKind::MICRO, [] {
+        std::vector<double> initial(1440), discharge(1440), heatRequired(1440);
+        for (std::size_t i = 0; i < initial.size(); i++) {
+            initial[i] = 70.0 + i;
+            discharge[i] = 71.0 + i;
+        }
+        const LoadChargeEnthalpy enthalpy(SolidLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC,
+                                                                  0.247910198232625, 169.0, 0.260090757105326,
+                                                                  1214.996, 10000.0, 0.0, 0.0, 70.0, 1510.0, 250.0,
+                                                                  10.0, 0.0, 100.0, 0));
+        return BenchmarkBody([=]() mutable {
+            enthalpy.getHeatRequired(initial.size(), initial.data(), discharge.data(), heatRequired.data());
+            double total = 0;
+            for (const double heat : heatRequired) total += heat;
+            return total * 10000.0;
+        });
+    });
+
+    BenchmarkRegistrar gasCompositions("phast", "GasCompositions/construct", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return makeGasComposition().getHeatingValue();
+        });
+    });
+
+    BenchmarkRegistrar gasExcessAir("phast", "GasCompositions::calculateExcessAir", BenchmarkKind::MICRO, [] {
+        GasCompositions composition = makeGasComposition();
+        return BenchmarkBody([composition]() mutable {
+            return composition.calculateExcessAir(0.07);
+        });
+    });
+
+    BenchmarkRegistrar gasFlueGas("phast", "GasFlueGasMaterial::getHeatLoss", BenchmarkKind::MICRO, [] {
+        const GasCompositions composition = makeGasComposition();
+        return BenchmarkBody([composition] {
+            return GasFlueGasMaterial(700, 2.31722095, 125, composition, 125).getHeatLoss();
+        });
+    });
+
+    BenchmarkRegistrar solidLiquidExcessAir("phast", "SolidLiquidFlueGasMaterial::calculateExcessAirFromFlueGasO2",
+                                            BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return SolidLiquidFlueGasMaterial::calculateExcessAirFromFlueGasO2(0.07, 1.0, 75.0, 5.0, 1.0, 9.0, 7.0, 0.0,
+                                                                               1.5);
+        });
+    });
+
+    BenchmarkRegistrar o2Enrichment("phast", "O2Enrichment", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return O2Enrichment(21, 100, 1800, 1900, 5, 1, 900, 80, 10).getFuelSavingsEnriched();
+        });
+    });
+
+    // a small furnace assessment: the loss list of one furnace plus the flue gas losses and available heat
+    BenchmarkRegistrar furnaceHeatBalance("phast", "furnace-heat-balance", BenchmarkKind::MACRO, [] {
+        const GasCompositions baseComposition = makeGasComposition();
+        return BenchmarkBody([baseComposition] {
+            GasCompositions composition = baseComposition;
+            double losses = SolidLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC,
+                                                    0.247910198232625, 169.0, 0.260090757105326, 1214.996, 10000.0,
+                                                    2.0, 1.0, 70.0, 1500.0, 250.0, 10.0, 10.0, 100.0, 0).getTotalHeat();
+            losses += WallLosses(500.0, 80.0, 225.0, 10.0, 0.9, 1.394, 1.0).getHeatLoss();
+            losses += OpeningLosses(0.95, 12.0, 9.0, 1.33, 75.0, 1600.0, 100.0, 0.70).getHeatLoss();
+            losses += OpeningLosses(0.95, 48.0, 15.0, 9.0, 1.67, 75.0, 1600.0, 20.0, 0.64).getHeatLoss();
+            losses += Atmosphere(100.0, 1400.0, 1200.0, 1.0, 0.02).getTotalHeat();
+            losses += LeakageLosses(0.1, 3.0, 1600.0, 80.0, 0.8052, 1.02, 1.0).getExfiltratedGasesHeatContent();
+
+            const double excessAir = composition.calculateExcessAir(0.03) * 100;
+            const double availableHeat = 1 - GasFlueGasMaterial(700, excessAir, 125, composition, 125).getHeatLoss();
+            return losses / availableHeat;
+        });
+    });
+
+    // one day of minute samples of logged wall, opening and flue gas conditions with the furnace geometry held fixed
+    BenchmarkRegistrar furnaceLossSeries("phast", "furnace-loss-series/1440-samples", BenchmarkKind::MACRO, [] {
+        const std::size_t samples = 1440;
+        std::vector<double> temperature(samples), flueGasO2(samples), flueGasTemperature(samples);
+        for (std::size_t i = 0; i < samples; i++) {
+            temperature[i] = 225.0 + 25.0 * std::sin(i * 0.01);
+            flueGasO2[i] = 0.03 + 0.01 * std::sin(i * 0.02);
+            flueGasTemperature[i] = 700.0 + 50.0 * std::cos(i * 0.01);
+        }
+        const WallLosses wall(500.0, 80.0, 225.0, 10.0, 0.9, 1.394, 1.0);
+        const OpeningLosses opening(0.95, 12.0, 9.0, 1.33, 75.0, 1600.0, 100.0, 0.70);
+        const GasFlueGasMaterial flueGas(700, 9.0, 125, makeGasComposition(), 125);
+        std::vector<double> losses(samples);
+        return BenchmarkBody([=]() mutable {
+            wall.getHeatLossSeries(samples, temperature.data(), nullptr, losses.data());
+            double total = losses.back();
+            opening.getHeatLossSeries(samples, nullptr, nullptr, nullptr, losses.data());
+            total += losses.back();
+            flueGas.getHeatLossSeries(samples, flueGasTemperature.data(), flueGasO2.data(), nullptr, losses.data());
+            return total / losses.back();
+        });
+    });
+
+    // preheat in 10 °F steps, flue gas O2 in 0.25% steps and enrichment in 1% steps, 108,000 configurations
+    BenchmarkRegistrar furnaceEfficiencyOptimizer("phast", "furnace-efficiency-optimizer/108000-candidates",
+                                                  BenchmarkKind::MACRO, [] {
+        FurnaceEfficiencyOptimizer::Inputs inputs;
+        inputs.flueGasTemp = 1600;
+        inputs.o2FlueGas = 5;
+        inputs.combAirTemp = 80;
+        inputs.o2CombAir = 21;
+        inputs.fuelConsumption = 10;
+        inputs.operatingHours = 8000;
+        inputs.fuelCost = 5;
+        inputs.oxygenCost = 4;
+        inputs.stoichiometricOxygen = 1980;
+        inputs.fuelHeatingValue = 1020;
+        inputs.ambientTemp = 80;
+        inputs.recuperatorEffectiveness = 0.6;
+        inputs.combAirTemps = {80, 1270, 10};
+        inputs.o2FlueGases = {0.5, 5.25, 0.25};
+        inputs.o2CombAirs = {21, 65, 1};
+        return BenchmarkBody([inputs] {
+            return FurnaceEfficiencyOptimizer::optimize(inputs).paretoSet.front().totalCost;
+        });
+    });
+
+    // a plant of 16 reheat furnaces with 5 zones each
+    BenchmarkRegistrar multiZoneFurnace("phast", "multi-zone-furnace/16-furnaces", BenchmarkKind::MACRO, [] {
+        MultiZoneFurnace::Furnace furnace;
+        furnace.charge = SolidLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC,
+                                                 0.247910198232625, 169.0, 0.260090757105326, 1214.996, 10000.0, 2.0,
+                                                 1.0, 70.0, 70.0, 250.0, 10.0, 10.0, 100.0, 0);
+        for (int i = 0; i < 5; i++) {
+            MultiZoneFurnace::Zone zone;
+            zone.grossHeatInput = 1500000.0;
+            zone.losses.walls.push_back(WallLosses(500.0, 80.0, 225.0, 10.0, 0.9, 1.394, 1.0));
+            zone.losses.openings.push_back(OpeningLosses(0.95, 12.0, 9.0, 1.33, 75.0, 1600.0, 100.0, 0.70));
+            zone.losses.atmospheres.push_back(Atmosphere(100.0, 1400.0, 1200.0, 1.0, 0.02));
+            zone.losses.gasFlueGas = std::make_shared<GasFlueGasMaterial>(700.0 + 100 * i, 9.0, 125,
+                                                                          makeGasComposition(), 125);
+            furnace.zones.push_back(zone);
+        }
+        const std::vector<MultiZoneFurnace::Furnace> furnaces(16, furnace);
+        return BenchmarkBody([furnaces] {
+            return MultiZoneFurnace::simulate(furnaces).back().dischargeTemperature;
+        });
+    });
+
+    // a year of historical heats, each logged once a minute over a one hour tap to tap time
+    BenchmarkRegistrar eafHeatBalance("phast", "eaf-heat-balance/5000-heats", BenchmarkKind::MACRO, [] {
+        EAFHeatBalance::Heat heat;
+        heat.tapWeight = 100;
+        heat.coalHeatingValue = 9000;
+        heat.electrodeHeatingValue = 12000;
+        heat.slags.push_back(SlagOtherMaterialLosses(3000, 500, 2800, 0.25, 1.0));
+        for (int i = 0; i < 60; i++) {
+            const double power = 18000 + 2000 * std::sin(i / 9.0);
+            heat.samples.push_back(EAFHeatBalance::Sample{1 / 60.0, power, 50, 3300, 500, 20, 2600 + 4.0 * i,
+                                                          12, 10, 3, 8000, 0.001});
+        }
+        const std::vector<EAFHeatBalance::Heat> heats(5000, heat);
+        return BenchmarkBody([heats] {
+            return EAFHeatBalance::calculate(heats).back().energyPerTon;
+        });
+    });
+}
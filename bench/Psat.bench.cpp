@@ -0,0 +1,57 @@
+#include "Benchmark.h"
+#include <calculator/motor/MotorEfficiency.h>
+#include <calculator/motor/MotorShaftPower.h>
+#include <calculator/pump/HeadTool.h>
+#include <results/Results.h>
+
+namespace {
+    // inputs from tests/Results.unit.cpp ("PSATResultsPremium existing"), tests/MotorEfficiency.unit.cpp and
+    // tests/HeadTool.unit.cpp
+
+    BenchmarkRegistrar motorEfficiency("psat", "MotorEfficiency::calculate", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return MotorEfficiency(Motor::LineFrequency::FREQ60, 1785, Motor::EfficiencyClass::ENERGY_EFFICIENT, 100)
+                    .calculate(0.5);
+        });
+    });
+
+    BenchmarkRegistrar motorShaftPower("psat", "MotorShaftPower::calculate/power", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return MotorShaftPower(200, 80, 1780, Motor::LineFrequency::FREQ60, Motor::EfficiencyClass::PREMIUM, 95, 460,
+                                   225, 480, Motor::LoadEstimationMethod::POWER, 125.857).calculate().shaftPower;
+        });
+    });
+
+    BenchmarkRegistrar motorShaftPowerCurrent("psat", "MotorShaftPower::calculate/current", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return MotorShaftPower(200, 80, 1780, Motor::LineFrequency::FREQ60, Motor::EfficiencyClass::PREMIUM, 95, 460,
+                                   225, 480, Motor::LoadEstimationMethod::CURRENT, 125.857).calculate().shaftPower;
+        });
+    });
+
+    BenchmarkRegistrar headTool("psat", "HeadToolSuctionTank::calculate", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return HeadToolSuctionTank(1, 2000, 17.9, 115, 0, 1, 10, 124, 0, 1).calculate().pumpHead;
+        });
+    });
+
+    BenchmarkRegistrar psatExisting("psat", "PSATResult::calculateExisting", BenchmarkKind::MACRO, [] {
+        return BenchmarkBody([] {
+            Pump::Input pump(Pump::Style::END_SUCTION_ANSI_API, 0.80, 1780, Motor::Drive::DIRECT_DRIVE, 1.0, 1.0, 2,
+                             Pump::SpecificSpeed::NOT_FIXED_SPEED, 1.0);
+            Motor motor(Motor::LineFrequency::FREQ60, 200, 1780, Motor::EfficiencyClass::PREMIUM, 95, 460, 225, 0);
+            Pump::FieldData fieldData(1840, 174.85, Motor::LoadEstimationMethod::POWER, 80, 125.857, 480);
+            return PSATResult(pump, motor, fieldData, 8760, 0.05).calculateExisting().annualCost;
+        });
+    });
+
+    BenchmarkRegistrar psatModified("psat", "PSATResult::calculateModified", BenchmarkKind::MACRO, [] {
+        return BenchmarkBody([] {
+            Pump::Input pump(Pump::Style::END_SUCTION_ANSI_API, 0.80, 1780, Motor::Drive::DIRECT_DRIVE, 1.0, 1.0, 2,
+                             Pump::SpecificSpeed::NOT_FIXED_SPEED, 1.0);
+            Motor motor(Motor::LineFrequency::FREQ60, 200, 1780, Motor::EfficiencyClass::SPECIFIED, 95, 460, 225, 0);
+            Pump::FieldData fieldData(1840, 174.85, Motor::LoadEstimationMethod::POWER, 80, 125.857, 480);
+            return PSATResult(pump, motor, fieldData, 8760, 0.05).calculateModified().annualCost;
+        });
+    });
+}
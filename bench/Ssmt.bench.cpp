@@ -0,0 +1,100 @@
+#include "Benchmark.h"
+#include "../tests/at/cpp/SsmtAcceptanceData.h"
+#include <ssmt/Boiler.h>
+#include <ssmt/SaturatedProperties.h>
+#include <ssmt/SteamProperties.h>
+#include <ssmt/Turbine.h>
+#include <ssmt/api/SteamModeler.h>
+
+namespace {
+    // inputs from tests/SteamProperties.unit.cpp, tests/Boiler.unit.cpp, tests/Turbine.unit.cpp and
+    // tests/steamapi/SteamModeler.unit.cpp
+
+    SteamModelerInput makeUnitTestSteamModelerInput() {
+        const BoilerInput boilerInput(1, 1, 85, 2, true, true, 514.2, .1, 0.204747, 10);
+        const HeaderInput headerInput(HeaderWithHighestPressure(1.136, 22680, 50, 0.1, 338.7, true), nullptr, nullptr);
+        const OperationsInput operationsInput(18000000, 283.15, 8000, 0.000005478, 1.39E-05, 0.66);
+        const TurbineInput turbineInput(
+                CondensingTurbine(1, 1, 1, CondensingTurbineOperation::POWER_GENERATION, 1, true),
+                PressureTurbine(1, 1, PressureTurbineOperation::POWER_GENERATION, 1, 1, true),
+                PressureTurbine(1, 1, PressureTurbineOperation::POWER_GENERATION, 1, 1, true),
+                PressureTurbine(1, 1, PressureTurbineOperation::POWER_GENERATION, 1, 1, true));
+        return {true, 1, boilerInput, headerInput, operationsInput, turbineInput};
+    }
+
+    std::vector<SteamModelerInput> loadAcceptanceInputs() {
+        std::vector<SteamModelerInput> inputs;
+        SsmtAcceptanceTestData::forEachTestCase(BenchmarkSettings::acceptanceDataDirectory(),
+                                                [&inputs](SsmtAcceptanceTestCase &&testCase) {
+                                                    if (testCase.isEnabled()) {
+                                                        inputs.push_back(testCase.makeSteamModelerInput());
+                                                    }
+                                                });
+        if (inputs.empty()) throw std::runtime_error("no enabled SSMT acceptance test rows found");
+        return inputs;
+    }
+
+    BenchmarkRegistrar steamPropertiesPressureTemperature(
+            "ssmt", "SteamProperties::calculate/pressure-temperature", BenchmarkKind::MICRO, [] {
+                return BenchmarkBody([] {
+                    return SteamProperties(25.58, SteamProperties::ThermodynamicQuantity::TEMPERATURE, 650)
+                            .calculate().specificEnthalpy;
+                });
+            });
+
+    BenchmarkRegistrar steamPropertiesPressureEnthalpy(
+            "ssmt", "SteamProperties::calculate/pressure-enthalpy", BenchmarkKind::MICRO, [] {
+                return BenchmarkBody([] {
+                    return SteamProperties(3, SteamProperties::ThermodynamicQuantity::ENTHALPY, 500)
+                            .calculate().temperature;
+                });
+            });
+
+    BenchmarkRegistrar steamPropertiesPressureEntropy(
+            "ssmt", "SteamProperties::calculate/pressure-entropy", BenchmarkKind::MICRO, [] {
+                return BenchmarkBody([] {
+                    return SteamProperties(3, SteamProperties::ThermodynamicQuantity::ENTROPY, 1.5)
+                            .calculate().temperature;
+                });
+            });
+
+    BenchmarkRegistrar saturatedPropertiesFromPressure(
+            "ssmt", "SaturatedProperties::calculate", BenchmarkKind::MICRO, [] {
+                return BenchmarkBody([] {
+                    const double temperature = SaturatedTemperature(1.136).calculate();
+                    return SaturatedProperties(1.136, temperature).calculate().gasSpecificEnthalpy;
+                });
+            });
+
+    BenchmarkRegistrar boiler("ssmt", "Boiler", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return Boiler(10, 85, 2, 20, SteamProperties::ThermodynamicQuantity::ENTHALPY, 2000, 45).getBoilerEnergy();
+        });
+    });
+
+    BenchmarkRegistrar turbine("ssmt", "Turbine/outlet-properties", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return Turbine(Turbine::Solve::OutletProperties, 4.2112, SteamProperties::ThermodynamicQuantity::TEMPERATURE,
+                           888, Turbine::TurbineProperty::MassFlow, 40.1, 94.2, 15844, 3.4781).getPowerOut();
+        });
+    });
+
+    BenchmarkRegistrar steamModelerUnitTest("ssmt", "SteamModeler::model/unit-test", BenchmarkKind::MACRO, [] {
+        const SteamModelerInput input = makeUnitTestSteamModelerInput();
+        return BenchmarkBody([input] {
+            return SteamModeler().model(input).energyAndCostCalculationsDomain.totalOperatingCost;
+        });
+    });
+
+    // one operation models every enabled row of the acceptance test data
+    BenchmarkRegistrar steamModelerAcceptance("ssmt", "SteamModeler::model/acceptance-data", BenchmarkKind::MACRO, [] {
+        const std::vector<SteamModelerInput> inputs = loadAcceptanceInputs();
+        return BenchmarkBody([inputs] {
+            double total = 0;
+            for (auto const &input : inputs) {
+                total += SteamModeler().model(input).energyAndCostCalculationsDomain.totalOperatingCost;
+            }
+            return total;
+        });
+    });
+}
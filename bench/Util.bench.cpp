@@ -0,0 +1,60 @@
+#include "Benchmark.h"
+#include <calculator/util/CHP.h>
+#include <calculator/util/insulation/pipes/InsulatedPipeCalculator.h>
+#include <calculator/util/insulation/pipes/InsulatedPipeInput.h>
+#include <calculator/util/insulation/pipes/InsulatedPipeOutput.h>
+#include <calculator/util/insulation/tanks/InsulatedTankCalculator.h>
+#include <calculator/util/insulation/tanks/InsulatedTankInput.h>
+#include <calculator/util/insulation/tanks/InsulatedTankOutput.h>
+
+namespace {
+    // inputs from tests/CHP.unit.cpp, tests/InsulatedPipeReduction.unit.cpp and tests/InsulatedTankReduction.unit.cpp
+
+    InsulatedPipeInput makeInsulatedPipeInput(const double insulationThickness) {
+        return InsulatedPipeInput(8640, 15.24, .025399, 0.0033782, 422.039, 299.817, 0.89408, 0.9, insulationThickness,
+                                  0.8, 0.1, {0, 2.08333e-9, 3.67044e-19, -5.10833e-2, 7.90000e1},
+                                  {1.57526e-12, -2.02822e-09, 8.6328e-07, 0, 0.006729488});
+    }
+
+    BenchmarkRegistrar chp("util", "CHP", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            return CHP(4160, 23781908, 122581, 5.49, 0.214, CHP::Option::PercentAvgkWhElectricCostAvoided, 5.49, 5.49,
+                       90.0, 85.0, 95, 90).getCostInfo().at("simplePayback");
+        });
+    });
+
+    // one step of a sweep: every input changes, then the results are read
+    BenchmarkRegistrar chpSweep("util", "CHP::setInputs", BenchmarkKind::MICRO, [] {
+        CHP chp(4160, 23781908, 122581, 5.49, 0.214, CHP::Option::PercentAvgkWhElectricCostAvoided, 5.49, 5.49, 90.0,
+                85.0, 95, 90);
+        double hours = 4000;
+        return BenchmarkBody([chp, hours]() mutable {
+            hours = hours < 8760 ? hours + 1 : 4000;
+            chp.setInputs(hours, 23781908, 122581, 5.49, 0.214, CHP::Option::PercentAvgkWhElectricCostAvoided, 5.49,
+                          5.49, 90.0, 85.0, 95, 90);
+            return chp.getCostInfo().at("simplePayback");
+        });
+    });
+
+    BenchmarkRegistrar insulatedTank("util", "InsulatedTankCalculator::calculate", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            InsulatedTankInput input(8760, 10, 5, 0.5, 0.8, 46.2320, 959.67, 529.67, 0.9, 0.5, 0.0191, 0.9);
+            InsulatedTankCalculator calculator(input);
+            return calculator.calculate().getHeatLoss();
+        });
+    });
+
+    BenchmarkRegistrar insulatedPipeBare("util", "InsulatedPipeCalculator::calculate/bare", BenchmarkKind::MICRO, [] {
+        return BenchmarkBody([] {
+            InsulatedPipeCalculator calculator(makeInsulatedPipeInput(0));
+            return calculator.calculate().getHeatLength();
+        });
+    });
+
+    BenchmarkRegistrar insulatedPipe("util", "InsulatedPipeCalculator::calculate/insulated", BenchmarkKind::MACRO, [] {
+        return BenchmarkBody([] {
+            InsulatedPipeCalculator calculator(makeInsulatedPipeInput(0.0762));
+            return calculator.calculate().getHeatLength();
+        });
+    });
+}
@@ -0,0 +1,62 @@
+#include "Benchmark.h"
+#include <vector>
+#include <wasteWater/WasteWater_Treatment.h>
+#include <wasteWater/WasteWaterAerationOptimizer.h>
+
+namespace {
+    // inputs from tests/WasteWaterTreatment.unit.cpp
+
+    BenchmarkRegistrar wasteWaterTreatment("wasteWater", "WasteWater_Treatment::calculate", BenchmarkKind::MACRO, [] {
+        return BenchmarkBody([] {
+            WasteWater_Treatment wasteWaterTreatment(20, 200, 1, 1, 40, 35, 0.85, 200, 20, 8, 10000, 3000, 0.1, 0.6, 60,
+                                                     0.1, 8, 72, 2, 4.5, 0.84, 0.92, 2.7, 150, 200, 24, 1, 100, 0.09);
+            return wasteWaterTreatment.calculate().MLSS;
+        });
+    });
+
+    // a sweep of aeration scenarios at a fine SRT increment, evaluated without their SRT tables
+    BenchmarkRegistrar wasteWaterTreatmentBatch("wasteWater", "WasteWater_Treatment::calculate/500-scenarios",
+                                                BenchmarkKind::MACRO, [] {
+        std::vector<WasteWater_Treatment> scenarios;
+        for (int i = 0; i < 500; i++) {
+            scenarios.emplace_back(10 + i % 20, 200, 1, 1, 40, 35, 0.85, 200, 20, 8, 10000, 2000 + 5 * i, 0.1, 0.6, 60,
+                                   0.1, 8, 100, 0.1, 4.5, 0.84, 0.92, 2.7, 150, 200, 24, 1, 100, 0.09);
+        }
+        return BenchmarkBody([scenarios] {
+            double MLSS = 0;
+            for (auto const &output : WasteWater_Treatment::calculate(scenarios)) MLSS += output.MLSS;
+            return MLSS;
+        });
+    });
+
+    BenchmarkRegistrar wasteWaterTreatmentTables("wasteWater", "WasteWater_Treatment::calculate/500-scenarios-tables",
+                                                 BenchmarkKind::MACRO, [] {
+        std::vector<WasteWater_Treatment> scenarios;
+        for (int i = 0; i < 500; i++) {
+            scenarios.emplace_back(10 + i % 20, 200, 1, 1, 40, 35, 0.85, 200, 20, 8, 10000, 2000 + 5 * i, 0.1, 0.6, 60,
+                                   0.1, 8, 100, 0.1, 4.5, 0.84, 0.92, 2.7, 150, 200, 24, 1, 100, 0.09);
+        }
+        return BenchmarkBody([scenarios] {
+            double MLSS = 0;
+            for (auto const &scenario : scenarios) MLSS += scenario.calculate().MLSS;
+            return MLSS;
+        });
+    });
+
+    // speed in 5% steps, operating time in 2 hr steps, DO in 0.5 mg/L steps and MLSS in 250 mg/L steps
+    BenchmarkRegistrar aerationOptimizer("wasteWater", "WasteWaterAerationOptimizer::optimize/5544-candidates",
+                                         BenchmarkKind::MACRO, [] {
+        WasteWaterAerationOptimizer::Inputs inputs;
+        inputs.speeds = {50, 100, 5};
+        inputs.operatingTimes = {12, 24, 2};
+        inputs.operatingDOs = {1, 4.5, 0.5};
+        inputs.MLSSpars = {2000, 4000, 250};
+        inputs.maxEffluentCBOD5 = 5;
+        inputs.maxEffluentAmmonia_N = 1;
+        return BenchmarkBody([inputs] {
+            WasteWater_Treatment plant(20, 200, 1, 1, 40, 35, 0.85, 200, 20, 8, 10000, 3000, 0.1, 0.6, 60, 0.1, 8, 72, 2,
+                                       4.5, 0.84, 0.92, 2.7, 150, 200, 24, 1, 100, 0.09);
+            return WasteWaterAerationOptimizer::optimize(plant, inputs).paretoSet.front().AeCost;
+        });
+    });
+}
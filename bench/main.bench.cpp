@@ -0,0 +1,285 @@
+#include "Benchmark.h"
+#include "calculator/util/SilencedCout.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+
+#ifndef AMO_SUITE_VERSION
+#define AMO_SUITE_VERSION "unknown"
+#endif
+
+#ifndef AMO_SUITE_SOURCE_DIR
+#define AMO_SUITE_SOURCE_DIR "."
+#endif
+
+std::atomic<std::size_t> AllocationCounter::allocations(0);
+std::atomic<std::size_t> AllocationCounter::bytes(0);
+
+// Replacing the global allocation functions counts every heap allocation made by the library while a benchmark runs.
+void *operator new(std::size_t size) {
+    AllocationCounter::allocations.fetch_add(1, std::memory_order_relaxed);
+    AllocationCounter::bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+    struct Options {
+        std::string filter;
+        std::string kind;
+        std::string output;
+        double minTime = 0.5;
+        std::size_t repetitions = 5;
+        bool list = false;
+    };
+
+    struct Measurement {
+        std::size_t iterations;
+        double nsPerOp;
+        double nsPerOpMin;
+        double nsPerOpMax;
+        double allocationsPerOp;
+        double bytesPerOp;
+        double result;
+    };
+
+    volatile double sink = 0;
+
+    const char *kindName(const BenchmarkKind kind) {
+        return kind == BenchmarkKind::MICRO ? "micro" : "macro";
+    }
+
+    std::string escapeJson(const std::string &value) {
+        std::string escaped;
+        for (auto const c : value) {
+            switch (c) {
+                case '"': escaped += "\\\""; break;
+                case '\\': escaped += "\\\\"; break;
+                case '\n': escaped += "\\n"; break;
+                case '\t': escaped += "\\t"; break;
+                default: escaped += c;
+            }
+        }
+        return escaped;
+    }
+
+    std::string formatJsonNumber(const double value) {
+        if (!std::isfinite(value)) return "null";
+        std::ostringstream stream;
+        stream.precision(10);
+        stream << value;
+        return stream.str();
+    }
+
+    double runBatch(BenchmarkBody const &body, const std::size_t iterations, double &result) {
+        auto const start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; i++) {
+            result = body();
+            sink = result;
+        }
+        auto const end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count();
+    }
+
+    Measurement measure(Benchmark const &benchmark, Options const &options) {
+        const BenchmarkBody body = benchmark.setup();
+
+        // warm up function local statics and lazily built tables before anything is timed
+        double result = body();
+
+        // grow the batch until its duration is well above the clock resolution, then size the samples from it
+        std::size_t iterations = 1;
+        double elapsed = runBatch(body, iterations, result);
+        while (elapsed < 1.0e7 && iterations < (std::size_t(1) << 30)) {
+            iterations *= 2;
+            elapsed = runBatch(body, iterations, result);
+        }
+        const double nsPerOpEstimate = elapsed / iterations;
+        const double sampleTime = options.minTime * 1.0e9 / options.repetitions;
+        iterations = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(sampleTime / nsPerOpEstimate)));
+
+        std::vector<double> samples;
+        samples.reserve(options.repetitions);
+        std::size_t allocations = 0, bytes = 0;
+        for (std::size_t repetition = 0; repetition < options.repetitions; repetition++) {
+            const std::size_t allocationsBefore = AllocationCounter::allocations.load();
+            const std::size_t bytesBefore = AllocationCounter::bytes.load();
+            const double elapsedSample = runBatch(body, iterations, result);
+            allocations += AllocationCounter::allocations.load() - allocationsBefore;
+            bytes += AllocationCounter::bytes.load() - bytesBefore;
+            samples.push_back(elapsedSample / iterations);
+        }
+
+        std::sort(samples.begin(), samples.end());
+        const double totalOps = static_cast<double>(iterations) * options.repetitions;
+        return {iterations, samples[samples.size() / 2], samples.front(), samples.back(),
+                allocations / totalOps, bytes / totalOps, result};
+    }
+
+    void printUsage() {
+        std::cout << "Usage: amo_tools_suite_bench [options]\n"
+                  << "  --filter <text>       run only benchmarks whose family/name contains <text>\n"
+                  << "  --kind <micro|macro>  run only micro or macro benchmarks\n"
+                  << "  --min-time <seconds>  measured time per benchmark, split across repetitions (default 0.5)\n"
+                  << "  --repetitions <n>     number of timed samples per benchmark (default 5)\n"
+                  << "  --data-dir <dir>      SSMT acceptance test data directory (default <source>/tests/at/csv)\n"
+                  << "  --output <file>       write the JSON report to <file> instead of stdout\n"
+                  << "  --list                list the registered benchmarks and exit\n";
+    }
+
+    Options parseOptions(int argc, char *argv[]) {
+        Options options;
+        BenchmarkSettings::acceptanceDataDirectory() = std::string(AMO_SUITE_SOURCE_DIR) + "/tests/at/csv";
+
+        for (int i = 1; i < argc; i++) {
+            const std::string arg = argv[i];
+            auto const value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::runtime_error("missing value for " + arg);
+                return argv[++i];
+            };
+
+            if (arg == "--filter") {
+                options.filter = value();
+            } else if (arg == "--kind") {
+                options.kind = value();
+                if (options.kind != "micro" && options.kind != "macro") {
+                    throw std::runtime_error("--kind must be micro or macro");
+                }
+            } else if (arg == "--min-time") {
+                options.minTime = std::stod(value());
+                if (!(options.minTime > 0)) throw std::runtime_error("--min-time must be positive");
+            } else if (arg == "--repetitions") {
+                options.repetitions = std::stoul(value());
+                if (options.repetitions == 0) throw std::runtime_error("--repetitions must be at least 1");
+            } else if (arg == "--data-dir") {
+                BenchmarkSettings::acceptanceDataDirectory() = value();
+            } else if (arg == "--output") {
+                options.output = value();
+            } else if (arg == "--list") {
+                options.list = true;
+            } else if (arg == "--help" || arg == "-h") {
+                printUsage();
+                std::exit(0);
+            } else {
+                throw std::runtime_error("unknown option " + arg);
+            }
+        }
+        return options;
+    }
+
+    bool isSelected(Benchmark const &benchmark, Options const &options) {
+        if (!options.kind.empty() && options.kind != kindName(benchmark.kind)) return false;
+        return (benchmark.family + "/" + benchmark.name).find(options.filter) != std::string::npos;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    Options options;
+    try {
+        options = parseOptions(argc, argv);
+    } catch (std::exception const &e) {
+        std::cerr << "amo_tools_suite_bench: " << e.what() << std::endl;
+        printUsage();
+        return 2;
+    }
+
+    std::vector<Benchmark> selected;
+    for (auto const &benchmark : BenchmarkRegistry::instance().getBenchmarks()) {
+        if (isSelected(benchmark, options)) selected.push_back(benchmark);
+    }
+    std::stable_sort(selected.begin(), selected.end(), [](Benchmark const &a, Benchmark const &b) {
+        return a.family < b.family;
+    });
+
+    if (options.list) {
+        for (auto const &benchmark : selected) {
+            std::cout << benchmark.family << "/" << benchmark.name << " (" << kindName(benchmark.kind) << ")\n";
+        }
+        return 0;
+    }
+
+    std::ostringstream json;
+    json << "{\n"
+         << "  \"suite\": \"amo_tools_suite\",\n"
+         << "  \"version\": \"" << AMO_SUITE_VERSION << "\",\n"
+         << "  \"minTimeSeconds\": " << formatJsonNumber(options.minTime) << ",\n"
+         << "  \"repetitions\": " << options.repetitions << ",\n"
+         << "  \"benchmarks\": [";
+
+    // some calculators log to std::cout, which would otherwise end up in the middle of the JSON report
+    int status = 0;
+    {
+        const SilencedCout silencedCout;
+        bool first = true;
+        for (auto const &benchmark : selected) {
+            std::cerr << benchmark.family << "/" << benchmark.name << " ..." << std::flush;
+            Measurement m{};
+            std::string error;
+            try {
+                m = measure(benchmark, options);
+                std::cerr << " " << formatJsonNumber(m.nsPerOp) << " ns/op, "
+                          << formatJsonNumber(m.allocationsPerOp) << " allocations/op" << std::endl;
+            } catch (std::exception const &e) {
+                error = e.what();
+                status = 1;
+                std::cerr << " failed: " << error << std::endl;
+            }
+
+            json << (first ? "\n" : ",\n") << "    {"
+                 << "\"family\": \"" << escapeJson(benchmark.family) << "\", "
+                 << "\"name\": \"" << escapeJson(benchmark.name) << "\", "
+                 << "\"kind\": \"" << kindName(benchmark.kind) << "\", ";
+            if (error.empty()) {
+                json << "\"iterations\": " << m.iterations << ", "
+                     << "\"ns_per_op\": " << formatJsonNumber(m.nsPerOp) << ", "
+                     << "\"ns_per_op_min\": " << formatJsonNumber(m.nsPerOpMin) << ", "
+                     << "\"ns_per_op_max\": " << formatJsonNumber(m.nsPerOpMax) << ", "
+                     << "\"allocations_per_op\": " << formatJsonNumber(m.allocationsPerOp) << ", "
+                     << "\"bytes_per_op\": " << formatJsonNumber(m.bytesPerOp) << ", "
+                     << "\"result\": " << formatJsonNumber(m.result) << "}";
+            } else {
+                json << "\"error\": \"" << escapeJson(error) << "\"}";
+            }
+            first = false;
+        }
+    }
+    json << "\n  ]\n}\n";
+
+    if (options.output.empty()) {
+        std::cout << json.str();
+    } else {
+        std::ofstream file(options.output);
+        if (!file) {
+            std::cerr << "amo_tools_suite_bench: cannot write " << options.output << std::endl;
+            return 2;
+        }
+        file << json.str();
+    }
+    return status;
+}
@@ -1,5 +1,16 @@
 
 {
+    "variables": {
+        # node-gyp rebuild --solver_instrumentation=1 compiles in the solver iteration statistics
+        "solver_instrumentation%": 0
+    },
+    "target_defaults": {
+        "conditions": [
+            [ 'solver_instrumentation==1', {
+                "defines": [ "AMO_TOOLS_SUITE_INSTRUMENTATION" ]
+            }]
+        ]
+    },
     "targets": [
         {
             "target_name": "standalone",
@@ -250,11 +261,14 @@
             'include_dirs': [
                 'include',
                 'include/chillers/CoolingTower.h',
+                'include/chillers/ChillerPlant.h',
                 "<!(node -e \"require('nan')\")"
             ],
             'sources': [
                 'bindings/chillers.cpp',
-                'src/chillers/CoolingTower.cpp'
+                'src/chillers/CoolingTower.cpp',
+                'src/chillers/ChillerPlant.cpp',
+                'src/calculator/util/CurveFitVal.cpp'
             ],
             "conditions": [
                 [ 'OS=="mac"', {
@@ -281,7 +295,8 @@
             ],
             'sources': [
                 'bindings/wasteWater.cpp',
-                'src/wasteWater/WasteWater_Treatment.cpp'
+                'src/wasteWater/WasteWater_Treatment.cpp',
+                'src/wasteWater/WasteWaterAerationOptimizer.cpp'
             ],
             "conditions": [
                 [ 'OS=="mac"', {
@@ -309,7 +324,11 @@
           'sources': [
               'bindings/compressedAir.cpp',
               'src/calculator/util/CurveFitVal.cpp',
-              'src/calculator/util/CompressedAirCentrifugal.cpp'
+              'src/calculator/util/CompressedAirCentrifugal.cpp',
+              'src/calculator/util/CompressedAirCentrifugalMap.cpp',
+              'src/calculator/util/CompressedAirSystemSimulation.cpp',
+              'src/calculator/util/CompressedAirSequencingOptimizer.cpp',
+              'src/calculator/util/CompressedAirNetwork.cpp'
           ],
           "conditions": [
               [ 'OS=="mac"', {
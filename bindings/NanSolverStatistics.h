@@ -0,0 +1,58 @@
+#ifndef AMO_TOOLS_SUITE_NANSOLVERSTATISTICS_H
+#define AMO_TOOLS_SUITE_NANSOLVERSTATISTICS_H
+
+#include <nan.h>
+#include <node.h>
+#include "calculator/util/SolverStatistics.h"
+
+/**
+ * Statistics of the iterative solvers compiled into this module. Every addon links its own copy of the solvers, so
+ * the counts only cover calls made through the module that is queried.
+ * Returns {enabled, solvers: {<name>: {calls, iterations, maxIterations, failures, meanIterations, totalTimeNs,
+ * histogram: [{maxIterations, calls}]}}}; enabled is false and all counts stay zero unless the addon was built
+ * with --solver_instrumentation=1.
+ */
+NAN_METHOD(solverStatistics) {
+    auto const setNumber = [](v8::Local<v8::Object> object, const char *name, const double value) {
+        Nan::Set(object, Nan::New<v8::String>(name).ToLocalChecked(), Nan::New<v8::Number>(value));
+    };
+
+    v8::Local<v8::Object> result = Nan::New<v8::Object>();
+    Nan::Set(result, Nan::New<v8::String>("enabled").ToLocalChecked(), Nan::New<v8::Boolean>(SolverStatistics::isEnabled()));
+
+    v8::Local<v8::Object> solvers = Nan::New<v8::Object>();
+    for (auto const &summary : SolverStatistics::getSummaries()) {
+        v8::Local<v8::Object> solver = Nan::New<v8::Object>();
+        setNumber(solver, "calls", summary.calls);
+        setNumber(solver, "iterations", summary.iterations);
+        setNumber(solver, "maxIterations", summary.maxIterations);
+        setNumber(solver, "failures", summary.failures);
+        setNumber(solver, "meanIterations", summary.getMeanIterations());
+        setNumber(solver, "totalTimeNs", summary.nanoseconds);
+
+        // only the buckets up to the largest iteration count seen, the rest are empty
+        v8::Local<v8::Array> histogram = Nan::New<v8::Array>();
+        const std::size_t buckets = summary.calls == 0 ? 0 : SolverStatistics::getBucket(summary.maxIterations) + 1;
+        for (std::size_t i = 0; i < buckets; i++) {
+            v8::Local<v8::Object> bucket = Nan::New<v8::Object>();
+            if (i + 1 == SolverStatistics::HISTOGRAM_BUCKETS) {
+                Nan::Set(bucket, Nan::New<v8::String>("maxIterations").ToLocalChecked(), Nan::Null());
+            } else {
+                setNumber(bucket, "maxIterations", SolverStatistics::getBucketUpperBound(i));
+            }
+            setNumber(bucket, "calls", summary.histogram[i]);
+            Nan::Set(histogram, static_cast<uint32_t>(i), bucket);
+        }
+        Nan::Set(solver, Nan::New<v8::String>("histogram").ToLocalChecked(), histogram);
+
+        Nan::Set(solvers, Nan::New<v8::String>(summary.name).ToLocalChecked(), solver);
+    }
+    Nan::Set(result, Nan::New<v8::String>("solvers").ToLocalChecked(), solvers);
+    info.GetReturnValue().Set(result);
+}
+
+NAN_METHOD(resetSolverStatistics) {
+    SolverStatistics::reset();
+}
+
+#endif //AMO_TOOLS_SUITE_NANSOLVERSTATISTICS_H
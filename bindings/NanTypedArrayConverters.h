@@ -0,0 +1,117 @@
+#ifndef AMO_TOOLS_SUITE_NANTYPEDARRAYCONVERTERS_H
+#define AMO_TOOLS_SUITE_NANTYPEDARRAYCONVERTERS_H
+
+#include <nan.h>
+#include <node.h>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Column of a columnar (batch) binding call. The column points directly into the backing store of a
+ * caller-provided Float64Array, so reading inputs and writing results never creates per-element V8 objects.
+ * The pointer is only valid for the duration of the NAN_METHOD that obtained it.
+ */
+struct Float64Column {
+    Float64Column() : data(nullptr), length(0) {}
+    Float64Column(double *data, std::size_t length) : data(data), length(length) {}
+
+    /**
+     * @return bool, true when the column was supplied by the caller
+     */
+    bool isPresent() const { return data != nullptr; }
+
+    double operator[](std::size_t i) const { return data[i]; }
+
+    /**
+     * Writes a value to the column if the caller supplied it; optional output columns are skipped.
+     * @param i std::size_t, row index
+     * @param value double, value to store
+     */
+    void set(std::size_t i, double value) {
+        if (data != nullptr) data[i] = value;
+    }
+
+    double *data;
+    std::size_t length;
+};
+
+/**
+ * Get the Float64Array for the specified name from the specified object without copying it.
+ * @param name Name (variable name) of the Float64Array on the specified object.
+ * @param sourceObject The specified object to get the array from.
+ * @param required When false, a missing field returns an empty column instead of throwing.
+ * @return Float64Column viewing the array's storage.
+ */
+inline Float64Column getFloat64Column(std::string const &name, v8::Local<v8::Object> sourceObject, bool required = true) {
+    v8::Local<v8::Value> value = Nan::Get(sourceObject, Nan::New<v8::String>(name).ToLocalChecked()).ToLocalChecked();
+    if (value->IsUndefined()) {
+        if (!required) return Float64Column();
+        throw std::runtime_error("NanTypedArrayConverters: field '" + name + "' not present in batch object");
+    }
+    if (!value->IsFloat64Array()) {
+        throw std::runtime_error("NanTypedArrayConverters: field '" + name + "' must be a Float64Array");
+    }
+    Nan::TypedArrayContents<double> contents(value);
+    return {*contents, contents.length()};
+}
+
+/**
+ * Get an output Float64Array; output columns are optional so callers only allocate the results they need.
+ * @param name Name (variable name) of the Float64Array on the specified object.
+ * @param sourceObject The specified object to get the array from.
+ * @return Float64Column viewing the array's storage, or an empty column when not supplied.
+ */
+inline Float64Column getOutputColumn(std::string const &name, v8::Local<v8::Object> sourceObject) {
+    return getFloat64Column(name, sourceObject, false);
+}
+
+/**
+ * Validates the shape of a batch call. All input columns must have the same length, and every supplied output
+ * column must be at least that long.
+ * @param inputs std::vector<Float64Column>, input columns
+ * @param outputs std::vector<Float64Column>, output columns (missing ones are ignored)
+ * @return std::size_t, number of rows to evaluate
+ */
+inline std::size_t getBatchRowCount(std::vector<Float64Column> const &inputs, std::vector<Float64Column> const &outputs) {
+    if (inputs.empty()) return 0;
+    std::size_t const rows = inputs.front().length;
+    for (auto const &column : inputs) {
+        if (column.length != rows) {
+            throw std::runtime_error("NanTypedArrayConverters: all input Float64Arrays must have the same length");
+        }
+    }
+    for (auto const &column : outputs) {
+        if (column.isPresent() && column.length < rows) {
+            throw std::runtime_error("NanTypedArrayConverters: output Float64Array is shorter than the input arrays");
+        }
+    }
+    return rows;
+}
+
+/**
+ * Validates the shape of a time series call. Every time-varying input is optional, the supplied ones must have the
+ * same length and the output column must be at least that long; without any input series the output length is used.
+ * @param inputs std::vector<Float64Column>, input columns (missing ones are ignored)
+ * @param output Float64Column, output column
+ * @return std::size_t, number of samples to evaluate
+ */
+inline std::size_t getSeriesSampleCount(std::vector<Float64Column> const &inputs, Float64Column const &output) {
+    std::size_t samples = output.length;
+    bool first = true;
+    for (auto const &column : inputs) {
+        if (!column.isPresent()) continue;
+        if (!first && column.length != samples) {
+            throw std::runtime_error("NanTypedArrayConverters: all input Float64Arrays must have the same length");
+        }
+        samples = column.length;
+        first = false;
+    }
+    if (output.length < samples) {
+        throw std::runtime_error("NanTypedArrayConverters: output Float64Array is shorter than the input arrays");
+    }
+    return samples;
+}
+
+#endif //AMO_TOOLS_SUITE_NANTYPEDARRAYCONVERTERS_H
@@ -17,6 +17,9 @@ NAN_MODULE_INIT(InitCalculator)
     Nan::Set(target, New<String>("compressedAirLeakSurvey").ToLocalChecked(),
              GetFunction(New<FunctionTemplate>(compressedAirLeakSurvey)).ToLocalChecked());
 
+    Nan::Set(target, New<String>("compressedAirLeakSurveyCsv").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(compressedAirLeakSurveyCsv)).ToLocalChecked());
+
     Nan::Set(target, New<String>("compressedAirPressureReduction").ToLocalChecked(),
              GetFunction(New<FunctionTemplate>(compressedAirPressureReduction)).ToLocalChecked());
 
@@ -31,6 +34,12 @@ NAN_MODULE_INIT(InitCalculator)
 
     Nan::Set(target, New<String>("steamReduction").ToLocalChecked(),
              GetFunction(New<FunctionTemplate>(steamReduction)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("solverStatistics").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(solverStatistics)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("resetSolverStatistics").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(resetSolverStatistics)).ToLocalChecked());
 }
 
 NODE_MODULE(calculator, InitCalculator)
\ No newline at end of file
@@ -13,6 +13,8 @@
 #include "calculator/util/NaturalGasReduction.h"
 #include "calculator/util/CompressedAirReduction.h"
 #include "calculator/util/CompressedAirLeakSurvey.h"
+#include "calculator/util/CompressedAirLeakSurveyAccumulator.h"
+#include <fast-cpp-csv-parser/csv.h>
 #include "calculator/util/CompressedAirPressureReduction.h"
 #include "calculator/util/WaterReduction.h"
 #include "calculator/util/insulation/pipes/InsulatedPipeInput.h"
@@ -26,6 +28,7 @@
 #include "ssmt/SteamSystemModelerTool.h"
 #include "calculator/util/SteamReduction.h"
 #include "calculator/util/Conversion.h"
+#include "NanSolverStatistics.h"
 
 using namespace Nan;
 using namespace v8;
@@ -744,6 +747,65 @@ NAN_METHOD(compressedAirLeakSurvey)
     info.GetReturnValue().Set(r);
 }
 
+Local<Object> getLeakSurveyTotals(CompressedAirLeakSurveyAccumulator::Totals const &totals)
+{
+    Local<Object> obj = Nan::New<Object>();
+    Nan::Set(obj, Nan::New<String>("leaks").ToLocalChecked(), Nan::New<Number>(static_cast<double>(totals.leaks)));
+    Nan::Set(obj, Nan::New<String>("annualTotalElectricity").ToLocalChecked(), Nan::New<Number>(totals.annualTotalElectricity));
+    Nan::Set(obj, Nan::New<String>("annualTotalElectricityCost").ToLocalChecked(), Nan::New<Number>(totals.annualTotalElectricityCost));
+    Nan::Set(obj, Nan::New<String>("totalFlowRate").ToLocalChecked(), Nan::New<Number>(totals.totalFlowRate));
+    Nan::Set(obj, Nan::New<String>("annualTotalFlowRate").ToLocalChecked(), Nan::New<Number>(totals.annualTotalFlowRate));
+    return obj;
+}
+
+NAN_METHOD(compressedAirLeakSurveyCsv)
+{
+    /**
+     * Totals a leak survey CSV file by area and by measurement method without loading every leak
+     * @param inputs object, fileName of a CSV file with the columns described in CompressedAirLeakSurveyAccumulator
+     * @return object, survey totals with the leak count, areas (totals with the area name) and methods (totals of the
+     *         estimate, decibels, bag, orifice and other methods)
+     */
+    inp = Nan::To<Object>(info[0]).ToLocalChecked();
+    r = Nan::New<Object>();
+    try
+    {
+        io::LineReader lines(GetStr("fileName", inp));
+        CompressedAirLeakSurveyAccumulator accumulator;
+        accumulator.addCsv(lines);
+
+        auto const totals = accumulator.getTotals();
+        SetR("leaks", static_cast<double>(totals.leaks));
+        SetR("annualTotalElectricity", totals.annualTotalElectricity);
+        SetR("annualTotalElectricityCost", totals.annualTotalElectricityCost);
+        SetR("totalFlowRate", totals.totalFlowRate);
+        SetR("annualTotalFlowRate", totals.annualTotalFlowRate);
+
+        Local<Array> areas = Nan::New<Array>();
+        for (std::size_t i = 0; i < accumulator.getAreas().size(); i++)
+        {
+            auto const &area = accumulator.getAreas()[i];
+            Local<Object> obj = getLeakSurveyTotals(accumulator.getAreaTotals(area));
+            Nan::Set(obj, Nan::New<String>("area").ToLocalChecked(), Nan::New<String>(area).ToLocalChecked());
+            Nan::Set(areas, static_cast<uint32_t>(i), obj);
+        }
+        Nan::Set(r, Nan::New<String>("areas").ToLocalChecked(), areas);
+
+        Local<Array> methods = Nan::New<Array>();
+        for (std::size_t i = 0; i < CompressedAirLeakSurveyAccumulator::METHOD_COUNT; i++)
+        {
+            Nan::Set(methods, static_cast<uint32_t>(i), getLeakSurveyTotals(accumulator.getMethodTotals(static_cast<int>(i))));
+        }
+        Nan::Set(r, Nan::New<String>("methods").ToLocalChecked(), methods);
+    }
+    catch (std::exception const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::exception thrown in compressedAirLeakSurveyCsv - calculator.h: " + what).c_str());
+    }
+    info.GetReturnValue().Set(r);
+}
+
 // ========== END Air Leak Survey =============
 
 // ========== Start Water Reduction ===========
@@ -6,6 +6,10 @@ using namespace Nan;
 NAN_MODULE_INIT(InitChillers) {
     Nan::Set(target, New<String>("coolingTowerMakeupWater").ToLocalChecked(),
              GetFunction(New<FunctionTemplate>(coolingTowerMakeupWater)).ToLocalChecked());
+    Nan::Set(target, New<String>("coolingTowerHourlySimulation").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(coolingTowerHourlySimulation)).ToLocalChecked());
+    Nan::Set(target, New<String>("chillerPlantSimulation").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(chillerPlantSimulation)).ToLocalChecked());
 }
 
 NODE_MODULE(chillers, InitChillers)
@@ -12,6 +12,7 @@
 
 //#include "calculator.h"
 #include "chillers/CoolingTower.h"
+#include "chillers/ChillerPlant.h"
 
 using namespace Nan;
 using namespace v8;
@@ -185,4 +186,158 @@ NAN_METHOD(coolingTowerMakeupWater)
     info.GetReturnValue().Set(r);
 }
 
+Local<Array> GetArray(std::vector<double> const &values)
+{
+    Local<Array> array = Nan::New<Array>(values.size());
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        Nan::Set(array, i, Nan::New<Number>(values[i]));
+    }
+    return array;
+}
+
+Local<Object> GetCoolingTowerHourlyOutput(CoolingTowerHourlySimulation::Output const &output)
+{
+    Local<Object> obj = Nan::New<Object>();
+    Nan::Set(obj, Nan::New<String>("evaporation").ToLocalChecked(), GetArray(output.evaporation));
+    Nan::Set(obj, Nan::New<String>("drift").ToLocalChecked(), GetArray(output.drift));
+    Nan::Set(obj, Nan::New<String>("blowDown").ToLocalChecked(), GetArray(output.blowDown));
+    Nan::Set(obj, Nan::New<String>("makeupWater").ToLocalChecked(), GetArray(output.makeupWater));
+    Nan::Set(obj, Nan::New<String>("totalEvaporation").ToLocalChecked(), Nan::New<Number>(output.totals.evaporation));
+    Nan::Set(obj, Nan::New<String>("totalDrift").ToLocalChecked(), Nan::New<Number>(output.totals.drift));
+    Nan::Set(obj, Nan::New<String>("totalBlowDown").ToLocalChecked(), Nan::New<Number>(output.totals.blowDown));
+    Nan::Set(obj, Nan::New<String>("totalMakeupWater").ToLocalChecked(), Nan::New<Number>(output.totals.makeupWater));
+    return obj;
+}
+
+NAN_METHOD(coolingTowerHourlySimulation)
+{
+    inp = Nan::To<Object>(info[0]).ToLocalChecked();
+    r = Nan::New<Object>();
+    try
+    {
+        double flowRate = GetDouble("flowRate", inp);
+        std::vector<double> coolingLoad = GetVector("coolingLoad", inp);
+        CoolingTowerWaterConservationData waterConservationBaselineData = getCoolingTowerWaterConservationData(inp, false);
+        CoolingTowerWaterConservationData waterConservationModificationData = getCoolingTowerWaterConservationData(inp, true);
+
+        // the loss correction factor follows the dry bulb temperature when an evaporation curve is given
+        auto const simulation = [&]() {
+            if (isDefined(inp, "dryBulbTemperature"))
+            {
+                v8::Isolate *isolate = v8::Isolate::GetCurrent();
+                v8::Local<v8::Context> context = isolate->GetCurrentContext();
+                Local<Object> evaporationCurveV8 = Nan::To<Object>(inp->Get(context, Nan::New<String>("evaporationCurve").ToLocalChecked()).ToLocalChecked()).ToLocalChecked();
+                CoolingTowerHourlySimulation::EvaporationCurve evaporationCurve = {
+                    GetVector("dryBulbTemperature", evaporationCurveV8),
+                    GetVector("lossCorrectionFactor", evaporationCurveV8)};
+                return CoolingTowerHourlySimulation(flowRate, coolingLoad, GetVector("dryBulbTemperature", inp), evaporationCurve);
+            }
+            return CoolingTowerHourlySimulation(flowRate, coolingLoad, GetDouble("lossCorrectionFactor", inp));
+        }();
+
+        CoolingTowerHourlySimulation::Comparison results = simulation.calculate(waterConservationBaselineData, waterConservationModificationData);
+        Nan::Set(r, Nan::New<String>("baseline").ToLocalChecked(), GetCoolingTowerHourlyOutput(results.baseline));
+        Nan::Set(r, Nan::New<String>("modification").ToLocalChecked(), GetCoolingTowerHourlyOutput(results.modification));
+        SetR("waterSavings", results.waterSavings);
+        SetR("operationalHours", simulation.getOperationalHours());
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in coolingTowerHourlySimulation - chillers.h: " + what).c_str());
+    }
+    info.GetReturnValue().Set(r);
+}
+
+ChillerPlant::Chiller getChiller(Local<Object> obj)
+{
+    CurveFitVal partLoadCurve(GetVector("partLoadRatio", obj), GetVector("partLoadPower", obj),
+                              static_cast<std::size_t>(GetDouble("partLoadCurveDegree", obj)));
+    CurveFitVal condenserWaterCurve(GetVector("condenserWaterTemperature", obj), GetVector("condenserWaterPower", obj),
+                                    static_cast<std::size_t>(GetDouble("condenserWaterCurveDegree", obj)));
+    return {
+        GetDouble("capacity", obj),
+        GetDouble("fullLoadEfficiency", obj),
+        partLoadCurve,
+        condenserWaterCurve,
+        GetDouble("condenserWaterFlow", obj),
+        GetDouble("chilledWaterPumpPower", obj),
+        GetDouble("condenserWaterPumpPower", obj)};
+}
+
+ChillerPlant::CoolingTower getChillerPlantCoolingTower(Local<Object> obj)
+{
+    return {
+        GetDouble("approach", obj),
+        GetDouble("condenserWaterSetpoint", obj),
+        GetBool("condenserWaterReset", obj),
+        GetDouble("minimumCondenserWaterTemperature", obj),
+        GetDouble("fanPower", obj),
+        CoolingTowerWaterConservationData(static_cast<int>(GetDouble("cyclesOfConcentration", obj)), GetDouble("driftLossFactor", obj)),
+        GetDouble("lossCorrectionFactor", obj)};
+}
+
+NAN_METHOD(chillerPlantSimulation)
+{
+    inp = Nan::To<Object>(info[0]).ToLocalChecked();
+    r = Nan::New<Object>();
+    try
+    {
+        v8::Isolate *isolate = v8::Isolate::GetCurrent();
+        v8::Local<v8::Context> context = isolate->GetCurrentContext();
+        Local<Array> chillersV8 = Local<Array>::Cast(inp->Get(context, Nan::New<String>("chillers").ToLocalChecked()).ToLocalChecked());
+        std::vector<ChillerPlant::Chiller> chillers;
+        for (unsigned int i = 0; i < chillersV8->Length(); i++)
+        {
+            chillers.push_back(getChiller(Nan::To<Object>(chillersV8->Get(context, i).ToLocalChecked()).ToLocalChecked()));
+        }
+        Local<Object> coolingTowerV8 = Nan::To<Object>(inp->Get(context, Nan::New<String>("coolingTower").ToLocalChecked()).ToLocalChecked()).ToLocalChecked();
+
+        ChillerPlant plant(chillers, getChillerPlantCoolingTower(coolingTowerV8),
+                           static_cast<ChillerPlant::Staging>(static_cast<int>(GetDouble("staging", inp))), GetDouble("maxPartLoadRatio", inp));
+
+        std::vector<double> coolingLoad = GetVector("coolingLoad", inp);
+        std::vector<double> wetBulbTemperature = GetVector("wetBulbTemperature", inp);
+        if (coolingLoad.size() != wetBulbTemperature.size())
+        {
+            throw std::runtime_error("the cooling load and wet bulb temperature series must have the same number of hours");
+        }
+        std::vector<ChillerPlant::HourResults> hours(coolingLoad.size());
+        ChillerPlant::Results results = plant.simulate(coolingLoad.size(), coolingLoad.data(), wetBulbTemperature.data(), hours.data());
+
+        SetR("operatingHours", results.operatingHours);
+        SetR("coolingDelivered", results.coolingDelivered);
+        SetR("unmetLoad", results.unmetLoad);
+        SetR("chillerEnergy", results.chillerEnergy);
+        SetR("pumpEnergy", results.pumpEnergy);
+        SetR("towerFanEnergy", results.towerFanEnergy);
+        SetR("energy", results.energy);
+        SetR("peakPower", results.peakPower);
+        SetR("efficiency", results.efficiency);
+        SetR("evaporation", results.evaporation);
+        SetR("drift", results.drift);
+        SetR("blowDown", results.blowDown);
+        SetR("makeupWater", results.makeupWater);
+        Nan::Set(r, Nan::New<String>("chillerRunHours").ToLocalChecked(), GetArray(results.chillerRunHours));
+
+        std::vector<double> chillersRunning(hours.size()), plantPower(hours.size()), makeupWater(hours.size());
+        for (std::size_t i = 0; i < hours.size(); i++)
+        {
+            chillersRunning[i] = hours[i].chillersRunning;
+            plantPower[i] = hours[i].plantPower;
+            makeupWater[i] = hours[i].makeupWater;
+        }
+        Nan::Set(r, Nan::New<String>("hourlyChillersRunning").ToLocalChecked(), GetArray(chillersRunning));
+        Nan::Set(r, Nan::New<String>("hourlyPlantPower").ToLocalChecked(), GetArray(plantPower));
+        Nan::Set(r, Nan::New<String>("hourlyMakeupWater").ToLocalChecked(), GetArray(makeupWater));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in chillerPlantSimulation - chillers.h: " + what).c_str());
+    }
+    info.GetReturnValue().Set(r);
+}
+
 #endif //AMO_TOOLS_SUITE_CHILLERS_H
\ No newline at end of file
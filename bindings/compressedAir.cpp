@@ -6,6 +6,15 @@ using namespace Nan;
 NAN_MODULE_INIT(InitCompressedAir) {
     Nan::Set(target, New<String>("CompressedAir").ToLocalChecked(),
              GetFunction(New<FunctionTemplate>(CompressedAir)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("compressedAirSystemSimulation").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(compressedAirSystemSimulation)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("compressedAirSequencingOptimizer").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(compressedAirSequencingOptimizer)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("compressedAirNetwork").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(compressedAirNetwork)).ToLocalChecked());
 }
 
 NODE_MODULE(compressedAir, InitCompressedAir)
\ No newline at end of file
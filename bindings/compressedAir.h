@@ -6,8 +6,12 @@
 #include <exception>
 #include <iostream>
 #include "./NanDataConverters.h"
+#include "./NanTypedArrayConverters.h"
 #include "calculator/util/CompressedAir.h"
 #include "calculator/util/CompressedAirCentrifugal.h"
+#include "calculator/util/CompressedAirNetwork.h"
+#include "calculator/util/CompressedAirSequencingOptimizer.h"
+#include "calculator/util/CompressedAirSystemSimulation.h"
 
 using namespace Nan;
 using namespace v8;
@@ -155,3 +159,260 @@ NAN_METHOD(CompressedAir)
         ThrowError(std::string("std::runtime_error thrown in CompressedAir - calculator: " + what).c_str());
     }
 }
+
+CompressedAirSystemSimulation::CompressorUnit getCompressorUnit()
+{
+    const int controlType = getInteger("controlType");
+    const double powerAtFullLoad = getDouble("powerAtFullLoad");
+    const double capacityAtFullLoad = getDouble("capacityAtFullLoad");
+
+    if(controlType == CompressedAirCentrifugal::ControlType::LoadUnload)
+        return CompressedAirSystemSimulation::CompressorUnit::loadUnload(powerAtFullLoad, capacityAtFullLoad,
+                                                                         getDouble("powerAtNoLoad"));
+    if(controlType == CompressedAirCentrifugal::ControlType::ModulationUnload)
+        return CompressedAirSystemSimulation::CompressorUnit::modulationUnload(
+                powerAtFullLoad, capacityAtFullLoad, getDouble("powerAtNoLoad"), getDouble("capacityAtMaxFullFlow"),
+                getDouble("powerAtUnload"), getDouble("capacityAtUnload"));
+    if(controlType == CompressedAirCentrifugal::ControlType::BlowOff)
+        return CompressedAirSystemSimulation::CompressorUnit::blowOff(powerAtFullLoad, capacityAtFullLoad,
+                                                                      getDouble("powerAtBlowOff"), getDouble("surgeFlow"));
+    throw std::runtime_error("CompressedAirSystemSimulation: Invalid Control Type in input");
+}
+
+std::vector<CompressedAirSystemSimulation::CompressorUnit> getCompressorUnits(Local<Object> const &inputs)
+{
+    std::vector<CompressedAirSystemSimulation::CompressorUnit> compressors;
+    Local<Array> const compressorArray = getArray("compressors", inputs);
+    for (uint32_t i = 0; i < compressorArray->Length(); i++)
+    {
+        inp = Nan::To<Object>(Nan::Get(compressorArray, i).ToLocalChecked()).ToLocalChecked();
+        compressors.push_back(getCompressorUnit());
+    }
+    inp = inputs;
+    return compressors;
+}
+
+Local<Object> getCompressorResults(CompressedAirSystemSimulation::CompressorResults const &unit)
+{
+    Local<Object> obj = Nan::New<Object>();
+    setRobject("energy", unit.energy, obj);
+    setRobject("peakPower", unit.peakPower, obj);
+    setRobject("airDelivered", unit.airDelivered, obj);
+    setRobject("fullLoadHours", unit.fullLoadHours, obj);
+    setRobject("partLoadHours", unit.partLoadHours, obj);
+    setRobject("offHours", unit.offHours, obj);
+    setRobject("loadUnloadCycles", unit.loadUnloadCycles, obj);
+    return obj;
+}
+
+NAN_METHOD(compressedAirSystemSimulation)
+{
+    /**
+     * Steps a sequenced compressor inventory through a demand profile
+     * @param inputs object, compressors array in loading order (CompressedAir centrifugal inputs), storageCapacity
+     *        (ft3), pressureBand (psi), timeStep (hours) and a demand Float64Array (acfm); optional power and loadState
+     *        Float64Arrays of demand.length x compressors.length receive each compressor's kW and LoadState per step
+     * @return object, energy, load hours and cycles of each compressor and of the system
+     */
+    inp = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const inputs = inp;
+
+    try
+    {
+        auto const compressors = getCompressorUnits(inputs);
+        const CompressedAirSystemSimulation system(compressors, getDouble("storageCapacity"), getDouble("pressureBand"),
+                                                   getDouble("timeStep"));
+
+        auto const demand = getFloat64Column("demand", inputs);
+        auto power = getOutputColumn("power", inputs);
+        auto loadState = getOutputColumn("loadState", inputs);
+        std::size_t const values = demand.length * compressors.size();
+        if ((power.isPresent() && power.length < values) || (loadState.isPresent() && loadState.length < values))
+        {
+            throw std::runtime_error("CompressedAirSystemSimulation: output Float64Array is shorter than demand x compressors");
+        }
+
+        std::vector<CompressedAirSystemSimulation::LoadState> states(loadState.isPresent() ? values : 0);
+        auto const results = system.simulate(demand.length, demand.data, states.empty() ? nullptr : states.data(),
+                                             power.data);
+        for (std::size_t i = 0; i < states.size(); i++) loadState.set(i, static_cast<double>(states[i]));
+
+        Local<Array> compressorResults = Nan::New<Array>();
+        for (std::size_t i = 0; i < results.compressors.size(); i++)
+        {
+            Nan::Set(compressorResults, static_cast<uint32_t>(i), getCompressorResults(results.compressors[i]));
+        }
+
+        r = Nan::New<Object>();
+        Nan::Set(r, Nan::New<String>("compressors").ToLocalChecked(), compressorResults);
+        setR("hours", results.hours);
+        setR("energy", results.energy);
+        setR("peakPower", results.peakPower);
+        setR("airDemand", results.airDemand);
+        setR("unmetDemand", results.unmetDemand);
+        info.GetReturnValue().Set(r);
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in compressedAirSystemSimulation - calculator: " + what).c_str());
+    }
+}
+
+std::vector<double> getDoubleArray(std::string const &name, Local<Object> const &inputs)
+{
+    std::vector<double> values;
+    Local<Array> const array = getArray(name, inputs);
+    for (uint32_t i = 0; i < array->Length(); i++)
+        values.push_back(Nan::To<double>(Nan::Get(array, i).ToLocalChecked()).FromJust());
+    return values;
+}
+
+NAN_METHOD(compressedAirSequencingOptimizer)
+{
+    /**
+     * Ranks sequencing strategies of a compressor inventory by their cost over a demand profile
+     * @param inputs object, compressors, storageCapacity, timeStep and demand as for compressedAirSystemSimulation,
+     *        electricityCost ($/kWh), storageCost ($/gallon), pressureBands and storageAdditions (gallons) arrays, and
+     *        optionally loadingOrders (arrays of compressor indexes), tryTrimCompressors and strategies (count)
+     * @return object, the cheapest strategies, cheapest first, and the number of candidates, pruned and infeasible
+     */
+    inp = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const inputs = inp;
+
+    try
+    {
+        CompressedAirSequencingOptimizer::Inputs optimizerInputs;
+        optimizerInputs.compressors = getCompressorUnits(inputs);
+        auto const demand = getFloat64Column("demand", inputs);
+        optimizerInputs.demand.assign(demand.data, demand.data + demand.length);
+        optimizerInputs.timeStep = getDouble("timeStep");
+        optimizerInputs.storageCapacity = getDouble("storageCapacity");
+        optimizerInputs.electricityCost = getDouble("electricityCost");
+        optimizerInputs.storageCost = getDouble("storageCost");
+        optimizerInputs.pressureBands = getDoubleArray("pressureBands", inputs);
+        optimizerInputs.storageAdditions = getDoubleArray("storageAdditions", inputs);
+
+        Local<Value> const orders = Nan::Get(inputs, Nan::New<String>("loadingOrders").ToLocalChecked()).ToLocalChecked();
+        if (orders->IsArray())
+        {
+            Local<Array> const orderArray = Local<Array>::Cast(orders);
+            for (uint32_t i = 0; i < orderArray->Length(); i++)
+            {
+                std::vector<std::size_t> order;
+                Local<Array> const indexes = Local<Array>::Cast(Nan::Get(orderArray, i).ToLocalChecked());
+                for (uint32_t j = 0; j < indexes->Length(); j++)
+                    order.push_back(static_cast<std::size_t>(Nan::To<uint32_t>(Nan::Get(indexes, j).ToLocalChecked()).FromJust()));
+                optimizerInputs.loadingOrders.push_back(order);
+            }
+        }
+        if (!Nan::Get(inputs, Nan::New<String>("tryTrimCompressors").ToLocalChecked()).ToLocalChecked()->IsUndefined())
+            optimizerInputs.tryTrimCompressors = getBool("tryTrimCompressors");
+        std::size_t strategies = 10;
+        if (!Nan::Get(inputs, Nan::New<String>("strategies").ToLocalChecked()).ToLocalChecked()->IsUndefined())
+            strategies = static_cast<std::size_t>(getInteger("strategies"));
+
+        auto const results = CompressedAirSequencingOptimizer::optimize(optimizerInputs, strategies);
+
+        Local<Array> strategyArray = Nan::New<Array>();
+        for (std::size_t i = 0; i < results.strategies.size(); i++)
+        {
+            auto const &strategy = results.strategies[i];
+            Local<Object> obj = Nan::New<Object>();
+            Local<Array> loadingOrder = Nan::New<Array>();
+            for (std::size_t j = 0; j < strategy.loadingOrder.size(); j++)
+                Nan::Set(loadingOrder, static_cast<uint32_t>(j), Nan::New<Number>(static_cast<double>(strategy.loadingOrder[j])));
+            Nan::Set(obj, Nan::New<String>("loadingOrder").ToLocalChecked(), loadingOrder);
+            setRobject("trimCompressor", strategy.trimCompressor, obj);
+            setRobject("pressureBand", strategy.pressureBand, obj);
+            setRobject("storageAddition", strategy.storageAddition, obj);
+            setRobject("energy", strategy.energy, obj);
+            setRobject("energyCost", strategy.energyCost, obj);
+            setRobject("storageCost", strategy.storageCost, obj);
+            setRobject("totalCost", strategy.totalCost, obj);
+            setRobject("peakPower", strategy.simulation.peakPower, obj);
+            Local<Array> compressorResults = Nan::New<Array>();
+            for (std::size_t j = 0; j < strategy.simulation.compressors.size(); j++)
+                Nan::Set(compressorResults, static_cast<uint32_t>(j), getCompressorResults(strategy.simulation.compressors[j]));
+            Nan::Set(obj, Nan::New<String>("compressors").ToLocalChecked(), compressorResults);
+            Nan::Set(strategyArray, static_cast<uint32_t>(i), obj);
+        }
+
+        r = Nan::New<Object>();
+        Nan::Set(r, Nan::New<String>("strategies").ToLocalChecked(), strategyArray);
+        setR("candidates", results.candidates);
+        setR("pruned", results.pruned);
+        setR("infeasible", results.infeasible);
+        info.GetReturnValue().Set(r);
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in compressedAirSequencingOptimizer - calculator: " + what).c_str());
+    }
+}
+
+Local<Array> getDoubleResults(std::vector<double> const &values)
+{
+    Local<Array> array = Nan::New<Array>();
+    for (std::size_t i = 0; i < values.size(); i++)
+        Nan::Set(array, static_cast<uint32_t>(i), Nan::New<Number>(values[i]));
+    return array;
+}
+
+NAN_METHOD(compressedAirNetwork)
+{
+    /**
+     * Solves the flows and pressures of a compressed air distribution network
+     * @param inputs object, nodes array of junctions {demand (scfm)} and supply points {supply: true, pressure (psig)},
+     *        pipes array of {from, to (node indexes), length (ft), diameter (in)}, optional atmosphericPressure (psia)
+     * @return object, pressures and supplies of each node, flows, pressureDrops and velocities of each pipe, iterations
+     *         and converged
+     */
+    inp = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const inputs = inp;
+
+    try
+    {
+        double atmosphericPressure = 14.7;
+        if (!Nan::Get(inputs, Nan::New<String>("atmosphericPressure").ToLocalChecked()).ToLocalChecked()->IsUndefined())
+            atmosphericPressure = getDouble("atmosphericPressure");
+        CompressedAirNetwork network(atmosphericPressure);
+
+        Local<Array> const nodes = getArray("nodes", inputs);
+        for (uint32_t i = 0; i < nodes->Length(); i++)
+        {
+            Local<Object> const node = Nan::To<Object>(Nan::Get(nodes, i).ToLocalChecked()).ToLocalChecked();
+            if (!Nan::Get(node, Nan::New<String>("supply").ToLocalChecked()).ToLocalChecked()->IsUndefined()
+                && getBool("supply", node))
+                network.addSupply(getDouble("pressure", node));
+            else
+                network.addJunction(getDouble("demand", node));
+        }
+        Local<Array> const pipes = getArray("pipes", inputs);
+        for (uint32_t i = 0; i < pipes->Length(); i++)
+        {
+            Local<Object> const pipe = Nan::To<Object>(Nan::Get(pipes, i).ToLocalChecked()).ToLocalChecked();
+            network.addPipe(static_cast<std::size_t>(getInteger("from", pipe)),
+                            static_cast<std::size_t>(getInteger("to", pipe)), getDouble("length", pipe),
+                            getDouble("diameter", pipe));
+        }
+
+        auto const results = network.solve();
+
+        r = Nan::New<Object>();
+        Nan::Set(r, Nan::New<String>("pressures").ToLocalChecked(), getDoubleResults(results.pressures));
+        Nan::Set(r, Nan::New<String>("supplies").ToLocalChecked(), getDoubleResults(results.supplies));
+        Nan::Set(r, Nan::New<String>("flows").ToLocalChecked(), getDoubleResults(results.flows));
+        Nan::Set(r, Nan::New<String>("pressureDrops").ToLocalChecked(), getDoubleResults(results.pressureDrops));
+        Nan::Set(r, Nan::New<String>("velocities").ToLocalChecked(), getDoubleResults(results.velocities));
+        setR("iterations", results.iterations);
+        Nan::Set(r, Nan::New<String>("converged").ToLocalChecked(), Nan::New<Boolean>(results.converged));
+        info.GetReturnValue().Set(r);
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in compressedAirNetwork - calculator: " + what).c_str());
+    }
+}
@@ -9,6 +9,9 @@ NAN_MODULE_INIT(InitFans) {
 	Nan::Set(target, New<String>("fanResultsExisting").ToLocalChecked(),
 	         GetFunction(New<FunctionTemplate>(fanResultsExisting)).ToLocalChecked());
 
+	Nan::Set(target, New<String>("fanResultsExistingBatch").ToLocalChecked(),
+			 GetFunction(New<FunctionTemplate>(fanResultsExistingBatch)).ToLocalChecked());
+
 	Nan::Set(target, New<String>("fanResultsModified").ToLocalChecked(),
 	         GetFunction(New<FunctionTemplate>(fanResultsModified)).ToLocalChecked());
 
@@ -38,6 +41,12 @@ NAN_MODULE_INIT(InitFans) {
 
 	Nan::Set(target, New<String>("compressibilityFactor").ToLocalChecked(),
 			 GetFunction(New<FunctionTemplate>(compressibilityFactor)).ToLocalChecked());
+
+	Nan::Set(target, New<String>("solverStatistics").ToLocalChecked(),
+			 GetFunction(New<FunctionTemplate>(solverStatistics)).ToLocalChecked());
+
+	Nan::Set(target, New<String>("resetSolverStatistics").ToLocalChecked(),
+			 GetFunction(New<FunctionTemplate>(resetSolverStatistics)).ToLocalChecked());
 }
 
 NODE_MODULE(fan, InitFans)
@@ -11,6 +11,8 @@
 #include "results/InputData.h"
 #include "fans/CompressibilityFactor.h"
 #include "calculator/util/Conversion.h"
+#include "NanTypedArrayConverters.h"
+#include "NanSolverStatistics.h"
 
 #include "calculator/pump/OptimalPumpShaftPower.h"
 #include "calculator/motor/OptimalMotorShaftPower.h"
@@ -311,6 +313,108 @@ NAN_METHOD(fanResultsExisting)
 	info.GetReturnValue().Set(r);
 }
 
+// Columnar (batch) version of fanResultsExisting: info[0] holds one Float64Array per fanResultsExisting input field
+// (enums as their numeric values; specifiedDriveEfficiency is optional), info[1] holds caller-allocated Float64Arrays
+// for any of the fanResultsExisting result fields. Returns the number of rows evaluated.
+NAN_METHOD(fanResultsExistingBatch)
+{
+	Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+	Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+	try
+	{
+		auto const fanSpeed = getFloat64Column("fanSpeed", inputs);
+		auto const airDensity = getFloat64Column("airDensity", inputs);
+		auto const driveType = getFloat64Column("drive", inputs);
+		auto const specifiedDriveEfficiency = getFloat64Column("specifiedDriveEfficiency", inputs, false);
+		auto const lineFrequency = getFloat64Column("lineFrequency", inputs);
+		auto const motorRatedPower = getFloat64Column("motorRatedPower", inputs);
+		auto const motorRpm = getFloat64Column("motorRpm", inputs);
+		auto const efficiencyClass = getFloat64Column("efficiencyClass", inputs);
+		auto const specifiedEfficiency = getFloat64Column("specifiedEfficiency", inputs);
+		auto const motorRatedVoltage = getFloat64Column("motorRatedVoltage", inputs);
+		auto const fullLoadAmps = getFloat64Column("fullLoadAmps", inputs);
+		auto const sizeMargin = getFloat64Column("sizeMargin", inputs);
+		auto const measuredPower = getFloat64Column("measuredPower", inputs);
+		auto const measuredVoltage = getFloat64Column("measuredVoltage", inputs);
+		auto const measuredAmps = getFloat64Column("measuredAmps", inputs);
+		auto const flowRate = getFloat64Column("flowRate", inputs);
+		auto const inletPressure = getFloat64Column("inletPressure", inputs);
+		auto const outletPressure = getFloat64Column("outletPressure", inputs);
+		auto const compressibilityFactor = getFloat64Column("compressibilityFactor", inputs);
+		auto const operatingHours = getFloat64Column("operatingHours", inputs);
+		auto const unitCost = getFloat64Column("unitCost", inputs);
+		auto const loadEstimationMethod = getFloat64Column("loadEstimationMethod", inputs);
+
+		auto fanEfficiency = getOutputColumn("fanEfficiency", outputs);
+		auto motorRatedPowerOut = getOutputColumn("motorRatedPower", outputs);
+		auto motorShaftPower = getOutputColumn("motorShaftPower", outputs);
+		auto fanShaftPower = getOutputColumn("fanShaftPower", outputs);
+		auto motorEfficiency = getOutputColumn("motorEfficiency", outputs);
+		auto motorPowerFactor = getOutputColumn("motorPowerFactor", outputs);
+		auto motorCurrent = getOutputColumn("motorCurrent", outputs);
+		auto motorPower = getOutputColumn("motorPower", outputs);
+		auto loadFactor = getOutputColumn("loadFactor", outputs);
+		auto driveEfficiency = getOutputColumn("driveEfficiency", outputs);
+		auto annualEnergy = getOutputColumn("annualEnergy", outputs);
+		auto annualCost = getOutputColumn("annualCost", outputs);
+		auto estimatedFLA = getOutputColumn("estimatedFLA", outputs);
+		auto fanEnergyIndex = getOutputColumn("fanEnergyIndex", outputs);
+
+		std::vector<Float64Column> inputColumns = {fanSpeed, airDensity, driveType, lineFrequency, motorRatedPower,
+												   motorRpm, efficiencyClass, specifiedEfficiency, motorRatedVoltage,
+												   fullLoadAmps, sizeMargin, measuredPower, measuredVoltage,
+												   measuredAmps, flowRate, inletPressure, outletPressure,
+												   compressibilityFactor, operatingHours, unitCost, loadEstimationMethod};
+		if (specifiedDriveEfficiency.isPresent()) inputColumns.push_back(specifiedDriveEfficiency);
+		std::size_t const rows = getBatchRowCount(inputColumns,
+												  {fanEfficiency, motorRatedPowerOut, motorShaftPower, fanShaftPower,
+												   motorEfficiency, motorPowerFactor, motorCurrent, motorPower,
+												   loadFactor, driveEfficiency, annualEnergy, annualCost,
+												   estimatedFLA, fanEnergyIndex});
+
+		for (std::size_t i = 0; i < rows; ++i)
+		{
+			auto const drive1 = static_cast<Motor::Drive>(static_cast<int>(driveType[i]));
+			double driveEfficiencyInput = 100.0;
+			if (drive1 == Motor::Drive::SPECIFIED && specifiedDriveEfficiency.isPresent())
+			{
+				driveEfficiencyInput = specifiedDriveEfficiency[i];
+			}
+
+			Fan::Input input(fanSpeed[i], airDensity[i], drive1, Conversion(driveEfficiencyInput).percentToFraction());
+			Motor motor(static_cast<Motor::LineFrequency>(static_cast<int>(lineFrequency[i])), motorRatedPower[i],
+						motorRpm[i], static_cast<Motor::EfficiencyClass>(static_cast<int>(efficiencyClass[i])),
+						specifiedEfficiency[i], motorRatedVoltage[i], fullLoadAmps[i], sizeMargin[i]);
+			Fan::FieldDataBaseline fanFieldData(measuredPower[i], measuredVoltage[i], measuredAmps[i], flowRate[i],
+												inletPressure[i], outletPressure[i], compressibilityFactor[i],
+												static_cast<Motor::LoadEstimationMethod>(static_cast<int>(loadEstimationMethod[i])));
+			FanResult result(input, motor, operatingHours[i], unitCost[i]);
+			FanResult::Output const output = result.calculateExisting(fanFieldData);
+
+			fanEfficiency.set(i, Conversion(output.fanEfficiency).fractionToPercent());
+			motorRatedPowerOut.set(i, output.motorRatedPower);
+			motorShaftPower.set(i, output.motorShaftPower);
+			fanShaftPower.set(i, output.fanShaftPower);
+			motorEfficiency.set(i, Conversion(output.motorEfficiency).fractionToPercent());
+			motorPowerFactor.set(i, Conversion(output.motorPowerFactor).fractionToPercent());
+			motorCurrent.set(i, output.motorCurrent);
+			motorPower.set(i, output.motorPower);
+			loadFactor.set(i, output.loadFactor);
+			driveEfficiency.set(i, Conversion(output.driveEfficiency).fractionToPercent());
+			annualEnergy.set(i, output.annualEnergy);
+			annualCost.set(i, output.annualCost);
+			estimatedFLA.set(i, output.estimatedFLA);
+			fanEnergyIndex.set(i, output.fanEnergyIndex);
+		}
+		info.GetReturnValue().Set(Nan::New<Number>(rows));
+	}
+	catch (std::runtime_error const &e)
+	{
+		std::string const what = e.what();
+		ThrowError(std::string("std::runtime_error thrown in fanResultsExistingBatch - fan.h: " + what).c_str());
+	}
+}
+
 NAN_METHOD(fanResultsModified)
 {
 	inp = Nan::To<Object>(info[0]).ToLocalChecked();
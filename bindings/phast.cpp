@@ -85,6 +85,73 @@ NAN_MODULE_INIT(InitPhast) {
     Nan::Set(target, New<String>("waterCoolingLosses").ToLocalChecked(),
              GetFunction(New<FunctionTemplate>(waterCoolingLosses)).ToLocalChecked());
 
+    // PHAST Losses - columnar batch entry points (Float64Array in, Float64Array out)
+    Nan::Set(target, New<String>("atmosphereBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(atmosphereBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("auxiliaryPowerLossBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(auxiliaryPowerLossBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("energyInputEAFBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(energyInputEAFBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("exhaustGasEAFBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(exhaustGasEAFBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("fixtureLossesBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(fixtureLossesBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("flueGasLossesByMassBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(flueGasLossesByMassBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("flueGasLossesByVolumeBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(flueGasLossesByVolumeBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("gasCoolingLossesBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(gasCoolingLossesBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("gasLoadChargeMaterialBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(gasLoadChargeMaterialBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("leakageLossesBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(leakageLossesBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("liquidCoolingLossesBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(liquidCoolingLossesBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("liquidLoadChargeMaterialBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(liquidLoadChargeMaterialBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("openingLossesCircularBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(openingLossesCircularBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("openingLossesQuadBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(openingLossesQuadBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("slagOtherMaterialLossesBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(slagOtherMaterialLossesBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("solidLoadChargeMaterialBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(solidLoadChargeMaterialBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("wallLossesBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(wallLossesBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("waterCoolingLossesBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(waterCoolingLossesBatch)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("wallLossesSeries").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(wallLossesSeries)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("openingLossesSeries").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(openingLossesSeries)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("atmosphereSeries").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(atmosphereSeries)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("flueGasLossesByVolumeSeries").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(flueGasLossesByVolumeSeries)).ToLocalChecked());
+
     Nan::Set(target, New<String>("efficiencyImprovement").ToLocalChecked(),
              GetFunction(New<FunctionTemplate>(efficiencyImprovement)).ToLocalChecked());
 
@@ -103,6 +170,25 @@ NAN_MODULE_INIT(InitPhast) {
     Nan::Set(target, New<String>("humidityRatio").ToLocalChecked(),
              GetFunction(New<FunctionTemplate>(humidityRatio)).ToLocalChecked());
 
+    Nan::Set(target, New<String>("furnaceHeatBalance").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(furnaceHeatBalance)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("furnaceHeatBalanceAssessment").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(furnaceHeatBalanceAssessment)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("furnaceEfficiencyOptimization").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(furnaceEfficiencyOptimization)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("multiZoneFurnace").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(multiZoneFurnace)).ToLocalChecked());
+    Nan::Set(target, New<String>("eafHeatBalance").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(eafHeatBalance)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("solverStatistics").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(solverStatistics)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("resetSolverStatistics").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(resetSolverStatistics)).ToLocalChecked());
 }
 
 NODE_MODULE(phast, InitPhast)
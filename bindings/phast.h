@@ -3,11 +3,17 @@
 
 #include <nan.h>
 #include <node.h>
+#include <algorithm>
 #include <iostream>
+#include <memory>
 #include <string>
+#include "calculator/furnace/EAFHeatBalance.h"
 #include "calculator/furnace/EfficiencyImprovement.h"
 #include "calculator/furnace/EnergyEquivalency.h"
 #include "calculator/furnace/FlowCalculationsEnergyUse.h"
+#include "calculator/furnace/FurnaceEfficiencyOptimizer.h"
+#include "calculator/furnace/FurnaceHeatBalance.h"
+#include "calculator/furnace/MultiZoneFurnace.h"
 #include "calculator/furnace/O2Enrichment.h"
 #include "calculator/losses/Atmosphere.h"
 #include "calculator/losses/AuxiliaryPower.h"
@@ -30,6 +36,8 @@
 #include "calculator/losses/WaterCoolingLosses.h"
 #include "calculator/furnace/HumidityRatio.h"
 #include "calculator/util/Conversion.h"
+#include "NanTypedArrayConverters.h"
+#include "NanSolverStatistics.h"
 
 using namespace Nan;
 using namespace v8;
@@ -1052,4 +1060,1223 @@ NAN_METHOD(humidityRatio)
     info.GetReturnValue().Set(r);
 }
 
+// Columnar (batch) entry points. Each takes an object of Float64Arrays, one per input field, and an object of
+// caller-allocated Float64Arrays for the results. Output arrays are optional; the number of rows evaluated is returned.
+
+NAN_METHOD(atmosphereBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const inletTemperature = getFloat64Column("inletTemperature", inputs);
+        auto const outletTemperature = getFloat64Column("outletTemperature", inputs);
+        auto const flowRate = getFloat64Column("flowRate", inputs);
+        auto const correctionFactor = getFloat64Column("correctionFactor", inputs);
+        auto const specificHeat = getFloat64Column("specificHeat", inputs);
+        auto heatLoss = getOutputColumn("heatLoss", outputs);
+
+        std::size_t const rows = getBatchRowCount({inletTemperature, outletTemperature, flowRate, correctionFactor, specificHeat},
+                                                  {heatLoss});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            Atmosphere a(inletTemperature[i], outletTemperature[i], flowRate[i], correctionFactor[i], specificHeat[i]);
+            heatLoss.set(i, a.getTotalHeat());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in atmosphereBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(auxiliaryPowerLossBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const motorPhase = getFloat64Column("motorPhase", inputs);
+        auto const supplyVoltage = getFloat64Column("supplyVoltage", inputs);
+        auto const avgCurrent = getFloat64Column("avgCurrent", inputs);
+        auto const powerFactor = getFloat64Column("powerFactor", inputs);
+        auto const operatingTime = getFloat64Column("operatingTime", inputs);
+        auto powerUsed = getOutputColumn("powerUsed", outputs);
+
+        std::size_t const rows = getBatchRowCount({motorPhase, supplyVoltage, avgCurrent, powerFactor, operatingTime},
+                                                  {powerUsed});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            AuxiliaryPower ap(motorPhase[i], supplyVoltage[i], avgCurrent[i], powerFactor[i], operatingTime[i]);
+            powerUsed.set(i, ap.getPowerUsed());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in auxiliaryPowerLossBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(energyInputEAFBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const naturalGasHeatInput = getFloat64Column("naturalGasHeatInput", inputs);
+        auto const coalCarbonInjection = getFloat64Column("coalCarbonInjection", inputs);
+        auto const coalHeatingValue = getFloat64Column("coalHeatingValue", inputs);
+        auto const electrodeUse = getFloat64Column("electrodeUse", inputs);
+        auto const electrodeHeatingValue = getFloat64Column("electrodeHeatingValue", inputs);
+        auto const otherFuels = getFloat64Column("otherFuels", inputs);
+        auto const electricityInput = getFloat64Column("electricityInput", inputs);
+        auto heatDelivered = getOutputColumn("heatDelivered", outputs);
+        auto totalChemicalEnergyInput = getOutputColumn("totalChemicalEnergyInput", outputs);
+
+        std::size_t const rows = getBatchRowCount({naturalGasHeatInput, coalCarbonInjection, coalHeatingValue, electrodeUse,
+                                                   electrodeHeatingValue, otherFuels, electricityInput},
+                                                  {heatDelivered, totalChemicalEnergyInput});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            EnergyInputEAF eaf(naturalGasHeatInput[i], coalCarbonInjection[i], coalHeatingValue[i], electrodeUse[i],
+                               electrodeHeatingValue[i], otherFuels[i], electricityInput[i]);
+            heatDelivered.set(i, eaf.getHeatDelivered());
+            totalChemicalEnergyInput.set(i, eaf.getTotalChemicalEnergyInput());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in energyInputEAFBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(exhaustGasEAFBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const offGasTemp = getFloat64Column("offGasTemp", inputs);
+        auto const CO = getFloat64Column("CO", inputs);
+        auto const H2 = getFloat64Column("H2", inputs);
+        auto const combustibleGases = getFloat64Column("combustibleGases", inputs);
+        auto const vfr = getFloat64Column("vfr", inputs);
+        auto const dustLoading = getFloat64Column("dustLoading", inputs);
+        auto totalHeatExhaust = getOutputColumn("totalHeatExhaust", outputs);
+
+        std::size_t const rows = getBatchRowCount({offGasTemp, CO, H2, combustibleGases, vfr, dustLoading},
+                                                  {totalHeatExhaust});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            ExhaustGasEAF eg(offGasTemp[i], CO[i], H2[i], combustibleGases[i], vfr[i], dustLoading[i]);
+            totalHeatExhaust.set(i, eg.getTotalHeatExhaust());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in exhaustGasEAFBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(fixtureLossesBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const specificHeat = getFloat64Column("specificHeat", inputs);
+        auto const feedRate = getFloat64Column("feedRate", inputs);
+        auto const initialTemperature = getFloat64Column("initialTemperature", inputs);
+        auto const finalTemperature = getFloat64Column("finalTemperature", inputs);
+        auto const correctionFactor = getFloat64Column("correctionFactor", inputs);
+        auto heatLoss = getOutputColumn("heatLoss", outputs);
+
+        std::size_t const rows = getBatchRowCount({specificHeat, feedRate, initialTemperature, finalTemperature, correctionFactor},
+                                                  {heatLoss});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            FixtureLosses fl(specificHeat[i], feedRate[i], initialTemperature[i], finalTemperature[i], correctionFactor[i]);
+            heatLoss.set(i, fl.getHeatLoss());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in fixtureLossesBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(flueGasLossesByMassBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const flueGasTemperature = getFloat64Column("flueGasTemperature", inputs);
+        auto const excessAirPercentage = getFloat64Column("excessAirPercentage", inputs);
+        auto const combustionAirTemperature = getFloat64Column("combustionAirTemperature", inputs);
+        auto const fuelTemperature = getFloat64Column("fuelTemperature", inputs);
+        auto const moistureInAirComposition = getFloat64Column("moistureInAirComposition", inputs);
+        auto const ashDischargeTemperature = getFloat64Column("ashDischargeTemperature", inputs);
+        auto const unburnedCarbonInAsh = getFloat64Column("unburnedCarbonInAsh", inputs);
+        auto const carbon = getFloat64Column("carbon", inputs);
+        auto const hydrogen = getFloat64Column("hydrogen", inputs);
+        auto const sulphur = getFloat64Column("sulphur", inputs);
+        auto const inertAsh = getFloat64Column("inertAsh", inputs);
+        auto const o2 = getFloat64Column("o2", inputs);
+        auto const moisture = getFloat64Column("moisture", inputs);
+        auto const nitrogen = getFloat64Column("nitrogen", inputs);
+        auto heatLoss = getOutputColumn("heatLoss", outputs);
+
+        std::size_t const rows = getBatchRowCount({flueGasTemperature, excessAirPercentage, combustionAirTemperature,
+                                                   fuelTemperature, moistureInAirComposition, ashDischargeTemperature,
+                                                   unburnedCarbonInAsh, carbon, hydrogen, sulphur, inertAsh, o2, moisture,
+                                                   nitrogen}, {heatLoss});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            SolidLiquidFlueGasMaterial slfgm(flueGasTemperature[i], excessAirPercentage[i], combustionAirTemperature[i],
+                                             fuelTemperature[i], moistureInAirComposition[i], ashDischargeTemperature[i],
+                                             unburnedCarbonInAsh[i], carbon[i], hydrogen[i], sulphur[i], inertAsh[i],
+                                             o2[i], moisture[i], nitrogen[i]);
+            heatLoss.set(i, slfgm.getHeatLoss());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in flueGasLossesByMassBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(flueGasLossesByVolumeBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const flueGasTemperature = getFloat64Column("flueGasTemperature", inputs);
+        auto const excessAirPercentage = getFloat64Column("excessAirPercentage", inputs);
+        auto const combustionAirTemperature = getFloat64Column("combustionAirTemperature", inputs);
+        auto const fuelTemperature = getFloat64Column("fuelTemperature", inputs);
+        std::vector<Float64Column> gases;
+        for (auto const name : {"CH4", "C2H6", "N2", "H2", "C3H8", "C4H10_CnH2n", "H2O", "CO", "CO2", "SO2", "O2"})
+        {
+            gases.push_back(getFloat64Column(name, inputs));
+        }
+        auto heatLoss = getOutputColumn("heatLoss", outputs);
+
+        std::vector<Float64Column> columns = {flueGasTemperature, excessAirPercentage, combustionAirTemperature,
+                                              fuelTemperature};
+        columns.insert(columns.end(), gases.begin(), gases.end());
+        std::size_t const rows = getBatchRowCount(columns, {heatLoss});
+
+        // rows burning the same fuel share its composition, whose heating value and stoichiometric air are derived
+        // in the GasCompositions constructor
+        std::unique_ptr<GasCompositions> comps;
+        std::size_t compositionRow = 0;
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            if (!comps || std::any_of(gases.begin(), gases.end(), [i, compositionRow](Float64Column const &gas) {
+                    return gas[i] != gas[compositionRow];
+                }))
+            {
+                comps.reset(new GasCompositions("", gases[0][i], gases[1][i], gases[2][i], gases[3][i], gases[4][i],
+                                                gases[5][i], gases[6][i], gases[7][i], gases[8][i], gases[9][i],
+                                                gases[10][i]));
+                compositionRow = i;
+            }
+            GasFlueGasMaterial fg(flueGasTemperature[i], excessAirPercentage[i], combustionAirTemperature[i], *comps,
+                                  fuelTemperature[i]);
+            heatLoss.set(i, fg.getHeatLoss());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in flueGasLossesByVolumeBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(gasCoolingLossesBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const flowRate = getFloat64Column("flowRate", inputs);
+        auto const initialTemperature = getFloat64Column("initialTemperature", inputs);
+        auto const finalTemperature = getFloat64Column("finalTemperature", inputs);
+        auto const specificHeat = getFloat64Column("specificHeat", inputs);
+        auto const correctionFactor = getFloat64Column("correctionFactor", inputs);
+        auto const gasDensity = getFloat64Column("gasDensity", inputs);
+        auto heatLoss = getOutputColumn("heatLoss", outputs);
+
+        std::size_t const rows = getBatchRowCount({flowRate, initialTemperature, finalTemperature, specificHeat,
+                                                   correctionFactor, gasDensity}, {heatLoss});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            GasCoolingLosses gcl(flowRate[i], initialTemperature[i], finalTemperature[i], specificHeat[i],
+                                 correctionFactor[i], gasDensity[i]);
+            heatLoss.set(i, gcl.getHeatLoss());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in gasCoolingLossesBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(gasLoadChargeMaterialBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const thermicReactionType = getFloat64Column("thermicReactionType", inputs);
+        auto const specificHeatGas = getFloat64Column("specificHeatGas", inputs);
+        auto const feedRate = getFloat64Column("feedRate", inputs);
+        auto const percentVapor = getFloat64Column("percentVapor", inputs);
+        auto const initialTemperature = getFloat64Column("initialTemperature", inputs);
+        auto const dischargeTemperature = getFloat64Column("dischargeTemperature", inputs);
+        auto const specificHeatVapor = getFloat64Column("specificHeatVapor", inputs);
+        auto const percentReacted = getFloat64Column("percentReacted", inputs);
+        auto const reactionHeat = getFloat64Column("reactionHeat", inputs);
+        auto const additionalHeat = getFloat64Column("additionalHeat", inputs);
+        auto totalHeat = getOutputColumn("totalHeat", outputs);
+
+        std::size_t const rows = getBatchRowCount({thermicReactionType, specificHeatGas, feedRate, percentVapor,
+                                                   initialTemperature, dischargeTemperature, specificHeatVapor,
+                                                   percentReacted, reactionHeat, additionalHeat}, {totalHeat});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            auto const reactionType = thermicReactionType[i] == 0 ? LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC
+                                                                  : LoadChargeMaterial::ThermicReactionType::EXOTHERMIC;
+            GasLoadChargeMaterial glcm(reactionType, specificHeatGas[i], feedRate[i], percentVapor[i],
+                                       initialTemperature[i], dischargeTemperature[i], specificHeatVapor[i],
+                                       percentReacted[i], reactionHeat[i], additionalHeat[i]);
+            totalHeat.set(i, glcm.getTotalHeat());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in gasLoadChargeMaterialBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(leakageLossesBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const draftPressure = getFloat64Column("draftPressure", inputs);
+        auto const openingArea = getFloat64Column("openingArea", inputs);
+        auto const leakageGasTemperature = getFloat64Column("leakageGasTemperature", inputs);
+        auto const ambientTemperature = getFloat64Column("ambientTemperature", inputs);
+        auto const coefficient = getFloat64Column("coefficient", inputs);
+        auto const specificGravity = getFloat64Column("specificGravity", inputs);
+        auto const correctionFactor = getFloat64Column("correctionFactor", inputs);
+        auto heatLoss = getOutputColumn("heatLoss", outputs);
+
+        std::size_t const rows = getBatchRowCount({draftPressure, openingArea, leakageGasTemperature, ambientTemperature,
+                                                   coefficient, specificGravity, correctionFactor}, {heatLoss});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            LeakageLosses ll(draftPressure[i], openingArea[i], leakageGasTemperature[i], ambientTemperature[i],
+                             coefficient[i], specificGravity[i], correctionFactor[i]);
+            heatLoss.set(i, ll.getExfiltratedGasesHeatContent());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in leakageLossesBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(liquidCoolingLossesBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const flowRate = getFloat64Column("flowRate", inputs);
+        auto const density = getFloat64Column("density", inputs);
+        auto const initialTemperature = getFloat64Column("initialTemperature", inputs);
+        auto const outletTemperature = getFloat64Column("outletTemperature", inputs);
+        auto const specificHeat = getFloat64Column("specificHeat", inputs);
+        auto const correctionFactor = getFloat64Column("correctionFactor", inputs);
+        auto heatLoss = getOutputColumn("heatLoss", outputs);
+
+        std::size_t const rows = getBatchRowCount({flowRate, density, initialTemperature, outletTemperature,
+                                                   specificHeat, correctionFactor}, {heatLoss});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            LiquidCoolingLosses lcl(flowRate[i], density[i], initialTemperature[i], outletTemperature[i],
+                                    specificHeat[i], correctionFactor[i]);
+            heatLoss.set(i, lcl.getHeatLoss());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in liquidCoolingLossesBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(liquidLoadChargeMaterialBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const thermicReactionType = getFloat64Column("thermicReactionType", inputs);
+        auto const specificHeatLiquid = getFloat64Column("specificHeatLiquid", inputs);
+        auto const vaporizingTemperature = getFloat64Column("vaporizingTemperature", inputs);
+        auto const latentHeat = getFloat64Column("latentHeat", inputs);
+        auto const specificHeatVapor = getFloat64Column("specificHeatVapor", inputs);
+        auto const chargeFeedRate = getFloat64Column("chargeFeedRate", inputs);
+        auto const initialTemperature = getFloat64Column("initialTemperature", inputs);
+        auto const dischargeTemperature = getFloat64Column("dischargeTemperature", inputs);
+        auto const percentVaporized = getFloat64Column("percentVaporized", inputs);
+        auto const percentReacted = getFloat64Column("percentReacted", inputs);
+        auto const reactionHeat = getFloat64Column("reactionHeat", inputs);
+        auto const additionalHeat = getFloat64Column("additionalHeat", inputs);
+        auto totalHeat = getOutputColumn("totalHeat", outputs);
+
+        std::size_t const rows = getBatchRowCount({thermicReactionType, specificHeatLiquid, vaporizingTemperature,
+                                                   latentHeat, specificHeatVapor, chargeFeedRate, initialTemperature,
+                                                   dischargeTemperature, percentVaporized, percentReacted, reactionHeat,
+                                                   additionalHeat}, {totalHeat});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            auto const reactionType = thermicReactionType[i] == 0 ? LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC
+                                                                  : LoadChargeMaterial::ThermicReactionType::EXOTHERMIC;
+            LiquidLoadChargeMaterial llcm(reactionType, specificHeatLiquid[i], vaporizingTemperature[i], latentHeat[i],
+                                          specificHeatVapor[i], chargeFeedRate[i], initialTemperature[i],
+                                          dischargeTemperature[i], percentVaporized[i], percentReacted[i],
+                                          reactionHeat[i], additionalHeat[i]);
+            totalHeat.set(i, llcm.getTotalHeat());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in liquidLoadChargeMaterialBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(openingLossesCircularBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const emissivity = getFloat64Column("emissivity", inputs);
+        auto const diameter = getFloat64Column("diameter", inputs);
+        auto const thickness = getFloat64Column("thickness", inputs);
+        auto const ratio = getFloat64Column("ratio", inputs);
+        auto const ambientTemperature = getFloat64Column("ambientTemperature", inputs);
+        auto const insideTemperature = getFloat64Column("insideTemperature", inputs);
+        auto const percentTimeOpen = getFloat64Column("percentTimeOpen", inputs);
+        auto const viewFactor = getFloat64Column("viewFactor", inputs);
+        auto heatLoss = getOutputColumn("heatLoss", outputs);
+
+        std::size_t const rows = getBatchRowCount({emissivity, diameter, thickness, ratio, ambientTemperature,
+                                                   insideTemperature, percentTimeOpen, viewFactor}, {heatLoss});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            OpeningLosses ol(emissivity[i], diameter[i], thickness[i], ratio[i], ambientTemperature[i],
+                             insideTemperature[i], percentTimeOpen[i], viewFactor[i]);
+            heatLoss.set(i, ol.getHeatLoss());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in openingLossesCircularBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(openingLossesQuadBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const emissivity = getFloat64Column("emissivity", inputs);
+        auto const length = getFloat64Column("length", inputs);
+        auto const width = getFloat64Column("width", inputs);
+        auto const thickness = getFloat64Column("thickness", inputs);
+        auto const ratio = getFloat64Column("ratio", inputs);
+        auto const ambientTemperature = getFloat64Column("ambientTemperature", inputs);
+        auto const insideTemperature = getFloat64Column("insideTemperature", inputs);
+        auto const percentTimeOpen = getFloat64Column("percentTimeOpen", inputs);
+        auto const viewFactor = getFloat64Column("viewFactor", inputs);
+        auto heatLoss = getOutputColumn("heatLoss", outputs);
+
+        std::size_t const rows = getBatchRowCount({emissivity, length, width, thickness, ratio, ambientTemperature,
+                                                   insideTemperature, percentTimeOpen, viewFactor}, {heatLoss});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            OpeningLosses ol(emissivity[i], length[i], width[i], thickness[i], ratio[i],
+                             ambientTemperature[i], insideTemperature[i], percentTimeOpen[i], viewFactor[i]);
+            heatLoss.set(i, ol.getHeatLoss());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in openingLossesQuadBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(slagOtherMaterialLossesBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const weight = getFloat64Column("weight", inputs);
+        auto const inletTemperature = getFloat64Column("inletTemperature", inputs);
+        auto const outletTemperature = getFloat64Column("outletTemperature", inputs);
+        auto const specificHeat = getFloat64Column("specificHeat", inputs);
+        auto const correctionFactor = getFloat64Column("correctionFactor", inputs);
+        auto heatLoss = getOutputColumn("heatLoss", outputs);
+
+        std::size_t const rows = getBatchRowCount({weight, inletTemperature, outletTemperature, specificHeat, correctionFactor},
+                                                  {heatLoss});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            SlagOtherMaterialLosses sl(weight[i], inletTemperature[i], outletTemperature[i], specificHeat[i],
+                                       correctionFactor[i]);
+            heatLoss.set(i, sl.getHeatLoss());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in slagOtherMaterialLossesBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(solidLoadChargeMaterialBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const thermicReactionType = getFloat64Column("thermicReactionType", inputs);
+        auto const specificHeatSolid = getFloat64Column("specificHeatSolid", inputs);
+        auto const latentHeat = getFloat64Column("latentHeat", inputs);
+        auto const specificHeatLiquid = getFloat64Column("specificHeatLiquid", inputs);
+        auto const meltingPoint = getFloat64Column("meltingPoint", inputs);
+        auto const chargeFeedRate = getFloat64Column("chargeFeedRate", inputs);
+        auto const waterContentCharged = getFloat64Column("waterContentCharged", inputs);
+        auto const waterContentDischarged = getFloat64Column("waterContentDischarged", inputs);
+        auto const initialTemperature = getFloat64Column("initialTemperature", inputs);
+        auto const dischargeTemperature = getFloat64Column("dischargeTemperature", inputs);
+        auto const waterVaporDischargeTemperature = getFloat64Column("waterVaporDischargeTemperature", inputs);
+        auto const chargeMelted = getFloat64Column("chargeMelted", inputs);
+        auto const chargeReacted = getFloat64Column("chargeReacted", inputs);
+        auto const reactionHeat = getFloat64Column("reactionHeat", inputs);
+        auto const additionalHeat = getFloat64Column("additionalHeat", inputs);
+        auto totalHeat = getOutputColumn("totalHeat", outputs);
+
+        std::size_t const rows = getBatchRowCount({thermicReactionType, specificHeatSolid, latentHeat, specificHeatLiquid,
+                                                   meltingPoint, chargeFeedRate, waterContentCharged, waterContentDischarged,
+                                                   initialTemperature, dischargeTemperature, waterVaporDischargeTemperature,
+                                                   chargeMelted, chargeReacted, reactionHeat, additionalHeat}, {totalHeat});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            auto const reactionType = thermicReactionType[i] == 0 ? LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC
+                                                                  : LoadChargeMaterial::ThermicReactionType::EXOTHERMIC;
+            SolidLoadChargeMaterial slcm(reactionType, specificHeatSolid[i], latentHeat[i], specificHeatLiquid[i],
+                                         meltingPoint[i], chargeFeedRate[i], waterContentCharged[i],
+                                         waterContentDischarged[i], initialTemperature[i], dischargeTemperature[i],
+                                         waterVaporDischargeTemperature[i], chargeMelted[i], chargeReacted[i],
+                                         reactionHeat[i], additionalHeat[i]);
+            totalHeat.set(i, slcm.getTotalHeat());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in solidLoadChargeMaterialBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(wallLossesBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const surfaceArea = getFloat64Column("surfaceArea", inputs);
+        auto const ambientTemperature = getFloat64Column("ambientTemperature", inputs);
+        auto const surfaceTemperature = getFloat64Column("surfaceTemperature", inputs);
+        auto const windVelocity = getFloat64Column("windVelocity", inputs);
+        auto const surfaceEmissivity = getFloat64Column("surfaceEmissivity", inputs);
+        auto const conditionFactor = getFloat64Column("conditionFactor", inputs);
+        auto const correctionFactor = getFloat64Column("correctionFactor", inputs);
+        auto heatLoss = getOutputColumn("heatLoss", outputs);
+
+        std::size_t const rows = getBatchRowCount({surfaceArea, ambientTemperature, surfaceTemperature, windVelocity,
+                                                   surfaceEmissivity, conditionFactor, correctionFactor}, {heatLoss});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            WallLosses wl(surfaceArea[i], ambientTemperature[i], surfaceTemperature[i], windVelocity[i],
+                          surfaceEmissivity[i], conditionFactor[i], correctionFactor[i]);
+            heatLoss.set(i, wl.getHeatLoss());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in wallLossesBatch - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(waterCoolingLossesBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const flowRate = getFloat64Column("flowRate", inputs);
+        auto const initialTemperature = getFloat64Column("initialTemperature", inputs);
+        auto const outletTemperature = getFloat64Column("outletTemperature", inputs);
+        auto const correctionFactor = getFloat64Column("correctionFactor", inputs);
+        auto heatLoss = getOutputColumn("heatLoss", outputs);
+
+        std::size_t const rows = getBatchRowCount({flowRate, initialTemperature, outletTemperature, correctionFactor},
+                                                  {heatLoss});
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            WaterCoolingLosses wcl(flowRate[i], initialTemperature[i], outletTemperature[i], correctionFactor[i]);
+            heatLoss.set(i, wcl.getHeatLoss());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in waterCoolingLossesBatch - phast.h: " + what).c_str());
+    }
+}
+
+
+// Time series: fixed inputs as for the single loss methods, optional Float64Array series of the time-varying inputs
+
+NAN_METHOD(wallLossesSeries)
+{
+    inp = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const inputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[2]).ToLocalChecked();
+    try
+    {
+        const WallLosses wl(Get("surfaceArea"), Get("ambientTemperature"), Get("surfaceTemperature"),
+                            Get("windVelocity"), Get("surfaceEmissivity"), Get("conditionFactor"),
+                            Get("correctionFactor"));
+        auto const surfaceTemperature = getFloat64Column("surfaceTemperature", inputs, false);
+        auto const ambientTemperature = getFloat64Column("ambientTemperature", inputs, false);
+        auto heatLoss = getFloat64Column("heatLoss", outputs);
+
+        std::size_t const samples = getSeriesSampleCount({surfaceTemperature, ambientTemperature}, heatLoss);
+        wl.getHeatLossSeries(samples, surfaceTemperature.data, ambientTemperature.data, heatLoss.data);
+        info.GetReturnValue().Set(Nan::New<Number>(samples));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in wallLossesSeries - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(openingLossesSeries)
+{
+    inp = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const inputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[2]).ToLocalChecked();
+    try
+    {
+        // circular openings give a diameter, rectangular ones a length and width
+        Local<Value> const diameter = Nan::Get(inp, Nan::New<String>("diameter").ToLocalChecked()).ToLocalChecked();
+        const OpeningLosses ol = !diameter->IsUndefined()
+                ? OpeningLosses(Get("emissivity"), Get("diameter"), Get("thickness"), Get("ratio"),
+                                Get("ambientTemperature"), Get("insideTemperature"), Get("percentTimeOpen"),
+                                Get("viewFactor"))
+                : OpeningLosses(Get("emissivity"), Get("length"), Get("width"), Get("thickness"), Get("ratio"),
+                                Get("ambientTemperature"), Get("insideTemperature"), Get("percentTimeOpen"),
+                                Get("viewFactor"));
+        auto const insideTemperature = getFloat64Column("insideTemperature", inputs, false);
+        auto const ambientTemperature = getFloat64Column("ambientTemperature", inputs, false);
+        auto const percentTimeOpen = getFloat64Column("percentTimeOpen", inputs, false);
+        auto heatLoss = getFloat64Column("heatLoss", outputs);
+
+        std::size_t const samples = getSeriesSampleCount({insideTemperature, ambientTemperature, percentTimeOpen},
+                                                         heatLoss);
+        ol.getHeatLossSeries(samples, insideTemperature.data, ambientTemperature.data, percentTimeOpen.data,
+                             heatLoss.data);
+        info.GetReturnValue().Set(Nan::New<Number>(samples));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in openingLossesSeries - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(atmosphereSeries)
+{
+    inp = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const inputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[2]).ToLocalChecked();
+    try
+    {
+        const Atmosphere a(Get("inletTemperature"), Get("outletTemperature"), Get("flowRate"), Get("correctionFactor"),
+                           Get("specificHeat"));
+        auto const inletTemperature = getFloat64Column("inletTemperature", inputs, false);
+        auto const outletTemperature = getFloat64Column("outletTemperature", inputs, false);
+        auto const flowRate = getFloat64Column("flowRate", inputs, false);
+        auto heatLoss = getFloat64Column("heatLoss", outputs);
+
+        std::size_t const samples = getSeriesSampleCount({inletTemperature, outletTemperature, flowRate}, heatLoss);
+        a.getTotalHeatSeries(samples, inletTemperature.data, outletTemperature.data, flowRate.data, heatLoss.data);
+        info.GetReturnValue().Set(Nan::New<Number>(samples));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in atmosphereSeries - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(flueGasLossesByVolumeSeries)
+{
+    inp = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const inputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[2]).ToLocalChecked();
+    try
+    {
+        GasCompositions comps("", Get("CH4"), Get("C2H6"), Get("N2"), Get("H2"), Get("C3H8"), Get("C4H10_CnH2n"),
+                              Get("H2O"), Get("CO"), Get("CO2"), Get("SO2"), Get("O2"));
+        const GasFlueGasMaterial fg(Get("flueGasTemperature"), Get("excessAirPercentage"),
+                                    Get("combustionAirTemperature"), comps, Get("fuelTemperature"));
+        auto const flueGasTemperature = getFloat64Column("flueGasTemperature", inputs, false);
+        auto const flueGasO2 = getFloat64Column("flueGasO2", inputs, false);
+        auto const combustionAirTemperature = getFloat64Column("combustionAirTemperature", inputs, false);
+        auto availableHeat = getFloat64Column("availableHeat", outputs);
+
+        std::size_t const samples = getSeriesSampleCount({flueGasTemperature, flueGasO2, combustionAirTemperature},
+                                                         availableHeat);
+        fg.getHeatLossSeries(samples, flueGasTemperature.data, flueGasO2.data, combustionAirTemperature.data,
+                             availableHeat.data);
+        info.GetReturnValue().Set(Nan::New<Number>(samples));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in flueGasLossesByVolumeSeries - phast.h: " + what).c_str());
+    }
+}
+
+// Furnace heat balance
+
+LoadChargeMaterial::ThermicReactionType thermicReactionType()
+{
+    return Get("thermicReactionType") == 0 ? LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC
+                                           : LoadChargeMaterial::ThermicReactionType::EXOTHERMIC;
+}
+
+/**
+ * Calls read once with inp set to each object of the named array; a missing array is an empty list
+ */
+template <typename Read>
+void forEachItem(std::string const &name, Local<Object> const &sourceObject, Read read)
+{
+    Local<Value> const value = Nan::Get(sourceObject, Nan::New<String>(name).ToLocalChecked()).ToLocalChecked();
+    if (value->IsUndefined()) return;
+    if (!value->IsArray()) throw std::runtime_error("field '" + name + "' must be an array");
+    Local<Array> const items = Local<Array>::Cast(value);
+    for (uint32_t i = 0; i < items->Length(); i++)
+    {
+        inp = Nan::To<Object>(Nan::Get(items, i).ToLocalChecked()).ToLocalChecked();
+        read();
+    }
+}
+
+/**
+ * Reads a furnace object: arrays of loss inputs, named and shaped as for the single loss methods, and either a
+ * gasFlueGas (flueGasLossesByVolume inputs) or a solidLiquidFlueGas (flueGasLossesByMass inputs) object
+ */
+FurnaceHeatBalance::Furnace getFurnace(Local<Object> const &furnaceObject)
+{
+    FurnaceHeatBalance::Furnace furnace;
+    forEachItem("gasChargeMaterials", furnaceObject, [&furnace]() {
+        furnace.gasChargeMaterials.emplace_back(
+                thermicReactionType(), Get("specificHeatGas"), Get("feedRate"), Get("percentVapor"),
+                Get("initialTemperature"), Get("dischargeTemperature"), Get("specificHeatVapor"),
+                Get("percentReacted"), Get("reactionHeat"), Get("additionalHeat"));
+    });
+    forEachItem("liquidChargeMaterials", furnaceObject, [&furnace]() {
+        furnace.liquidChargeMaterials.emplace_back(
+                thermicReactionType(), Get("specificHeatLiquid"), Get("vaporizingTemperature"), Get("latentHeat"),
+                Get("specificHeatVapor"), Get("chargeFeedRate"), Get("initialTemperature"),
+                Get("dischargeTemperature"), Get("percentVaporized"), Get("percentReacted"), Get("reactionHeat"),
+                Get("additionalHeat"));
+    });
+    forEachItem("solidChargeMaterials", furnaceObject, [&furnace]() {
+        furnace.solidChargeMaterials.emplace_back(
+                thermicReactionType(), Get("specificHeatSolid"), Get("latentHeat"), Get("specificHeatLiquid"),
+                Get("meltingPoint"), Get("chargeFeedRate"), Get("waterContentCharged"), Get("waterContentDischarged"),
+                Get("initialTemperature"), Get("dischargeTemperature"), Get("waterVaporDischargeTemperature"),
+                Get("chargeMelted"), Get("chargeReacted"), Get("reactionHeat"), Get("additionalHeat"));
+    });
+    forEachItem("fixtures", furnaceObject, [&furnace]() {
+        furnace.fixtures.emplace_back(Get("specificHeat"), Get("feedRate"), Get("initialTemperature"),
+                                      Get("finalTemperature"), Get("correctionFactor"));
+    });
+    forEachItem("walls", furnaceObject, [&furnace]() {
+        furnace.walls.emplace_back(Get("surfaceArea"), Get("ambientTemperature"), Get("surfaceTemperature"),
+                                   Get("windVelocity"), Get("surfaceEmissivity"), Get("conditionFactor"),
+                                   Get("correctionFactor"));
+    });
+    forEachItem("openings", furnaceObject, [&furnace]() {
+        // circular openings give a diameter, rectangular ones a length and width
+        Local<Value> const diameter = Nan::Get(inp, Nan::New<String>("diameter").ToLocalChecked()).ToLocalChecked();
+        if (!diameter->IsUndefined())
+        {
+            furnace.openings.emplace_back(Get("emissivity"), Get("diameter"), Get("thickness"), Get("ratio"),
+                                          Get("ambientTemperature"), Get("insideTemperature"),
+                                          Get("percentTimeOpen"), Get("viewFactor"));
+        }
+        else
+        {
+            furnace.openings.emplace_back(Get("emissivity"), Get("length"), Get("width"), Get("thickness"),
+                                          Get("ratio"), Get("ambientTemperature"), Get("insideTemperature"),
+                                          Get("percentTimeOpen"), Get("viewFactor"));
+        }
+    });
+    forEachItem("atmospheres", furnaceObject, [&furnace]() {
+        furnace.atmospheres.emplace_back(Get("inletTemperature"), Get("outletTemperature"), Get("flowRate"),
+                                         Get("correctionFactor"), Get("specificHeat"));
+    });
+    forEachItem("leakages", furnaceObject, [&furnace]() {
+        furnace.leakages.emplace_back(Get("draftPressure"), Get("openingArea"), Get("leakageGasTemperature"),
+                                      Get("ambientTemperature"), Get("coefficient"), Get("specificGravity"),
+                                      Get("correctionFactor"));
+    });
+    forEachItem("gasCoolings", furnaceObject, [&furnace]() {
+        furnace.gasCoolings.emplace_back(Get("flowRate"), Get("initialTemperature"), Get("finalTemperature"),
+                                         Get("specificHeat"), Get("correctionFactor"), Get("gasDensity"));
+    });
+    forEachItem("liquidCoolings", furnaceObject, [&furnace]() {
+        furnace.liquidCoolings.emplace_back(Get("flowRate"), Get("density"), Get("initialTemperature"),
+                                            Get("outletTemperature"), Get("specificHeat"), Get("correctionFactor"));
+    });
+    forEachItem("waterCoolings", furnaceObject, [&furnace]() {
+        furnace.waterCoolings.emplace_back(Get("flowRate"), Get("initialTemperature"), Get("outletTemperature"),
+                                           Get("correctionFactor"));
+    });
+    forEachItem("slags", furnaceObject, [&furnace]() {
+        furnace.slags.emplace_back(Get("weight"), Get("inletTemperature"), Get("outletTemperature"),
+                                   Get("specificHeat"), Get("correctionFactor"));
+    });
+    forEachItem("otherLosses", furnaceObject, [&furnace]() {
+        furnace.otherLosses.push_back(Get("heatLoss"));
+    });
+    forEachItem("auxiliaryPowers", furnaceObject, [&furnace]() {
+        furnace.auxiliaryPowers.emplace_back(Get("motorPhase"), Get("supplyVoltage"), Get("avgCurrent"),
+                                             Get("powerFactor"), Get("operatingTime"));
+    });
+
+    Local<Value> const gasFlueGas = Nan::Get(furnaceObject, Nan::New<String>("gasFlueGas").ToLocalChecked()).ToLocalChecked();
+    if (!gasFlueGas->IsUndefined())
+    {
+        inp = Nan::To<Object>(gasFlueGas).ToLocalChecked();
+        GasCompositions comps("", Get("CH4"), Get("C2H6"), Get("N2"), Get("H2"), Get("C3H8"), Get("C4H10_CnH2n"),
+                              Get("H2O"), Get("CO"), Get("CO2"), Get("SO2"), Get("O2"));
+        furnace.gasFlueGas = std::make_shared<GasFlueGasMaterial>(
+                Get("flueGasTemperature"), Get("excessAirPercentage"), Get("combustionAirTemperature"), comps,
+                Get("fuelTemperature"));
+    }
+    Local<Value> const solidLiquidFlueGas =
+            Nan::Get(furnaceObject, Nan::New<String>("solidLiquidFlueGas").ToLocalChecked()).ToLocalChecked();
+    if (!solidLiquidFlueGas->IsUndefined())
+    {
+        inp = Nan::To<Object>(solidLiquidFlueGas).ToLocalChecked();
+        furnace.solidLiquidFlueGas = std::make_shared<SolidLiquidFlueGasMaterial>(
+                Get("flueGasTemperature"), Get("excessAirPercentage"), Get("combustionAirTemperature"),
+                Get("fuelTemperature"), Get("moistureInAirComposition"), Get("ashDischargeTemperature"),
+                Get("unburnedCarbonInAsh"), Get("carbon"), Get("hydrogen"), Get("sulphur"), Get("inertAsh"),
+                Get("o2"), Get("moisture"), Get("nitrogen"));
+    }
+    return furnace;
+}
+
+Local<Object> getFurnaceResults(FurnaceHeatBalance::Results const &results)
+{
+    r = Nan::New<Object>();
+    SetR("chargeMaterials", results.chargeMaterials);
+    SetR("fixtures", results.fixtures);
+    SetR("walls", results.walls);
+    SetR("openings", results.openings);
+    SetR("atmospheres", results.atmospheres);
+    SetR("leakages", results.leakages);
+    SetR("coolings", results.coolings);
+    SetR("slags", results.slags);
+    SetR("otherLosses", results.otherLosses);
+    SetR("totalNetHeatRequired", results.totalNetHeatRequired);
+    SetR("availableHeat", results.availableHeat);
+    SetR("flueGasLosses", results.flueGasLosses);
+    SetR("grossHeatInput", results.grossHeatInput);
+    SetR("auxiliaryPower", results.auxiliaryPower);
+    SetR("chargeFeedRate", results.chargeFeedRate);
+    SetR("efficiency", results.efficiency);
+    SetR("energyIntensity", results.energyIntensity);
+    return r;
+}
+
+NAN_METHOD(furnaceHeatBalance)
+{
+    /**
+     * Heat balance of a complete furnace
+     * @param furnace object, arrays of loss inputs named as the members of FurnaceHeatBalance::Furnace, each item
+     * with the inputs of the matching single loss method, otherLosses items with a heatLoss, and an optional
+     * gasFlueGas or solidLiquidFlueGas object
+     * @return object, FurnaceHeatBalance::Results
+     */
+    try
+    {
+        auto const results = FurnaceHeatBalance::calculate(getFurnace(Nan::To<Object>(info[0]).ToLocalChecked()));
+        info.GetReturnValue().Set(getFurnaceResults(results));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in furnaceHeatBalance - phast.h: " + what).c_str());
+    }
+}
+
+NAN_METHOD(furnaceHeatBalanceAssessment)
+{
+    /**
+     * Heat balance of the baseline and modification of every furnace of a plant
+     * @param assessments array, objects with a baseline and a modification furnace, as for furnaceHeatBalance
+     * @return object, plant totals and a furnaces array with baseline, modification and savings of each furnace
+     */
+    try
+    {
+        Local<Array> const assessmentArray = Local<Array>::Cast(info[0]);
+        std::vector<FurnaceHeatBalance::Assessment> assessments;
+        assessments.reserve(assessmentArray->Length());
+        for (uint32_t i = 0; i < assessmentArray->Length(); i++)
+        {
+            Local<Object> const assessment = Nan::To<Object>(Nan::Get(assessmentArray, i).ToLocalChecked()).ToLocalChecked();
+            assessments.push_back({
+                getFurnace(Nan::To<Object>(Nan::Get(assessment, Nan::New<String>("baseline").ToLocalChecked()).ToLocalChecked()).ToLocalChecked()),
+                getFurnace(Nan::To<Object>(Nan::Get(assessment, Nan::New<String>("modification").ToLocalChecked()).ToLocalChecked()).ToLocalChecked())
+            });
+        }
+
+        auto const results = FurnaceHeatBalance::calculate(assessments);
+        Local<Array> furnaces = Nan::New<Array>();
+        for (std::size_t i = 0; i < results.furnaces.size(); i++)
+        {
+            auto const &furnace = results.furnaces[i];
+            Local<Object> furnaceResults = Nan::New<Object>();
+            Nan::Set(furnaceResults, Nan::New<String>("baseline").ToLocalChecked(), getFurnaceResults(furnace.baseline));
+            Nan::Set(furnaceResults, Nan::New<String>("modification").ToLocalChecked(), getFurnaceResults(furnace.modification));
+            r = furnaceResults;
+            SetR("energySavings", furnace.energySavings);
+            SetR("percentSavings", furnace.percentSavings);
+            Nan::Set(furnaces, static_cast<uint32_t>(i), furnaceResults);
+        }
+
+        r = Nan::New<Object>();
+        Nan::Set(r, Nan::New<String>("furnaces").ToLocalChecked(), furnaces);
+        SetR("baselineGrossHeatInput", results.baselineGrossHeatInput);
+        SetR("modificationGrossHeatInput", results.modificationGrossHeatInput);
+        SetR("energySavings", results.energySavings);
+        SetR("percentSavings", results.percentSavings);
+        info.GetReturnValue().Set(r);
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in furnaceHeatBalanceAssessment - phast.h: " + what).c_str());
+    }
+}
+
+FurnaceEfficiencyOptimizer::Range getRange(std::string const &name)
+{
+    Local<Object> const inputs = inp;
+    inp = Nan::To<Object>(Nan::Get(inputs, Nan::New<String>(name).ToLocalChecked()).ToLocalChecked()).ToLocalChecked();
+    FurnaceEfficiencyOptimizer::Range const range = {Get("minimum"), Get("maximum"), Get("step")};
+    inp = inputs;
+    return range;
+}
+
+Local<Object> getCandidate(FurnaceEfficiencyOptimizer::Candidate const &candidate)
+{
+    r = Nan::New<Object>();
+    SetR("combAirTemp", candidate.combAirTemp);
+    SetR("o2FlueGas", candidate.o2FlueGas);
+    SetR("o2CombAir", candidate.o2CombAir);
+    SetR("excessAir", candidate.excessAir);
+    SetR("availableHeat", candidate.availableHeat);
+    SetR("fuelConsumption", candidate.fuelConsumption);
+    SetR("fuelSavings", candidate.fuelSavings);
+    SetR("oxygenFlow", candidate.oxygenFlow);
+    SetR("fuelCost", candidate.fuelCost);
+    SetR("oxygenCost", candidate.oxygenCost);
+    SetR("totalCost", candidate.totalCost);
+    return r;
+}
+
+NAN_METHOD(furnaceEfficiencyOptimization)
+{
+    /**
+     * Searches combustion air preheat, flue gas O2 and O2 enrichment for the lowest fuel and oxygen costs
+     * @param inputs object, the members of FurnaceEfficiencyOptimizer::Inputs, combAirTemps, o2FlueGases and
+     * o2CombAirs objects with a minimum, maximum and step
+     * @return object, the baseline, a paretoSet array ranked by total cost and the number of candidates evaluated
+     */
+    try
+    {
+        inp = Nan::To<Object>(info[0]).ToLocalChecked();
+        FurnaceEfficiencyOptimizer::Inputs inputs;
+        inputs.flueGasTemp = Get("flueGasTemp");
+        inputs.o2FlueGas = Get("o2FlueGas");
+        inputs.combAirTemp = Get("combAirTemp");
+        inputs.o2CombAir = Get("o2CombAir");
+        inputs.fuelConsumption = Get("fuelConsumption");
+        inputs.operatingHours = Get("operatingHours");
+        inputs.fuelCost = Get("fuelCost");
+        inputs.oxygenCost = Get("oxygenCost");
+        inputs.stoichiometricOxygen = Get("stoichiometricOxygen");
+        inputs.fuelHeatingValue = Get("fuelHeatingValue");
+        inputs.ambientTemp = Get("ambientTemp");
+        inputs.recuperatorEffectiveness = Get("recuperatorEffectiveness");
+        inputs.combAirTemps = getRange("combAirTemps");
+        inputs.o2FlueGases = getRange("o2FlueGases");
+        inputs.o2CombAirs = getRange("o2CombAirs");
+
+        auto const results = FurnaceEfficiencyOptimizer::optimize(inputs);
+        Local<Array> paretoSet = Nan::New<Array>();
+        for (std::size_t i = 0; i < results.paretoSet.size(); i++)
+        {
+            Nan::Set(paretoSet, static_cast<uint32_t>(i), getCandidate(results.paretoSet[i]));
+        }
+
+        Local<Object> const baseline = getCandidate(results.baseline);
+        r = Nan::New<Object>();
+        Nan::Set(r, Nan::New<String>("baseline").ToLocalChecked(), baseline);
+        Nan::Set(r, Nan::New<String>("paretoSet").ToLocalChecked(), paretoSet);
+        SetR("candidates", results.candidates);
+        SetR("feasibleCandidates", results.feasibleCandidates);
+        info.GetReturnValue().Set(r);
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in furnaceEfficiencyOptimization - phast.h: " + what).c_str());
+    }
+}
+
+/**
+ * Reads a multi-zone furnace object: a charge with the solidChargeMaterials inputs except dischargeTemperature, and a
+ * zones array of furnace objects as for furnaceHeatBalance, each with a grossHeatInput
+ */
+MultiZoneFurnace::Furnace getMultiZoneFurnace(Local<Object> const &furnaceObject)
+{
+    MultiZoneFurnace::Furnace furnace;
+    inp = Nan::To<Object>(Nan::Get(furnaceObject, Nan::New<String>("charge").ToLocalChecked()).ToLocalChecked()).ToLocalChecked();
+    furnace.charge = SolidLoadChargeMaterial(
+            thermicReactionType(), Get("specificHeatSolid"), Get("latentHeat"), Get("specificHeatLiquid"),
+            Get("meltingPoint"), Get("chargeFeedRate"), Get("waterContentCharged"), Get("waterContentDischarged"),
+            Get("initialTemperature"), Get("initialTemperature"), Get("waterVaporDischargeTemperature"),
+            Get("chargeMelted"), Get("chargeReacted"), Get("reactionHeat"), Get("additionalHeat"));
+
+    Local<Array> const zones = Local<Array>::Cast(Nan::Get(furnaceObject, Nan::New<String>("zones").ToLocalChecked()).ToLocalChecked());
+    for (uint32_t i = 0; i < zones->Length(); i++)
+    {
+        Local<Object> const zone = Nan::To<Object>(Nan::Get(zones, i).ToLocalChecked()).ToLocalChecked();
+        FurnaceHeatBalance::Furnace losses = getFurnace(zone);
+        inp = zone;
+        furnace.zones.push_back(MultiZoneFurnace::Zone{std::move(losses), Get("grossHeatInput")});
+    }
+    return furnace;
+}
+
+Local<Object> getMultiZoneFurnaceResults(MultiZoneFurnace::Results const &results)
+{
+    Local<Array> zones = Nan::New<Array>();
+    for (std::size_t i = 0; i < results.zones.size(); i++)
+    {
+        auto const &zone = results.zones[i];
+        r = Nan::New<Object>();
+        SetR("chargeInletTemperature", zone.chargeInletTemperature);
+        SetR("chargeOutletTemperature", zone.chargeOutletTemperature);
+        SetR("walls", zone.walls);
+        SetR("openings", zone.openings);
+        SetR("atmospheres", zone.atmospheres);
+        SetR("totalLosses", zone.totalLosses);
+        SetR("availableHeat", zone.availableHeat);
+        SetR("flueGasLosses", zone.flueGasLosses);
+        SetR("heatToCharge", zone.heatToCharge);
+        Nan::Set(zones, static_cast<uint32_t>(i), r);
+    }
+
+    r = Nan::New<Object>();
+    Nan::Set(r, Nan::New<String>("zones").ToLocalChecked(), zones);
+    SetR("dischargeTemperature", results.dischargeTemperature);
+    SetR("grossHeatInput", results.grossHeatInput);
+    SetR("heatToCharge", results.heatToCharge);
+    SetR("efficiency", results.efficiency);
+    return r;
+}
+
+NAN_METHOD(multiZoneFurnace)
+{
+    /**
+     * Simulates a continuous furnace zone by zone
+     * @param furnaces object or array, a multi-zone furnace or an array of independent ones, simulated in parallel
+     * @return object or array, charge temperatures and heat balance of each zone of each furnace
+     */
+    try
+    {
+        if (!info[0]->IsArray())
+        {
+            auto const results = MultiZoneFurnace::simulate(getMultiZoneFurnace(Nan::To<Object>(info[0]).ToLocalChecked()));
+            info.GetReturnValue().Set(getMultiZoneFurnaceResults(results));
+            return;
+        }
+
+        Local<Array> const furnaceArray = Local<Array>::Cast(info[0]);
+        std::vector<MultiZoneFurnace::Furnace> furnaces;
+        furnaces.reserve(furnaceArray->Length());
+        for (uint32_t i = 0; i < furnaceArray->Length(); i++)
+        {
+            furnaces.push_back(getMultiZoneFurnace(Nan::To<Object>(Nan::Get(furnaceArray, i).ToLocalChecked()).ToLocalChecked()));
+        }
+
+        auto const results = MultiZoneFurnace::simulate(furnaces);
+        Local<Array> resultArray = Nan::New<Array>();
+        for (std::size_t i = 0; i < results.size(); i++)
+        {
+            Nan::Set(resultArray, static_cast<uint32_t>(i), getMultiZoneFurnaceResults(results[i]));
+        }
+        info.GetReturnValue().Set(resultArray);
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in multiZoneFurnace - phast.h: " + what).c_str());
+    }
+}
+
+/**
+ * Reads a heat of an electric arc furnace: tapWeight, coalHeatingValue, electrodeHeatingValue, an optional slags array
+ * of slagOtherMaterialLosses inputs and a samples object of equal length Float64Array columns, one row per logged
+ * sample; the columns are named as the EAFHeatBalance::Sample fields
+ */
+EAFHeatBalance::Heat getEAFHeat(Local<Object> const &heatObject)
+{
+    EAFHeatBalance::Heat heat;
+    inp = heatObject;
+    heat.tapWeight = Get("tapWeight");
+    heat.coalHeatingValue = Get("coalHeatingValue");
+    heat.electrodeHeatingValue = Get("electrodeHeatingValue");
+    forEachItem("slags", heatObject, [&heat]() {
+        heat.slags.emplace_back(Get("weight"), Get("inletTemperature"), Get("outletTemperature"), Get("specificHeat"),
+                                Get("correctionFactor"));
+    });
+
+    Local<Object> const samples = Nan::To<Object>(Nan::Get(heatObject, Nan::New<String>("samples").ToLocalChecked()).ToLocalChecked()).ToLocalChecked();
+    std::vector<Float64Column> const columns = {
+            getFloat64Column("duration", samples), getFloat64Column("electricityInput", samples),
+            getFloat64Column("naturalGasHeatInput", samples), getFloat64Column("coalCarbonInjection", samples),
+            getFloat64Column("electrodeUse", samples), getFloat64Column("otherFuels", samples),
+            getFloat64Column("offGasTemp", samples), getFloat64Column("CO", samples), getFloat64Column("H2", samples),
+            getFloat64Column("combustibleGases", samples), getFloat64Column("vfr", samples),
+            getFloat64Column("dustLoading", samples)};
+    std::size_t const rows = getBatchRowCount(columns, {});
+    heat.samples.reserve(rows);
+    for (std::size_t i = 0; i < rows; i++)
+    {
+        heat.samples.push_back(EAFHeatBalance::Sample{
+                columns[0].data[i], columns[1].data[i], columns[2].data[i], columns[3].data[i], columns[4].data[i],
+                columns[5].data[i], columns[6].data[i], columns[7].data[i], columns[8].data[i], columns[9].data[i],
+                columns[10].data[i], columns[11].data[i]});
+    }
+    return heat;
+}
+
+NAN_METHOD(eafHeatBalance)
+{
+    /**
+     * Integrates the energy in and out of electric arc furnace heats from their logged samples
+     * @param heats array, heats as read by getEAFHeat, evaluated in parallel
+     * @return array, energy balance of each heat in btu, electricity in kWh and kWh/ton tapped
+     */
+    try
+    {
+        Local<Array> const heatArray = Local<Array>::Cast(info[0]);
+        std::vector<EAFHeatBalance::Heat> heats;
+        heats.reserve(heatArray->Length());
+        for (uint32_t i = 0; i < heatArray->Length(); i++)
+        {
+            heats.push_back(getEAFHeat(Nan::To<Object>(Nan::Get(heatArray, i).ToLocalChecked()).ToLocalChecked()));
+        }
+
+        auto const results = EAFHeatBalance::calculate(heats);
+        Local<Array> resultArray = Nan::New<Array>();
+        for (std::size_t i = 0; i < results.size(); i++)
+        {
+            r = Nan::New<Object>();
+            SetR("duration", results[i].duration);
+            SetR("electricityUse", results[i].electricityUse);
+            SetR("chemicalEnergyInput", results[i].chemicalEnergyInput);
+            SetR("totalEnergyInput", results[i].totalEnergyInput);
+            SetR("exhaustGasLosses", results[i].exhaustGasLosses);
+            SetR("slagLosses", results[i].slagLosses);
+            SetR("otherLosses", results[i].otherLosses);
+            SetR("electricityPerTon", results[i].electricityPerTon);
+            SetR("energyPerTon", results[i].energyPerTon);
+            Nan::Set(resultArray, static_cast<uint32_t>(i), r);
+        }
+        info.GetReturnValue().Set(resultArray);
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in eafHeatBalance - phast.h: " + what).c_str());
+    }
+}
+
 #endif //AMO_TOOLS_SUITE_LOSSES_H
@@ -35,6 +35,9 @@ NAN_MODULE_INIT(InitPsat)
     Nan::Set(target, New<String>("resultsExisting").ToLocalChecked(),
              GetFunction(New<FunctionTemplate>(resultsExisting)).ToLocalChecked());
 
+    Nan::Set(target, New<String>("resultsExistingBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(resultsExistingBatch)).ToLocalChecked());
+
     // Nan::Set(target, New<String>("resultsOptimal").ToLocalChecked(),
     //          GetFunction(New<FunctionTemplate>(resultsOptimal)).ToLocalChecked());
 
@@ -46,6 +49,12 @@ NAN_MODULE_INIT(InitPsat)
 
     Nan::Set(target, New<String>("motorCurrent").ToLocalChecked(),
              GetFunction(New<FunctionTemplate>(motorCurrent)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("solverStatistics").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(solverStatistics)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("resetSolverStatistics").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(resetSolverStatistics)).ToLocalChecked());
 }
 
 NODE_MODULE(psat, InitPsat)
\ No newline at end of file
@@ -20,6 +20,8 @@
 #include "calculator/pump/OptimalDeviationFactor.h"
 #include "calculator/pump/HeadTool.h"
 #include "calculator/util/Conversion.h"
+#include "NanTypedArrayConverters.h"
+#include "NanSolverStatistics.h"
 
 using namespace Nan;
 using namespace v8;
@@ -232,6 +234,111 @@ NAN_METHOD(resultsExisting)
     }
 }
 
+// Columnar (batch) version of resultsExisting: info[0] holds one Float64Array per resultsExisting input field (enums
+// as their numeric values; specifiedDriveEfficiency is optional), info[1] holds caller-allocated Float64Arrays
+// for any of the resultsExisting result fields. Returns the number of rows evaluated.
+NAN_METHOD(resultsExistingBatch)
+{
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+    try
+    {
+        auto const pumpStyle = getFloat64Column("pump_style", inputs);
+        auto const pumpSpecified = getFloat64Column("pump_specified", inputs);
+        auto const pumpRatedSpeed = getFloat64Column("pump_rated_speed", inputs);
+        auto const driveType = getFloat64Column("drive", inputs);
+        auto const specifiedDriveEfficiency = getFloat64Column("specifiedDriveEfficiency", inputs, false);
+        auto const specificGravity = getFloat64Column("specific_gravity", inputs);
+        auto const stages = getFloat64Column("stages", inputs);
+        auto const lineFrequency = getFloat64Column("line_frequency", inputs);
+        auto const motorRatedPower = getFloat64Column("motor_rated_power", inputs);
+        auto const motorRatedSpeed = getFloat64Column("motor_rated_speed", inputs);
+        auto const efficiencyClass = getFloat64Column("efficiency_class", inputs);
+        auto const specifiedMotorEfficiency = getFloat64Column("efficiency", inputs);
+        auto const motorRatedVoltage = getFloat64Column("motor_rated_voltage", inputs);
+        auto const motorRatedFLA = getFloat64Column("motor_rated_fla", inputs);
+        auto const flowRate = getFloat64Column("flow_rate", inputs);
+        auto const head = getFloat64Column("head", inputs);
+        auto const loadEstimation = getFloat64Column("load_estimation_method", inputs);
+        auto const motorFieldPower = getFloat64Column("motor_field_power", inputs);
+        auto const motorFieldCurrent = getFloat64Column("motor_field_current", inputs);
+        auto const motorFieldVoltage = getFloat64Column("motor_field_voltage", inputs);
+        auto const operatingHours = getFloat64Column("operating_hours", inputs);
+        auto const costKwHour = getFloat64Column("cost_kw_hour", inputs);
+
+        auto pumpEfficiency = getOutputColumn("pump_efficiency", outputs);
+        auto motorRatedPowerOut = getOutputColumn("motor_rated_power", outputs);
+        auto motorShaftPower = getOutputColumn("motor_shaft_power", outputs);
+        auto pumpShaftPower = getOutputColumn("pump_shaft_power", outputs);
+        auto motorEfficiency = getOutputColumn("motor_efficiency", outputs);
+        auto motorPowerFactor = getOutputColumn("motor_power_factor", outputs);
+        auto motorCurrent = getOutputColumn("motor_current", outputs);
+        auto motorPower = getOutputColumn("motor_power", outputs);
+        auto loadFactor = getOutputColumn("load_factor", outputs);
+        auto driveEfficiency = getOutputColumn("drive_efficiency", outputs);
+        auto annualEnergy = getOutputColumn("annual_energy", outputs);
+        auto annualCost = getOutputColumn("annual_cost", outputs);
+        auto annualSavingsPotential = getOutputColumn("annual_savings_potential", outputs);
+        auto optimizationRating = getOutputColumn("optimization_rating", outputs);
+
+        std::vector<Float64Column> inputColumns = {pumpStyle, pumpSpecified, pumpRatedSpeed, driveType, specificGravity,
+                                                   stages, lineFrequency, motorRatedPower, motorRatedSpeed,
+                                                   efficiencyClass, specifiedMotorEfficiency, motorRatedVoltage,
+                                                   motorRatedFLA, flowRate, head, loadEstimation, motorFieldPower,
+                                                   motorFieldCurrent, motorFieldVoltage, operatingHours, costKwHour};
+        if (specifiedDriveEfficiency.isPresent()) inputColumns.push_back(specifiedDriveEfficiency);
+        std::size_t const rows = getBatchRowCount(inputColumns,
+                                                  {pumpEfficiency, motorRatedPowerOut, motorShaftPower, pumpShaftPower,
+                                                   motorEfficiency, motorPowerFactor, motorCurrent, motorPower,
+                                                   loadFactor, driveEfficiency, annualEnergy, annualCost,
+                                                   annualSavingsPotential, optimizationRating});
+
+        for (std::size_t i = 0; i < rows; ++i)
+        {
+            auto const drive1 = static_cast<Motor::Drive>(static_cast<unsigned>(driveType[i]));
+            double driveEfficiencyInput = 100.0;
+            if (drive1 == Motor::Drive::SPECIFIED && specifiedDriveEfficiency.isPresent())
+            {
+                driveEfficiencyInput = specifiedDriveEfficiency[i];
+            }
+
+            Pump::Input pump(static_cast<Pump::Style>(static_cast<unsigned>(pumpStyle[i])),
+                             Conversion(pumpSpecified[i]).percentToFraction(), pumpRatedSpeed[i], drive1, 0,
+                             specificGravity[i], static_cast<int>(stages[i]), Pump::SpecificSpeed::FIXED_SPEED,
+                             Conversion(driveEfficiencyInput).percentToFraction());
+            Motor motor(static_cast<Motor::LineFrequency>(static_cast<unsigned>(lineFrequency[i])), motorRatedPower[i],
+                        motorRatedSpeed[i], static_cast<Motor::EfficiencyClass>(static_cast<unsigned>(efficiencyClass[i])),
+                        specifiedMotorEfficiency[i], motorRatedVoltage[i], motorRatedFLA[i]);
+            Pump::FieldData fd(flowRate[i], head[i],
+                               static_cast<Motor::LoadEstimationMethod>(static_cast<unsigned>(loadEstimation[i])),
+                               motorFieldPower[i], motorFieldCurrent[i], motorFieldVoltage[i]);
+            PSATResult psat(pump, motor, fd, operatingHours[i], costKwHour[i]);
+
+            auto const ex = psat.calculateExisting();
+            pumpEfficiency.set(i, Conversion(ex.pumpEfficiency).fractionToPercent());
+            motorRatedPowerOut.set(i, ex.motorRatedPower);
+            motorShaftPower.set(i, ex.motorShaftPower);
+            pumpShaftPower.set(i, ex.pumpShaftPower);
+            motorEfficiency.set(i, Conversion(ex.motorEfficiency).fractionToPercent());
+            motorPowerFactor.set(i, Conversion(ex.motorPowerFactor).fractionToPercent());
+            motorCurrent.set(i, ex.motorCurrent);
+            motorPower.set(i, ex.motorPower);
+            loadFactor.set(i, ex.loadFactor);
+            driveEfficiency.set(i, Conversion(ex.driveEfficiency).fractionToPercent());
+            annualEnergy.set(i, ex.annualEnergy);
+            annualCost.set(i, Conversion(ex.annualCost).manualConversion(1000.0));
+            annualSavingsPotential.set(i, Conversion(psat.getAnnualSavingsPotential()).manualConversion(1000.0));
+            optimizationRating.set(i, psat.getOptimizationRating());
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in resultsExistingBatch - psat.h: " + what).c_str());
+    }
+}
+
 NAN_METHOD(resultsModified)
 {
     //NAN initialize data
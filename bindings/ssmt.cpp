@@ -19,6 +19,9 @@ NAN_MODULE_INIT(InitSsmt) {
     Nan::Set(target, New<String>("steamProperties").ToLocalChecked(),
              GetFunction(New<FunctionTemplate>(steamProperties)).ToLocalChecked());
 
+    Nan::Set(target, New<String>("steamPropertiesBatch").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(steamPropertiesBatch)).ToLocalChecked());
+
     Nan::Set(target, New<String>("boiler").ToLocalChecked(),
         GetFunction(New<FunctionTemplate>(boiler)).ToLocalChecked());
 
@@ -48,6 +51,12 @@ NAN_MODULE_INIT(InitSsmt) {
 
     Nan::Set(target, New<String>("steamModeler").ToLocalChecked(),
              GetFunction(New<FunctionTemplate>(steamModeler)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("solverStatistics").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(solverStatistics)).ToLocalChecked());
+
+    Nan::Set(target, New<String>("resetSolverStatistics").ToLocalChecked(),
+             GetFunction(New<FunctionTemplate>(resetSolverStatistics)).ToLocalChecked());
 }
 
 NODE_MODULE(ssmt, InitSsmt)
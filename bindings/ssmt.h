@@ -2,6 +2,8 @@
 #define AMO_TOOLS_SUITE_SSMT_H
 
 #include "NanDataConverters.h"
+#include "NanTypedArrayConverters.h"
+#include "NanSolverStatistics.h"
 
 #include "ssmt/SaturatedProperties.h"
 #include "ssmt/SteamSystemModelerTool.h"
@@ -134,6 +136,50 @@ NAN_METHOD(steamProperties) {
     info.GetReturnValue().Set(r);
 }
 
+/**
+ * Columnar version of steamProperties: info[0] holds Float64Arrays pressure, thermodynamicQuantity and quantityValue;
+ * info[1] holds caller-allocated Float64Arrays for any of the steamProperties result fields.
+ * Returns the number of rows evaluated.
+ */
+NAN_METHOD(steamPropertiesBatch) {
+    Local<Object> const inputs = Nan::To<Object>(info[0]).ToLocalChecked();
+    Local<Object> const outputs = Nan::To<Object>(info[1]).ToLocalChecked();
+
+    try {
+        auto const pressure = getFloat64Column("pressure", inputs);
+        auto const quantity = getFloat64Column("thermodynamicQuantity", inputs);
+        auto const quantityValue = getFloat64Column("quantityValue", inputs);
+
+        auto pressureOut = getOutputColumn("pressure", outputs);
+        auto temperature = getOutputColumn("temperature", outputs);
+        auto specificEnthalpy = getOutputColumn("specificEnthalpy", outputs);
+        auto specificEntropy = getOutputColumn("specificEntropy", outputs);
+        auto quality = getOutputColumn("quality", outputs);
+        auto specificVolume = getOutputColumn("specificVolume", outputs);
+
+        std::size_t const rows = getBatchRowCount({pressure, quantity, quantityValue},
+                                                  {pressureOut, temperature, specificEnthalpy, specificEntropy,
+                                                   quality, specificVolume});
+        for (std::size_t i = 0; i < rows; ++i) {
+            auto const thermodynamicQuantity = static_cast<SteamProperties::ThermodynamicQuantity>(
+                    static_cast<unsigned>(quantity[i]));
+            SteamSystemModelerTool::SteamPropertiesOutput const results =
+                    SteamProperties(pressure[i], thermodynamicQuantity, quantityValue[i]).calculate();
+
+            pressureOut.set(i, results.pressure);
+            temperature.set(i, results.temperature);
+            specificEnthalpy.set(i, results.specificEnthalpy);
+            specificEntropy.set(i, results.specificEntropy);
+            quality.set(i, results.quality);
+            specificVolume.set(i, results.specificVolume);
+        }
+        info.GetReturnValue().Set(Nan::New<Number>(rows));
+    } catch (std::runtime_error const &e) {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in steamPropertiesBatch - ssmt.h: " + what).c_str());
+    }
+}
+
 NAN_METHOD(boiler) {
     inp = Nan::To<Object>(info[0]).ToLocalChecked();
     r = Nan::New<Object>();
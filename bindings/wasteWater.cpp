@@ -6,6 +6,10 @@ using namespace Nan;
 NAN_MODULE_INIT(InitWasteWater) {
 	Nan::Set(target, New<String>("WasteWaterTreatment").ToLocalChecked(),
 	         GetFunction(New<FunctionTemplate>(WasteWaterTreatment)).ToLocalChecked());
+	Nan::Set(target, New<String>("WasteWaterTreatmentBatch").ToLocalChecked(),
+	         GetFunction(New<FunctionTemplate>(WasteWaterTreatmentBatch)).ToLocalChecked());
+	Nan::Set(target, New<String>("WasteWaterAerationOptimization").ToLocalChecked(),
+	         GetFunction(New<FunctionTemplate>(WasteWaterAerationOptimization)).ToLocalChecked());
 }
 
 NODE_MODULE(wasteWater, InitWasteWater)
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <nan.h>
 #include <node.h>
 #include "wasteWater/WasteWater_Treatment.h"
+#include "wasteWater/WasteWaterAerationOptimizer.h"
 #include <string>
 #include <array>
 #include <vector>
@@ -17,11 +18,8 @@ using namespace v8;
 // Local<Object> inp;
 // Local<Object> r;
 
-NAN_METHOD(WasteWaterTreatment)
+WasteWater_Treatment getWasteWaterTreatment(Local<Object> inp)
 {
-    inp = Nan::To<Object>(info[0]).ToLocalChecked();
-    r = Nan::New<Object>();
-
     const double Temperature = getDouble("Temperature", inp);
     const double So = getDouble("So", inp);
     const double Volume = getDouble("Volume", inp);
@@ -51,70 +49,81 @@ NAN_METHOD(WasteWaterTreatment)
     const int TypeAerators = getInteger("TypeAerators", inp);
     const double Speed = getDouble("Speed", inp);
     const double EnergyCostUnit = getDouble("EnergyCostUnit", inp);
+    return WasteWater_Treatment(Temperature,
+                                So,
+                                Volume,
+                                FlowRate,
+                                InertVSS,
+                                OxidizableN,
+                                Biomass,
+                                InfluentTSS,
+                                InertInOrgTSS,
+                                EffluentTSS,
+                                RASTSS,
+                                MLSSpar,
+                                FractionBiomass,
+                                BiomassYeild,
+                                HalfSaturation,
+                                MicrobialDecay,
+                                MaxUtilizationRate,
+                                MaxDays,
+                                TimeIncrement,
+                                OperatingDO,
+                                Alpha,
+                                Beta,
+                                SOTR,
+                                Aeration,
+                                Elevation,
+                                OperatingTime,
+                                TypeAerators,
+                                Speed,
+                                EnergyCostUnit);
+}
+
+void setWasteWaterTreatmentOutput(WasteWater_Treatment::Output const &output, Local<Object> obj)
+{
+    setRobject("TotalAverageDailyFlowRate", output.TotalAverageDailyFlowRate, obj);
+    setRobject("VolumeInService", output.VolumeInService, obj);
+    setRobject("InfluentBOD5Concentration", output.InfluentBOD5Concentration, obj);
+    setRobject("InfluentBOD5MassLoading", output.InfluentBOD5MassLoading, obj);
+    setRobject("SecWWOxidNLoad", output.SecWWOxidNLoad, obj);
+    setRobject("SecWWTSSLoad", output.SecWWTSSLoad, obj);
+    setRobject("FM_ratio", output.FM_ratio, obj);
+    setRobject("SolidsRetentionTime", output.SolidsRetentionTime, obj);
+    setRobject("MLSS", output.MLSS, obj);
+    setRobject("MLVSS", output.MLVSS, obj);
+    setRobject("TSSSludgeProduction", output.TSSSludgeProduction, obj);
+    setRobject("TSSInActivatedSludgeEffluent", output.TSSInActivatedSludgeEffluent, obj);
+    setRobject("TotalOxygenRequirements", output.TotalOxygenRequirements, obj);
+    setRobject("TotalOxygenReqWDenit", output.TotalOxygenReqWDenit, obj);
+    setRobject("TotalOxygenSupplied", output.TotalOxygenSupplied, obj);
+    setRobject("MixingIntensityInReactor", output.MixingIntensityInReactor, obj);
+    setRobject("RASFlowRate", output.RASFlowRate, obj);
+    setRobject("RASRecyclePercentage", output.RASRecyclePercentage, obj);
+    setRobject("WASFlowRate", output.WASFlowRate, obj);
+    setRobject("RASTSSConcentration", output.RASTSSConcentration, obj);
+    setRobject("TotalSludgeProduction", output.TotalSludgeProduction, obj);
+    setRobject("ReactorDetentionTime", output.ReactorDetentionTime, obj);
+    setRobject("VOLR", output.VOLR, obj);
+    setRobject("EffluentCBOD5", output.EffluentCBOD5, obj);
+    setRobject("EffluentTSS", output.EffluentTSS, obj);
+    setRobject("EffluentAmmonia_N", output.EffluentAmmonia_N, obj);
+    setRobject("EffluentNO3_N", output.EffluentNO3_N, obj);
+    setRobject("EffluentNO3_N_W_Denit", output.EffluentNO3_N_W_Denit, obj);
+    setRobject("AeEnergy", output.AeEnergy, obj);
+    setRobject("AeCost", output.AeCost, obj);
+    setRobject("FieldOTR", output.FieldOTR, obj);
+}
+
+NAN_METHOD(WasteWaterTreatment)
+{
+    inp = Nan::To<Object>(info[0]).ToLocalChecked();
+    r = Nan::New<Object>();
+
     try
     {
-        auto wwTreatment = WasteWater_Treatment(Temperature,
-                                              So,
-                                              Volume,
-                                              FlowRate,
-                                              InertVSS,
-                                              OxidizableN,
-                                              Biomass,
-                                              InfluentTSS,
-                                              InertInOrgTSS,
-                                              EffluentTSS,
-                                              RASTSS,
-                                              MLSSpar,
-                                              FractionBiomass,
-                                              BiomassYeild,
-                                              HalfSaturation,
-                                              MicrobialDecay,
-                                              MaxUtilizationRate,
-                                              MaxDays,
-                                              TimeIncrement,
-                                              OperatingDO,
-                                              Alpha,
-                                              Beta,
-                                              SOTR,
-                                              Aeration,
-                                              Elevation,
-                                              OperatingTime,
-                                              TypeAerators,
-                                              Speed,
-                                              EnergyCostUnit);
-        WasteWater_Treatment::Output output = wwTreatment.calculate();
-
-        setR("TotalAverageDailyFlowRate", output.TotalAverageDailyFlowRate);
-        setR("VolumeInService", output.VolumeInService);
-        setR("InfluentBOD5Concentration", output.InfluentBOD5Concentration);
-        setR("InfluentBOD5MassLoading", output.InfluentBOD5MassLoading);
-        setR("SecWWOxidNLoad", output.SecWWOxidNLoad);
-        setR("SecWWTSSLoad", output.SecWWTSSLoad);
-        setR("FM_ratio", output.FM_ratio);
-        setR("SolidsRetentionTime", output.SolidsRetentionTime);
-        setR("MLSS", output.MLSS);
-        setR("MLVSS", output.MLVSS);
-        setR("TSSSludgeProduction", output.TSSSludgeProduction);
-        setR("TSSInActivatedSludgeEffluent", output.TSSInActivatedSludgeEffluent);
-        setR("TotalOxygenRequirements", output.TotalOxygenRequirements);
-        setR("TotalOxygenReqWDenit", output.TotalOxygenReqWDenit);
-        setR("TotalOxygenSupplied", output.TotalOxygenSupplied);
-        setR("MixingIntensityInReactor", output.MixingIntensityInReactor);
-        setR("RASFlowRate", output.RASFlowRate);
-        setR("RASRecyclePercentage", output.RASRecyclePercentage);
-        setR("WASFlowRate", output.WASFlowRate);
-        setR("RASTSSConcentration", output.RASTSSConcentration);
-        setR("TotalSludgeProduction", output.TotalSludgeProduction);
-        setR("ReactorDetentionTime", output.ReactorDetentionTime);
-        setR("VOLR", output.VOLR);
-        setR("EffluentCBOD5", output.EffluentCBOD5);
-        setR("EffluentTSS", output.EffluentTSS);
-        setR("EffluentAmmonia_N", output.EffluentAmmonia_N);
-        setR("EffluentNO3_N", output.EffluentNO3_N);
-        setR("EffluentNO3_N_W_Denit", output.EffluentNO3_N_W_Denit);
-        setR("AeEnergy", output.AeEnergy);
-        setR("AeCost", output.AeCost);
-        setR("FieldOTR", output.FieldOTR);
+        WasteWater_Treatment::Output output = getWasteWaterTreatment(inp).calculate();
+        setWasteWaterTreatmentOutput(output, r);
 
         auto calculationsTable = output.calculationsTable;
         auto ctArrayTable = New<Array>(calculationsTable.size());
@@ -136,4 +145,92 @@ NAN_METHOD(WasteWaterTreatment)
     }
     info.GetReturnValue().Set(r);
 }
+
+NAN_METHOD(WasteWaterTreatmentBatch)
+{
+    inp = Nan::To<Object>(info[0]).ToLocalChecked();
+
+    try
+    {
+        Local<Array> scenarioArray = getArray("scenarios", inp);
+        std::vector<WasteWater_Treatment> scenarios;
+        for (unsigned i = 0; i < scenarioArray->Length(); i++)
+            scenarios.push_back(getWasteWaterTreatment(Nan::To<Object>(Nan::Get(scenarioArray, i).ToLocalChecked()).ToLocalChecked()));
+
+        auto const outputs = WasteWater_Treatment::calculate(scenarios);
+        auto results = New<Array>(outputs.size());
+        for (unsigned i = 0; i < outputs.size(); i++)
+        {
+            auto obj = Nan::New<Object>();
+            setWasteWaterTreatmentOutput(outputs[i], obj);
+            Nan::Set(results, i, obj);
+        }
+        info.GetReturnValue().Set(results);
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in WasteWaterTreatmentBatch - wasteWater.h: " + what).c_str());
+    }
+}
+
+WasteWaterAerationOptimizer::Range getAerationRange(std::string const &name, Local<Object> obj)
+{
+    Local<Object> range = getObject(name, obj);
+    return {getDouble("minimum", range), getDouble("maximum", range), getDouble("step", range)};
+}
+
+Local<Object> getAerationCandidate(WasteWaterAerationOptimizer::Candidate const &candidate)
+{
+    Local<Object> obj = Nan::New<Object>();
+    setRobject("Speed", candidate.Speed, obj);
+    setRobject("OperatingTime", candidate.OperatingTime, obj);
+    setRobject("OperatingDO", candidate.OperatingDO, obj);
+    setRobject("MLSSpar", candidate.MLSSpar, obj);
+    setRobject("SolidsRetentionTime", candidate.SolidsRetentionTime, obj);
+    setRobject("MLSS", candidate.MLSS, obj);
+    setRobject("EffluentCBOD5", candidate.EffluentCBOD5, obj);
+    setRobject("EffluentAmmonia_N", candidate.EffluentAmmonia_N, obj);
+    setRobject("TotalOxygenSupplied", candidate.TotalOxygenSupplied, obj);
+    setRobject("OxygenRequired", candidate.OxygenRequired, obj);
+    setRobject("AeEnergy", candidate.AeEnergy, obj);
+    setRobject("AeCost", candidate.AeCost, obj);
+    return obj;
+}
+
+NAN_METHOD(WasteWaterAerationOptimization)
+{
+    inp = Nan::To<Object>(info[0]).ToLocalChecked();
+    r = Nan::New<Object>();
+
+    try
+    {
+        const WasteWater_Treatment plant = getWasteWaterTreatment(getObject("plant", inp));
+        WasteWaterAerationOptimizer::Inputs inputs;
+        inputs.speeds = getAerationRange("speeds", inp);
+        inputs.operatingTimes = getAerationRange("operatingTimes", inp);
+        inputs.operatingDOs = getAerationRange("operatingDOs", inp);
+        inputs.MLSSpars = getAerationRange("MLSSpars", inp);
+        inputs.maxEffluentCBOD5 = getDouble("maxEffluentCBOD5", inp);
+        inputs.maxEffluentAmmonia_N = getDouble("maxEffluentAmmonia_N", inp);
+        inputs.minMLSS = getDouble("minMLSS", inp);
+        inputs.maxMLSS = getDouble("maxMLSS", inp);
+        inputs.denitrification = getBool("denitrification", inp);
+
+        auto const results = WasteWaterAerationOptimizer::optimize(plant, inputs);
+        Nan::Set(r, New("baseline").ToLocalChecked(), getAerationCandidate(results.baseline));
+        auto paretoSet = New<Array>(results.paretoSet.size());
+        for (unsigned i = 0; i < results.paretoSet.size(); i++)
+            Nan::Set(paretoSet, i, getAerationCandidate(results.paretoSet[i]));
+        Nan::Set(r, New("paretoSet").ToLocalChecked(), paretoSet);
+        setR("candidates", results.candidates);
+        setR("feasibleCandidates", results.feasibleCandidates);
+    }
+    catch (std::runtime_error const &e)
+    {
+        std::string const what = e.what();
+        ThrowError(std::string("std::runtime_error thrown in WasteWaterAerationOptimization - wasteWater.h: " + what).c_str());
+    }
+    info.GetReturnValue().Set(r);
+}
 #endif //AMO_TOOLS_SUITE_WASTEWATER_H
\ No newline at end of file
@@ -0,0 +1,196 @@
+#ifndef AMO_TOOLS_SUITE_BATCHCALCULATOR_H
+#define AMO_TOOLS_SUITE_BATCHCALCULATOR_H
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Field names of the input records, shared by every record that has the same fields in the same order (all of the
+ * rows of a CSV file, consecutive NDJSON lines written by the same producer).
+ */
+struct BatchColumns {
+    explicit BatchColumns(std::vector<std::string> names) : names(std::move(names)) {
+        for (std::size_t i = 0; i < this->names.size(); i++) indexes[this->names[i]] = i;
+    }
+
+    std::vector<std::string> names;
+    std::unordered_map<std::string, std::size_t> indexes;
+};
+
+/**
+ * One input record. The field names are those of the corresponding Node binding input object, so records exported
+ * for the bindings can be fed to the command line tool as they are.
+ */
+class BatchRecord {
+public:
+    BatchRecord() = default;
+
+    BatchRecord(std::shared_ptr<const BatchColumns> columns, std::vector<std::string> values, const std::size_t number)
+            : columns(std::move(columns)), values(std::move(values)), number(number) {}
+
+    /**
+     * @return std::size_t, 1 based position of the record in the input
+     */
+    std::size_t getNumber() const { return number; }
+
+    /**
+     * @param name std::string, field name
+     * @return bool, true when the record has the field, blank or not
+     */
+    bool has(const std::string &name) const {
+        auto const it = columns->indexes.find(name);
+        return it != columns->indexes.end() && it->second < values.size();
+    }
+
+    /**
+     * @param name std::string, field name
+     * @return std::string, raw field value
+     */
+    const std::string &getString(const std::string &name) const {
+        auto const it = columns->indexes.find(name);
+        if (it == columns->indexes.end() || it->second >= values.size()) {
+            throw std::runtime_error("field '" + name + "' is missing");
+        }
+        return values[it->second];
+    }
+
+    /**
+     * @param name std::string, field name
+     * @return double, field value; NaN when the field is blank (or JSON null)
+     */
+    double getDouble(const std::string &name) const {
+        const std::string &value = getString(name);
+        if (value.empty()) return std::numeric_limits<double>::quiet_NaN();
+
+        char *end = nullptr;
+        const double result = std::strtod(value.c_str(), &end);
+        while (end != nullptr && std::isspace(static_cast<unsigned char>(*end))) end++;
+        if (end == value.c_str() || *end != '\0') {
+            throw std::runtime_error("field '" + name + "' is not a number: '" + value + "'");
+        }
+        return result;
+    }
+
+    /**
+     * @param name std::string, field name
+     * @return int, field value, which must be a whole number
+     */
+    int getInteger(const std::string &name) const {
+        const double value = getDouble(name);
+        if (std::isnan(value) || value != std::floor(value)) {
+            throw std::runtime_error("field '" + name + "' is not a whole number: '" + getString(name) + "'");
+        }
+        return static_cast<int>(value);
+    }
+
+    /**
+     * Same as the bindings' getBoolFromString: "true" or "yes", case insensitive; "1" is accepted as well.
+     * @param name std::string, field name
+     * @return bool, field value
+     */
+    bool getBool(const std::string &name) const {
+        std::string lower(getString(name));
+        for (auto &c : lower) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        return lower == "true" || lower == "yes" || lower == "1";
+    }
+
+    /**
+     * @param name std::string, field name
+     * @return T, enum field given as its numeric value, as in the bindings' GetEnumVal
+     */
+    template<typename T>
+    T getEnum(const std::string &name) const {
+        return static_cast<T>(getInteger(name));
+    }
+
+private:
+    std::shared_ptr<const BatchColumns> columns;
+    std::vector<std::string> values;
+    std::size_t number = 0;
+};
+
+/**
+ * Evaluates one record. The calculation writes one value per output name into results, which is presized and
+ * filled with NaN; a value left at NaN is written as a blank (CSV) or null (JSON) result.
+ * Errors are reported by throwing, the message ends up in the error field of the record's result.
+ */
+typedef std::function<void(const BatchRecord &record, std::vector<double> &results)> BatchEvaluate;
+
+/**
+ * A calculator the command line tool can run over a stream of records.
+ */
+struct BatchCalculator {
+    BatchCalculator(std::string family, std::string name, std::string description, std::vector<std::string> inputs,
+                    std::function<std::vector<std::string>()> outputs, BatchEvaluate evaluate)
+            : family(std::move(family)), name(std::move(name)), description(std::move(description)),
+              inputs(std::move(inputs)), outputs(std::move(outputs)), evaluate(std::move(evaluate)) {}
+
+    std::string family;
+    std::string name;
+    std::string description;
+    std::vector<std::string> inputs; ///< input field names, for the usage text only
+    std::function<std::vector<std::string>()> outputs; ///< output field names, the same for every record
+    BatchEvaluate evaluate;
+};
+
+/**
+ * Holds every calculator registered by the *.cli.cpp translation units.
+ */
+class BatchCalculatorRegistry {
+public:
+    static BatchCalculatorRegistry &instance() {
+        static BatchCalculatorRegistry registry;
+        return registry;
+    }
+
+    void add(BatchCalculator calculator) { calculators.push_back(std::move(calculator)); }
+
+    const std::vector<BatchCalculator> &getCalculators() const { return calculators; }
+
+    /**
+     * @param name std::string, calculator name
+     * @return const BatchCalculator *, nullptr when there is no calculator with the name
+     */
+    const BatchCalculator *find(const std::string &name) const {
+        for (auto const &calculator : calculators) {
+            if (calculator.name == name) return &calculator;
+        }
+        return nullptr;
+    }
+
+private:
+    BatchCalculatorRegistry() = default;
+
+    std::vector<BatchCalculator> calculators;
+};
+
+/**
+ * Registers a calculator during static initialization, declare one per calculator at namespace scope.
+ */
+struct BatchCalculatorRegistrar {
+    BatchCalculatorRegistrar(std::string family, std::string name, std::string description,
+                             std::vector<std::string> inputs, std::vector<std::string> outputs, BatchEvaluate evaluate) {
+        auto const outputNames = std::make_shared<const std::vector<std::string>>(std::move(outputs));
+        BatchCalculatorRegistry::instance().add(
+                BatchCalculator(std::move(family), std::move(name), std::move(description), std::move(inputs),
+                                [outputNames] { return *outputNames; }, std::move(evaluate)));
+    }
+
+    BatchCalculatorRegistrar(std::string family, std::string name, std::string description,
+                             std::vector<std::string> inputs, std::function<std::vector<std::string>()> outputs,
+                             BatchEvaluate evaluate) {
+        BatchCalculatorRegistry::instance().add(
+                BatchCalculator(std::move(family), std::move(name), std::move(description), std::move(inputs),
+                                std::move(outputs), std::move(evaluate)));
+    }
+};
+
+#endif //AMO_TOOLS_SUITE_BATCHCALCULATOR_H
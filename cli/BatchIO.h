@@ -0,0 +1,350 @@
+#ifndef AMO_TOOLS_SUITE_BATCHIO_H
+#define AMO_TOOLS_SUITE_BATCHIO_H
+
+#include "BatchCalculator.h"
+#include <calculator/util/CsvLine.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Streams input records one line at a time, so inputs of any size are read with a constant amount of memory.
+ */
+class BatchRecordReader {
+public:
+    explicit BatchRecordReader(std::unique_ptr<io::LineReader> lines) : lines(std::move(lines)) {}
+
+    virtual ~BatchRecordReader() = default;
+
+    /**
+     * @param record BatchRecord, set to the next record
+     * @return bool, false at the end of the input
+     */
+    virtual bool next(BatchRecord &record) = 0;
+
+protected:
+    /**
+     * @return char *, the next non blank line, nullptr at the end of the input
+     */
+    char *nextLine() {
+        while (char *line = lines->next_line()) {
+            const char *c = line;
+            while (*c == ' ' || *c == '\t' || *c == '\r') c++;
+            if (*c != '\0') return line;
+        }
+        return nullptr;
+    }
+
+    std::string where() const {
+        return std::string(lines->get_truncated_file_name()) + " line " + std::to_string(lines->get_file_line());
+    }
+
+    std::unique_ptr<io::LineReader> lines;
+    std::size_t count = 0;
+};
+
+/**
+ * CSV with a header row naming the fields; values may be double quoted, as written by spreadsheets.
+ */
+class CsvRecordReader : public BatchRecordReader {
+public:
+    explicit CsvRecordReader(std::unique_ptr<io::LineReader> lines) : BatchRecordReader(std::move(lines)) {
+        char *header = nextLine();
+        if (header == nullptr) throw std::runtime_error("CsvRecordReader: " + where() + ": no header row");
+        columns = std::make_shared<const BatchColumns>(CsvLine::split(header));
+    }
+
+    bool next(BatchRecord &record) override {
+        char *line = nextLine();
+        if (line == nullptr) return false;
+
+        std::vector<std::string> values = CsvLine::split(line);
+        if (values.size() != columns->names.size()) {
+            throw std::runtime_error("CsvRecordReader: " + where() + " has " + std::to_string(values.size())
+                                     + " columns, expected " + std::to_string(columns->names.size()));
+        }
+        record = BatchRecord(columns, std::move(values), ++count);
+        return true;
+    }
+
+private:
+    std::shared_ptr<const BatchColumns> columns;
+};
+
+/**
+ * Newline delimited JSON, one flat object per line. Strings, numbers, booleans and null are accepted as values;
+ * consecutive lines with the same keys in the same order share their field names.
+ */
+class NdjsonRecordReader : public BatchRecordReader {
+public:
+    explicit NdjsonRecordReader(std::unique_ptr<io::LineReader> lines) : BatchRecordReader(std::move(lines)) {}
+
+    bool next(BatchRecord &record) override {
+        const char *line = nextLine();
+        if (line == nullptr) return false;
+
+        names.clear();
+        std::vector<std::string> values;
+        parseObject(line, values);
+
+        if (!columns || columns->names != names) columns = std::make_shared<const BatchColumns>(names);
+        record = BatchRecord(columns, std::move(values), ++count);
+        return true;
+    }
+
+private:
+    void parseObject(const char *c, std::vector<std::string> &values) {
+        skipSpace(c);
+        expect(c, '{');
+        skipSpace(c);
+        if (*c == '}') return;
+
+        while (true) {
+            skipSpace(c);
+            if (*c != '"') fail("expected a key");
+            names.push_back(parseString(c));
+            skipSpace(c);
+            expect(c, ':');
+            skipSpace(c);
+            values.push_back(parseValue(c));
+            skipSpace(c);
+            if (*c == ',') {
+                c++;
+                continue;
+            }
+            expect(c, '}');
+            skipSpace(c);
+            if (*c != '\0') fail("unexpected characters after the object");
+            return;
+        }
+    }
+
+    std::string parseValue(const char *&c) {
+        if (*c == '"') return parseString(c);
+        if (*c == '{' || *c == '[') fail("nested objects and arrays are not supported");
+
+        const char *begin = c;
+        while (*c != '\0' && *c != ',' && *c != '}' && *c != ' ' && *c != '\t' && *c != '\r') c++;
+        const std::string literal(begin, c);
+        if (literal == "null") return "";
+        if (literal == "true" || literal == "false") return literal;
+
+        char *end = nullptr;
+        std::strtod(literal.c_str(), &end);
+        if (literal.empty() || *end != '\0') fail("invalid value '" + literal + "'");
+        return literal;
+    }
+
+    std::string parseString(const char *&c) {
+        expect(c, '"');
+        std::string result;
+        while (*c != '"') {
+            if (*c == '\0') fail("unterminated string");
+            if (*c != '\\') {
+                result += *c++;
+                continue;
+            }
+            c++;
+            switch (*c++) {
+                case '"': result += '"'; break;
+                case '\\': result += '\\'; break;
+                case '/': result += '/'; break;
+                case 'b': result += '\b'; break;
+                case 'f': result += '\f'; break;
+                case 'n': result += '\n'; break;
+                case 'r': result += '\r'; break;
+                case 't': result += '\t'; break;
+                case 'u': appendCodePoint(c, result); break;
+                default: fail("invalid escape sequence");
+            }
+        }
+        c++;
+        return result;
+    }
+
+    void appendCodePoint(const char *&c, std::string &result) {
+        unsigned codePoint = 0;
+        for (int i = 0; i < 4; i++, c++) {
+            const char h = *c;
+            codePoint <<= 4;
+            if (h >= '0' && h <= '9') codePoint |= h - '0';
+            else if (h >= 'a' && h <= 'f') codePoint |= h - 'a' + 10;
+            else if (h >= 'A' && h <= 'F') codePoint |= h - 'A' + 10;
+            else fail("invalid \\u escape");
+        }
+        // UTF-8 encoding; surrogate pairs are not combined, which only matters for names and text, never numbers
+        if (codePoint < 0x80) {
+            result += static_cast<char>(codePoint);
+        } else if (codePoint < 0x800) {
+            result += static_cast<char>(0xC0 | (codePoint >> 6));
+            result += static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else {
+            result += static_cast<char>(0xE0 | (codePoint >> 12));
+            result += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            result += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    static void skipSpace(const char *&c) {
+        while (*c == ' ' || *c == '\t' || *c == '\r') c++;
+    }
+
+    void expect(const char *&c, const char expected) {
+        if (*c != expected) fail(std::string("expected '") + expected + "'");
+        c++;
+    }
+
+    void fail(const std::string &message) const {
+        throw std::runtime_error("NdjsonRecordReader: " + where() + ": " + message);
+    }
+
+    std::vector<std::string> names;
+    std::shared_ptr<const BatchColumns> columns;
+};
+
+/**
+ * Formats the result of one record as one line of output. Formatting runs on the worker threads, only the finished
+ * lines are written in input order.
+ */
+class BatchResultFormatter {
+public:
+    /**
+     * @param outputs std::vector<std::string>, output field names of the calculator
+     * @param passthrough std::vector<std::string>, input fields copied to the output ahead of the results
+     */
+    BatchResultFormatter(std::vector<std::string> outputs, std::vector<std::string> passthrough)
+            : outputs(std::move(outputs)), passthrough(std::move(passthrough)) {}
+
+    virtual ~BatchResultFormatter() = default;
+
+    /**
+     * @return std::string, written once ahead of the results, may be empty
+     */
+    virtual std::string header() const = 0;
+
+    /**
+     * @param record BatchRecord, the input record
+     * @param results std::vector<double>, one value per output field, NaN when there is no value
+     * @param error std::string, empty when the calculation succeeded
+     * @return std::string, one line of output including the line end
+     */
+    virtual std::string format(const BatchRecord &record, const std::vector<double> &results,
+                               const std::string &error) const = 0;
+
+    /**
+     * Shortest decimal form that reads back as the same double, as JavaScript prints numbers.
+     * @param value double, finite value
+     * @param buffer char *, at least 32 characters
+     * @return int, length of the text
+     */
+    static int formatNumber(const double value, char *buffer) {
+        int length = std::snprintf(buffer, 32, "%.15g", value);
+        if (std::strtod(buffer, nullptr) != value) length = std::snprintf(buffer, 32, "%.17g", value);
+        return length;
+    }
+
+protected:
+    std::vector<std::string> outputs;
+    std::vector<std::string> passthrough;
+};
+
+/**
+ * CSV output: record number, passthrough fields, results and error message; values that are not present are blank.
+ */
+class CsvResultFormatter : public BatchResultFormatter {
+public:
+    using BatchResultFormatter::BatchResultFormatter;
+
+    std::string header() const override {
+        std::string line = "record";
+        for (auto const &name : passthrough) line += "," + quote(name);
+        for (auto const &name : outputs) line += "," + quote(name);
+        return line + ",error\n";
+    }
+
+    std::string format(const BatchRecord &record, const std::vector<double> &results,
+                       const std::string &error) const override {
+        std::string line = std::to_string(record.getNumber());
+        for (auto const &name : passthrough) {
+            line += ',';
+            if (record.has(name)) line += quote(record.getString(name));
+        }
+        char buffer[32];
+        for (auto const value : results) {
+            line += ',';
+            if (std::isfinite(value)) line.append(buffer, static_cast<std::size_t>(formatNumber(value, buffer)));
+        }
+        return line + "," + quote(error) + "\n";
+    }
+
+private:
+    static std::string quote(const std::string &value) {
+        if (value.find_first_of(",\"\r\n") == std::string::npos) return value;
+        std::string quoted = "\"";
+        for (auto const c : value) {
+            if (c == '"') quoted += '"';
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
+};
+
+/**
+ * Newline delimited JSON output, one object per record; values that are not present are null and the error key is
+ * only written for records that failed.
+ */
+class NdjsonResultFormatter : public BatchResultFormatter {
+public:
+    using BatchResultFormatter::BatchResultFormatter;
+
+    std::string header() const override { return ""; }
+
+    std::string format(const BatchRecord &record, const std::vector<double> &results,
+                       const std::string &error) const override {
+        std::string line = "{\"record\":" + std::to_string(record.getNumber());
+        for (auto const &name : passthrough) {
+            line += "," + quote(name) + ":";
+            line += record.has(name) ? quote(record.getString(name)) : "null";
+        }
+        char buffer[32];
+        for (std::size_t i = 0; i < outputs.size(); i++) {
+            line += "," + quote(outputs[i]) + ":";
+            if (std::isfinite(results[i])) {
+                line.append(buffer, static_cast<std::size_t>(formatNumber(results[i], buffer)));
+            } else {
+                line += "null";
+            }
+        }
+        if (!error.empty()) line += ",\"error\":" + quote(error);
+        return line + "}\n";
+    }
+
+private:
+    static std::string quote(const std::string &value) {
+        std::string quoted = "\"";
+        for (auto const c : value) {
+            switch (c) {
+                case '"': quoted += "\\\""; break;
+                case '\\': quoted += "\\\\"; break;
+                case '\n': quoted += "\\n"; break;
+                case '\r': quoted += "\\r"; break;
+                case '\t': quoted += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char escape[8];
+                        std::snprintf(escape, sizeof(escape), "\\u%04x", static_cast<unsigned>(c));
+                        quoted += escape;
+                    } else {
+                        quoted += c;
+                    }
+            }
+        }
+        return quoted + "\"";
+    }
+};
+
+#endif //AMO_TOOLS_SUITE_BATCHIO_H
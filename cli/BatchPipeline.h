@@ -0,0 +1,200 @@
+#ifndef AMO_TOOLS_SUITE_BATCHPIPELINE_H
+#define AMO_TOOLS_SUITE_BATCHPIPELINE_H
+
+#include "BatchCalculator.h"
+#include "BatchIO.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+struct BatchPipelineSettings {
+    unsigned threads = 1;
+    std::size_t chunkSize = 256; ///< records evaluated by a worker at a time
+    std::size_t chunksInFlight = 0; ///< chunks read but not yet written, 0 for 4 per thread
+};
+
+struct BatchPipelineSummary {
+    std::size_t records = 0;
+    std::size_t errors = 0;
+};
+
+/**
+ * Reads records on one thread, evaluates them in chunks on a pool of worker threads and writes the results in input
+ * order on the calling thread. At most chunksInFlight chunks exist at any time, so memory use does not grow with
+ * the size of the input.
+ */
+class BatchPipeline {
+public:
+    /**
+     * @param reader BatchRecordReader, the input
+     * @param calculator BatchCalculator, evaluates each record
+     * @param formatter BatchResultFormatter, formats each result
+     * @param out std::ostream, receives the header and one line per record
+     * @param settings BatchPipelineSettings
+     * @return BatchPipelineSummary, number of records and of records that failed
+     */
+    static BatchPipelineSummary run(BatchRecordReader &reader, const BatchCalculator &calculator,
+                                    const BatchResultFormatter &formatter, std::ostream &out,
+                                    const BatchPipelineSettings &settings) {
+        BatchPipeline pipeline(settings);
+        const std::size_t outputCount = calculator.outputs().size();
+        out << formatter.header();
+
+        std::thread readerThread([&pipeline, &reader] { pipeline.read(reader); });
+        std::vector<std::thread> workers;
+        for (unsigned i = 0; i < pipeline.threads; i++) {
+            workers.emplace_back([&pipeline, &calculator, &formatter, outputCount] {
+                pipeline.work(calculator.evaluate, formatter, outputCount);
+            });
+        }
+
+        BatchPipelineSummary summary;
+        try {
+            pipeline.write(out, summary);
+        } catch (...) {
+            pipeline.abort(std::current_exception());
+        }
+
+        readerThread.join();
+        for (auto &worker : workers) worker.join();
+        if (pipeline.failure) std::rethrow_exception(pipeline.failure);
+        return summary;
+    }
+
+private:
+    struct Chunk {
+        std::size_t sequence = 0;
+        std::vector<BatchRecord> records;
+        std::string output;
+        std::size_t count = 0;
+        std::size_t errors = 0;
+    };
+
+    explicit BatchPipeline(const BatchPipelineSettings &settings)
+            : threads(settings.threads == 0 ? 1 : settings.threads),
+              chunkSize(settings.chunkSize == 0 ? 1 : settings.chunkSize),
+              chunksInFlight(settings.chunksInFlight == 0 ? 4 * threads : settings.chunksInFlight) {}
+
+    void read(BatchRecordReader &reader) {
+        try {
+            std::size_t sequence = 0;
+            bool more = true;
+            while (more) {
+                Chunk chunk;
+                chunk.sequence = sequence;
+                chunk.records.reserve(chunkSize);
+                BatchRecord record;
+                while (chunk.records.size() < chunkSize && (more = reader.next(record))) {
+                    chunk.records.push_back(std::move(record));
+                }
+                if (chunk.records.empty()) break;
+
+                std::unique_lock<std::mutex> lock(mutex);
+                spaceAvailable.wait(lock, [this, sequence] {
+                    return stopped || sequence - written < chunksInFlight;
+                });
+                if (stopped) return;
+                pending.push_back(std::move(chunk));
+                sequence++;
+                workAvailable.notify_one();
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            chunkCount = sequence;
+            readDone = true;
+        } catch (...) {
+            abort(std::current_exception());
+            return;
+        }
+        workAvailable.notify_all();
+        chunkDone.notify_all();
+    }
+
+    void work(const BatchEvaluate &evaluate, const BatchResultFormatter &formatter, const std::size_t outputCount) {
+        std::vector<double> results(outputCount);
+        while (true) {
+            Chunk chunk;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                workAvailable.wait(lock, [this] { return stopped || readDone || !pending.empty(); });
+                if (stopped || pending.empty()) return;
+                chunk = std::move(pending.front());
+                pending.pop_front();
+            }
+
+            for (auto const &record : chunk.records) {
+                std::fill(results.begin(), results.end(), std::numeric_limits<double>::quiet_NaN());
+                std::string error;
+                try {
+                    evaluate(record, results);
+                } catch (std::exception const &e) {
+                    std::fill(results.begin(), results.end(), std::numeric_limits<double>::quiet_NaN());
+                    error = e.what();
+                    chunk.errors++;
+                }
+                chunk.output += formatter.format(record, results, error);
+            }
+            chunk.count = chunk.records.size();
+            chunk.records.clear();
+
+            std::lock_guard<std::mutex> lock(mutex);
+            done.insert(std::make_pair(chunk.sequence, std::move(chunk)));
+            chunkDone.notify_all();
+        }
+    }
+
+    void write(std::ostream &out, BatchPipelineSummary &summary) {
+        for (std::size_t sequence = 0;; sequence++) {
+            Chunk chunk;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                chunkDone.wait(lock, [this, sequence] {
+                    return stopped || done.count(sequence) || (readDone && sequence >= chunkCount);
+                });
+                if (stopped || !done.count(sequence)) return;
+                chunk = std::move(done[sequence]);
+                done.erase(sequence);
+            }
+
+            out << chunk.output;
+            if (!out) throw std::runtime_error("BatchPipeline: writing the output failed");
+            summary.records += chunk.count;
+            summary.errors += chunk.errors;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            written = sequence + 1;
+            spaceAvailable.notify_one();
+        }
+    }
+
+    void abort(std::exception_ptr exception) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!failure) failure = exception;
+            stopped = true;
+        }
+        workAvailable.notify_all();
+        spaceAvailable.notify_all();
+        chunkDone.notify_all();
+    }
+
+    const unsigned threads;
+    const std::size_t chunkSize;
+    const std::size_t chunksInFlight;
+
+    std::mutex mutex;
+    std::condition_variable workAvailable, spaceAvailable, chunkDone;
+    std::deque<Chunk> pending;
+    std::map<std::size_t, Chunk> done;
+    std::size_t written = 0, chunkCount = 0;
+    bool readDone = false, stopped = false;
+    std::exception_ptr failure;
+};
+
+#endif //AMO_TOOLS_SUITE_BATCHPIPELINE_H
@@ -0,0 +1,111 @@
+#include "BatchCalculator.h"
+#include <calculator/util/CompressedAir.h>
+#include <calculator/util/CompressedAirCentrifugal.h>
+
+namespace {
+    // field names follow bindings/compressedAir.h and bindings/standalone.h
+
+    BatchCalculatorRegistrar compressedAirCentrifugal(
+            "compressedAir", "compressedAirCentrifugal",
+            "load/unload centrifugal compressor power and capacity at part load",
+            {"computeFrom", "computeFromVal", "computeFromPFVoltage", "computeFromPFAmps", "powerAtFullLoad",
+             "capacityAtFullLoad", "powerAtNoLoad", "adjustForDischargePressure", "fullLoadPressure",
+             "capacityAtMinFullLoadPressure", "capacityAtMaxFullLoadPressure", "minFullLoadPressure",
+             "maxFullLoadPressure"},
+            {"powerCalculated", "capacityCalculated", "percentagePower", "percentageCapacity",
+             "capacityAtFullLoadAdjusted"},
+            [](const BatchRecord &record, std::vector<double> &results) {
+                const double capacityAtFullLoad = record.getDouble("capacityAtFullLoad");
+                CompressedAirCentrifugal_LoadUnload compressor(record.getDouble("powerAtFullLoad"), capacityAtFullLoad,
+                                                               record.getDouble("powerAtNoLoad"));
+                if (record.has("adjustForDischargePressure") && record.getBool("adjustForDischargePressure")) {
+                    compressor.AdjustDischargePressure(
+                            {capacityAtFullLoad, record.getDouble("capacityAtMinFullLoadPressure"),
+                             record.getDouble("capacityAtMaxFullLoadPressure")},
+                            {record.getDouble("fullLoadPressure"), record.getDouble("minFullLoadPressure"),
+                             record.getDouble("maxFullLoadPressure")}, record.getDouble("fullLoadPressure"));
+                    results[4] = compressor.C_fl_Adjusted;
+                }
+
+                const double value = record.getDouble("computeFromVal");
+                CompressedAirCentrifugalBase::Output output;
+                switch (record.getInteger("computeFrom")) {
+                    case CompressedAirCentrifugal::ComputeFrom::PercentagePower:
+                        output = compressor.calculateFromPerkW(value);
+                        break;
+                    case CompressedAirCentrifugal::ComputeFrom::PercentageCapacity:
+                        output = compressor.calculateFromPerC(value);
+                        break;
+                    case CompressedAirCentrifugal::ComputeFrom::PowerMeasured:
+                        output = compressor.calculateFromkWMeasured(value);
+                        break;
+                    case CompressedAirCentrifugal::ComputeFrom::CapacityMeasured:
+                        output = compressor.calculateFromCMeasured(value);
+                        break;
+                    case CompressedAirCentrifugal::ComputeFrom::PowerFactor:
+                        output = compressor.calculateFromVIPFMeasured(value, record.getDouble("computeFromPFVoltage"),
+                                                                      record.getDouble("computeFromPFAmps"));
+                        break;
+                    default:
+                        throw std::runtime_error("invalid computeFrom");
+                }
+                results[0] = output.kW_Calc;
+                results[1] = output.C_Calc;
+                results[2] = output.PerkW;
+                results[3] = output.C_Per;
+            });
+
+    BatchCalculatorRegistrar pneumaticAirRequirement(
+            "compressedAir", "pneumaticAirRequirement", "air required by a single or double acting pneumatic cylinder",
+            {"pistonType", "cylinderDiameter", "cylinderStroke", "pistonRodDiameter", "airPressure", "cyclesPerMinute"},
+            {"airRequirementPneumaticCylinder", "volumeAirIntakePiston", "compressionRatio"},
+            [](const BatchRecord &record, std::vector<double> &results) {
+                PneumaticAirRequirement airRequirement;
+                if (record.getInteger("pistonType") == 0) {
+                    airRequirement = PneumaticAirRequirement(
+                            PneumaticAirRequirement::PistonType::SingleActing, record.getDouble("cylinderDiameter"),
+                            record.getDouble("cylinderStroke"), record.getDouble("airPressure"),
+                            record.getDouble("cyclesPerMinute"));
+                } else {
+                    airRequirement = PneumaticAirRequirement(
+                            PneumaticAirRequirement::PistonType::DoubleActing, record.getDouble("cylinderDiameter"),
+                            record.getDouble("cylinderStroke"), record.getDouble("pistonRodDiameter"),
+                            record.getDouble("airPressure"), record.getDouble("cyclesPerMinute"));
+                }
+                auto const output = airRequirement.calculate();
+                results[0] = output.airRequirementPneumaticCylinder;
+                results[1] = output.volumeAirIntakePiston;
+                results[2] = output.compressionRatio;
+            });
+
+    BatchCalculatorRegistrar bagMethod(
+            "compressedAir", "bagMethod", "leak flow rate and annual consumption measured with the bag method",
+            {"operatingTime", "bagFillTime", "heightOfBag", "diameterOfBag", "numberOfUnits"},
+            {"flowRate", "annualConsumption"},
+            [](const BatchRecord &record, std::vector<double> &results) {
+                auto const output = BagMethod(record.getDouble("operatingTime"), record.getDouble("bagFillTime"),
+                                              record.getDouble("heightOfBag"), record.getDouble("diameterOfBag"),
+                                              record.getInteger("numberOfUnits")).calculate();
+                results[0] = output.flowRate;
+                results[1] = output.annualConsumption;
+            });
+
+    BatchCalculatorRegistrar orificeMethod(
+            "compressedAir", "orificeMethod", "leak rate and annual consumption estimated from the orifice size",
+            {"operatingTime", "airTemp", "atmPressure", "dischargeCoef", "diameter", "supplyPressure", "numOrifices"},
+            {"standardDensity", "sonicDensity", "leakVelocity", "leakRateLBMmin", "leakRateScfm", "leakRateEstimate",
+             "annualConsumption"},
+            [](const BatchRecord &record, std::vector<double> &results) {
+                auto const output = OrificeMethod(record.getDouble("operatingTime"), record.getDouble("airTemp"),
+                                                  record.getDouble("atmPressure"), record.getDouble("dischargeCoef"),
+                                                  record.getDouble("diameter"), record.getDouble("supplyPressure"),
+                                                  record.getInteger("numOrifices")).calculate();
+                results[0] = output.standardDensity;
+                results[1] = output.sonicDensity;
+                results[2] = output.leakVelocity;
+                results[3] = output.leakRateLBMmin;
+                results[4] = output.leakRateScfm;
+                results[5] = output.leakRateEstimate;
+                results[6] = output.annualConsumption;
+            });
+}
@@ -0,0 +1,83 @@
+#include "BatchCalculator.h"
+#include <calculator/util/Conversion.h>
+#include <results/Results.h>
+
+namespace {
+    // field names and conversions follow fanResultsExisting and fanResultsModified in bindings/fan.h
+
+    const std::vector<std::string> fanOutputs = {
+            "fanEfficiency", "motorRatedPower", "motorShaftPower", "fanShaftPower", "motorEfficiency",
+            "motorPowerFactor", "motorCurrent", "motorPower", "loadFactor", "driveEfficiency", "annualEnergy",
+            "annualCost", "estimatedFLA", "fanEnergyIndex"};
+
+    Fan::Input makeFanInput(const BatchRecord &record) {
+        const Motor::Drive drive = record.getEnum<Motor::Drive>("drive");
+        const double specifiedDriveEfficiency = drive == Motor::Drive::SPECIFIED
+                                                ? record.getDouble("specifiedDriveEfficiency") : 100.0;
+        return {record.getDouble("fanSpeed"), record.getDouble("airDensity"), drive,
+                Conversion(specifiedDriveEfficiency).percentToFraction()};
+    }
+
+    Motor makeMotor(const BatchRecord &record) {
+        return {record.getEnum<Motor::LineFrequency>("lineFrequency"), record.getDouble("motorRatedPower"),
+                record.getDouble("motorRpm"), record.getEnum<Motor::EfficiencyClass>("efficiencyClass"),
+                record.getDouble("specifiedEfficiency"), record.getDouble("motorRatedVoltage"),
+                record.getDouble("fullLoadAmps"), record.getDouble("sizeMargin")};
+    }
+
+    void setFanResults(FanResult::Output const &output, std::vector<double> &results) {
+        results[0] = Conversion(output.fanEfficiency).fractionToPercent();
+        results[1] = output.motorRatedPower;
+        results[2] = output.motorShaftPower;
+        results[3] = output.fanShaftPower;
+        results[4] = Conversion(output.motorEfficiency).fractionToPercent();
+        results[5] = Conversion(output.motorPowerFactor).fractionToPercent();
+        results[6] = output.motorCurrent;
+        results[7] = output.motorPower;
+        results[8] = output.loadFactor;
+        results[9] = Conversion(output.driveEfficiency).fractionToPercent();
+        results[10] = output.annualEnergy;
+        results[11] = output.annualCost;
+        results[12] = output.estimatedFLA;
+        results[13] = output.fanEnergyIndex;
+    }
+
+    BatchCalculatorRegistrar fanResultsExisting(
+            "fan", "fanResultsExisting", "fan system assessment of the existing fan and motor",
+            {"fanSpeed", "airDensity", "drive", "specifiedDriveEfficiency", "lineFrequency", "motorRatedPower",
+             "motorRpm", "efficiencyClass", "specifiedEfficiency", "motorRatedVoltage", "fullLoadAmps", "sizeMargin",
+             "measuredPower", "measuredVoltage", "measuredAmps", "flowRate", "inletPressure", "outletPressure",
+             "compressibilityFactor", "operatingHours", "unitCost", "loadEstimationMethod"},
+            fanOutputs,
+            [](const BatchRecord &record, std::vector<double> &results) {
+                const Fan::FieldDataBaseline fieldData(
+                        record.getDouble("measuredPower"), record.getDouble("measuredVoltage"),
+                        record.getDouble("measuredAmps"), record.getDouble("flowRate"),
+                        record.getDouble("inletPressure"), record.getDouble("outletPressure"),
+                        record.getDouble("compressibilityFactor"),
+                        record.getEnum<Motor::LoadEstimationMethod>("loadEstimationMethod"));
+                Fan::Input input = makeFanInput(record);
+                Motor motor = makeMotor(record);
+                FanResult result(input, motor, record.getDouble("operatingHours"), record.getDouble("unitCost"));
+                setFanResults(result.calculateExisting(fieldData), results);
+            });
+
+    BatchCalculatorRegistrar fanResultsModified(
+            "fan", "fanResultsModified", "fan system assessment of the modified fan and motor",
+            {"fanSpeed", "airDensity", "drive", "specifiedDriveEfficiency", "lineFrequency", "motorRatedPower",
+             "motorRpm", "efficiencyClass", "specifiedEfficiency", "motorRatedVoltage", "fullLoadAmps", "sizeMargin",
+             "measuredVoltage", "measuredAmps", "flowRate", "inletPressure", "outletPressure", "compressibilityFactor",
+             "operatingHours", "unitCost", "fanEfficiency"},
+            fanOutputs,
+            [](const BatchRecord &record, std::vector<double> &results) {
+                const Fan::FieldDataModified fieldData(
+                        record.getDouble("measuredVoltage"), record.getDouble("measuredAmps"),
+                        record.getDouble("flowRate"), record.getDouble("inletPressure"),
+                        record.getDouble("outletPressure"), record.getDouble("compressibilityFactor"));
+                Fan::Input input = makeFanInput(record);
+                Motor motor = makeMotor(record);
+                FanResult result(input, motor, record.getDouble("operatingHours"), record.getDouble("unitCost"));
+                setFanResults(result.calculateModified(
+                        fieldData, Conversion(record.getDouble("fanEfficiency")).percentToFraction()), results);
+            });
+}
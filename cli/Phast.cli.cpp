@@ -0,0 +1,79 @@
+#include "BatchCalculator.h"
+#include <calculator/losses/Atmosphere.h>
+#include <calculator/losses/GasFlueGasMaterial.h>
+#include <calculator/losses/OpeningLosses.h>
+#include <calculator/losses/WallLosses.h>
+#include <calculator/losses/WaterCoolingLosses.h>
+
+namespace {
+    // field names follow bindings/phast.h; each loss calculator returns a single heat loss
+
+    BatchCalculatorRegistrar atmosphere(
+            "phast", "atmosphere", "atmosphere heat loss in btu/cycle",
+            {"inletTemperature", "outletTemperature", "flowRate", "correctionFactor", "specificHeat"}, {"heatLoss"},
+            [](const BatchRecord &record, std::vector<double> &results) {
+                results[0] = Atmosphere(record.getDouble("inletTemperature"), record.getDouble("outletTemperature"),
+                                        record.getDouble("flowRate"), record.getDouble("correctionFactor"),
+                                        record.getDouble("specificHeat")).getTotalHeat();
+            });
+
+    BatchCalculatorRegistrar wallLosses(
+            "phast", "wallLosses", "wall heat loss in btu/cycle",
+            {"surfaceArea", "ambientTemperature", "surfaceTemperature", "windVelocity", "surfaceEmissivity",
+             "conditionFactor", "correctionFactor"}, {"heatLoss"},
+            [](const BatchRecord &record, std::vector<double> &results) {
+                results[0] = WallLosses(record.getDouble("surfaceArea"), record.getDouble("ambientTemperature"),
+                                        record.getDouble("surfaceTemperature"), record.getDouble("windVelocity"),
+                                        record.getDouble("surfaceEmissivity"), record.getDouble("conditionFactor"),
+                                        record.getDouble("correctionFactor")).getHeatLoss();
+            });
+
+    BatchCalculatorRegistrar waterCoolingLosses(
+            "phast", "waterCoolingLosses", "water cooling heat loss in btu/cycle",
+            {"flowRate", "initialTemperature", "outletTemperature", "correctionFactor"}, {"heatLoss"},
+            [](const BatchRecord &record, std::vector<double> &results) {
+                results[0] = WaterCoolingLosses(record.getDouble("flowRate"), record.getDouble("initialTemperature"),
+                                                record.getDouble("outletTemperature"),
+                                                record.getDouble("correctionFactor")).getHeatLoss();
+            });
+
+    BatchCalculatorRegistrar openingLossesCircular(
+            "phast", "openingLossesCircular", "circular opening heat loss in btu/cycle",
+            {"emissivity", "diameter", "thickness", "ratio", "ambientTemperature", "insideTemperature",
+             "percentTimeOpen", "viewFactor"}, {"heatLoss"},
+            [](const BatchRecord &record, std::vector<double> &results) {
+                results[0] = OpeningLosses(record.getDouble("emissivity"), record.getDouble("diameter"),
+                                           record.getDouble("thickness"), record.getDouble("ratio"),
+                                           record.getDouble("ambientTemperature"),
+                                           record.getDouble("insideTemperature"), record.getDouble("percentTimeOpen"),
+                                           record.getDouble("viewFactor")).getHeatLoss();
+            });
+
+    BatchCalculatorRegistrar openingLossesQuad(
+            "phast", "openingLossesQuad", "rectangular opening heat loss in btu/cycle",
+            {"emissivity", "length", "width", "thickness", "ratio", "ambientTemperature", "insideTemperature",
+             "percentTimeOpen", "viewFactor"}, {"heatLoss"},
+            [](const BatchRecord &record, std::vector<double> &results) {
+                results[0] = OpeningLosses(record.getDouble("emissivity"), record.getDouble("length"),
+                                           record.getDouble("width"), record.getDouble("thickness"),
+                                           record.getDouble("ratio"), record.getDouble("ambientTemperature"),
+                                           record.getDouble("insideTemperature"), record.getDouble("percentTimeOpen"),
+                                           record.getDouble("viewFactor")).getHeatLoss();
+            });
+
+    BatchCalculatorRegistrar flueGasLossesByVolume(
+            "phast", "flueGasLossesByVolume", "flue gas heat loss as a fraction of available heat, gas fuels",
+            {"flueGasTemperature", "excessAirPercentage", "combustionAirTemperature", "fuelTemperature", "CH4", "C2H6",
+             "N2", "H2", "C3H8", "C4H10_CnH2n", "H2O", "CO", "CO2", "SO2", "O2"}, {"heatLoss"},
+            [](const BatchRecord &record, std::vector<double> &results) {
+                const GasCompositions composition(
+                        "", record.getDouble("CH4"), record.getDouble("C2H6"), record.getDouble("N2"),
+                        record.getDouble("H2"), record.getDouble("C3H8"), record.getDouble("C4H10_CnH2n"),
+                        record.getDouble("H2O"), record.getDouble("CO"), record.getDouble("CO2"),
+                        record.getDouble("SO2"), record.getDouble("O2"));
+                results[0] = GasFlueGasMaterial(record.getDouble("flueGasTemperature"),
+                                                record.getDouble("excessAirPercentage"),
+                                                record.getDouble("combustionAirTemperature"), composition,
+                                                record.getDouble("fuelTemperature")).getHeatLoss();
+            });
+}
@@ -0,0 +1,67 @@
+#include "BatchCalculator.h"
+#include <calculator/util/Conversion.h>
+#include <results/Results.h>
+
+namespace {
+    // field names and conversions follow resultsExisting and resultsModified in bindings/psat.h
+
+    const std::vector<std::string> psatInputs = {
+            "pump_style", "pump_specified", "pump_rated_speed", "drive", "specifiedDriveEfficiency",
+            "kinematic_viscosity", "specific_gravity", "stages", "fixed_speed", "line_frequency", "motor_rated_power",
+            "motor_rated_speed", "efficiency_class", "efficiency", "motor_rated_voltage", "motor_rated_fla", "margin",
+            "flow_rate", "head", "load_estimation_method", "motor_field_power", "motor_field_current",
+            "motor_field_voltage", "operating_hours", "cost_kw_hour"};
+
+    const std::vector<std::string> psatOutputs = {
+            "pump_efficiency", "motor_rated_power", "motor_shaft_power", "pump_shaft_power", "motor_efficiency",
+            "motor_power_factor", "motor_current", "motor_power", "load_factor", "drive_efficiency", "annual_energy",
+            "annual_cost", "annual_savings_potential", "optimization_rating"};
+
+    void evaluatePsat(const BatchRecord &record, std::vector<double> &results, const bool modified) {
+        const Motor::Drive drive = record.getEnum<Motor::Drive>("drive");
+        const double specifiedDriveEfficiency = drive == Motor::Drive::SPECIFIED
+                                                ? record.getDouble("specifiedDriveEfficiency") : 100.0;
+
+        // the existing system is always evaluated as fixed speed with the viscosity correction off
+        Pump::Input pump(record.getEnum<Pump::Style>("pump_style"),
+                         Conversion(record.getDouble("pump_specified")).percentToFraction(),
+                         record.getDouble("pump_rated_speed"), drive,
+                         modified ? record.getDouble("kinematic_viscosity") : 0, record.getDouble("specific_gravity"),
+                         record.getInteger("stages"),
+                         modified ? record.getEnum<Pump::SpecificSpeed>("fixed_speed") : Pump::SpecificSpeed::FIXED_SPEED,
+                         Conversion(specifiedDriveEfficiency).percentToFraction());
+        Motor motor(record.getEnum<Motor::LineFrequency>("line_frequency"), record.getDouble("motor_rated_power"),
+                    record.getDouble("motor_rated_speed"), record.getEnum<Motor::EfficiencyClass>("efficiency_class"),
+                    record.getDouble("efficiency"), record.getDouble("motor_rated_voltage"),
+                    record.getDouble("motor_rated_fla"), modified ? record.getDouble("margin") : 1);
+        Pump::FieldData fieldData(record.getDouble("flow_rate"), record.getDouble("head"),
+                                  record.getEnum<Motor::LoadEstimationMethod>("load_estimation_method"),
+                                  record.getDouble("motor_field_power"), record.getDouble("motor_field_current"),
+                                  record.getDouble("motor_field_voltage"));
+        PSATResult psat(pump, motor, fieldData, record.getDouble("operating_hours"), record.getDouble("cost_kw_hour"));
+
+        const PSATResult::Output output = modified ? psat.calculateModified() : psat.calculateExisting();
+        results[0] = Conversion(output.pumpEfficiency).fractionToPercent();
+        results[1] = output.motorRatedPower;
+        results[2] = output.motorShaftPower;
+        results[3] = output.pumpShaftPower;
+        results[4] = Conversion(output.motorEfficiency).fractionToPercent();
+        results[5] = Conversion(output.motorPowerFactor).fractionToPercent();
+        results[6] = output.motorCurrent;
+        results[7] = output.motorPower;
+        results[8] = output.loadFactor;
+        results[9] = Conversion(output.driveEfficiency).fractionToPercent();
+        results[10] = output.annualEnergy;
+        results[11] = Conversion(output.annualCost).manualConversion(1000.0);
+        results[12] = Conversion(psat.getAnnualSavingsPotential()).manualConversion(1000.0);
+        results[13] = psat.getOptimizationRating();
+    }
+
+    BatchCalculatorRegistrar resultsExisting(
+            "psat", "resultsExisting", "pump system assessment of the existing pump and motor", psatInputs, psatOutputs,
+            [](const BatchRecord &record, std::vector<double> &results) { evaluatePsat(record, results, false); });
+
+    BatchCalculatorRegistrar resultsModified(
+            "psat", "resultsModified", "pump system assessment of the modified pump and motor", psatInputs, psatOutputs,
+            [](const BatchRecord &record, std::vector<double> &results) { evaluatePsat(record, results, true); });
+}
@@ -0,0 +1,138 @@
+#include "BatchCalculator.h"
+#include <ssmt/SteamProperties.h>
+#include <ssmt/api/SteamModeler.h>
+#include <ssmt/api/SteamModelerOutputFlattener.h>
+
+namespace {
+    // field names and conversions follow bindings/ssmt.h and, for steamModeler, the tests/at/csv data columns
+
+    BatchCalculatorRegistrar steamProperties(
+            "ssmt", "steamProperties", "steam properties given pressure and one other thermodynamic quantity",
+            {"pressure", "thermodynamicQuantity", "quantityValue"},
+            {"pressure", "temperature", "specificEnthalpy", "specificEntropy", "quality", "specificVolume"},
+            [](const BatchRecord &record, std::vector<double> &results) {
+                auto const output = SteamProperties(
+                        record.getDouble("pressure"),
+                        record.getEnum<SteamProperties::ThermodynamicQuantity>("thermodynamicQuantity"),
+                        record.getDouble("quantityValue")).calculate();
+                results[0] = output.pressure;
+                results[1] = output.temperature;
+                results[2] = output.specificEnthalpy;
+                results[3] = output.specificEntropy;
+                results[4] = output.quality;
+                results[5] = output.specificVolume;
+            });
+
+    /**
+     * The acceptance data leaves the operation type of unused turbines blank, which the binding reads as 0
+     */
+    int getOperationType(const BatchRecord &record, const std::string &name) {
+        return record.getString(name).empty() ? 0 : record.getInteger(name);
+    }
+
+    /**
+     * fuelType and fuel only describe the boiler and the acceptance data names them ("NG"), the Node tests read
+     * them with parseFloat, so text reads as NaN instead of failing the record
+     */
+    double getDescription(const BatchRecord &record, const std::string &name) {
+        const std::string &value = record.getString(name);
+        char *end = nullptr;
+        const double result = std::strtod(value.c_str(), &end);
+        return end == value.c_str() ? std::numeric_limits<double>::quiet_NaN() : result;
+    }
+
+    std::shared_ptr<HeaderNotHighestPressure> makeHeaderNotHighestPressure(const BatchRecord &record,
+                                                                           const std::string &prefix) {
+        const double pressure = record.getDouble(prefix + "Pressure");
+        if (std::isnan(pressure)) return nullptr;
+
+        return std::make_shared<HeaderNotHighestPressure>(
+                pressure, record.getDouble(prefix + "ProcessSteamUsage"),
+                record.getDouble(prefix + "CondensationRecoveryRate"), record.getDouble(prefix + "HeatLoss"),
+                record.getBool(prefix + "FlashCondensateIntoHeader"),
+                record.getBool(prefix + "DesuperheatSteamIntoNextHighest"),
+                record.getDouble(prefix + "DesuperheatSteamTemperature"));
+    }
+
+    PressureTurbine makePressureTurbine(const BatchRecord &record, const std::string &prefix) {
+        return {record.getDouble(prefix + "IsentropicEfficiency"), record.getDouble(prefix + "GenerationEfficiency"),
+                static_cast<PressureTurbineOperation>(getOperationType(record, prefix + "OperationType")),
+                record.getDouble(prefix + "OperationValue1"), record.getDouble(prefix + "OperationValue2"),
+                record.getBool(prefix + "UseTurbine")};
+    }
+
+    SteamModelerInput makeSteamModelerInput(const BatchRecord &record) {
+        const BoilerInput boilerInput(
+                getDescription(record, "fuelType"), getDescription(record, "fuel"),
+                record.getDouble("combustionEfficiency"),
+                record.getDouble("blowdownRate"), record.getBool("blowdownFlashed"),
+                record.getBool("preheatMakeupWater"), record.getDouble("steamTemperature"),
+                record.getDouble("deaeratorVentRate"), record.getDouble("deaeratorPressure"),
+                record.getDouble("approachTemperature"));
+
+        const HeaderWithHighestPressure highPressureHeader(
+                record.getDouble("highPressureHeaderPressure"), record.getDouble("highPressureHeaderProcessSteamUsage"),
+                record.getDouble("highPressureHeaderCondensationRecoveryRate"),
+                record.getDouble("highPressureHeaderHeatLoss"),
+                record.getDouble("highPressureHeaderCondensateReturnTemperature"),
+                record.getBool("highPressureHeaderFlashCondensateReturn"));
+        const HeaderInput headerInput(highPressureHeader, makeHeaderNotHighestPressure(record, "mediumPressureHeader"),
+                                      makeHeaderNotHighestPressure(record, "lowPressureHeader"));
+
+        const OperationsInput operationsInput(
+                record.getDouble("sitePowerImport"), record.getDouble("makeUpWaterTemperature"),
+                record.getDouble("operatingHoursPerYear"), record.getDouble("fuelCosts"),
+                record.getDouble("electricityCosts"), record.getDouble("makeUpWaterCosts"));
+
+        const CondensingTurbine condensingTurbine(
+                record.getDouble("condensingTurbineIsentropicEfficiency"),
+                record.getDouble("condensingTurbineGenerationEfficiency"),
+                record.getDouble("condensingTurbineCondenserPressure"),
+                static_cast<CondensingTurbineOperation>(getOperationType(record, "condensingTurbineOperationType")),
+                record.getDouble("condensingTurbineOperationValue"), record.getBool("condensingTurbineUseTurbine"));
+        const TurbineInput turbineInput(condensingTurbine, makePressureTurbine(record, "highToLowTurbine"),
+                                        makePressureTurbine(record, "highToMediumTurbine"),
+                                        makePressureTurbine(record, "mediumToLowTurbine"));
+
+        const double baselinePowerDemand = record.getString("baselinePowerDemand").empty()
+                                           ? 0 : record.getDouble("baselinePowerDemand");
+        return {record.getBool("isBaselineCalc"), baselinePowerDemand, boilerInput, headerInput, operationsInput,
+                turbineInput};
+    }
+
+    /**
+     * The flattened output names do not depend on the model, they are taken from a single header reference model
+     */
+    std::vector<std::string> getSteamModelerOutputNames() {
+        const BoilerInput boilerInput(1, 1, 85, 2, true, true, 514.2, .1, 0.204747, 10);
+        const HeaderInput headerInput(HeaderWithHighestPressure(1.136, 22680, 50, 0.1, 338.7, true), nullptr, nullptr);
+        const OperationsInput operationsInput(18000000, 283.15, 8000, 0.000005478, 1.39E-05, 0.66);
+        const PressureTurbine unusedTurbine(1, 1, PressureTurbineOperation::POWER_GENERATION, 1, 1, false);
+        const TurbineInput turbineInput(
+                CondensingTurbine(1, 1, 1, CondensingTurbineOperation::POWER_GENERATION, 1, false), unusedTurbine,
+                unusedTurbine, unusedTurbine);
+
+        std::vector<std::string> names;
+        const SteamModelerOutput output = SteamModeler().model(
+                SteamModelerInput(true, 0, boilerInput, headerInput, operationsInput, turbineInput));
+        for (auto const &field : SteamModelerOutputFlattener::flatten(output)) names.push_back(field.name);
+        return names;
+    }
+
+    BatchCalculatorRegistrar steamModeler(
+            "ssmt", "steamModeler", "complete steam system model, in the column layout of the tests/at/csv data",
+            {"isBaselineCalc", "baselinePowerDemand", "fuelType", "fuel", "combustionEfficiency", "...",
+             "mediumToLowTurbineUseTurbine"},
+            [] {
+                static const std::vector<std::string> names = getSteamModelerOutputNames();
+                return names;
+            },
+            [](const BatchRecord &record, std::vector<double> &results) {
+                const SteamModelerOutput output = SteamModeler().model(makeSteamModelerInput(record));
+                const std::vector<SteamModelerOutputFlattener::Field> fields =
+                        SteamModelerOutputFlattener::flatten(output);
+                for (std::size_t i = 0; i < fields.size() && i < results.size(); i++) {
+                    if (fields[i].isPresent) results[i] = fields[i].value;
+                }
+            });
+}
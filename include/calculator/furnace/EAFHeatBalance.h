@@ -0,0 +1,114 @@
+/**
+ * @file
+ * @brief Energy balance of electric arc furnace (EAF) heats from logged data
+ *
+ * The logged power, fuel, injection and exhaust gas readings of a heat are streamed sample by sample; each sample is
+ * evaluated with the EnergyInputEAF and ExhaustGasEAF calculators and integrated over its duration, and the slag and
+ * other materials discharged with the heat are added once per heat. Reports the energy in, exhaust gas and slag
+ * losses and the electricity and total energy used per ton of steel tapped. Batches of heats are evaluated in
+ * parallel, one heat at a time per thread.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_EAFHEATBALANCE_H
+#define AMO_TOOLS_SUITE_EAFHEATBALANCE_H
+
+#include <vector>
+#include "calculator/losses/SlagOtherMaterialLosses.h"
+
+/**
+ * EAF Heat Balance class
+ * Used to integrate the energy in and out of an electric arc furnace over each heat.
+ */
+class EAFHeatBalance {
+public:
+    /**
+     * Logged readings of a heat, held for the duration of the sample
+     */
+    struct Sample {
+        double duration; ///< hours
+        double electricityInput; ///< electric power in kW
+        double naturalGasHeatInput; ///< natural gas (oxy-fuel burners) in MM btu/hr
+        double coalCarbonInjection; ///< lb/hr
+        double electrodeUse; ///< lb/hr
+        double otherFuels; ///< MM btu/hr
+        double offGasTemp; ///< exhaust gas temperature before it mixes with outside air in °F
+        double CO; ///< % of CO in the exhaust gas
+        double H2; ///< % of H2 in the exhaust gas
+        double combustibleGases; ///< % of other combustible gases in the exhaust gas
+        double vfr; ///< exhaust gas flow in cfm
+        double dustLoading; ///< dust loading of the exhaust gas in s/scf
+    };
+
+    /**
+     * A heat and its logged samples
+     */
+    struct Heat {
+        double tapWeight; ///< steel tapped in tons
+        double coalHeatingValue; ///< btu/lb
+        double electrodeHeatingValue; ///< btu/lb
+        std::vector<SlagOtherMaterialLosses> slags; ///< slag and other materials discharged, weights per heat
+        std::vector<Sample> samples;
+    };
+
+    /**
+     * Energy balance of a heat, energy in btu
+     */
+    struct Results {
+        double duration; ///< hours
+        double electricityUse; ///< kWh
+        double chemicalEnergyInput; ///< fuels, injected carbon and electrodes
+        double totalEnergyInput; ///< chemical energy plus electricity
+        double exhaustGasLosses;
+        double slagLosses;
+        double otherLosses; ///< energy in less the exhaust gas and slag losses: heat to the steel and unmeasured losses
+        double electricityPerTon; ///< kWh/ton tapped, 0 without a tap weight
+        double energyPerTon; ///< total energy input in kWh/ton tapped, 0 without a tap weight
+    };
+
+    /**
+     * Constructor for the energy balance of one heat, before any samples are added
+     * @param tapWeight double, steel tapped in tons
+     * @param coalHeatingValue double, heating value of the coal or carbon injected in btu/lb
+     * @param electrodeHeatingValue double, electrode heating value in btu/lb
+     * @param slags std::vector<SlagOtherMaterialLosses>, slag and other materials discharged with the heat
+     */
+    EAFHeatBalance(double tapWeight, double coalHeatingValue, double electrodeHeatingValue,
+                   const std::vector<SlagOtherMaterialLosses> &slags = std::vector<SlagOtherMaterialLosses>());
+
+    /**
+     * Integrates one logged sample into the balance of the heat
+     * @param sample Sample, readings and the hours they apply to
+     */
+    void addSample(const Sample &sample);
+
+    /**
+     * Gets the energy balance of the samples added so far
+     * @return Results, energy in and out and energy per ton tapped
+     */
+    Results getResults() const;
+
+    /**
+     * Calculates the energy balance of a heat
+     * @param heat Heat, heat and its samples
+     * @return Results, energy in and out and energy per ton tapped
+     */
+    static Results calculate(const Heat &heat);
+
+    /**
+     * Calculates the energy balance of each heat of a batch
+     * @param heats std::vector<Heat>, heats with their samples
+     * @param threads unsigned, number of threads evaluating heats, 0 for one per hardware thread
+     * @return std::vector<Results>, results of each heat, in order
+     */
+    static std::vector<Results> calculate(const std::vector<Heat> &heats, unsigned threads = 0);
+
+private:
+    double tapWeight, coalHeatingValue, electrodeHeatingValue;
+    double slagLosses = 0;
+    double duration = 0, electricityUse = 0, chemicalEnergyInput = 0, totalEnergyInput = 0, exhaustGasLosses = 0;
+};
+
+#endif //AMO_TOOLS_SUITE_EAFHEATBALANCE_H
@@ -0,0 +1,107 @@
+/**
+ * @file
+ * @brief Search for the combustion settings of a fuel fired furnace with the lowest fuel cost
+ *
+ * Evaluates every combination of combustion air preheat temperature, flue gas O2 and combustion air O2 enrichment on
+ * a grid with the O2 enrichment calculator and returns the configurations that are not beaten on both fuel cost and
+ * oxygen cost by any other, ranked by total cost. Candidates are evaluated on several threads.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_FURNACEEFFICIENCYOPTIMIZER_H
+#define AMO_TOOLS_SUITE_FURNACEEFFICIENCYOPTIMIZER_H
+
+#include <cstddef>
+#include <vector>
+#include "calculator/util/GridSearch.h"
+
+/**
+ * Furnace Efficiency Optimizer class
+ * Used to find the preheat temperature, flue gas O2 and O2 enrichment that minimize the operating cost of a furnace.
+ */
+class FurnaceEfficiencyOptimizer {
+public:
+    using Range = GridSearch::Range;
+
+    /**
+     * Current operation of the furnace, costs and the configurations to search
+     */
+    struct Inputs {
+        double flueGasTemp; ///< flue gas temperature in °F, assumed not to change with the configuration
+        double o2FlueGas; ///< current % of dry O2 in the flue gas
+        double combAirTemp; ///< current combustion air preheat temperature in °F
+        double o2CombAir; ///< current % of O2 in the combustion air, 21 without enrichment
+        double fuelConsumption; ///< current fuel consumption in MM Btu/hr
+        double operatingHours; ///< hours per year
+        double fuelCost; ///< $/MM Btu
+        double oxygenCost; ///< cost of purchased oxygen in $ per 1000 scf
+        double stoichiometricOxygen; ///< scf of O2 needed to burn 1 MM Btu of fuel, about 1980 for natural gas
+        double fuelHeatingValue; ///< Btu/scf, about 1020 for natural gas
+        double ambientTemp; ///< temperature of the combustion air before preheating in °F
+        double recuperatorEffectiveness; ///< fraction of the flue gas to ambient temperature difference recoverable
+        Range combAirTemps; ///< combustion air preheat temperatures to search in °F
+        Range o2FlueGases; ///< % of dry O2 in the flue gas to search
+        Range o2CombAirs; ///< % of O2 in the combustion air to search, from 21
+    };
+
+    /**
+     * One configuration of the furnace and its annual costs
+     */
+    struct Candidate {
+        double combAirTemp; ///< °F
+        double o2FlueGas; ///< % dry
+        double o2CombAir; ///< %
+        double excessAir; ///< fraction, at the flue gas O2 and combustion air O2 of the configuration
+        double availableHeat; ///< % of the heat input available to the furnace
+        double fuelConsumption; ///< MM Btu/hr
+        double fuelSavings; ///< % of the current fuel consumption
+        double oxygenFlow; ///< purchased oxygen in scf/hr
+        double fuelCost; ///< $/yr
+        double oxygenCost; ///< $/yr
+        double totalCost; ///< $/yr
+    };
+
+    struct Results {
+        Candidate baseline; ///< the current operation
+        std::vector<Candidate> paretoSet; ///< non-dominated feasible candidates, lowest total cost first
+        std::size_t candidates; ///< number of configurations evaluated
+        std::size_t feasibleCandidates; ///< number of configurations that meet the constraints
+    };
+
+    /**
+     * Evaluates one configuration of the furnace, relative to the current operation in inputs
+     * @param inputs Inputs, current operation and costs; the ranges are not used
+     * @param combAirTemp double, combustion air preheat temperature in °F
+     * @param o2FlueGas double, % of dry O2 in the flue gas
+     * @param o2CombAir double, % of O2 in the combustion air
+     * @return Candidate, fuel and oxygen use and annual costs
+     */
+    static Candidate evaluate(const Inputs &inputs, double combAirTemp, double o2FlueGas, double o2CombAir);
+
+    /**
+     * Checks that a configuration can be operated: the flue gas leaves heat available to the furnace and the preheat
+     * temperature can be reached with the recuperator, modeled with AirHeatingUsingExhaust
+     * @param inputs Inputs, current operation and costs
+     * @param candidate Candidate, evaluated configuration
+     * @return bool, true if the configuration meets the constraints
+     */
+    static bool isFeasible(const Inputs &inputs, const Candidate &candidate);
+
+    /**
+     * Evaluates every configuration of the search ranges and returns the Pareto set of fuel cost and oxygen cost
+     * @param inputs Inputs, current operation, costs and search ranges
+     * @param threads unsigned, number of threads evaluating candidates, 0 for one per hardware thread
+     * @return Results, the baseline and the ranked Pareto set
+     */
+    static Results optimize(const Inputs &inputs, unsigned threads = 0);
+
+private:
+    /**
+     * Keeps the candidates that no other candidate beats on both fuel cost and oxygen cost, sorted by fuel cost
+     */
+    static std::vector<Candidate> getParetoSet(std::vector<Candidate> candidates);
+};
+
+#endif //AMO_TOOLS_SUITE_FURNACEEFFICIENCYOPTIMIZER_H
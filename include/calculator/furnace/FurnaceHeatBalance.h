@@ -0,0 +1,136 @@
+/**
+ * @file
+ * @brief Heat balance of a complete process heating furnace
+ *
+ * Combines the individual PHAST loss calculators: one description of a furnace, with a list of loss items of each
+ * type, gives the heat to the charge, every loss total, the flue gas loss, gross heat input, efficiency and energy
+ * intensity in one pass. Baseline and modification pairs of any number of furnaces are evaluated together for a plant
+ * assessment.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_FURNACEHEATBALANCE_H
+#define AMO_TOOLS_SUITE_FURNACEHEATBALANCE_H
+
+#include <memory>
+#include <vector>
+#include "calculator/losses/Atmosphere.h"
+#include "calculator/losses/AuxiliaryPower.h"
+#include "calculator/losses/FixtureLosses.h"
+#include "calculator/losses/GasCoolingLosses.h"
+#include "calculator/losses/GasFlueGasMaterial.h"
+#include "calculator/losses/GasLoadChargeMaterial.h"
+#include "calculator/losses/LeakageLosses.h"
+#include "calculator/losses/LiquidCoolingLosses.h"
+#include "calculator/losses/LiquidLoadChargeMaterial.h"
+#include "calculator/losses/OpeningLosses.h"
+#include "calculator/losses/SlagOtherMaterialLosses.h"
+#include "calculator/losses/SolidLiquidFlueGasMaterial.h"
+#include "calculator/losses/SolidLoadChargeMaterial.h"
+#include "calculator/losses/WallLosses.h"
+#include "calculator/losses/WaterCoolingLosses.h"
+
+/**
+ * Furnace Heat Balance class
+ * Used to calculate the losses, gross heat input and efficiency of one or more furnaces.
+ */
+class FurnaceHeatBalance {
+public:
+    /**
+     * Description of a furnace. Every list may be empty. Fuel fired furnaces give one flue gas, by volume for gas
+     * fuels or by mass for solid and liquid fuels; without a flue gas all of the heat input is available to the
+     * furnace, e.g. for electrically heated furnaces.
+     */
+    struct Furnace {
+        std::vector<GasLoadChargeMaterial> gasChargeMaterials;
+        std::vector<LiquidLoadChargeMaterial> liquidChargeMaterials;
+        std::vector<SolidLoadChargeMaterial> solidChargeMaterials;
+        std::vector<FixtureLosses> fixtures;
+        std::vector<WallLosses> walls;
+        std::vector<OpeningLosses> openings;
+        std::vector<Atmosphere> atmospheres;
+        std::vector<LeakageLosses> leakages;
+        std::vector<GasCoolingLosses> gasCoolings;
+        std::vector<LiquidCoolingLosses> liquidCoolings;
+        std::vector<WaterCoolingLosses> waterCoolings;
+        std::vector<SlagOtherMaterialLosses> slags;
+        std::vector<double> otherLosses; ///< user defined losses in btu/hr
+        std::vector<AuxiliaryPower> auxiliaryPowers;
+        std::shared_ptr<GasFlueGasMaterial> gasFlueGas;
+        std::shared_ptr<SolidLiquidFlueGasMaterial> solidLiquidFlueGas;
+    };
+
+    /**
+     * Heat balance of a furnace, heat in btu/hr
+     */
+    struct Results {
+        double chargeMaterials; ///< net heat required by the charge (load) materials
+        double fixtures;
+        double walls;
+        double openings;
+        double atmospheres;
+        double leakages;
+        double coolings; ///< gas, liquid and water cooling
+        double slags;
+        double otherLosses;
+        double totalNetHeatRequired; ///< heat to the charge plus every loss above
+        double availableHeat; ///< % of the gross heat input available to the furnace, 100 without a flue gas
+        double flueGasLosses;
+        double grossHeatInput;
+        double auxiliaryPower; ///< electricity used by the furnace auxiliaries in btu/hr, not part of the heat balance
+        double chargeFeedRate; ///< total charge (load) feed rate in lb/hr
+        double efficiency; ///< % of the gross heat input taken up by the charge
+        double energyIntensity; ///< gross heat input per lb of charge in btu/lb, 0 without charge materials
+    };
+
+    /**
+     * Baseline and modified version of one furnace
+     */
+    struct Assessment {
+        Furnace baseline;
+        Furnace modification;
+    };
+
+    struct AssessmentResults {
+        Results baseline;
+        Results modification;
+        double energySavings; ///< reduction in gross heat input in btu/hr
+        double percentSavings; ///< reduction in gross heat input as % of the baseline
+    };
+
+    /**
+     * Results of every furnace of a plant, with the plant totals
+     */
+    struct PlantResults {
+        std::vector<AssessmentResults> furnaces;
+        double baselineGrossHeatInput; ///< btu/hr
+        double modificationGrossHeatInput; ///< btu/hr
+        double energySavings; ///< btu/hr
+        double percentSavings; ///< % of the baseline gross heat input
+    };
+
+    /**
+     * Calculates the heat balance of a furnace
+     * @param furnace Furnace, description of the furnace
+     * @return Results, losses, gross heat input and efficiency
+     */
+    static Results calculate(const Furnace &furnace);
+
+    /**
+     * Calculates the heat balance of the baseline and the modification of a furnace
+     * @param assessment Assessment, baseline and modified furnace
+     * @return AssessmentResults, results of both and the energy savings
+     */
+    static AssessmentResults calculate(const Assessment &assessment);
+
+    /**
+     * Calculates the heat balance of the baseline and the modification of every furnace of a plant
+     * @param assessments std::vector<Assessment>, baseline and modification of each furnace
+     * @return PlantResults, results of each furnace, in order, and the plant totals
+     */
+    static PlantResults calculate(const std::vector<Assessment> &assessments);
+};
+
+#endif //AMO_TOOLS_SUITE_FURNACEHEATBALANCE_H
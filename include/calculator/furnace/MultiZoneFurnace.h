@@ -0,0 +1,83 @@
+/**
+ * @file
+ * @brief Simulation of a continuous furnace with several zones in series
+ *
+ * A solid charge passes through each zone in turn. Every zone has its own walls, openings, atmospheres, flue gas and
+ * firing rate; the heat of each zone that is left after its losses and flue gas losses goes into the charge, and the
+ * charge leaves the zone at the temperature that heat brings it to, which is its inlet temperature in the next zone.
+ * Independent furnaces are simulated in parallel.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_MULTIZONEFURNACE_H
+#define AMO_TOOLS_SUITE_MULTIZONEFURNACE_H
+
+#include <vector>
+#include "calculator/furnace/FurnaceHeatBalance.h"
+
+/**
+ * Multi Zone Furnace class
+ * Used to calculate the charge temperature and losses of each zone of a continuous furnace.
+ */
+class MultiZoneFurnace {
+public:
+    /**
+     * One zone of the furnace
+     */
+    struct Zone {
+        FurnaceHeatBalance::Furnace losses; ///< loss items and flue gas of the zone, without charge materials
+        double grossHeatInput; ///< heat fired in the zone in btu/hr
+    };
+
+    /**
+     * A furnace and the charge passing through it. The charge gives the material, feed rate, moisture, initial
+     * temperature, part melted and reaction of the charge; its discharge temperature is not used. The heat to remove
+     * the moisture, the heat of reaction and any additional heat are taken up in the first zone.
+     */
+    struct Furnace {
+        SolidLoadChargeMaterial charge;
+        std::vector<Zone> zones;
+    };
+
+    /**
+     * Heat balance of a zone, heat in btu/hr
+     */
+    struct ZoneResults {
+        double chargeInletTemperature; ///< °F
+        double chargeOutletTemperature; ///< °F
+        double walls;
+        double openings;
+        double atmospheres;
+        double totalLosses; ///< every loss of the zone, including walls, openings and atmospheres
+        double availableHeat; ///< % of the gross heat input available to the zone
+        double flueGasLosses;
+        double heatToCharge; ///< heat taken up by the charge, negative when the charge cools
+    };
+
+    struct Results {
+        std::vector<ZoneResults> zones;
+        double dischargeTemperature; ///< charge temperature leaving the last zone in °F
+        double grossHeatInput; ///< btu/hr
+        double heatToCharge; ///< btu/hr
+        double efficiency; ///< % of the gross heat input taken up by the charge
+    };
+
+    /**
+     * Simulates a furnace zone by zone
+     * @param furnace Furnace, charge and zones in the order the charge passes through them
+     * @return Results, charge temperatures and heat balance of each zone
+     */
+    static Results simulate(const Furnace &furnace);
+
+    /**
+     * Simulates independent furnaces
+     * @param furnaces std::vector<Furnace>, furnaces to simulate
+     * @param threads unsigned, number of threads simulating furnaces, 0 for one per hardware thread
+     * @return std::vector<Results>, results of each furnace, in order
+     */
+    static std::vector<Results> simulate(const std::vector<Furnace> &furnaces, unsigned threads = 0);
+};
+
+#endif //AMO_TOOLS_SUITE_MULTIZONEFURNACE_H
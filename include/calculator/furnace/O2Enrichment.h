@@ -37,12 +37,30 @@ public:
               flueGasTempEnriched(flueGasTempEnriched), o2FlueGas(o2FlueGas / 100),
               o2FlueGasEnriched(o2FlueGasEnriched / 100), combAirTemp(combAirTemp),
               combAirTempEnriched(combAirTempEnriched), fuelConsumption(fuelConsumption)
-    {
-        calculate();
-    }
+    {}
 
     O2Enrichment() = default;
 
+    /**
+     * Sets every input at once, e.g. for one step of a sweep. Like the individual setters it only marks the results
+     * out of date, they are calculated once, on the next read.
+     * @param o2CombAir double, % of O2 in the combustion air
+     * @param o2CombAirEnriched double, % of O2 in the oxygen enriched combustion air
+     * @param flueGasTemp double, flue gas temperature in °F
+     * @param flueGasTempEnriched double, flue gas temperature with oxygen enriched air in °F
+     * @param o2FlueGas double, % of dry O2 in flue gas
+     * @param o2FlueGasEnriched double, % of dry O2 in flue gas with oxygen enriched air
+     * @param combAirTemp double, combustion air preheat temperature in °F
+     * @param combAirTempEnriched double, combustion air preheat temperature with oxygen enriched air in °F
+     * @param fuelConsumption double, fuel consumption in MM Btu/hr
+     */
+    void setInputs(const double o2CombAir, const double o2CombAirEnriched, const double flueGasTemp,
+                   const double flueGasTempEnriched, const double o2FlueGas, const double o2FlueGasEnriched,
+                   const double combAirTemp, const double combAirTempEnriched, const double fuelConsumption) {
+        *this = O2Enrichment(o2CombAir, o2CombAirEnriched, flueGasTemp, flueGasTempEnriched, o2FlueGas,
+                             o2FlueGasEnriched, combAirTemp, combAirTempEnriched, fuelConsumption);
+    }
+
     /**
      * Gets the O2 in combustion air
      * @return double, % of O2 in combustion air
@@ -55,7 +73,7 @@ public:
      */
     void setO2CombAir(const double o2CombAir) {
         this->o2CombAir = o2CombAir / 100;
-        calculate();
+        calculated = false;
     }
 
     /**
@@ -70,7 +88,7 @@ public:
      */
     void setO2CombAirEnriched(double o2CombAirEnriched) {
         this->o2CombAirEnriched = o2CombAirEnriched / 100;
-        calculate();
+        calculated = false;
     }
 
     /**
@@ -85,7 +103,7 @@ public:
      */
     void setFlueGasTemp(double flueGasTemp) {
         this->flueGasTemp = flueGasTemp;
-        calculate();
+        calculated = false;
     }
 
     /**
@@ -100,7 +118,7 @@ public:
      */
     void setFlueGasTempEnriched(double flueGasTempEnriched) {
         this->flueGasTempEnriched = flueGasTempEnriched;
-        calculate();
+        calculated = false;
     }
 
     /**
@@ -115,7 +133,7 @@ public:
      */
     void setO2FlueGas(double o2FlueGas) {
         this->o2FlueGas = o2FlueGas / 100;
-        calculate();
+        calculated = false;
     }
 
     /**
@@ -130,7 +148,7 @@ public:
      */
     void setO2FlueGasEnriched(double o2FlueGasEnriched) {
         this->o2FlueGasEnriched = o2FlueGasEnriched / 100;
-        calculate();
+        calculated = false;
     }
 
     /**
@@ -145,7 +163,7 @@ public:
      */
     void setCombAirTemp(double combAirTemp) {
         this->combAirTemp = combAirTemp;
-        calculate();
+        calculated = false;
     }
 
     /**
@@ -160,7 +178,7 @@ public:
      */
     void setCombAirTempEnriched(double combAirTempEnriched) {
         this->combAirTempEnriched = combAirTempEnriched;
-        calculate();
+        calculated = false;
     }
 
     /**
@@ -175,113 +193,119 @@ public:
      */
     void setFuelConsumption(double fuelConsumption) {
         this->fuelConsumption = fuelConsumption;
-        calculate();
+        calculated = false;
     }
 
     /**
      * Gets the excess air
      * @return double, excess air as %
      */
-    double getExcessAir() { return excessAir; };
+    double getExcessAir() { calculateIfNeeded(); return excessAir; }
 
     /**
      * Gets the excess air with oxygen enrichment
      * @return double, excess air with oxygen enrichment as %
      */
-    double getExcessAirEnriched() { return excessAirEnriched; };
+    double getExcessAirEnriched() { calculateIfNeeded(); return excessAirEnriched; }
 
     /**
      * Gets the heat input
      * @return double, heat input in °F
      */
-    double getHeatInput() { return heatInput; };
+    double getHeatInput() { calculateIfNeeded(); return heatInput; }
 
     /**
      * Gets the heat input with oxygen enrichment
      * @return double, heat input with oxygen enrichment in °F
      */
-    double getHeatInputEnriched() { return heatInputEnriched; };
+    double getHeatInputEnriched() { calculateIfNeeded(); return heatInputEnriched; }
 
     /**
      * Gets the specific heat of air
      * @return double, specific heat of air in Btu/(lb*°F)
      */
-    double getAirSpecificHeat() { return airSpecificHeat; };
+    double getAirSpecificHeat() { calculateIfNeeded(); return airSpecificHeat; }
 
     /**
      * Gets the specific heat of air with oxygen enrichment
      * @return double, specific heat of air with oxygen enrichment in Btu/(lb*°F)
      */
-    double getEnrichedAirSpecificHeat() { return enrichedAirSpecificHeat; };
+    double getEnrichedAirSpecificHeat() { calculateIfNeeded(); return enrichedAirSpecificHeat; }
 
     /**
      * Gets the air correction
      * @return double, air correction in btu
      */
-    double getAirCorrection() { return airCorrection; };
+    double getAirCorrection() { calculateIfNeeded(); return airCorrection; }
 
     /**
      * Gets the air correction with oxygen enrichment
      * @return double, air correction with oxygen enrichment in btu
      */
-    double getEnrichedAirCorrection() { return enrichedAirCorrection; };
+    double getEnrichedAirCorrection() { calculateIfNeeded(); return enrichedAirCorrection; }
 
     /**
      * Gets the combustion air correction
      * @return double, combustion air correction in btu
      */
-    double getCombustionAirCorrection() { return combustionAirCorrection; };
+    double getCombustionAirCorrection() { calculateIfNeeded(); return combustionAirCorrection; }
 
     /**
      * Gets the combustion air correction with oxygen enrichment
      * @return double, combustion air correction with oxygen enrichment in btu
      */
-    double getCombustionAirCorrectionEnriched() { return combustionAirCorrectionEnriched; };
+    double getCombustionAirCorrectionEnriched() { calculateIfNeeded(); return combustionAirCorrectionEnriched; }
 
     /**
      * Gets the standard available heat (this does not take % of O2 in combustion air into account)
      * @return double, standard available heat as %
      */
-    double getStdAvailableHeat() { return stdAvailableHeat; };
+    double getStdAvailableHeat() { calculateIfNeeded(); return stdAvailableHeat; }
 
     /**
      * Gets the standard available heat with oxygen enrichment (this does not take % of O2 in combustion air into account)
      * @return double, standard available heat with oxygen enrichment as %
      */
-    double getStdAvailableHeatEnriched() { return stdAvailableHeatEnriched; };
+    double getStdAvailableHeatEnriched() { calculateIfNeeded(); return stdAvailableHeatEnriched; }
 
     /**
      * Gets the available heat (uses % of O2 in combustion air)
      * @return double, available heat as % of HHV
      */
-    double getAvailableHeat() { return availableHeat; };
+    double getAvailableHeat() { calculateIfNeeded(); return availableHeat; }
 
     /**
      * Gets the available heat with oxygen enrichment (uses % of O2 in combustion air)
      * @return double, available heat with oxygen enrichment as % of HHV
      */
-    double getAvailableHeatEnriched() { return availableHeatEnriched; };
+    double getAvailableHeatEnriched() { calculateIfNeeded(); return availableHeatEnriched; }
 
     /**
      * Gets the fuel consumption with oxygen enrichment
      * @return double, fuel consumption with oxygen enrichment in MM Btu/hr
      */
-    double getFuelConsumptionEnriched() { return fuelConsumptionEnriched; };
+    double getFuelConsumptionEnriched() { calculateIfNeeded(); return fuelConsumptionEnriched; }
 
     /**
      * Gets the fuel savings with oxygen enrichment
      * @return double, % of fuel savings
      */
-    double getFuelSavingsEnriched() { return fuelSavingsEnriched; };
+    double getFuelSavingsEnriched() { calculateIfNeeded(); return fuelSavingsEnriched; }
 
     /**
-     * Calculates available heat, available heat enriched, fuel consumption enriched, and fuel saving enriched
-     * @return double, available heat as % of HHV
+     * Calculates available heat, available heat enriched, fuel consumption enriched, and fuel saving enriched. The
+     * getters call it when an input has changed since the last calculation.
      */
     void calculate();
 
 
 private:
+    void calculateIfNeeded() {
+        if (!calculated) calculate();
+    }
+
+    bool calculated = false;
+
     // In values
     double o2CombAir, o2CombAirEnriched, flueGasTemp, flueGasTempEnriched, o2FlueGas, o2FlueGasEnriched, combAirTemp;
     double combAirTempEnriched, fuelConsumption;
@@ -10,6 +10,7 @@
  *
  */
 
+#include <cstddef>
 #include <string>
 
 #ifndef AMO_SUITE_ATMOSPHERE_H
@@ -141,6 +142,18 @@ public:
      */
     double getTotalHeat();
 
+    /**
+     * Calculates the total heat loss of every sample of a time series; inputs without a series are held at the
+     * values of this object
+     * @param count std::size_t, number of samples
+     * @param inletTemperature const double *, inlet temperature of each sample in °F, or nullptr
+     * @param outletTemperature const double *, outlet temperature of each sample in °F, or nullptr
+     * @param flowRate const double *, flow rate of each sample in scfh, or nullptr
+     * @param totalHeat double *, receives the total heat loss of each sample in btu/hr
+     */
+    void getTotalHeatSeries(std::size_t count, const double *inletTemperature, const double *outletTemperature,
+                            const double *flowRate, double *totalHeat) const;
+
     /**
      * Gets the name of substance
      * @return string, name of substance
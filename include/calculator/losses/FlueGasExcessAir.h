@@ -0,0 +1,27 @@
+/**
+ * @file
+ * @brief Limits of the excess air found from a measured flue gas O2, shared by the flue gas calculators
+ *
+ * No O2 is left in the flue gas at 0 excess air, and O2 approaches that of air as excess air grows, so O2 levels at
+ * or above those of air have no solution. The calculators then return MAX_EXCESS_AIR.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_FLUEGASEXCESSAIR_H
+#define AMO_TOOLS_SUITE_FLUEGASEXCESSAIR_H
+
+struct FlueGasExcessAir {
+    /**
+     * Default absolute tolerance of an excess air fraction that has to be searched for
+     */
+    static constexpr double TOLERANCE = 1e-10;
+
+    /**
+     * Largest excess air fraction, returned for flue gas O2 levels that would need more excess air
+     */
+    static constexpr double MAX_EXCESS_AIR = 1000;
+};
+
+#endif //AMO_TOOLS_SUITE_FLUEGASEXCESSAIR_H
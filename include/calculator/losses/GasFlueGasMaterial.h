@@ -12,11 +12,11 @@
 #ifndef AMO_SUITE_GASFLUEGASMATERIAL_H
 #define AMO_SUITE_GASFLUEGASMATERIAL_H
 
-#include <unordered_map>
-#include <functional>
+#include <array>
 #include <string>
 #include <cmath>
-#include <memory>
+#include <stdexcept>
+#include "calculator/losses/FlueGasExcessAir.h"
 
 /**
  * Gas Properties class
@@ -25,8 +25,22 @@
 class GasProperties {
 public:
 	/**
+	 * Specific heat of a gas in btu/(lb-mol*°R) as a function of the absolute temperature t in °R, stored as the
+	 * coefficients of a + b*t + c/t + d/t^2 + e/sqrt(t), which covers every correlation in the flue gas tables
+	 */
+	struct SpecificHeat {
+		double constant, linear, inverse, inverseSquare, inverseRoot;
+
+		double operator()(const double t) const {
+			return constant + linear * t + inverse / t + inverseSquare / (t * t) + inverseRoot / std::sqrt(t);
+		}
+	};
+
+	GasProperties() = default;
+
+	/**
      * Constructor
-     * @param specificHeat double, specific heat in btu/(lb*°F)
+     * @param specificHeat SpecificHeat, coefficients of the specific heat in btu/(lb-mol*°R)
      * @param molecularWeight double, molecular weight in g/mol
      * @param specificWeight double, specific weight in lb/scf
      * @param compPercent double, composition percent as %
@@ -38,7 +52,7 @@ public:
      * @param co2Generated double, CO2 generated in g/mol
      */
 
-	GasProperties( std::function< double ( double t ) > specificHeat,
+	GasProperties( const SpecificHeat specificHeat,
 	               const double molecularWeight,
 	               const double specificWeight,
 	               const double compPercent,
@@ -48,20 +62,20 @@ public:
 	               const int heatingValueVolume,
 	               const double h2oGenerated,
 	               const double co2Generated) :
-			specificHeat(std::move(specificHeat)), molecularWeight(molecularWeight), specificWeight(specificWeight),
+			specificHeat(specificHeat), molecularWeight(molecularWeight), specificWeight(specificWeight),
 	        compByVol(compPercent), compAdjByVol(compByVol), h2oGenerated(h2oGenerated), co2Generated(co2Generated),
 			o2Generated(o2Generated), heatingValue(heatingValue), heatingValueVolume(heatingValueVolume)
 	{};
 
 private:
 	friend class GasCompositions;
-	const std::function< double ( double t ) > specificHeat;
+	SpecificHeat specificHeat = {0, 0, 0, 0, 0};
 	// compByWeight == X double bar, compAdjByVol == X bar in document
 	double compByWeight = 0;
-	const double molecularWeight, specificWeight, compByVol, compAdjByVol, h2oGenerated, co2Generated;
+	double molecularWeight = 0, specificWeight = 0, compByVol = 0, compAdjByVol = 0, h2oGenerated = 0, co2Generated = 0;
 
 	// TODO so2Generated is always 0 according to the one table, are these all the gas types we deal with or not?
-	const int so2Generated = 0, o2Generated, heatingValue, heatingValueVolume;
+	int so2Generated = 0, o2Generated = 0, heatingValue = 0, heatingValueVolume = 0;
 };
 
 
@@ -73,6 +87,15 @@ private:
  */
 class GasCompositions {
 public:
+	/**
+	 * The gasses of a composition, in the order of the constructor parameters, used to index its properties
+	 */
+	enum class Gas {
+		CH4, C2H6, N2, H2, C3H8, C4H10_CnH2n, H2O, CO, CO2, SO2, O2
+	};
+
+	static const std::size_t GAS_COUNT = 11;
+
 	/**
 	 * Constructor for GasCompositions with which flue gas losses will be calculated. All molecule parameters are the
 	 * percentage of that molecule present in the fuel
@@ -96,33 +119,8 @@ public:
 	                const double CO, const double CO2, const double SO2, const double O2) :
 			substance(std::move(substance)),
 			totalPercent(CH4 + C2H6 + N2 + H2 + C3H8 + C4H10_CnH2n + H2O + CO + CO2 + SO2 + O2),
-			CH4(std::make_shared<GasProperties>([] (double t) { return 4.23 + 0.01177 * t; }, 16.042, 0.042417, CH4,
-			                  CH4 / totalPercent, 64, 23875, 1012, 36.032, 44.01)),
-			C2H6(std::make_shared<GasProperties>([] (double t) { return 4.04 + 0.01636 * t; }, 30.068, 0.079503, C2H6,
-			                   C2H6 / totalPercent, 112, 22323, 1773, 54.048, 88.02)),
-			N2(std::make_shared<GasProperties>([] (double t) { return 9.47 - 3.47 * 1000 / t + 1.07 * 1000000 / (t * t); },
-			                 28.016, 0.074077, N2, N2 / totalPercent, 0, 0, 0, 0, 0)),
-			H2(std::make_shared<GasProperties>([] (double t) { return 5.76 + 0.578 * t / 1000 + 20 / pow(t, 0.5); }, 2.016, 0.005331,
-			                 H2, H2 / totalPercent, 16, 61095, 325, 18.016, 0)),
-			C3H8(std::make_shared<GasProperties>([] (double t) { (void)t; return 17.108; }, 44.094, 0.116589, C3H8,
-			                   C3H8 / totalPercent, 160, 21669, 2523, 72.064, 132.03)),
-			C4H10_CnH2n(std::make_shared<GasProperties>([] (double t) { (void)t; return 22.202; }, 58.12, 0.153675, C4H10_CnH2n,
-			                          C4H10_CnH2n / totalPercent, 208, 21321, 3270, 90.08, 176.04)),
-			H2O(std::make_shared<GasProperties>([] (double t) { return 19.86 - 597 / pow(t, 0.5) + 7500 / t; }, 18.016, 0.047636, H2O,
-			                  H2O / totalPercent, 0, 0, 0, 18.016, 0)),
-			CO(std::make_shared<GasProperties>([] (double t) { return 9.46 - 3.29 * 1000 / t + 1.07 * 1000000 / (t * t); },
-			                 28.01, 0.074061, CO, CO / totalPercent, 16, 4347, 321, 0, 44.01)),
-			CO2(std::make_shared<GasProperties>([] (double t) { return 16.2 - 6.53 * 1000 / t + 1.41 * 1000000 / (t * t); },
-			                  44.01, 0.116367, CO2, CO2 / totalPercent, 0, 0, 0, 0, 44.01)),
-			SO2(std::make_shared<GasProperties>([] (double t) { (void)t; return 17.472; }, 64.06, 0.169381, SO2, SO2 * 100 / totalPercent,
-			                  0, 0, 0, 0, 0)),
-			O2(std::make_shared<GasProperties>([] (double t) { return 11.515 - 172 / pow(t, 0.5) + 1530 / t; }, 32.00, 0.084611, O2,
-			                 O2 / totalPercent, -32, 0, 0, 0, 0))
+			gasses(makeGasses(CH4, C2H6, N2, H2, C3H8, C4H10_CnH2n, H2O, CO, CO2, SO2, O2, totalPercent))
 	{
-		gasses = {{"CH4", this->CH4}, {"C2H6", this->C2H6}, {"N2", this->N2}, {"H2", this->H2},
-		          {"C3H8", this->C3H8}, {"C4H10_CnH2n", this->C4H10_CnH2n}, {"H2O", this->H2O}, {"CO", this->CO},
-		          {"CO2", this->CO2}, {"SO2", this->SO2}, {"O2", this->O2}};
-
 		calculateCompByWeight();
 		heatingValue = calculateHeatingValueFuel();
 		heatingValueVolume = calculateHeatingValueFuelVolume();
@@ -135,12 +133,15 @@ public:
      * @param gasName const string, name of gas
      * @return double, composition by volume as %
      */
-	double getGasByVol(const std::string & gasName) const {
-		auto const gas = gasses.find(gasName);
-		if (gas == gasses.end()) {
-			throw std::runtime_error("Cannot find " + gasName + " in gasses");
-		}
-		return gas->second->compByVol;
+	double getGasByVol(const std::string & gasName) const;
+
+    /**
+     * Gets the gas by its index
+     * @param gas Gas, the gas
+     * @return double, composition by volume as %
+     */
+	double getGasByVol(const Gas gas) const {
+		return get(gas).compByVol;
 	}
 
 	double getHeatingValue() const { return heatingValue; };
@@ -148,7 +149,19 @@ public:
 	double getSpecificGravity() const { return specificGravity; };
 	double getStoichometricAir() const { return stoichometricAir; };
 
+	/**
+	 * Calculates the excess air that results in the given O2 in the flue gas. The flue gas masses are linear in excess
+	 * air, so it is solved for in closed form.
+	 * @param flueGasO2 double, O2 in flue gas as a fraction
+	 * @return double, excess air as a fraction, FlueGasExcessAir::MAX_EXCESS_AIR when the O2 has no solution
+	 */
 	double calculateExcessAir(double flueGasO2);
+
+	/**
+	 * Calculates the O2 in the flue gas given excess air
+	 * @param excessAir double, excess air as a fraction
+	 * @return double, O2 in flue gas as a fraction
+	 */
 	double calculateO2(double excessAir);
 
     /**
@@ -177,6 +190,14 @@ private:
 	friend class GasFlueGasMaterial;
 	friend class SQLite;
 
+	static std::array<GasProperties, GAS_COUNT> makeGasses(double CH4, double C2H6, double N2, double H2, double C3H8,
+	                                                       double C4H10_CnH2n, double H2O, double CO, double CO2,
+	                                                       double SO2, double O2, double totalPercent);
+
+	const GasProperties & get(const Gas gas) const {
+		return gasses[static_cast<std::size_t>(gas)];
+	}
+
 	double calculateSpecificGravity();
 	double calculateStoichometricAir();
 
@@ -189,52 +210,42 @@ private:
 	void calculateEnthalpy();
 	double calculateTotalHeatContentFlueGas(double flueGasTemperature);
 
+	/**
+	 * Flue gas masses per lb of fuel as a linear function of excess air:
+	 * mO2 = o2PerExcessAir * excessAir and mN2 = n2Stoichiometric + n2PerExcessAir * excessAir
+	 */
+	struct FlueGasMasses {
+		double h2o, co2, so2, n2Stoichiometric, o2PerExcessAir, n2PerExcessAir;
+
+		/**
+		 * @param flueGasO2 double, O2 in flue gas as a fraction
+		 * @return double, excess air as a fraction, between -1 and FlueGasExcessAir::MAX_EXCESS_AIR
+		 */
+		double excessAir(double flueGasO2) const;
+		void set(GasCompositions & compositions, double excessAir) const;
+	};
+	FlueGasMasses calculateFlueGasMasses();
+
 	GasCompositions(std::string substance, const double CH4, const double C2H6, const double N2,
 	                const double H2, const double C3H8, const double C4H10_CnH2n, const double H2O,
 	                const double CO, const double CO2, const double SO2, const double O2, const double heatingValue,
 	                const double heatingValueVolume, const double specificGravity, const double stoichometricAir = 0) :
 			substance(std::move(substance)),
 			totalPercent(CH4 + C2H6 + N2 + H2 + C3H8 + C4H10_CnH2n + H2O + CO + CO2 + SO2 + O2),
-			CH4(std::make_shared<GasProperties>([] (double t) { return 4.23 + 0.01177 * t; }, 16.042, 0.042417, CH4,
-			                                    CH4 / totalPercent, 64, 23875, 1012, 36.032, 44.01)),
-			C2H6(std::make_shared<GasProperties>([] (double t) { return 4.04 + 0.01636 * t; }, 30.068, 0.079503, C2H6,
-			                                     C2H6 / totalPercent, 112, 22323, 1773, 54.048, 88.02)),
-			N2(std::make_shared<GasProperties>([] (double t) { return 9.47 - 3.47 * 1000 / t + 1.07 * 1000000 / (t * t); },
-			                                   28.016, 0.074077, N2, N2 / totalPercent, 0, 0, 0, 0, 0)),
-			H2(std::make_shared<GasProperties>([] (double t) { return 5.76 + 0.578 * t / 1000 + 20 / pow(t, 0.5); }, 2.016, 0.005331,
-			                                   H2, H2 / totalPercent, 16, 61095, 325, 18.016, 0)),
-			C3H8(std::make_shared<GasProperties>([] (double t) { (void)t; return 17.108; }, 44.094, 0.116589, C3H8,
-			                                     C3H8 / totalPercent, 160, 21669, 2523, 72.064, 132.03)),
-			C4H10_CnH2n(std::make_shared<GasProperties>([] (double t) { (void)t; return 22.202; }, 58.12, 0.153675, C4H10_CnH2n,
-			                                            C4H10_CnH2n / totalPercent, 208, 21321, 3270, 90.08, 176.04)),
-			H2O(std::make_shared<GasProperties>([] (double t) { return 19.86 - 597 / pow(t, 0.5) + 7500 / t; }, 18.016, 0.047636, H2O,
-			                                    H2O / totalPercent, 0, 0, 0, 18.016, 0)),
-			CO(std::make_shared<GasProperties>([] (double t) { return 9.46 - 3.29 * 1000 / t + 1.07 * 1000000 / (t * t); },
-			                                   28.01, 0.074061, CO, CO / totalPercent, 16, 4347, 321, 0, 44.01)),
-			CO2(std::make_shared<GasProperties>([] (double t) { return 16.2 - 6.53 * 1000 / t + 1.41 * 1000000 / (t * t); },
-			                                    44.01, 0.116367, CO2, CO2 / totalPercent, 0, 0, 0, 0, 44.01)),
-			SO2(std::make_shared<GasProperties>([] (double t) { (void)t; return 17.472; }, 64.06, 0.169381, SO2, SO2 * 100 / totalPercent,
-			                                    0, 0, 0, 0, 0)),
-			O2(std::make_shared<GasProperties>([] (double t) { return 11.515 - 172 / pow(t, 0.5) + 1530 / t; }, 32.00, 0.084611, O2,
-			                                   O2 / totalPercent, -32, 0, 0, 0, 0)),
+			gasses(makeGasses(CH4, C2H6, N2, H2, C3H8, C4H10_CnH2n, H2O, CO, CO2, SO2, O2, totalPercent)),
 			heatingValue(heatingValue),
 			specificGravity(specificGravity),
 			heatingValueVolume(heatingValueVolume),
             stoichometricAir(stoichometricAir)
-	{
-		gasses = {{"CH4", this->CH4}, {"C2H6", this->C2H6}, {"N2", this->N2}, {"H2", this->H2},
-		          {"C3H8", this->C3H8}, {"C4H10_CnH2n", this->C4H10_CnH2n}, {"H2O", this->H2O}, {"CO", this->CO},
-		          {"CO2", this->CO2}, {"SO2", this->SO2}, {"O2", this->O2}};
-	}
+	{}
 
-	// the hash map holds a reference to the GasProperties below for easier iterable summations
-	std::unordered_map <std::string, std::shared_ptr<GasProperties>> gasses;
 	int id = 0;
 	std::string substance;
 	double totalPercent;
+	// indexed by Gas, held by value so the summations below run over contiguous memory
+	std::array<GasProperties, GAS_COUNT> gasses;
 	double hH2Osat = 0, tH2Osat = 0;
 	double mH2O = 0, mCO2 = 0, mO2 = 0, mN2 = 0, mSO2 = 0;
-	std::shared_ptr<GasProperties> CH4, C2H6, N2, H2, C3H8, C4H10_CnH2n, H2O, CO, CO2, SO2, O2;
 	double heatingValue = 0, specificGravity = 0, heatingValueVolume = 0, stoichometricAir = 0;
 };
 
@@ -269,6 +280,19 @@ public:
      */
     double getHeatLoss();
 
+    /**
+     * Calculates the available heat of every sample of a time series; inputs without a series are held at the values
+     * of this object. The excess air of each sample is found from its flue gas O2, exactly, as the flue gas O2 and
+     * N2 grow linearly with excess air while the other products of combustion do not depend on it.
+     * @param count std::size_t, number of samples
+     * @param flueGasTemperature const double *, flue gas temperature of each sample in °F, or nullptr
+     * @param flueGasO2 const double *, O2 in flue gas of each sample as a fraction, or nullptr to use the excess air
+     * @param combustionAirTemperature const double *, combustion air temperature of each sample in °F, or nullptr
+     * @param availableHeat double *, receives the available heat of each sample as a fraction of the heat input
+     */
+    void getHeatLossSeries(std::size_t count, const double *flueGasTemperature, const double *flueGasO2,
+                           const double *combustionAirTemperature, double *availableHeat) const;
+
 private:
     const double flueGasTemperature, excessAirPercentage, combustionAirTemperature, fuelTemperature;
 	GasCompositions compositions;
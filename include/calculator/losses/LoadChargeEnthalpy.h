@@ -0,0 +1,153 @@
+/**
+ * @file
+ * @brief Enthalpy curve of a load/charge material
+ *
+ * Built once from a solid, liquid or gas load/charge material, the curve gives the heat required to take one lb of the
+ * charge between any two temperatures, including the latent heat of the melted or vaporized part, without building
+ * a load/charge calculator for each temperature pair. Used by zone models that heat the same charge in many steps.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_LOADCHARGEENTHALPY_H
+#define AMO_TOOLS_SUITE_LOADCHARGEENTHALPY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include "GasLoadChargeMaterial.h"
+#include "LiquidLoadChargeMaterial.h"
+#include "SolidLoadChargeMaterial.h"
+
+/**
+ * Load Charge Enthalpy class
+ * Piecewise linear enthalpy of a load/charge material with one phase change, relative to 0 °F
+ */
+class LoadChargeEnthalpy {
+public:
+    /**
+     * Constructor for the enthalpy curve with all inputs specified.
+     * @param specificHeatBelow double, specific heat below the phase change temperature in Btu/(lb*°F)
+     * @param transitionTemperature double, melting or vaporizing temperature in °F
+     * @param latentHeat double, heat taken up at the transition temperature in Btu/lb, already weighted by the part of
+     * the charge that changes phase
+     * @param specificHeatAbove double, specific heat above the phase change temperature in Btu/(lb*°F)
+     * @param reactionHeat double, heat of reaction in Btu/lb, already weighted by the part of the charge that reacts
+     */
+    LoadChargeEnthalpy(const double specificHeatBelow, const double transitionTemperature, const double latentHeat,
+                       const double specificHeatAbove, const double reactionHeat = 0)
+            : specificHeatBelow(specificHeatBelow), transitionTemperature(transitionTemperature),
+              enthalpyAboveOffset(specificHeatBelow * transitionTemperature + latentHeat
+                                  - specificHeatAbove * transitionTemperature),
+              specificHeatAbove(specificHeatAbove), reactionHeat(reactionHeat)
+    {}
+
+    /**
+     * Enthalpy of the dry charge of a solid material, with the part melted and reacted of the material
+     * @param material SolidLoadChargeMaterial, e.g. a material from the database with its charge melted set
+     */
+    explicit LoadChargeEnthalpy(const SolidLoadChargeMaterial &material)
+            : LoadChargeEnthalpy(material.getSpecificHeatSolid(), material.getMeltingPoint(),
+                                 material.getLatentHeat() * material.getChargeMelted() / 100.0,
+                                 material.getSpecificHeatLiquid() * material.getChargeMelted() / 100.0
+                                 + material.getSpecificHeatSolid() * (1 - material.getChargeMelted() / 100.0),
+                                 getWeightedReactionHeat(material.getThermicReactionType(),
+                                                         material.getChargedReacted(), material.getReactionHeat()))
+    {}
+
+    /**
+     * Enthalpy of a liquid charge, with the part vaporized and reacted of the material
+     * @param material LiquidLoadChargeMaterial, e.g. a material from the database with its percent vaporized set
+     */
+    explicit LoadChargeEnthalpy(const LiquidLoadChargeMaterial &material)
+            : LoadChargeEnthalpy(material.getSpecificHeatLiquid(), material.getVaporizingTemperature(),
+                                 material.getLatentHeat() * material.getPercentVaporized() / 100.0,
+                                 material.getSpecificHeatVapor() * material.getPercentVaporized() / 100.0
+                                 + material.getSpecificHeatLiquid() * (1 - material.getPercentVaporized() / 100.0),
+                                 getWeightedReactionHeat(material.getThermicReactionType(),
+                                                         material.getPercentReacted(), material.getReactionHeat()))
+    {}
+
+    /**
+     * Enthalpy of a gas charge and its water vapor, which has no phase change
+     * @param material GasLoadChargeMaterial, e.g. a material from the database with its percent vapor set
+     */
+    explicit LoadChargeEnthalpy(const GasLoadChargeMaterial &material)
+            : LoadChargeEnthalpy(material.getSpecificHeatGas() * (1 - material.getPercentVapor() / 100.0)
+                                 + material.getSpecificHeatVapor() * material.getPercentVapor() / 100.0,
+                                 std::numeric_limits<double>::infinity(), 0, 0,
+                                 getWeightedReactionHeat(material.getThermicReactionType(),
+                                                         material.getPercentReacted(), material.getReactionHeat()))
+    {}
+
+    /**
+     * Gets the enthalpy of the charge relative to 0 °F
+     * @param temperature double, temperature of the charge in °F
+     * @return double, enthalpy in Btu/lb
+     */
+    double getEnthalpy(const double temperature) const {
+        return temperature < transitionTemperature ? specificHeatBelow * temperature
+                                                   : enthalpyAboveOffset + specificHeatAbove * temperature;
+    }
+
+    /**
+     * Gets the sensible and latent heat required to heat the charge, the same as the load/charge calculators give
+     * when the initial temperature is below the phase change temperature. The heat of reaction is not included, as it
+     * is taken up once however many steps the charge is heated in.
+     * @param initialTemperature double, initial temperature in °F
+     * @param dischargeTemperature double, discharge temperature in °F
+     * @return double, heat required in Btu/lb, negative when the charge is cooled
+     */
+    double getHeatRequired(const double initialTemperature, const double dischargeTemperature) const {
+        return getEnthalpy(dischargeTemperature) - getEnthalpy(initialTemperature);
+    }
+
+    /**
+     * Gets the heat required for each pair of initial and discharge temperatures
+     * @param count std::size_t, number of temperature pairs
+     * @param initialTemperatures const double *, count initial temperatures in °F
+     * @param dischargeTemperatures const double *, count discharge temperatures in °F
+     * @param heatRequired double *, receives count heats required in Btu/lb, may be one of the inputs
+     */
+    void getHeatRequired(const std::size_t count, const double *initialTemperatures,
+                         const double *dischargeTemperatures, double *heatRequired) const {
+        for (std::size_t i = 0; i < count; i++) {
+            heatRequired[i] = getHeatRequired(initialTemperatures[i], dischargeTemperatures[i]);
+        }
+    }
+
+    /**
+     * Gets the temperature of the charge at an enthalpy, the inverse of getEnthalpy. Within the latent heat the charge
+     * is at the phase change temperature.
+     * @param enthalpy double, enthalpy relative to 0 °F in Btu/lb
+     * @return double, temperature in °F
+     */
+    double getTemperature(const double enthalpy) const {
+        if (enthalpy < specificHeatBelow * transitionTemperature) return enthalpy / specificHeatBelow;
+        return std::max((enthalpy - enthalpyAboveOffset) / specificHeatAbove, transitionTemperature);
+    }
+
+    /**
+     * Gets the heat of reaction, taken up only by endothermic reactions
+     * @return double, heat of reaction in Btu/lb
+     */
+    double getReactionHeat() const {
+        return reactionHeat;
+    }
+
+private:
+    static double getWeightedReactionHeat(const LoadChargeMaterial::ThermicReactionType thermicReactionType,
+                                          const double percentReacted, const double reactionHeat) {
+        return thermicReactionType == LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC
+               ? percentReacted / 100.0 * reactionHeat : 0;
+    }
+
+    double specificHeatBelow;
+    double transitionTemperature;
+    double enthalpyAboveOffset; ///< enthalpy above the transition extrapolated to 0 °F
+    double specificHeatAbove;
+    double reactionHeat;
+};
+
+#endif //AMO_TOOLS_SUITE_LOADCHARGEENTHALPY_H
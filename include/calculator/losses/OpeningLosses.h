@@ -11,7 +11,7 @@
 #ifndef AMO_SUITE_OPENINGLOSSES_H
 #define AMO_SUITE_OPENINGLOSSES_H
 
-#include <functional>
+#include <cstddef>
 #include <array>
 
 /**
@@ -50,6 +50,26 @@ public:
      */
     double calculateViewFactor(double thickness, double length, double height);
 
+    /**
+     * Interpolates the viewFactor of a circular opening in a table of calculateViewFactor precomputed over the
+     * thickness ratio, for repeated or interactive evaluation. Within 2e-5 of calculateViewFactor.
+     * @param double, thickness - furnace wall thickness in inches
+     * @param double, diameter of opening in inches
+     * @return double, viewFactor - unitless
+     * */
+    static double interpolateViewFactor(double thickness, double diameter);
+
+    /**
+     * Interpolates the viewFactor of a rectangular opening in a table of calculateViewFactor precomputed over the
+     * thickness ratio; the view factor is linear in the lateral dimension ratio between the chart's curves for 1, 2
+     * and 10, so only the thickness ratio is interpolated. Within 2e-5 of calculateViewFactor.
+     * @param double, thickness - furnace wall thickness in inches
+     * @param double, length - length of opening in inches
+     * @param double, height - height of opening in inches
+     * @return double, viewFactor - unitless
+     */
+    static double interpolateViewFactor(double thickness, double length, double height);
+
     /**
 	 * Constructor for a rectangular opening
 	 * @param emissivity double, emissivity - unitless
@@ -306,7 +326,24 @@ public:
      */
     double getHeatLoss();
 
+    /**
+     * Calculates the heat loss of every sample of a time series; inputs without a series are held at the values of
+     * this object
+     * @param count std::size_t, number of samples
+     * @param insideTemperature const double *, inside temperature of each sample in °F, or nullptr
+     * @param ambientTemperature const double *, ambient temperature of each sample in °F, or nullptr
+     * @param percentTimeOpen const double *, amount of time open of each sample as %, or nullptr
+     * @param heatLoss double *, receives the heat loss of each sample in btu/cycle
+     */
+    void getHeatLossSeries(std::size_t count, const double *insideTemperature, const double *ambientTemperature,
+                           const double *percentTimeOpen, double *heatLoss) const;
+
 private:
+    /**
+     * @return double, area of the opening in ft^2
+     */
+    double getArea() const;
+
     double emissivity = 0.95;
     double diameter = 0;
     double length = 0, width = 0;
@@ -320,45 +357,13 @@ private:
 
     double heatLoss = 0;
 
-    const std::array<const std::function< double ( const double thicknessRatio ) >, 8> viewFactorEquations = {
-            {
-                    [](const double tr) {
-                        return (1.10000000001829 + 92.8571428570049 * tr - 57.5892857139671 * std::pow(tr, 2) +
-                               15.6249999998005 * std::pow(tr, 3)) / 100;
-                    }, // case 1
-                    [](const double tr) {
-                        return (29.4999999989821 + 26.8416666684161 * tr - 4.35416666785322 * std::pow(tr, 2) -
-                               8.33333330461522E-02 * std::pow(tr, 3) + 0.104166666655532 * std::pow(tr, 4) -
-                               8.33333333686747E-03 * std::pow(tr, 5)) / 100;
-                    }, // case 2
-                    [](const double tr) {
-                        return (3.50000000001719 + 89.5833333332039 * tr - 49.9999999997023 * std::pow(tr, 2) +
-                               10.4166666664804 * std::pow(tr, 3)) / 100;
-                    }, // case 3
-                    [](const double tr) {
-                        return (23.9999999965639 + 39.3916666718743 * tr - 11.6041666697487 * std::pow(tr, 2) +
-                               1.85416666706894 * std::pow(tr, 3) - 0.145833333217932 * std::pow(tr, 4) +
-                               4.16666663902102E-03 * std::pow(tr, 5)) / 100;
-                    }, // case 4
-                    [](const double tr) {
-                        return (2.70000000002409 + 112.678571428391 * tr - 70.9821428567315 * std::pow(tr, 2) +
-                               15.6249999997447 * std::pow(tr, 3)) / 100;
-                    }, // case 5
-                    [](const double tr) {
-                        return (35.4999999992976 + 29.4583333347815 * tr - 4.52083333446976 * std::pow(tr, 2) -
-                               0.687499999606652 * std::pow(tr, 3) + 0.270833333273064 * std::pow(tr, 4) -
-                               2.08333333303721E-02 * std::pow(tr, 5)) / 100;
-                    }, // case 6
-                    [](const double tr) {
-                        return (13.0000000000278 + 123.74999999979 * tr - 99.9999999995182 * std::pow(tr, 2) +
-                               31.249999999699 * std::pow(tr, 3)) / 100;
-                    }, // case 7
-                    [](const double tr) {
-                        return (26.9999999903567 + 64.5666666806646 * tr - 29.9166666745008 * std::pow(tr, 2) +
-                               7.14583333396145 * std::pow(tr, 3) - 0.833333332874441 * std::pow(tr, 4) +
-                               3.74999999085373E-02 * std::pow(tr, 5)) / 100;
-                    }, // case 8
-            }
-    };
+    // view factor as a function of the thickness ratio, in the order of the cases of the PHAST view factor chart
+    static const std::array<double (*)(double thicknessRatio), 8> viewFactorEquations;
+
+    /**
+     * calculateViewFactor tabulated over the thickness ratio, see OpeningLosses.cpp
+     */
+    struct ViewFactorTable;
+    static const ViewFactorTable & getViewFactorTable();
 };
 #endif //AMO_SUITE_OPENINGLOSSES_H
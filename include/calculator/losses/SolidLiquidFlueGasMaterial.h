@@ -2,6 +2,8 @@
 #define AMO_TOOLS_SUITE_SOLIDLIQUIDFLUEGASMATERIAL_H
 
 #include <string>
+#include "calculator/losses/FlueGasExcessAir.h"
+#include "calculator/util/RootFinder.h"
 
 /**
  * Solid Liquid Flue Gas Material class
@@ -90,6 +92,20 @@ public:
 	                                              double moistureInAirCombustion);
 
 	/**
+	 * Calculates excess air given flue gas O2 levels to the given tolerance. Flue gas O2 rises monotonically with
+	 * excess air, so the root is bracketed starting from the stoichiometric estimate and found with Brent's method.
+	 * The search runs from 0 excess air, where no O2 is left, up to FlueGasExcessAir::MAX_EXCESS_AIR, where it stops
+	 * without converging for O2 levels at or above those of air.
+	 * @param tolerance double, absolute tolerance of the excess air fraction
+	 * @param maxIterations int, maximum number of flue gas O2 evaluations
+	 * @return RootFinder::Result, excess air as a fraction and the number of flue gas O2 evaluations
+	 */
+	static RootFinder::Result solveExcessAirFromFlueGasO2(double flueGasO2, double carbon, double hydrogen,
+	                                                      double sulphur, double inertAsh, double o2, double moisture,
+	                                                      double nitrogen, double moistureInAirCombustion,
+	                                                      double tolerance, int maxIterations = 100);
+
+	/**
      * Calculates excess air percentage given flue gas O2 levels
      * @return double, calculated excess air percentage
      */
@@ -15,6 +15,7 @@
 /** Rad constant is 460.0 */
 #define RAD_CONSTANT 460.0
 
+#include <cstddef>
 #include <string>
 
 /**
@@ -172,6 +173,17 @@ public:
      */
     double getHeatLoss();
 
+    /**
+     * Calculates the wall heat loss of every sample of a time series; inputs without a series are held at the values
+     * of this object
+     * @param count std::size_t, number of samples
+     * @param surfaceTemperature const double *, average surface temperature of each sample in °F, or nullptr
+     * @param ambientTemperature const double *, ambient temperature of each sample in °F, or nullptr
+     * @param heatLoss double *, receives the wall heat loss of each sample in btu/hr
+     */
+    void getHeatLossSeries(std::size_t count, const double *surfaceTemperature, const double *ambientTemperature,
+                           double *heatLoss) const;
+
     /**
      * Gets the surface description
      * @return string, surface description
@@ -30,6 +30,10 @@ public:
         stoichAir = solidLiquidFlueGasMaterial.getStoichAirFuel();
     }
 
+    // fuel given by its heating value in Btu/scf and its stoichiometric air in scf per scf of fuel
+    AirHeatingUsingExhaust(const double fuelHeatingValue, const double stoichAir)
+            : fuelHeatingValue(fuelHeatingValue), stoichAir(stoichAir) {}
+
     AirHeatingUsingExhaust::Output calculate(const double flueTemperature, const double excessAir, const double fireRate,
                                              const double airflow, const double inletTemperature,
                                              const double heaterEfficiency, const double hxEfficiency, const double operatingHours);
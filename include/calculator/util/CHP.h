@@ -43,7 +43,20 @@ public:
 	    double percentAvgkWhElectricCostAvoidedOrStandbyRate, double displacedThermalEfficiency, double chpAvailability,
 		double thermalUtilization);
 
-	std::unordered_map<std::string, double> const & getCostInfo() const { return costInfo; }
+	/**
+	 * Sets every input at once, e.g. for one step of a sweep, with the parameters of the constructor. Like the
+	 * individual setters it only marks the results out of date, they are calculated once, on the next read.
+	 */
+	void setInputs(double annualOperatingHours, double annualElectricityConsumption, double annualThermalDemand,
+	               double boilerThermalFuelCosts, double avgElectricityCosts, Option calculationOption,
+	               double boilerThermalFuelCostsCHPcase, double CHPfuelCosts,
+	               double percentAvgkWhElectricCostAvoidedOrStandbyRate, double displacedThermalEfficiency,
+	               double chpAvailability, double thermalUtilization);
+
+	std::unordered_map<std::string, double> const & getCostInfo() const {
+		calculateIfNeeded();
+		return costInfo;
+	}
 /**
  *  Gets the Annual Operating Hours
  * 
@@ -115,13 +128,19 @@ public:
 	 * 
 	 * @return double const, CHP electric efficiency as a percent
 	 */
-	double getChpElectricEfficiency() const { return chpElectricEfficiency; }
+	double getChpElectricEfficiency() const {
+		calculateIfNeeded();
+		return chpElectricEfficiency;
+	}
 	/**
 	 * Get the Chp Thermal Output
 	 * 
 	 * @return double const, CHP thermal output in  MMBtu
 	 */
-	double getChpThermalOutput() const { return chpThermalOutput; }
+	double getChpThermalOutput() const {
+		calculateIfNeeded();
+		return chpThermalOutput;
+	}
 	/**
 	 * Gets the Chp Availability 
 	 * 
@@ -139,19 +158,28 @@ public:
 	 * 
 	 * @return double const, Average Power Demand in kWh
 	 */
-	double getAvgPowerDemand() const { return avgPowerDemand; }
+	double getAvgPowerDemand() const {
+		calculateIfNeeded();
+		return avgPowerDemand;
+	}
 	/**
 	 * Gets the Avg Thermal Demand 
 	 * 
 	 * @return double const, Average Thermal Demand in MMBtu
 	 */
-	double getAvgThermalDemand() const { return avgThermalDemand; }
+	double getAvgThermalDemand() const {
+		calculateIfNeeded();
+		return avgThermalDemand;
+	}
 	/**
 	 * Gets the Net CHP power
 	 * 
 	 * @return double const, Net CHP power in  MMBtu
 	 */
-	double getNetCHPpower() const { return netCHPpower; }
+	double getNetCHPpower() const {
+		calculateIfNeeded();
+		return netCHPpower;
+	}
 
 	void setAnnualOperatingHours(double annualOperatingHours);
 	void setAnnualElectricityConsumption(double annualElectricityConsumption);
@@ -173,7 +201,15 @@ public:
 	void setNetCHPpower(double netCHPpower);
 
 private:
-	void calculate();
+	/**
+	 * Calculates the results from the inputs; the getters of the results call it when an input has changed since
+	 * the last calculation, so the results are calculated once however many inputs are set.
+	 */
+	void calculate() const;
+
+	void calculateIfNeeded() const {
+		if (!calculated) calculate();
+	}
 
 	std::map<double, std::size_t>::const_iterator findNearest(double val, std::size_t index) const;
 
@@ -181,11 +217,14 @@ private:
 	double boilerThermalFuelCosts, chpFuelCosts, avgElectricityCosts;
 	Option calculationOption;
 	double boilerThermalFuelCostsCHPcase, percentAvgkWhElectricCostAvoided = 0, standbyRate = 0;
-	double displacedThermalEfficiency, chpElectricEfficiency, chpThermalOutput, chpAvailability, thermalUtilization;
-
-	double avgPowerDemand, avgThermalDemand, netCHPpower;
+	double displacedThermalEfficiency, chpAvailability, thermalUtilization;
 
-	std::unordered_map<std::string, double> costInfo;
+	// results, calculated on first read; as that read fills them, read one result of a CHP before sharing it between
+	// threads
+	mutable bool calculated = false;
+	mutable double chpElectricEfficiency, chpThermalOutput;
+	mutable double avgPowerDemand, avgThermalDemand, netCHPpower;
+	mutable std::unordered_map<std::string, double> costInfo;
 
 	const std::array<std::array<double, 8>, 3> chpSystemByIndex = {
 			{
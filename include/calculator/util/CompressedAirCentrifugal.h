@@ -75,7 +75,7 @@ private:
     virtual CompressedAirCentrifugalBase::Output calculateFromCMeasured(double) {return Output();}
     virtual CompressedAirCentrifugalBase::Output calculateFromVIPFMeasured(double, double, double) {return Output();}
 
-    virtual void AdjustDischargePressure(std::vector<double>, std::vector<double>, double, double) {}
+    virtual void AdjustDischargePressure(const std::vector<double> &, const std::vector<double> &, double, double) {}
 };
 
 class CompressedAirCentrifugal: public CompressedAirCentrifugalBase {
@@ -99,7 +99,7 @@ public:
     CompressedAirCentrifugalBase::OutputBlowOff calculateFromCMeasured_BlowOff(double C) override;
     CompressedAirCentrifugalBase::OutputBlowOff calculateFromVIPFMeasured_BlowOff(double V, double I, double PF, double blowPer) override;
 
-    void AdjustDischargePressure(std::vector<double> Capacity, std::vector<double> DischargePressure, double P_fl, double P_max = 0) override {
+    void AdjustDischargePressure(const std::vector<double> &Capacity, const std::vector<double> &DischargePressure, double P_fl, double P_max = 0) override {
         if(P_fl > 0) {
             CurveFitVal curveFitValCap(DischargePressure, Capacity, 2);
             C_fl_Adjusted = C_fl = curveFitValCap.calculate(P_fl);
@@ -129,7 +129,7 @@ public:
     CompressedAirCentrifugalBase::Output calculateFromCMeasured(double C) override;
     CompressedAirCentrifugalBase::Output calculateFromVIPFMeasured(double V, double I, double PF) override;
 
-    void AdjustDischargePressure(std::vector<double> Capacity, std::vector<double> DischargePressure, double P_fl, double P_max = 0) override {
+    void AdjustDischargePressure(const std::vector<double> &Capacity, const std::vector<double> &DischargePressure, double P_fl, double P_max = 0) override {
         if(P_fl > 0) {
             CurveFitVal curveFitValCap(DischargePressure, Capacity, 2);
             C_fl_Adjusted = C_fl = curveFitValCap.calculate(P_fl);
@@ -162,7 +162,7 @@ public:
     CompressedAirCentrifugalBase::Output calculateFromCMeasured(double C) override;
     CompressedAirCentrifugalBase::Output calculateFromVIPFMeasured(double V, double I, double PF) override;
 
-    void AdjustDischargePressure(std::vector<double> Capacity, std::vector<double> DischargePressure, double P_fl, double P_max) override {
+    void AdjustDischargePressure(const std::vector<double> &Capacity, const std::vector<double> &DischargePressure, double P_fl, double P_max) override {
         if(P_fl > 0 || P_max > 0) {
             CurveFitVal curveFitValCap(DischargePressure, Capacity, 2);
 
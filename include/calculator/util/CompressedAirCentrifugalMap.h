@@ -0,0 +1,102 @@
+/**
+ * @file
+ * @brief Performance map of a centrifugal compressor over its discharge pressure range
+ *
+ * AdjustDischargePressure of the centrifugal control type models fits the capacity curve of the compressor each time
+ * it is called. The map fits the curve once and evaluates the power and capacity of the compressor at any discharge
+ * pressure and load from that fit, without allocating. Each evaluation gives the result of the control type model
+ * adjusted to the discharge pressure.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_COMPRESSEDAIRCENTRIFUGALMAP_H
+#define AMO_TOOLS_SUITE_COMPRESSEDAIRCENTRIFUGALMAP_H
+
+#include <vector>
+#include "calculator/util/CompressedAirCentrifugal.h"
+#include "calculator/util/CurveFitVal.h"
+
+/**
+ * Compressed Air Centrifugal Map class
+ * Used to evaluate a centrifugal compressor at the discharge pressure of each time step of a simulation.
+ */
+class CompressedAirCentrifugalMap {
+public:
+    /**
+     * @param kW_fl double, power at full load - kW
+     * @param C_fl double, capacity at full load at the rated discharge pressure - acfm
+     * @param kW_nl double, power at no load - kW
+     * @param capacity std::vector<double>, capacity at each pressure of the performance curve - acfm
+     * @param dischargePressure std::vector<double>, pressures of the performance curve - psig
+     * @return CompressedAirCentrifugalMap, map of a load/unload compressor
+     */
+    static CompressedAirCentrifugalMap loadUnload(double kW_fl, double C_fl, double kW_nl,
+                                                  const std::vector<double> &capacity,
+                                                  const std::vector<double> &dischargePressure);
+
+    /**
+     * @param kW_fl double, power at full load - kW
+     * @param C_fl double, capacity at full load at the rated discharge pressure - acfm
+     * @param kW_nl double, power at no load - kW
+     * @param C_max double, capacity at maximum full flow - acfm
+     * @param kW_ul double, power at the unload point - kW
+     * @param C_ul double, capacity at the unload point - acfm
+     * @param capacity std::vector<double>, capacity at each pressure of the performance curve - acfm
+     * @param dischargePressure std::vector<double>, pressures of the performance curve - psig
+     * @param P_max double, discharge pressure at maximum full flow, 0 to keep C_max - psig
+     * @return CompressedAirCentrifugalMap, map of a modulation with unloading compressor
+     */
+    static CompressedAirCentrifugalMap modulationUnload(double kW_fl, double C_fl, double kW_nl, double C_max,
+                                                        double kW_ul, double C_ul, const std::vector<double> &capacity,
+                                                        const std::vector<double> &dischargePressure, double P_max = 0);
+
+    /**
+     * @param kW_fl double, power at full load - kW
+     * @param C_fl double, capacity at full load at the rated discharge pressure - acfm
+     * @param kW_blow double, power at the blow off point - kW
+     * @param C_blow double, surge flow - acfm
+     * @param capacity std::vector<double>, capacity at each pressure of the performance curve - acfm
+     * @param dischargePressure std::vector<double>, pressures of the performance curve - psig
+     * @return CompressedAirCentrifugalMap, map of a blow off compressor
+     */
+    static CompressedAirCentrifugalMap blowOff(double kW_fl, double C_fl, double kW_blow, double C_blow,
+                                               const std::vector<double> &capacity,
+                                               const std::vector<double> &dischargePressure);
+
+    CompressedAirCentrifugalBase::ControlType getControlType() const { return controlType; }
+
+    /**
+     * @param P_fl double, discharge pressure, 0 for the rated discharge pressure - psig
+     * @return double, capacity at full load - acfm
+     */
+    double getFullLoadCapacity(double P_fl) const { return P_fl > 0 ? capacityFit.calculate(P_fl) : C_fl; }
+
+    /**
+     * @param P_fl double, discharge pressure, 0 for the rated discharge pressure - psig
+     * @param C_Per double, delivered air as a fraction of the full load capacity at the discharge pressure
+     * @return CompressedAirCentrifugalBase::Output, power and capacity of the compressor
+     */
+    CompressedAirCentrifugalBase::Output calculateFromPerC(double P_fl, double C_Per) const;
+
+    /**
+     * @param P_fl double, discharge pressure, 0 for the rated discharge pressure - psig
+     * @param PerkW double, power as a fraction of the full load power
+     * @param blowPer double, fraction of the full load capacity blown off at the blow off point, blow off only
+     * @return CompressedAirCentrifugalBase::Output, power and capacity of the compressor
+     */
+    CompressedAirCentrifugalBase::Output calculateFromPerkW(double P_fl, double PerkW, double blowPer = 0) const;
+
+private:
+    CompressedAirCentrifugalMap(CompressedAirCentrifugalBase::ControlType controlType, double kW_fl, double C_fl,
+                                const std::vector<double> &capacity, const std::vector<double> &dischargePressure);
+
+    CompressedAirCentrifugalBase::ControlType controlType;
+    double kW_fl, C_fl;
+    double kW_nl = 0, C_max = 0, kW_ul = 0, C_ul = 0; ///< modulation with unloading, C_max at P_max
+    double kW_blow = 0, C_blow = 0; ///< blow off
+    CurveFitVal capacityFit;
+};
+
+#endif //AMO_TOOLS_SUITE_COMPRESSEDAIRCENTRIFUGALMAP_H
@@ -148,6 +148,14 @@ class CompressedAirLeakSurvey
     }
 
     CompressedAirLeakSurvey::Output calculate();
+
+    /**
+     * Flow rates, electricity and cost of a single leak
+     * @param compressedAirLeakSurveyInput CompressedAirLeakSurveyInput, the leak and the utility data
+     * @return Output, the leak's share of the survey totals
+     */
+    static CompressedAirLeakSurvey::Output calculateLeak(const CompressedAirLeakSurveyInput &compressedAirLeakSurveyInput);
+
     std::vector<CompressedAirLeakSurveyInput> const &getCompressedAirLeakSurveyInputVec() const
     {
         return compressedAirLeakSurveyInputVec;
@@ -0,0 +1,118 @@
+/**
+ * @file
+ * @brief Running totals of a compressed air leak survey fed one leak at a time
+ *
+ * Leaks are added one at a time or read from a CSV file and kept only until a batch is full. The batch is sorted by
+ * measurement method, evaluated in parallel with CompressedAirLeakSurvey::calculateLeak and folded into the running
+ * totals of each survey area and each method, so surveys of any size are totaled with a bounded amount of memory.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_COMPRESSEDAIRLEAKSURVEYACCUMULATOR_H
+#define AMO_TOOLS_SUITE_COMPRESSEDAIRLEAKSURVEYACCUMULATOR_H
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "calculator/util/CompressedAirLeakSurvey.h"
+
+namespace io {
+    class LineReader;
+}
+
+/**
+ * Compressed Air Leak Survey Accumulator class
+ * Used to total the flow, electricity and cost of a leak survey by area and by measurement method.
+ */
+class CompressedAirLeakSurveyAccumulator {
+public:
+    /// estimate, decibels, bag and orifice methods, then every other measurement method
+    static const std::size_t METHOD_COUNT = 5;
+
+    struct Totals {
+        std::size_t leaks = 0;
+        double annualTotalElectricity = 0; ///< kWh
+        double annualTotalElectricityCost = 0; ///< $
+        double totalFlowRate = 0; ///< scfm
+        double annualTotalFlowRate = 0; ///< scf
+    };
+
+    /**
+     * Constructor for CompressedAirLeakSurveyAccumulator
+     * @param batchSize std::size_t, number of leaks kept before they are evaluated
+     * @param threads unsigned, number of threads evaluating a batch, 0 for one per hardware thread
+     */
+    explicit CompressedAirLeakSurveyAccumulator(std::size_t batchSize = 4096, unsigned threads = 0);
+
+    /**
+     * Adds a leak; the totals include it once its batch is evaluated
+     * @param leak CompressedAirLeakSurveyInput, the leak and the utility data
+     * @param area std::string, name of the survey area the leak was tagged in
+     */
+    void add(const CompressedAirLeakSurveyInput &leak, const std::string &area = "");
+
+    /**
+     * Adds every leak of a CSV file with a header row. The columns are named as the fields of the compressedAirLeakSurvey
+     * binding inputs, without the method data objects: area, hoursPerYear, utilityType, utilityCost, measurementMethod,
+     * units, leakRateEstimate, linePressure, decibels, decibelRatingA, pressureA, firstFlowA, secondFlowA,
+     * decibelRatingB, pressureB, firstFlowB, secondFlowB, height, diameter, fillTime, compressorAirTemp,
+     * atmosphericPressure, dischargeCoefficient, orificeDiameter, supplyPressure, numberOfOrifices,
+     * compressorControlAdjustment and compressorSpecificPower. Absent columns and blank values are 0.
+     * @param lines io::LineReader, the CSV file
+     * @return std::size_t, number of leaks read
+     */
+    std::size_t addCsv(io::LineReader &lines);
+
+    /**
+     * Evaluates the leaks waiting in the current batch
+     */
+    void flush();
+
+    /**
+     * @return Totals, the totals of every leak added
+     */
+    Totals getTotals();
+
+    /**
+     * @param area std::string, name of a survey area
+     * @return Totals, the totals of the leaks of the area, empty for an unknown area
+     */
+    Totals getAreaTotals(const std::string &area);
+
+    /**
+     * @param measurementMethod int, 0 estimate, 1 decibels, 2 bag, 3 orifice; other values are totaled together
+     * @return Totals, the totals of the leaks measured with the method
+     */
+    Totals getMethodTotals(int measurementMethod);
+
+    /**
+     * @return std::vector<std::string>, names of the survey areas in the order they were first seen
+     */
+    const std::vector<std::string> &getAreas() const { return areas; }
+
+private:
+    struct Leak {
+        CompressedAirLeakSurveyInput input;
+        std::size_t area;
+    };
+
+    static std::size_t getMethod(int measurementMethod);
+
+    static void addTotals(Totals &totals, const Totals &leaks);
+
+    const std::size_t batchSize;
+    const unsigned threads;
+
+    std::vector<std::string> areas;
+    std::unordered_map<std::string, std::size_t> areaIndexes;
+    std::size_t lastArea = 0;
+    std::vector<Leak> pending[METHOD_COUNT];
+    std::size_t pendingCount = 0;
+
+    std::vector<Totals> totals; ///< area x method, row major
+};
+
+#endif //AMO_TOOLS_SUITE_COMPRESSEDAIRLEAKSURVEYACCUMULATOR_H
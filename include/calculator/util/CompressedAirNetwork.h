@@ -0,0 +1,140 @@
+/**
+ * @file
+ * @brief Flows and pressures of a compressed air distribution network of loops and branches
+ *
+ * The network is made of junctions, which draw a demand, supply points held at the compressor discharge pressure and
+ * pipes between them. The pressure drop of a pipe follows the Harris formula for steel pipe,
+ * dp = 0.1025 L Q^2 / (3600 r d^5.31), with the compression ratio r taken at the mean pressure of the pipe.
+ * The network is solved with the global gradient (Newton) method: each iteration solves the sparse, symmetric
+ * positive definite system of the junction pressures with conjugate gradients, preconditioned by an incomplete
+ * Cholesky factor, and then corrects the pipe flows. The last solution is the starting point of the next solve, so a
+ * network re-solved after a small change such as resizing one pipe converges in a few iterations.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_COMPRESSEDAIRNETWORK_H
+#define AMO_TOOLS_SUITE_COMPRESSEDAIRNETWORK_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Compressed Air Network class
+ * Used to find the flow in every pipe and the pressure at every node of a compressed air distribution network.
+ */
+class CompressedAirNetwork {
+public:
+    struct Results {
+        std::vector<double> pressures; ///< pressure of each node - psig
+        std::vector<double> supplies; ///< air supplied at each node, 0 at junctions - scfm
+        std::vector<double> flows; ///< flow of each pipe, positive from its first node to its second - scfm
+        std::vector<double> pressureDrops; ///< pressure drop of each pipe along its flow - psi
+        std::vector<double> velocities; ///< velocity of the compressed air in each pipe, as in Compressor::AirVelocity - ft/s
+        int iterations; ///< Newton iterations
+        bool converged; ///< false when the iteration limit was reached first
+    };
+
+    /**
+     * Constructor for CompressedAirNetwork
+     * @param atmosphericPressure double, atmospheric pressure - psia
+     */
+    explicit CompressedAirNetwork(double atmosphericPressure = 14.7);
+
+    /**
+     * Adds a junction
+     * @param demand double, air drawn from the network at the junction - scfm
+     * @return std::size_t, index of the node
+     */
+    std::size_t addJunction(double demand = 0);
+
+    /**
+     * Adds a compressor supply point, held at its discharge pressure
+     * @param pressure double, discharge pressure - psig
+     * @return std::size_t, index of the node
+     */
+    std::size_t addSupply(double pressure);
+
+    /**
+     * Adds a pipe
+     * @param from std::size_t, index of the first node
+     * @param to std::size_t, index of the second node
+     * @param length double, equivalent length of the pipe, fittings included - ft
+     * @param diameter double, inside diameter - in
+     * @return std::size_t, index of the pipe
+     */
+    std::size_t addPipe(std::size_t from, std::size_t to, double length, double diameter);
+
+    /**
+     * @param node std::size_t, index of a junction
+     * @param demand double, air drawn from the network at the junction - scfm
+     */
+    void setDemand(std::size_t node, double demand);
+
+    /**
+     * @param node std::size_t, index of a supply point
+     * @param pressure double, discharge pressure - psig
+     */
+    void setSupplyPressure(std::size_t node, double pressure);
+
+    /**
+     * Resizes a pipe; the next solve starts from the current solution
+     * @param pipe std::size_t, index of the pipe
+     * @param diameter double, inside diameter - in
+     */
+    void setPipeDiameter(std::size_t pipe, double diameter);
+
+    std::size_t getNodeCount() const { return nodes.size(); }
+    std::size_t getPipeCount() const { return pipes.size(); }
+
+    /**
+     * Solves the network, starting from the last solution
+     * @param tolerance double, largest flow correction of the last iteration, relative to the largest flow
+     * @param maxIterations int, maximum number of Newton iterations
+     * @return Results, pressures, flows, pressure drops and velocities
+     */
+    Results solve(double tolerance = 1e-8, int maxIterations = 100);
+
+private:
+    struct Node {
+        bool supply;
+        double value; ///< demand of a junction, pressure of a supply point
+    };
+
+    struct Pipe {
+        std::size_t from, to;
+        double length, diameter;
+    };
+
+    /**
+     * Numbers the junctions, builds the sparsity pattern of the junction pressure system and checks that every
+     * junction is connected to a supply point
+     */
+    void prepare();
+
+    /**
+     * Computes the incomplete Cholesky factor of the junction pressure system
+     */
+    void factorize();
+
+    /**
+     * Solves the junction pressure system with conjugate gradients preconditioned by its incomplete Cholesky factor,
+     * starting from x
+     */
+    void solveLinearSystem(std::vector<double> &x);
+
+    const double atmosphericPressure;
+    std::vector<Node> nodes;
+    std::vector<Pipe> pipes;
+
+    bool prepared = false;
+    std::vector<long> unknown; ///< junction number of each node, -1 for supply points
+    std::vector<std::size_t> rowStart, columns; ///< compressed sparse rows of the junction pressure system
+    std::vector<std::size_t> diagonal, fromEntry, toEntry; ///< entries of the diagonals and of each pipe
+    std::vector<double> values, rhs, factor;
+
+    std::vector<double> pressures, flows; ///< last solution
+};
+
+#endif //AMO_TOOLS_SUITE_COMPRESSEDAIRNETWORK_H
@@ -0,0 +1,71 @@
+/**
+ * @file
+ * @brief Search for the cheapest sequencing strategy of a compressed air system
+ *
+ * Every combination of the candidate loading orders, trim compressor assignments, pressure bands and storage additions
+ * is simulated with CompressedAirSystemSimulation against the demand profile. A wider pressure band stores more air
+ * but the system runs at a higher average pressure, which costs 0.5 % of the compressor energy per psi as in
+ * CompressedAirPressureReduction. Candidates are evaluated in parallel, and a simulation is abandoned as soon as its
+ * running cost exceeds the cost of the last of the ranked strategies found so far.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_COMPRESSEDAIRSEQUENCINGOPTIMIZER_H
+#define AMO_TOOLS_SUITE_COMPRESSEDAIRSEQUENCINGOPTIMIZER_H
+
+#include <cstddef>
+#include <vector>
+#include "calculator/util/CompressedAirSystemSimulation.h"
+
+/**
+ * Compressed Air Sequencing Optimizer class
+ * Used to rank sequencing strategies of a compressor inventory by their cost over a demand profile.
+ */
+class CompressedAirSequencingOptimizer {
+public:
+    struct Inputs {
+        std::vector<CompressedAirSystemSimulation::CompressorUnit> compressors; ///< compressor inventory
+        std::vector<double> demand; ///< air demand of each sample - acfm
+        double timeStep; ///< duration of each sample - hours
+        double storageCapacity; ///< receivers and piping of the existing system - ft3
+        double electricityCost; ///< $/kWh
+        double storageCost; ///< cost of added storage charged to the demand profile - $/gallon
+        /// loading orders to try, each a permutation of the inventory indexes; empty for the inventory order only
+        std::vector<std::vector<std::size_t>> loadingOrders;
+        bool tryTrimCompressors = true; ///< also try each compressor as the designated trim compressor
+        std::vector<double> pressureBands; ///< psi between the load and unload pressures
+        std::vector<double> storageAdditions = {0}; ///< receiver volumes to add - gallons
+    };
+
+    struct Strategy {
+        std::vector<std::size_t> loadingOrder; ///< inventory indexes in loading order
+        int trimCompressor; ///< inventory index of the designated trim compressor, -1 for the last compressor needed
+        double pressureBand; ///< psi
+        double storageAddition; ///< gallons
+        double energy = 0; ///< kWh, including the pressure band penalty
+        double energyCost = 0; ///< $
+        double storageCost = 0; ///< $
+        double totalCost = 0; ///< $
+        CompressedAirSystemSimulation::Results simulation; ///< compressors in inventory order, without the penalty
+    };
+
+    struct Results {
+        std::vector<Strategy> strategies; ///< the cheapest strategies that meet the demand, cheapest first
+        std::size_t candidates = 0;
+        std::size_t pruned = 0; ///< candidates abandoned once they cost more than the ranked strategies
+        std::size_t infeasible = 0; ///< candidates that left demand unmet
+    };
+
+    /**
+     * Ranks the sequencing strategies
+     * @param inputs Inputs, inventory, demand profile, costs and candidate settings
+     * @param strategies std::size_t, number of ranked strategies to return
+     * @param threads unsigned, number of threads evaluating candidates, 0 for one per hardware thread
+     * @return Results, the cheapest strategies and counts of the candidates evaluated
+     */
+    static Results optimize(const Inputs &inputs, std::size_t strategies = 10, unsigned threads = 0);
+};
+
+#endif //AMO_TOOLS_SUITE_COMPRESSEDAIRSEQUENCINGOPTIMIZER_H
@@ -0,0 +1,159 @@
+/**
+ * @file
+ * @brief Simulation of a compressed air system of several compressors run by a sequencer against a demand profile
+ *
+ * The compressors are modeled with the centrifugal control type calculators (load/unload, modulation with unloading
+ * and blow off). At each step of the demand profile the sequencer loads the compressors in their sequence order: every
+ * compressor but the last one needed runs at full load and the last one trims to the remaining demand, while the
+ * others are off. With a designated trim compressor, the others are base compressors loaded in order only while the
+ * demand exceeds what the trim compressor can supply; a base compressor runs at full load, or at part load supplying
+ * only the demand above the trim capacity when the demand is below its own capacity. The usable air stored in the
+ * receivers and piping between the load and unload pressures covers demand above the system capacity and is
+ * recharged by the trim compressor.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_COMPRESSEDAIRSYSTEMSIMULATION_H
+#define AMO_TOOLS_SUITE_COMPRESSEDAIRSYSTEMSIMULATION_H
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <vector>
+#include "calculator/util/CompressedAirCentrifugal.h"
+#include "calculator/util/CompressedAirCentrifugalMap.h"
+
+/**
+ * Compressed Air System Simulation class
+ * Used to step a sequenced compressor inventory through a demand time series.
+ */
+class CompressedAirSystemSimulation {
+public:
+    enum class LoadState {
+        OFF,
+        PART_LOAD, ///< trim compressor, modulating, blowing off or cycling between load and unload
+        FULL_LOAD
+    };
+
+    /**
+     * A compressor of the inventory; use the factory functions to build it from its control type model
+     */
+    class CompressorUnit {
+    public:
+        /**
+         * @param kW_fl double, power at full load - kW
+         * @param C_fl double, capacity at full load - acfm
+         * @param kW_nl double, power at no load - kW
+         */
+        static CompressorUnit loadUnload(double kW_fl, double C_fl, double kW_nl);
+
+        /**
+         * @param kW_fl double, power at full load - kW
+         * @param C_fl double, capacity at full load - acfm
+         * @param kW_nl double, power at no load - kW
+         * @param C_max double, capacity at maximum full flow - acfm
+         * @param kW_ul double, power at the unload point - kW
+         * @param C_ul double, capacity at the unload point - acfm
+         */
+        static CompressorUnit modulationUnload(double kW_fl, double C_fl, double kW_nl, double C_max, double kW_ul,
+                                               double C_ul);
+
+        /**
+         * @param kW_fl double, power at full load - kW
+         * @param C_fl double, capacity at full load - acfm
+         * @param kW_blow double, power at the blow off point - kW
+         * @param C_blow double, surge flow - acfm
+         */
+        static CompressorUnit blowOff(double kW_fl, double C_fl, double kW_blow, double C_blow);
+
+        /**
+         * @param map CompressedAirCentrifugalMap, performance map of the compressor
+         * @param P_fl double, discharge pressure the system runs at, 0 for the rated discharge pressure - psig
+         */
+        static CompressorUnit centrifugal(const CompressedAirCentrifugalMap &map, double P_fl);
+
+        CompressedAirCentrifugalBase::ControlType getControlType() const { return controlType; }
+        double getFullLoadCapacity() const { return fullLoadCapacity; }
+        double getFullLoadPower() const { return fullLoadPower; }
+
+        /**
+         * @param capacityFraction double, delivered air as a fraction of the full load capacity
+         * @return double, power of the compressor - kW
+         */
+        double getPower(double capacityFraction) const { return power(capacityFraction); }
+
+    private:
+        CompressorUnit(CompressedAirCentrifugalBase::ControlType controlType, double fullLoadCapacity,
+                       std::function<double(double)> power);
+
+        CompressedAirCentrifugalBase::ControlType controlType;
+        double fullLoadCapacity, fullLoadPower;
+        std::function<double(double)> power;
+    };
+
+    struct CompressorResults {
+        double energy = 0; ///< kWh
+        double peakPower = 0; ///< kW
+        double airDelivered = 0; ///< acf
+        double fullLoadHours = 0;
+        double partLoadHours = 0;
+        double offHours = 0;
+        double loadUnloadCycles = 0; ///< cycles of a load/unload compressor while trimming, 0 without storage
+    };
+
+    struct Results {
+        std::vector<CompressorResults> compressors;
+        std::size_t steps = 0; ///< steps simulated, fewer than the demand profile when the energy limit was reached
+        double hours = 0; ///< hours simulated
+        double energy = 0; ///< kWh, the annual energy when the profile covers a year
+        double peakPower = 0; ///< kW
+        double airDemand = 0; ///< acf
+        double unmetDemand = 0; ///< acf of demand neither the compressors nor the storage could supply
+    };
+
+    /**
+     * Constructor for the simulation
+     * @param compressors std::vector<CompressorUnit>, compressor inventory in the sequencer's loading order
+     * @param storageCapacity double, total capacity of the receivers and piping, as given by
+     *        Compressor::AirSystemCapacity - ft3
+     * @param pressureBand double, pressure difference between the load and unload pressures - psi
+     * @param timeStep double, duration of each sample of the demand profile - hours
+     * @param trimCompressor int, index of the compressor that always trims while the others run as base load
+     *        compressors, -1 for the last compressor needed to trim
+     */
+    CompressedAirSystemSimulation(std::vector<CompressorUnit> compressors, double storageCapacity, double pressureBand,
+                                  double timeStep, int trimCompressor = -1);
+
+    /**
+     * Steps the system through a demand profile, starting with full storage
+     * @param count std::size_t, number of samples in the demand profile
+     * @param demand const double *, air demand of each sample - acfm
+     * @param states LoadState *, optional count x compressors load state of each compressor at each sample, row major
+     * @param power double *, optional count x compressors power of each compressor at each sample - kW, row major
+     * @param energyLimit double, the simulation stops after the step at which the energy exceeds it - kWh
+     * @return Results, energy, load hours and cycles of each compressor and of the system
+     */
+    Results simulate(std::size_t count, const double *demand, LoadState *states = nullptr, double *power = nullptr,
+                     double energyLimit = std::numeric_limits<double>::infinity()) const;
+
+    /**
+     * Steps the system through a demand profile, starting with full storage
+     * @param demand std::vector<double>, air demand of each sample - acfm
+     * @return Results, energy, load hours and cycles of each compressor and of the system
+     */
+    Results simulate(const std::vector<double> &demand) const {
+        return simulate(demand.size(), demand.data());
+    }
+
+    double getUsableStorage() const { return usableStorage; }
+    double getTotalCapacity() const { return totalCapacity; }
+
+private:
+    std::vector<CompressorUnit> compressors;
+    double usableStorage, timeStep, totalCapacity = 0;
+    int trimCompressor;
+};
+
+#endif //AMO_TOOLS_SUITE_COMPRESSEDAIRSYSTEMSIMULATION_H
@@ -0,0 +1,40 @@
+/**
+ * @file
+ * @brief Splits a line read by io::LineReader into its comma separated values
+ *
+ * Values may be double quoted, with "" standing for a quote inside a quoted value. A carriage return left at the
+ * end of the line by a file with CRLF line endings is dropped.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_CSVLINE_H
+#define AMO_TOOLS_SUITE_CSVLINE_H
+
+#include <fast-cpp-csv-parser/csv.h>
+#include <string>
+#include <vector>
+
+class CsvLine {
+public:
+    /**
+     * @param line char *, the line, which is unescaped in place
+     * @return std::vector<std::string>, the values, one more than the number of separating commas
+     */
+    static std::vector<std::string> split(char *line) {
+        typedef io::double_quote_escape<',', '"'> quote_policy;
+
+        std::vector<std::string> values;
+        while (line != nullptr) {
+            char *begin, *end;
+            io::detail::chop_next_column<quote_policy>(line, begin, end);
+            quote_policy::unescape(begin, end);
+            values.emplace_back(begin, end);
+        }
+        if (!values.empty() && !values.back().empty() && values.back().back() == '\r') values.back().pop_back();
+        return values;
+    }
+};
+
+#endif //AMO_TOOLS_SUITE_CSVLINE_H
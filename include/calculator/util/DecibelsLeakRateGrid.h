@@ -0,0 +1,110 @@
+/**
+ * @file
+ * @brief Leak rates of the decibels method looked up in a reference table of decibel ratings and line pressures
+ *
+ * An ultrasonic leak detector comes with a table of leak rates measured at several decibel ratings and line pressures.
+ * The decibels method (DecibelsMethod, DecibelsMethodData) interpolates the leak rate bilinearly between two decibel
+ * ratings and two pressures of the table. The grid compiles the whole table once: the cell of a reading is found in
+ * constant time from a bin index of each axis, and the leak rate is interpolated between the corners of the cell with
+ * the same formula, so the result is the one DecibelsMethodData gives for those corners. Readings outside the table
+ * are extrapolated from its edge cells, as the formula does outside its reference points.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_DECIBELSLEAKRATEGRID_H
+#define AMO_TOOLS_SUITE_DECIBELSLEAKRATEGRID_H
+
+#include <cstddef>
+#include <vector>
+
+class DecibelsMethodData;
+
+/**
+ * Decibels Leak Rate Grid class
+ * Used to estimate the leak rates of many decibel readings from one reference table.
+ */
+class DecibelsLeakRateGrid {
+public:
+    /**
+     * Constructor for DecibelsLeakRateGrid
+     * @param pressures std::vector<double>, line pressures of the table, increasing - psig
+     * @param decibelRatings std::vector<double>, decibel ratings of the table, increasing - dB
+     * @param leakRates std::vector<double>, leak rate at each decibel rating and pressure, one row per decibel rating -
+     *        scfm
+     */
+    DecibelsLeakRateGrid(std::vector<double> pressures, std::vector<double> decibelRatings,
+                         std::vector<double> leakRates);
+
+    /**
+     * @param linePressure double, line pressure of the leak - psig
+     * @param decibels double, decibel reading of the leak - dB
+     * @return double, leak rate - scfm
+     */
+    double calculate(double linePressure, double decibels) const;
+
+    /**
+     * Leak rates of a batch of readings
+     * @param count std::size_t, number of readings
+     * @param linePressures const double *, line pressure of each leak - psig
+     * @param decibels const double *, decibel reading of each leak - dB
+     * @param leakRates double *, receives the leak rate of each leak - scfm
+     */
+    void calculate(std::size_t count, const double *linePressures, const double *decibels, double *leakRates) const;
+
+    /**
+     * The reference points the leak rate of a reading is interpolated between
+     * @param linePressure double, line pressure of the leak - psig
+     * @param decibels double, decibel reading of the leak - dB
+     * @return DecibelsMethodData, the reading with the corners of its cell as the A and B reference points
+     */
+    DecibelsMethodData getReferencePoints(double linePressure, double decibels) const;
+
+    /**
+     * Bilinear interpolation of the decibels method between the A and B reference points
+     * @param linePressure double, X
+     * @param decibels double, Y
+     * @param decibelRatingA double, Y1
+     * @param pressureA double, X1
+     * @param firstFlowA double, Q11, leak rate at X1 and Y1
+     * @param secondFlowA double, Q21, leak rate at X2 and Y1
+     * @param decibelRatingB double, Y2
+     * @param pressureB double, X2
+     * @param firstFlowB double, Q12, leak rate at X1 and Y2
+     * @param secondFlowB double, Q22, leak rate at X2 and Y2
+     * @return double, leak rate estimate
+     */
+    static double interpolate(double linePressure, double decibels, double decibelRatingA, double pressureA,
+                              double firstFlowA, double secondFlowA, double decibelRatingB, double pressureB,
+                              double firstFlowB, double secondFlowB);
+
+private:
+    /**
+     * Points of one axis of the table, with a uniform bin index to find the cell of a value in constant time
+     */
+    class Axis {
+    public:
+        explicit Axis(std::vector<double> points);
+
+        /**
+         * @return std::size_t, index of the first point of the cell [points[i], points[i + 1]) holding the value,
+         *         the first or last cell outside the table
+         */
+        std::size_t findCell(double value) const;
+
+        const std::vector<double> &getPoints() const { return points; }
+
+    private:
+        std::vector<double> points;
+        double binWidth;
+        std::vector<std::size_t> bins; ///< cell holding the start of each bin
+    };
+
+    double interpolateCell(std::size_t pressureCell, std::size_t decibelCell, double linePressure, double decibels) const;
+
+    Axis pressures, decibelRatings;
+    std::vector<double> leakRates;
+};
+
+#endif //AMO_TOOLS_SUITE_DECIBELSLEAKRATEGRID_H
@@ -0,0 +1,127 @@
+/**
+ * @file
+ * @brief Exhaustive search of a grid of settings for the Pareto set of two objectives
+ *
+ * Each search variable takes the values of a Range. The grid points are numbered from 0 and evaluated on several
+ * threads; the caller maps a number to its settings and supplies the feasibility test and the dominance order.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_GRIDSEARCH_H
+#define AMO_TOOLS_SUITE_GRIDSEARCH_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "calculator/util/ParallelFor.h"
+
+class GridSearch {
+public:
+    /**
+     * Values minimum, minimum + step, ... that are not above maximum. The step may be 0 when minimum equals maximum.
+     */
+    struct Range {
+        double minimum;
+        double maximum;
+        double step;
+    };
+
+    template <typename Candidate>
+    struct Results {
+        std::vector<Candidate> paretoSet; ///< non-dominated feasible candidates, in the order of the search
+        std::size_t feasibleCandidates = 0;
+    };
+
+    /**
+     * @param range Range, values of one search variable
+     * @param owner const char *, name of the calling optimizer for the error messages
+     * @param name const char *, name of the search variable for the error messages
+     * @return std::vector<double>, the values of the range, increasing
+     */
+    static std::vector<double> getValues(const Range &range, const char *owner, const char *name) {
+        if (!(range.minimum <= range.maximum)) {
+            throw std::runtime_error(std::string(owner) + ": " + name + " minimum is above its maximum");
+        }
+        if (range.minimum == range.maximum) return {range.minimum};
+        if (!(range.step > 0)) {
+            throw std::runtime_error(std::string(owner) + ": " + name + " step must be positive");
+        }
+
+        // tolerates rounding in (maximum - minimum) / step so that a maximum on the grid is included
+        const auto count =
+                static_cast<std::size_t>(std::floor((range.maximum - range.minimum) / range.step + 1e-9)) + 1;
+        std::vector<double> values(count);
+        for (std::size_t i = 0; i < count; i++) {
+            values[i] = std::min(range.minimum + i * range.step, range.maximum);
+        }
+        return values;
+    }
+
+    /**
+     * Keeps the candidates that no other candidate beats on both objectives
+     * @param candidates std::vector<Candidate>, candidates to reduce
+     * @param isBetter function bool(const Candidate &, const Candidate &), strict order by the first objective, then
+     *        the second objective, then any tie break
+     * @param secondObjective function double(const Candidate &), the second objective, lower is better
+     * @return std::vector<Candidate>, the Pareto set in the order of isBetter
+     */
+    template <typename Candidate, typename IsBetter, typename SecondObjective>
+    static std::vector<Candidate> getParetoSet(std::vector<Candidate> candidates, IsBetter isBetter,
+                                               SecondObjective secondObjective) {
+        std::sort(candidates.begin(), candidates.end(), isBetter);
+
+        std::vector<Candidate> paretoSet;
+        double lowest = std::numeric_limits<double>::infinity();
+        for (auto const &candidate : candidates) {
+            if (secondObjective(candidate) < lowest) {
+                paretoSet.push_back(candidate);
+                lowest = secondObjective(candidate);
+            }
+        }
+        return paretoSet;
+    }
+
+    /**
+     * Evaluates the grid points 0 to count - 1 and returns the Pareto set of the feasible ones
+     * @param count std::size_t, number of grid points
+     * @param threads unsigned, number of threads evaluating candidates, 0 for one per hardware thread
+     * @param evaluate function Candidate(std::size_t), evaluates one grid point
+     * @param isFeasible function bool(const Candidate &)
+     * @param getParetoSet function std::vector<Candidate>(std::vector<Candidate>), the Pareto set of some candidates
+     * @return Results<Candidate>, the Pareto set of the grid and the number of feasible candidates
+     */
+    template <typename Candidate, typename Evaluate, typename IsFeasible, typename ParetoSet>
+    static Results<Candidate> search(const std::size_t count, unsigned threads, Evaluate evaluate,
+                                     IsFeasible isFeasible, ParetoSet getParetoSet) {
+        // each thread evaluates a contiguous block of the grid and keeps only the Pareto set of its block
+        threads = ParallelFor::getThreadCount(threads, count);
+        std::vector<std::vector<Candidate>> paretoSets(threads);
+        std::vector<std::size_t> feasibleCandidates(threads, 0);
+        ParallelFor::run(count, threads, [&](const std::size_t begin, const std::size_t end, const unsigned thread) {
+            std::vector<Candidate> feasible;
+            for (std::size_t i = begin; i < end; i++) {
+                const Candidate candidate = evaluate(i);
+                if (isFeasible(candidate)) feasible.push_back(candidate);
+            }
+            feasibleCandidates[thread] = feasible.size();
+            paretoSets[thread] = getParetoSet(std::move(feasible));
+        });
+
+        Results<Candidate> results;
+        std::vector<Candidate> merged;
+        for (unsigned thread = 0; thread < threads; thread++) {
+            results.feasibleCandidates += feasibleCandidates[thread];
+            merged.insert(merged.end(), paretoSets[thread].begin(), paretoSets[thread].end());
+        }
+        results.paretoSet = getParetoSet(std::move(merged));
+        return results;
+    }
+};
+
+#endif //AMO_TOOLS_SUITE_GRIDSEARCH_H
@@ -0,0 +1,64 @@
+/**
+ * @file
+ * @brief Splits independent evaluations across threads
+ *
+ * The range of items is divided into one contiguous block per thread; the calling thread evaluates the first block.
+ * An exception thrown by any block is rethrown on the calling thread once every block has finished.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_PARALLELFOR_H
+#define AMO_TOOLS_SUITE_PARALLELFOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+class ParallelFor {
+public:
+    /**
+     * Number of threads used for count items
+     * @param threads unsigned, requested number of threads, 0 for one per hardware thread
+     * @param count std::size_t, number of items
+     * @return unsigned, between 1 and count, 1 when there are no items
+     */
+    static unsigned getThreadCount(unsigned threads, const std::size_t count) {
+        if (threads == 0) threads = std::max(std::thread::hardware_concurrency(), 1u);
+        return static_cast<unsigned>(std::max<std::size_t>(std::min<std::size_t>(threads, count), 1));
+    }
+
+    /**
+     * Calls body(begin, end, thread) once for each block of the items 0 to count - 1
+     * @param count std::size_t, number of items
+     * @param threads unsigned, requested number of threads, 0 for one per hardware thread
+     * @param body function void(std::size_t begin, std::size_t end, unsigned thread), thread numbers the blocks from 0
+     * to getThreadCount(threads, count) - 1
+     */
+    template <typename Body>
+    static void run(const std::size_t count, unsigned threads, Body body) {
+        threads = getThreadCount(threads, count);
+        std::vector<std::exception_ptr> failures(threads);
+        auto const block = [&](const unsigned thread) {
+            try {
+                body(count * thread / threads, count * (thread + 1) / threads, thread);
+            } catch (...) {
+                failures[thread] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        for (unsigned thread = 1; thread < threads; thread++) workers.emplace_back(block, thread);
+        block(0);
+        for (auto &worker : workers) worker.join();
+        for (auto const &failure : failures) {
+            if (failure) std::rethrow_exception(failure);
+        }
+    }
+};
+
+#endif //AMO_TOOLS_SUITE_PARALLELFOR_H
@@ -0,0 +1,154 @@
+/**
+ * @file
+ * @brief Bracketed root finding for the calculators that invert a monotone forward model
+ *
+ * Brent's method combines bisection, the secant method and inverse quadratic interpolation. It keeps the root
+ * bracketed, so it converges for any continuous function that changes sign over the starting interval, and converges
+ * superlinearly on smooth functions, e.g. flue gas O2 as a function of excess air.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_ROOTFINDER_H
+#define AMO_TOOLS_SUITE_ROOTFINDER_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+class RootFinder {
+public:
+    /**
+     * Result of a root search
+     */
+    struct Result {
+        double root; ///< the root, or the last estimate when not converged
+        int iterations; ///< function evaluations used
+        bool converged; ///< false when the iteration limit was reached first
+    };
+
+    /**
+     * Finds a root of f within [lower, upper] using Brent's method
+     * @param f function double(double), must change sign over [lower, upper]
+     * @param lower double, one end of the bracket
+     * @param upper double, other end of the bracket
+     * @param tolerance double, absolute tolerance of the root
+     * @param maxIterations int, maximum number of function evaluations
+     * @return Result, root and number of function evaluations
+     */
+    template <typename Function>
+    static Result brent(Function f, const double lower, const double upper, const double tolerance,
+                        const int maxIterations = 100) {
+        return brent(f, lower, f(lower), upper, f(upper), tolerance, maxIterations, 2);
+    }
+
+    /**
+     * Finds a root of f starting from an estimate. The interval from origin to estimate is doubled in width, away
+     * from origin and up to bound, until f changes sign over it, then the root is found within it using Brent's
+     * method.
+     * @param f function double(double), monotone on the side of origin the estimate is on
+     * @param origin double, a point known to be on the other side of the root from the estimate, or close to it
+     * @param estimate double, estimated root, must differ from origin
+     * @param bound double, farthest point from origin searched, on the same side as the estimate
+     * @param tolerance double, absolute tolerance of the root
+     * @param maxIterations int, maximum number of function evaluations, bracketing included
+     * @return Result, root and number of function evaluations; not converged, with the root at the last point
+     * searched, when f does not change sign before bound
+     */
+    template <typename Function>
+    static Result bracketAndSolve(Function f, const double origin, const double estimate, const double bound,
+                                  const double tolerance, const int maxIterations = 100) {
+        if (estimate == origin || (estimate - origin) * (bound - estimate) < 0) {
+            throw std::runtime_error("RootFinder::bracketAndSolve - the estimate must lie between origin and bound");
+        }
+
+        double a = origin, fa = f(a);
+        if (fa == 0) return {a, 1, true};
+
+        double b = estimate, fb = f(b);
+        int iterations = 2;
+        while (sameSign(fa, fb)) {
+            if (b == bound || iterations >= maxIterations) return {b, iterations, false};
+            double next = origin + 2 * (b - origin);
+            if ((next - bound) * (b - origin) > 0) next = bound;
+            a = b;
+            fa = fb;
+            b = next;
+            fb = f(b);
+            iterations++;
+        }
+        return brent(f, a, fa, b, fb, tolerance, maxIterations, iterations);
+    }
+
+private:
+    static bool sameSign(const double x, const double y) {
+        return (x > 0 && y > 0) || (x < 0 && y < 0);
+    }
+
+    template <typename Function>
+    static Result brent(Function f, double a, double fa, double b, double fb, const double tolerance,
+                        const int maxIterations, int iterations) {
+        if (sameSign(fa, fb)) throw std::runtime_error("RootFinder::brent - the root is not bracketed");
+        if (fa == 0) return {a, iterations, true};
+
+        double c = b, fc = fb, d = b - a, e = d;
+        while (true) {
+            if (sameSign(fb, fc)) {
+                c = a;
+                fc = fa;
+                d = e = b - a;
+            }
+            if (std::fabs(fc) < std::fabs(fb)) {
+                a = b;
+                b = c;
+                c = a;
+                fa = fb;
+                fb = fc;
+                fc = fa;
+            }
+
+            const double tol = 2 * std::numeric_limits<double>::epsilon() * std::fabs(b) + 0.5 * tolerance;
+            const double middle = 0.5 * (c - b);
+            if (std::fabs(middle) <= tol || fb == 0) return {b, iterations, true};
+            if (iterations >= maxIterations) return {b, iterations, false};
+
+            if (std::fabs(e) >= tol && std::fabs(fa) > std::fabs(fb)) {
+                // secant when only two points are known, inverse quadratic interpolation otherwise
+                double p, q;
+                const double s = fb / fa;
+                if (a == c) {
+                    p = 2 * middle * s;
+                    q = 1 - s;
+                } else {
+                    const double r = fb / fc;
+                    q = fa / fc;
+                    p = s * (2 * middle * q * (q - r) - (b - a) * (r - 1));
+                    q = (q - 1) * (r - 1) * (s - 1);
+                }
+                if (p > 0) q = -q;
+                p = std::fabs(p);
+
+                if (2 * p < std::min(3 * middle * q - std::fabs(tol * q), std::fabs(e * q))) {
+                    e = d;
+                    d = p / q;
+                } else {
+                    d = middle;
+                    e = d;
+                }
+            } else {
+                d = middle;
+                e = d;
+            }
+
+            a = b;
+            fa = fb;
+            b += std::fabs(d) > tol ? d : (middle > 0 ? tol : -tol);
+            fb = f(b);
+            iterations++;
+        }
+    }
+};
+
+#endif //AMO_TOOLS_SUITE_ROOTFINDER_H
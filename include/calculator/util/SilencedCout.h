@@ -0,0 +1,50 @@
+/**
+ * @file
+ * @brief Discards what the library writes to std::cout
+ *
+ * Some calculations print diagnostics to std::cout, which would otherwise end up in the middle of the results that
+ * a tool writes to standard output. While a SilencedCout exists, std::cout writes to a buffer that drops everything,
+ * and the tool writes its own output through getStandardOutput().
+ *
+ * The buffer of std::cout is swapped when the SilencedCout is created and destroyed, so that must happen while no
+ * other thread is writing to std::cout. In between, calculations on other threads may write to std::cout as long as
+ * it stays synchronized with stdio (std::ios::sync_with_stdio is not turned off); the dropped writes then do not race.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_SILENCEDCOUT_H
+#define AMO_TOOLS_SUITE_SILENCEDCOUT_H
+
+#include <iostream>
+#include <streambuf>
+
+class SilencedCout {
+public:
+    SilencedCout() : standardOutput(std::cout.rdbuf(&nullBuffer)) {}
+
+    ~SilencedCout() { std::cout.rdbuf(standardOutput); }
+
+    SilencedCout(const SilencedCout &) = delete;
+    SilencedCout &operator=(const SilencedCout &) = delete;
+
+    /**
+     * @return std::streambuf *, the buffer std::cout wrote to before it was silenced
+     */
+    std::streambuf *getStandardOutput() const { return standardOutput; }
+
+private:
+    /**
+     * Accepts and discards everything written to it; it keeps no state, so concurrent writes are harmless
+     */
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override { return c; }
+    };
+
+    NullBuffer nullBuffer;
+    std::streambuf *const standardOutput;
+};
+
+#endif //AMO_TOOLS_SUITE_SILENCEDCOUT_H
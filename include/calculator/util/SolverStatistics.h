@@ -0,0 +1,239 @@
+/**
+ * @brief Iteration statistics for the iterative solvers
+ *
+ * Several calculators hide iteration loops (steam balance restarts, IAPWS region 3 root finding, motor load
+ * stepping, excess air search, insulation heat balance, fan compressibility, compressed air networks). This collects,
+ * per solver, the number of calls, an iteration count histogram, convergence failures and wall-clock time so
+ * pathological inputs can be found.
+ *
+ * Collection is compiled in only when AMO_TOOLS_SUITE_INSTRUMENTATION is defined (CMake option
+ * ENABLE_SOLVER_INSTRUMENTATION, node-gyp --solver_instrumentation=1). Otherwise the AMO_SOLVER_* macros expand to
+ * nothing, the solvers are unchanged, and the query functions report no calls.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_SOLVERSTATISTICS_H
+#define AMO_TOOLS_SUITE_SOLVERSTATISTICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * The instrumented solvers
+ */
+enum class Solver {
+    STEAM_MODEL_RUNNER, ///< SteamModelRunner::run, one iteration per steam balance attempt
+    STEAM_REGION3, ///< SteamSystemModelerTool::region3, one iteration per density evaluation
+    STEAM_BACKWARD_REGION3, ///< SteamSystemModelerTool::backwardRegion3Exact, one iteration per secant step
+    MOTOR_SHAFT_POWER, ///< MotorShaftPower::calculate, one iteration per 1% load fraction step
+    INSULATED_PIPE, ///< InsulatedPipeCalculator heat balance, one iteration per recursion
+    FAN_CURVE, ///< FanCurve kp / kpc iteration, one call per curve row
+    FAN203_COMPRESSIBILITY, ///< Fan203 compressibility factor ratio iteration
+    SOLID_LIQUID_EXCESS_AIR, ///< SolidLiquidFlueGasMaterial::solveExcessAirFromFlueGasO2, one iteration per O2 step
+    AIR_NETWORK ///< CompressedAirNetwork::solve, one iteration per Newton step
+};
+
+class SolverStatistics {
+public:
+    static const std::size_t SOLVER_COUNT = 9;
+
+    /**
+     * Bucket 0 counts calls that needed no iterations, bucket b counts calls needing [2^(b-1), 2^b) iterations and
+     * the last bucket is open ended.
+     */
+    static const std::size_t HISTOGRAM_BUCKETS = 17;
+
+    struct Summary {
+        Solver solver;
+        std::string name;
+        unsigned long long calls;
+        unsigned long long iterations; ///< total over all calls
+        unsigned long long maxIterations;
+        unsigned long long failures; ///< calls that hit their iteration limit or threw
+        unsigned long long nanoseconds; ///< total wall-clock time over all calls
+        std::array<unsigned long long, HISTOGRAM_BUCKETS> histogram;
+
+        double getMeanIterations() const { return calls == 0 ? 0 : static_cast<double>(iterations) / calls; }
+    };
+
+    /**
+     * @return bool, true when the library was built with AMO_TOOLS_SUITE_INSTRUMENTATION
+     */
+    static bool isEnabled() {
+#ifdef AMO_TOOLS_SUITE_INSTRUMENTATION
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @param solver Solver
+     * @return const char *, camelCase solver name, as reported by the bindings
+     */
+    static const char *getName(const Solver solver) {
+        static const char *names[SOLVER_COUNT] = {
+                "steamModelRunner", "steamRegion3", "steamBackwardRegion3", "motorShaftPower", "insulatedPipe",
+                "fanCurve", "fan203Compressibility", "solidLiquidExcessAir", "compressedAirNetwork"
+        };
+        return names[static_cast<std::size_t>(solver)];
+    }
+
+    /**
+     * @param iterations std::size_t, iteration count of one call
+     * @return std::size_t, histogram bucket of the iteration count
+     */
+    static std::size_t getBucket(std::size_t iterations) {
+        std::size_t bucket = 0;
+        while (iterations > 0 && bucket < HISTOGRAM_BUCKETS - 1) {
+            iterations >>= 1;
+            bucket++;
+        }
+        return bucket;
+    }
+
+    /**
+     * @param bucket std::size_t, histogram bucket
+     * @return unsigned long long, largest iteration count counted in the bucket (the last bucket is open ended)
+     */
+    static unsigned long long getBucketUpperBound(const std::size_t bucket) {
+        return bucket == 0 ? 0 : (1ULL << bucket) - 1;
+    }
+
+    /**
+     * Adds one solver call. Normally called by SolverScope.
+     * @param solver Solver
+     * @param iterations std::size_t, iterations the call needed
+     * @param converged bool, false when the call hit its iteration limit or threw
+     * @param nanoseconds unsigned long long, wall-clock time of the call
+     */
+    static void record(const Solver solver, const std::size_t iterations, const bool converged,
+                       const unsigned long long nanoseconds) {
+        Counters &c = counters()[static_cast<std::size_t>(solver)];
+        c.calls.fetch_add(1, std::memory_order_relaxed);
+        c.iterations.fetch_add(iterations, std::memory_order_relaxed);
+        if (!converged) c.failures.fetch_add(1, std::memory_order_relaxed);
+        c.nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+        c.histogram[getBucket(iterations)].fetch_add(1, std::memory_order_relaxed);
+
+        unsigned long long max = c.maxIterations.load(std::memory_order_relaxed);
+        while (iterations > max && !c.maxIterations.compare_exchange_weak(max, iterations)) {}
+    }
+
+    static Summary getSummary(const Solver solver) {
+        const Counters &c = counters()[static_cast<std::size_t>(solver)];
+        Summary summary;
+        summary.solver = solver;
+        summary.name = getName(solver);
+        summary.calls = c.calls.load();
+        summary.iterations = c.iterations.load();
+        summary.maxIterations = c.maxIterations.load();
+        summary.failures = c.failures.load();
+        summary.nanoseconds = c.nanoseconds.load();
+        for (std::size_t i = 0; i < HISTOGRAM_BUCKETS; i++) summary.histogram[i] = c.histogram[i].load();
+        return summary;
+    }
+
+    /**
+     * @return std::vector<Summary>, statistics of every solver, in Solver order
+     */
+    static std::vector<Summary> getSummaries() {
+        std::vector<Summary> summaries;
+        for (std::size_t i = 0; i < SOLVER_COUNT; i++) summaries.push_back(getSummary(static_cast<Solver>(i)));
+        return summaries;
+    }
+
+    /**
+     * Clears the statistics of every solver
+     */
+    static void reset() {
+        for (auto &c : counters()) {
+            c.calls = 0;
+            c.iterations = 0;
+            c.maxIterations = 0;
+            c.failures = 0;
+            c.nanoseconds = 0;
+            for (auto &bucket : c.histogram) bucket = 0;
+        }
+    }
+
+private:
+    struct Counters {
+        std::atomic<unsigned long long> calls;
+        std::atomic<unsigned long long> iterations;
+        std::atomic<unsigned long long> maxIterations;
+        std::atomic<unsigned long long> failures;
+        std::atomic<unsigned long long> nanoseconds;
+        std::array<std::atomic<unsigned long long>, HISTOGRAM_BUCKETS> histogram;
+    };
+
+    // static storage, so every counter starts at zero
+    static std::array<Counters, SOLVER_COUNT> &counters() {
+        static std::array<Counters, SOLVER_COUNT> solverCounters;
+        return solverCounters;
+    }
+};
+
+/**
+ * Times one solver call and records it when it goes out of scope. Iterations are counted per thread, so solvers
+ * that recurse can count from any depth with SolverScope::iteration without access to the scope object. A call that
+ * leaves the scope without converged() being called (iteration limit reached, exception thrown) is a failure.
+ */
+class SolverScope {
+public:
+    explicit SolverScope(const Solver solver)
+            : solver(solver), outerIterations(pendingIterations()[static_cast<std::size_t>(solver)]),
+              start(std::chrono::steady_clock::now()) {
+        pendingIterations()[static_cast<std::size_t>(solver)] = 0;
+    }
+
+    ~SolverScope() {
+        std::size_t &pending = pendingIterations()[static_cast<std::size_t>(solver)];
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        SolverStatistics::record(solver, pending, isConverged,
+                                 std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        pending = outerIterations;
+    }
+
+    SolverScope(const SolverScope &) = delete;
+    SolverScope &operator=(const SolverScope &) = delete;
+
+    /**
+     * Counts one iteration of the innermost active scope of the solver on this thread
+     * @param solver Solver
+     */
+    static void iteration(const Solver solver) {
+        ++pendingIterations()[static_cast<std::size_t>(solver)];
+    }
+
+    void converged() { isConverged = true; }
+
+private:
+    static std::array<std::size_t, SolverStatistics::SOLVER_COUNT> &pendingIterations() {
+        static thread_local std::array<std::size_t, SolverStatistics::SOLVER_COUNT> iterations = {};
+        return iterations;
+    }
+
+    const Solver solver;
+    const std::size_t outerIterations;
+    const std::chrono::steady_clock::time_point start;
+    bool isConverged = false;
+};
+
+#ifdef AMO_TOOLS_SUITE_INSTRUMENTATION
+#define AMO_SOLVER_SCOPE(name, solver) SolverScope name(solver)
+#define AMO_SOLVER_ITERATION(solver) SolverScope::iteration(solver)
+#define AMO_SOLVER_CONVERGED(name) name.converged()
+#else
+#define AMO_SOLVER_SCOPE(name, solver) ((void) 0)
+#define AMO_SOLVER_ITERATION(solver) ((void) 0)
+#define AMO_SOLVER_CONVERGED(name) ((void) 0)
+#endif
+
+#endif //AMO_TOOLS_SUITE_SOLVERSTATISTICS_H
@@ -0,0 +1,216 @@
+/**
+ * @file
+ * @brief Hourly energy and water model of a chilled water plant of chillers, cooling towers and pumps
+ *
+ * Each hour the cooling towers supply condenser water at a setpoint, or at the wet bulb temperature plus the tower
+ * approach when the setpoint cannot be reached; with condenser water temperature reset the setpoint follows the wet
+ * bulb temperature down to a minimum. The chillers are staged on in their sequence order and share the load at the
+ * same part load ratio. Chiller power is the full load power times polynomial curves of the part load ratio and of the
+ * entering condenser water temperature, each running chiller runs its dedicated chilled and condenser water pumps,
+ * and the tower fans slow in proportion to the heat rejected and to how far the setpoint is above the free running
+ * temperature. The makeup water of the towers is accounted with CoolingTowerMakeupWaterCalculator.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_CHILLERPLANT_H
+#define AMO_TOOLS_SUITE_CHILLERPLANT_H
+
+#include <cstddef>
+#include <vector>
+#include "calculator/util/CurveFitVal.h"
+#include "chillers/CoolingTower.h"
+#include "results/Results.h"
+
+/**
+ * Chiller Plant class
+ * Used to simulate the chillers, cooling towers and pumps of a chilled water plant through hourly cooling load and
+ * weather series, e.g. the 8760 hours of a year.
+ */
+class ChillerPlant {
+public:
+    enum class Staging {
+        SEQUENCE, ///< the fewest chillers in sequence order that carry the load at up to the maximum part load ratio
+        LOWEST_POWER ///< of the fewest chillers up to all chillers in sequence order, the number with the lowest plant power
+    };
+
+    /**
+     * A chiller with its dedicated chilled water and condenser water pumps
+     */
+    class Chiller {
+    public:
+        /**
+         * @param capacity double, cooling capacity at full load - tons
+         * @param fullLoadEfficiency double, power at full load and at the reference condenser water temperature - kW/ton
+         * @param partLoadCurve CurveFitVal, power as a fraction of the full load power vs the part load ratio
+         * @param condenserWaterCurve CurveFitVal, power multiplier vs the entering condenser water temperature in °F,
+         *        1 at the reference temperature
+         * @param condenserWaterFlow double, condenser water flow through the towers while the chiller runs - gpm
+         * @param chilledWaterPumpPower double, electric power of the chilled water pump - kW
+         * @param condenserWaterPumpPower double, electric power of the condenser water pump - kW
+         */
+        Chiller(double capacity, double fullLoadEfficiency, CurveFitVal partLoadCurve, CurveFitVal condenserWaterCurve,
+                double condenserWaterFlow, double chilledWaterPumpPower, double condenserWaterPumpPower);
+
+        /**
+         * Electric power of a pump from its PSAT results
+         * @param pump PSATResult::Output, the existing or modified results of the pump
+         * @return double, electric power of the pump motor - kW
+         */
+        static double getPumpPower(const PSATResult::Output &pump) { return pump.motorPower; }
+
+        /**
+         * @param partLoadRatio double, cooling load as a fraction of the capacity
+         * @param condenserWaterTemperature double, entering condenser water temperature - °F
+         * @return double, electric power of the chiller without its pumps - kW
+         */
+        double getPower(double partLoadRatio, double condenserWaterTemperature) const {
+            return capacity * fullLoadEfficiency * partLoadCurve.calculate(partLoadRatio)
+                   * condenserWaterCurve.calculate(condenserWaterTemperature);
+        }
+
+        double getCapacity() const { return capacity; }
+        double getFullLoadEfficiency() const { return fullLoadEfficiency; }
+        double getCondenserWaterFlow() const { return condenserWaterFlow; }
+        double getPumpPower() const { return chilledWaterPumpPower + condenserWaterPumpPower; }
+
+    private:
+        double capacity, fullLoadEfficiency;
+        CurveFitVal partLoadCurve, condenserWaterCurve;
+        double condenserWaterFlow, chilledWaterPumpPower, condenserWaterPumpPower;
+    };
+
+    /**
+     * The cooling towers of the plant, modeled as one tower
+     */
+    struct CoolingTower {
+        /**
+         * @param approach double, condenser water supply temperature above the wet bulb temperature with the fans at
+         *        full speed - °F
+         * @param condenserWaterSetpoint double, condenser water supply temperature setpoint - °F
+         * @param condenserWaterReset bool, the setpoint follows the wet bulb temperature plus the approach down to
+         *        minimumCondenserWaterTemperature instead of being held at condenserWaterSetpoint
+         * @param minimumCondenserWaterTemperature double, lowest condenser water supply temperature with reset - °F
+         * @param fanPower double, electric power of all fans at full speed - kW
+         * @param waterConservationData CoolingTowerWaterConservationData, cycles of concentration and drift loss
+         * @param lossCorrectionFactor double, correction factor for evaporation loss
+         */
+        CoolingTower(const double approach, const double condenserWaterSetpoint, const bool condenserWaterReset,
+                     const double minimumCondenserWaterTemperature, const double fanPower,
+                     const CoolingTowerWaterConservationData &waterConservationData,
+                     const double lossCorrectionFactor = 0.85)
+                : approach(approach), condenserWaterSetpoint(condenserWaterSetpoint),
+                  condenserWaterReset(condenserWaterReset),
+                  minimumCondenserWaterTemperature(minimumCondenserWaterTemperature), fanPower(fanPower),
+                  waterConservationData(waterConservationData), lossCorrectionFactor(lossCorrectionFactor) {}
+
+        double approach;
+        double condenserWaterSetpoint;
+        bool condenserWaterReset;
+        double minimumCondenserWaterTemperature;
+        double fanPower;
+        CoolingTowerWaterConservationData waterConservationData;
+        double lossCorrectionFactor;
+    };
+
+    struct HourResults {
+        int chillersRunning = 0;
+        double partLoadRatio = 0; ///< of each running chiller
+        double condenserWaterTemperature = 0; ///< °F, entering the chillers
+        double chillerPower = 0; ///< kW
+        double pumpPower = 0; ///< kW
+        double towerFanPower = 0; ///< kW
+        double plantPower = 0; ///< kW
+        double evaporation = 0; ///< gallons
+        double drift = 0; ///< gallons
+        double blowDown = 0; ///< gallons
+        double makeupWater = 0; ///< gallons
+        double unmetLoad = 0; ///< tons above the capacity of all chillers
+    };
+
+    struct Results {
+        std::vector<double> chillerRunHours; ///< of each chiller in sequence order
+        std::size_t hours = 0;
+        std::size_t operatingHours = 0; ///< hours with a cooling load
+        double coolingDelivered = 0; ///< ton-hours
+        double unmetLoad = 0; ///< ton-hours
+        double chillerEnergy = 0; ///< kWh
+        double pumpEnergy = 0; ///< kWh
+        double towerFanEnergy = 0; ///< kWh
+        double energy = 0; ///< kWh, of the whole plant
+        double peakPower = 0; ///< kW
+        double efficiency = 0; ///< kW/ton, plant energy over the cooling delivered
+        double evaporation = 0; ///< gallons
+        double drift = 0; ///< gallons
+        double blowDown = 0; ///< gallons
+        double makeupWater = 0; ///< gallons
+    };
+
+    /**
+     * Constructor for the plant
+     * @param chillers std::vector<Chiller>, chillers in the order they are staged on
+     * @param coolingTower CoolingTower, the cooling towers of the plant
+     * @param staging Staging, how many chillers run at each hour
+     * @param maxPartLoadRatio double, part load ratio above which the next chiller is staged on
+     */
+    ChillerPlant(std::vector<Chiller> chillers, CoolingTower coolingTower, Staging staging = Staging::SEQUENCE,
+                 double maxPartLoadRatio = 1);
+
+    /**
+     * Steps the plant through hourly cooling load and weather series; the hours are independent and are simulated on
+     * several threads
+     * @param count std::size_t, number of hours
+     * @param coolingLoad const double *, cooling load of each hour - tons, 0 while the plant is off
+     * @param wetBulbTemperature const double *, ambient wet bulb temperature of each hour - °F
+     * @param hours HourResults *, optional, receives the results of each hour
+     * @param threads unsigned, number of threads, 0 for one per hardware thread
+     * @return Results, energy, water and run hours over the series
+     */
+    Results simulate(std::size_t count, const double *coolingLoad, const double *wetBulbTemperature,
+                     HourResults *hours = nullptr, unsigned threads = 0) const;
+
+    /**
+     * Steps the plant through hourly cooling load and weather series
+     * @param coolingLoad std::vector<double>, cooling load of each hour - tons, 0 while the plant is off
+     * @param wetBulbTemperature std::vector<double>, ambient wet bulb temperature of each hour - °F
+     * @return Results, energy, water and run hours over the series
+     */
+    Results simulate(const std::vector<double> &coolingLoad, const std::vector<double> &wetBulbTemperature) const;
+
+    /**
+     * Simulates one hour
+     * @param coolingLoad double, cooling load - tons
+     * @param wetBulbTemperature double, ambient wet bulb temperature - °F
+     * @return HourResults, staging, power and makeup water of the hour
+     */
+    HourResults calculate(double coolingLoad, double wetBulbTemperature) const;
+
+    /**
+     * @param wetBulbTemperature double, ambient wet bulb temperature - °F
+     * @return double, condenser water temperature entering the chillers - °F
+     */
+    double getCondenserWaterTemperature(double wetBulbTemperature) const;
+
+    const std::vector<Chiller> &getChillers() const { return chillers; }
+    const CoolingTower &getCoolingTower() const { return coolingTower; }
+    Staging getStaging() const { return staging; }
+
+private:
+    /**
+     * Plant power with the first chillersRunning chillers sharing the load; sets everything but the water
+     */
+    void calculatePower(int chillersRunning, double coolingLoad, double condenserWaterTemperature,
+                        double wetBulbTemperature, HourResults &hour) const;
+
+    std::vector<Chiller> chillers;
+    CoolingTower coolingTower;
+    Staging staging;
+    double maxPartLoadRatio;
+
+    // capacity, condenser water flow and pump power of the first n chillers at index n
+    std::vector<double> stagedCapacity, stagedCondenserWaterFlow, stagedPumpPower;
+    double designHeatRejection = 0; ///< Btu/h of all chillers at full load and the condenser water setpoint
+};
+
+#endif //AMO_TOOLS_SUITE_CHILLERPLANT_H
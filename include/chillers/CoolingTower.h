@@ -10,6 +10,8 @@
 #ifndef AMO_TOOLS_SUITE_COOLING_TOWER_H
 #define AMO_TOOLS_SUITE_COOLING_TOWER_H
 
+#include <cstddef>
+#include <vector>
 
 class CoolingTowerOperatingConditionsData
 {
@@ -91,6 +93,36 @@ class CoolingTowerMakeupWaterCalculator
 
         CoolingTowerMakeupWaterCalculator::Output calculate();
 
+        /**
+        * @param coolingLoad double, in MMBtu/h
+        * @param lossCorrectionFactor double, correction factor for evaporation loss
+        * @return double, evaporation loss in gpm
+        */
+        static double calculateEvaporationLoss(const double coolingLoad, const double lossCorrectionFactor)
+        {
+            return lossCorrectionFactor * 0.01 * coolingLoad * 1000000 / (500 * 10); // 0.01 = evaporation loss for ideal case
+        }
+
+        /**
+        * @param flowRate double, water flow rate in gpm
+        * @param driftLossFactor double, correction factor for drift loss
+        * @return double, drift loss in gpm
+        */
+        static double calculateDriftLoss(const double flowRate, const double driftLossFactor)
+        {
+            return driftLossFactor * flowRate;
+        }
+
+        /**
+        * @param evaporationLoss double, in gpm
+        * @param cyclesOfConcentration int
+        * @return double, blowdown in gpm
+        */
+        static double calculateBlowDown(const double evaporationLoss, const int cyclesOfConcentration)
+        {
+            return evaporationLoss / (cyclesOfConcentration - 1);
+        }
+
         CoolingTowerOperatingConditionsData getOperatingConditionsData() const { return operatingConditionsData; }
         CoolingTowerWaterConservationData getWaterConservationBaselineData() const { return waterConservationBaselineData; }
         CoolingTowerWaterConservationData getWaterConservationModificationData() const { return waterConservationModificationData; }
@@ -105,6 +137,120 @@ class CoolingTowerMakeupWaterCalculator
         CoolingTowerWaterConservationData waterConservationModificationData;
 };
 
+/**
+ * Hourly makeup water of a cooling tower over a load and weather series, e.g. the 8760 hours of a year. The
+ * evaporation of each hour does not depend on the water conservation data, so it is calculated once when the series
+ * is given; each scenario then only adds its drift and blowdown, and its annual totals take constant time.
+ */
+class CoolingTowerHourlySimulation
+{
+    public:
+        /**
+        * Correction factor for evaporation loss as a function of the ambient dry bulb temperature, interpolated
+        * linearly between the points and held at the first and last points outside them
+        */
+        struct EvaporationCurve
+        {
+            std::vector<double> dryBulbTemperature; ///< °F, increasing
+            std::vector<double> lossCorrectionFactor;
+        };
+
+        /**
+        * Water consumed over the series, in gallons
+        */
+        struct Totals
+        {
+            double evaporation = 0;
+            double drift       = 0;
+            double blowDown    = 0;
+            double makeupWater = 0;
+        };
+
+        /**
+        * Water consumed in each hour of the series and over the series, in gallons
+        */
+        struct Output
+        {
+            std::vector<double> evaporation;
+            std::vector<double> drift;
+            std::vector<double> blowDown;
+            std::vector<double> makeupWater;
+            Totals totals;
+        };
+
+        struct Comparison
+        {
+            Output baseline;
+            Output modification;
+            double waterSavings = 0; ///< gallons
+        };
+
+        /**
+        * @param flowRate double, water flow rate in gpm while the tower operates
+        * @param coolingLoad vector<double>, cooling load of each hour in MMBtu/h; the tower is off in hours without load
+        * @param lossCorrectionFactor double, correction factor for evaporation loss in every hour
+        */
+        CoolingTowerHourlySimulation(double flowRate, const std::vector<double> &coolingLoad,
+                                     double lossCorrectionFactor = 0.85);
+
+        /**
+        * @param flowRate double, water flow rate in gpm while the tower operates
+        * @param coolingLoad vector<double>, cooling load of each hour in MMBtu/h; the tower is off in hours without load
+        * @param dryBulbTemperature vector<double>, ambient dry bulb temperature of each hour in °F
+        * @param evaporationCurve EvaporationCurve, correction factor for evaporation loss at the dry bulb temperature
+        */
+        CoolingTowerHourlySimulation(double flowRate, const std::vector<double> &coolingLoad,
+                                     const std::vector<double> &dryBulbTemperature,
+                                     const EvaporationCurve &evaporationCurve);
+
+        /**
+        * @param waterConservationData CoolingTowerWaterConservationData, cycles of concentration above 1
+        * @return Output, the water consumed in each hour and the totals
+        */
+        Output calculate(const CoolingTowerWaterConservationData &waterConservationData) const;
+
+        /**
+        * @param waterConservationBaselineData CoolingTowerWaterConservationData, before modifications
+        * @param waterConservationModificationData CoolingTowerWaterConservationData, after modifications
+        * @return Comparison, both scenarios hour by hour and the water saved over the series
+        */
+        Comparison calculate(const CoolingTowerWaterConservationData &waterConservationBaselineData,
+                             const CoolingTowerWaterConservationData &waterConservationModificationData) const;
+
+        /**
+        * Totals of one scenario without the hourly values; equal to the totals of calculate
+        * @param waterConservationData CoolingTowerWaterConservationData, cycles of concentration above 1
+        * @return Totals, the water consumed over the series
+        */
+        Totals calculateTotals(const CoolingTowerWaterConservationData &waterConservationData) const;
+
+        /**
+        * Totals of each scenario of a sweep, e.g. over cycles of concentration and drift loss factors
+        * @param scenarios vector<CoolingTowerWaterConservationData>, cycles of concentration above 1
+        * @return vector<Totals>, the water consumed over the series in each scenario
+        */
+        std::vector<Totals> calculateTotals(const std::vector<CoolingTowerWaterConservationData> &scenarios) const;
+
+        std::size_t getHours() const { return evaporationLoss.size(); }
+        std::size_t getOperationalHours() const { return operationalHours; }
+        double getFlowRate() const { return flowRate; }
+
+    private:
+        void setFlowRates(const std::vector<double> &coolingLoad);
+        void setTotals();
+
+        double flowRate;
+        std::size_t operationalHours = 0;
+
+        // gpm in each hour, 0 while the tower is off
+        std::vector<double> evaporationLoss;
+        std::vector<double> flowRates;
+
+        // gallons over the series before drift and blowdown
+        double totalEvaporation = 0;
+        double totalCirculation = 0;
+};
+
 
 #endif //AMO_TOOLS_SUITE_COOLING_TOWER_H
 
@@ -19,6 +19,7 @@
 #include <functional>
 #include "Planar.h"
 #include "FanShaftPower.h"
+#include <calculator/util/SolverStatistics.h>
 
 #include <fstream>
 #include <iostream>
@@ -702,10 +703,12 @@ public:
 private:
 	double calculateCompressibilityFactor(const double x, const double z, const double isentropic)
 	{
+		AMO_SOLVER_SCOPE(solverScope, Solver::FAN203_COMPRESSIBILITY);
 		double assumedKpOverKpc = 1.0;
 		auto const &p1 = planeData.fanInletFlange;
 		for (auto i = 0; i < 50; i++)
 		{
+			AMO_SOLVER_ITERATION(Solver::FAN203_COMPRESSIBILITY);
 			double const pt1c = p1.gasTotalPressure * std::pow(fanRatedInfo.fanSpeedCorrected / fanRatedInfo.fanSpeed, 2) * (fanRatedInfo.densityCorrected / p1.gasDensity) * assumedKpOverKpc;
 
 			// TODO how to get isentropic exponent for gas at converted conditions? section 9.4.1 step 2
@@ -720,6 +723,7 @@ private:
 			double const kpOverKpc = (z / zc) * (xc / x) * (isentropic / (isentropic - 1)) * ((isentropic - 1) / isentropic);
 			if (fabs(kpOverKpc - assumedKpOverKpc) < 0.0000001)
 			{
+				AMO_SOLVER_CONVERGED(solverScope);
 				return kpOverKpc;
 			}
 			assumedKpOverKpc = kpOverKpc;
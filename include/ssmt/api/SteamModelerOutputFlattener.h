@@ -0,0 +1,29 @@
+#ifndef AMO_TOOLS_SUITE_STEAMMODELEROUTPUTFLATTENER_H
+#define AMO_TOOLS_SUITE_STEAMMODELEROUTPUTFLATTENER_H
+
+#include "SteamModelerOutput.h"
+#include <string>
+#include <vector>
+
+/**
+ * Flattens the Steam Modeler output into named scalar fields, "<component>Output_<field>", the same names the
+ * acceptance test data (tests/at/csv) uses for its expected data columns. The values are those the Node binding
+ * (bindings/steam/SteamModelerOutputDataMapper.h) returns, so native tools can compare and export results without
+ * going through Node.
+ */
+class SteamModelerOutputFlattener {
+public:
+    struct Field {
+        std::string name;
+        double value;
+        bool isPresent; ///< false when the component does not exist in this model run, e.g. an unused turbine
+    };
+
+    /**
+     * @param output SteamModelerOutput, the result of SteamModeler::model
+     * @return std::vector<Field>, every output field; the names and their order are the same for every model run
+     */
+    static std::vector<Field> flatten(const SteamModelerOutput &output);
+};
+
+#endif //AMO_TOOLS_SUITE_STEAMMODELEROUTPUTFLATTENER_H
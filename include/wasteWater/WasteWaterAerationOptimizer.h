@@ -0,0 +1,110 @@
+/**
+ * @file
+ * @brief Search for the aerator settings of an activated sludge plant with the lowest aeration energy cost
+ *
+ * Evaluates every combination of aerator speed, operating time, DO setpoint and MLSS target on a grid with
+ * WasteWater_Treatment, without the SRT tables, and keeps the settings that meet the effluent and MLSS limits and
+ * supply the oxygen the process needs. The effluent quality is set by the MLSS target, so the settings that no other
+ * beats on both aeration cost and effluent ammonia are returned, ranked by aeration cost. Candidates are evaluated on
+ * several threads.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#ifndef AMO_TOOLS_SUITE_WASTEWATERAERATIONOPTIMIZER_H
+#define AMO_TOOLS_SUITE_WASTEWATERAERATIONOPTIMIZER_H
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include "calculator/util/GridSearch.h"
+#include "wasteWater/WasteWater_Treatment.h"
+
+/**
+ * Waste Water Aeration Optimizer class
+ * Used to find the aerator speed, operating time, DO setpoint and MLSS target that meet the effluent limits at the
+ * lowest aeration energy cost.
+ */
+class WasteWaterAerationOptimizer {
+public:
+    using Range = GridSearch::Range;
+
+    /**
+     * Settings to search and the limits the plant must meet
+     */
+    struct Inputs {
+        Range speeds; ///< aerator speeds to search in %, above 0 and at most 100
+        Range operatingTimes; ///< aerator operating times to search in hr/day, above 0 and at most 24
+        Range operatingDOs; ///< DO setpoints to search in mg/L
+        Range MLSSpars; ///< MLSS targets to search in mg/L
+        double maxEffluentCBOD5 = std::numeric_limits<double>::infinity(); ///< mg/L
+        double maxEffluentAmmonia_N = std::numeric_limits<double>::infinity(); ///< mg/L
+        double minMLSS = 0; ///< mg/L
+        double maxMLSS = std::numeric_limits<double>::infinity(); ///< mg/L
+        bool denitrification = false; ///< the oxygen supplied must cover TotalOxygenReqWDenit, else TotalOxygenRequirements
+    };
+
+    /**
+     * One setting of the aerators and the plant performance at it
+     */
+    struct Candidate {
+        double Speed; ///< %
+        double OperatingTime; ///< hr/day
+        double OperatingDO; ///< mg/L
+        double MLSSpar; ///< mg/L
+        double SolidsRetentionTime; ///< days
+        double MLSS; ///< mg/L
+        double EffluentCBOD5; ///< mg/L
+        double EffluentAmmonia_N; ///< mg/L
+        double TotalOxygenSupplied; ///< lb/day
+        double OxygenRequired; ///< lb/day
+        double AeEnergy; ///< kWh
+        double AeCost; ///< $
+    };
+
+    struct Results {
+        Candidate baseline; ///< the current settings of the plant
+        std::vector<Candidate> paretoSet; ///< non-dominated feasible candidates, lowest aeration cost first
+        std::size_t candidates; ///< number of settings evaluated
+        std::size_t feasibleCandidates; ///< number of settings that meet the limits
+    };
+
+    /**
+     * Evaluates the plant at one setting of the aerators
+     * @param plant WasteWater_Treatment, the plant at its current settings
+     * @param inputs Inputs, limits of the plant; the ranges are not used
+     * @param Speed double, aerator speed in %
+     * @param OperatingTime double, aerator operating time in hr/day
+     * @param OperatingDO double, DO setpoint in mg/L
+     * @param MLSSpar double, MLSS target in mg/L
+     * @return Candidate, plant performance and aeration energy cost
+     */
+    static Candidate evaluate(const WasteWater_Treatment &plant, const Inputs &inputs, double Speed,
+                              double OperatingTime, double OperatingDO, double MLSSpar);
+
+    /**
+     * Checks that a setting meets the effluent and MLSS limits and supplies the oxygen the process needs
+     * @param inputs Inputs, limits of the plant
+     * @param candidate Candidate, evaluated setting
+     * @return bool, true if the setting meets the limits
+     */
+    static bool isFeasible(const Inputs &inputs, const Candidate &candidate);
+
+    /**
+     * Evaluates every setting of the search ranges and returns the Pareto set of aeration cost and effluent ammonia
+     * @param plant WasteWater_Treatment, the plant at its current settings
+     * @param inputs Inputs, search ranges and limits
+     * @param threads unsigned, number of threads evaluating candidates, 0 for one per hardware thread
+     * @return Results, the baseline and the ranked Pareto set; its first candidate is the optimal setting
+     */
+    static Results optimize(const WasteWater_Treatment &plant, const Inputs &inputs, unsigned threads = 0);
+
+private:
+    /**
+     * Keeps the candidates that no other candidate beats on both aeration cost and effluent ammonia, sorted by cost
+     */
+    static std::vector<Candidate> getParetoSet(std::vector<Candidate> candidates);
+};
+
+#endif //AMO_TOOLS_SUITE_WASTEWATERAERATIONOPTIMIZER_H
@@ -333,9 +333,51 @@ public:
           Speed(Speed),
           EnergyCostUnit(EnergyCostUnit){};
 
-    Output calculate();
+    /**
+     * Finds the solids retention time whose MLSS best matches MLSSpar and the plant performance at it
+     * @param calculationsTable bool, true to keep every row of the SRT table in the output; false finds the matching
+     *        SRT with a bisection on the rows and leaves the table of the output empty
+     * @return WasteWater_Treatment::Output, performance at the matching SRT
+     */
+    Output calculate(bool calculationsTable = true) const;
+
+    /**
+     * Calculates a batch of scenarios without their SRT tables
+     * @param scenarios std::vector<WasteWater_Treatment>, scenarios to evaluate
+     * @param threads unsigned, number of threads evaluating scenarios, 0 for one per hardware thread
+     * @return std::vector<Output>, performance of each scenario, in order, with empty SRT tables
+     */
+    static std::vector<Output> calculate(const std::vector<WasteWater_Treatment> &scenarios, unsigned threads = 0);
+
+    double getMLSSpar() const { return MLSSpar; }
+    double getOperatingDO() const { return OperatingDO; }
+    double getOperatingTime() const { return OperatingTime; }
+    double getSpeed() const { return Speed; }
+
+    void setMLSSpar(double MLSSpar) { this->MLSSpar = MLSSpar; }
+    void setOperatingDO(double OperatingDO) { this->OperatingDO = OperatingDO; }
+    void setOperatingTime(double OperatingTime) { this->OperatingTime = OperatingTime; }
+    void setSpeed(double Speed) { this->Speed = Speed; }
 
 private:
+    /**
+     * Computes the row of the SRT table at an SRT
+     * @param SRT double, solids retention time - days
+     * @param AdjustedMicrobialDecay double, microbial decay at the temperature
+     * @param AdjustedMaxUtilizationRate double, maximum utilization rate at the temperature
+     * @param first const CalculationsTable *, first row of the table, nullptr to compute the first row
+     * @return CalculationsTable, the row
+     */
+    CalculationsTable calculateRow(double SRT, double AdjustedMicrobialDecay, double AdjustedMaxUtilizationRate,
+                                   const CalculationsTable *first) const;
+
+    /**
+     * @return bool, true when MLSS never decreases along the rows of the SRT table, so the best match is found
+     *         where MLSS crosses MLSSpar
+     */
+    bool isMLSSIncreasing(double AdjustedMicrobialDecay, double AdjustedMaxUtilizationRate,
+                          const CalculationsTable &first) const;
+
     double Temperature;
     double So;
     double Volume;
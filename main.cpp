@@ -1,7 +1,225 @@
+#include "cli/BatchCalculator.h"
+#include "cli/BatchIO.h"
+#include "cli/BatchPipeline.h"
+#include "calculator/util/SilencedCout.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <sstream>
+#include <thread>
 
-int main() {
-    std::cout << "Run 'doxygen Doxyfile.in' from the root project directory to generate documentation." << std::endl;
-	std::cout << "View the documentation by opening docs/html/index.html in a web browser." << std::endl;
-	return 0;
-}
\ No newline at end of file
+namespace {
+    struct Options {
+        std::string calculator;
+        std::string input = "-";
+        std::string output = "-";
+        std::string inputFormat;
+        std::string outputFormat;
+        std::vector<std::string> passthrough;
+        BatchPipelineSettings pipeline;
+        bool list = false;
+        bool quiet = false;
+    };
+
+    void printUsage(std::ostream &out) {
+        out << "Usage: amo_tools_suite <calculator> [options]\n"
+            << "       amo_tools_suite --list\n\n"
+            << "Evaluates one record per input line with the chosen calculator and writes one result per record, in\n"
+            << "input order. Input field names are those of the Node binding inputs, see --list.\n\n"
+            << "Options:\n"
+            << "  --input <file>           input file, - for standard input (default)\n"
+            << "  --output <file>          output file, - for standard output (default)\n"
+            << "  --input-format <format>  csv (header row) or ndjson (one JSON object per line); by default taken\n"
+            << "                           from the input file extension, csv for standard input\n"
+            << "  --output-format <format> csv or ndjson; by default taken from the output file extension, or the\n"
+            << "                           input format\n"
+            << "  --passthrough <a,b,...>  input fields copied to the output, e.g. an id column\n"
+            << "  --threads <n>            worker threads (default: number of hardware threads)\n"
+            << "  --chunk-size <n>         records evaluated by a worker at a time (default 256)\n"
+            << "  --quiet                  no summary on standard error\n"
+            << "  --list                   list the calculators with their input and output fields\n"
+            << "  --help                   this text\n\n"
+            << "Records that fail keep their place in the output with blank (null) results and the error message;\n"
+            << "the exit code is 1 when any record failed, 2 for usage and input errors.\n\n"
+            << "Run 'doxygen Doxyfile.in' from the root project directory to generate the library documentation,\n"
+            << "then open docs/html/index.html in a web browser.\n";
+    }
+
+    void printCalculators(std::ostream &out) {
+        std::string family;
+        for (auto const &calculator : BatchCalculatorRegistry::instance().getCalculators()) {
+            if (calculator.family != family) {
+                family = calculator.family;
+                out << (family.empty() ? "" : "\n") << family << ":\n";
+            }
+            out << "  " << calculator.name << " - " << calculator.description << "\n    inputs:";
+            for (auto const &name : calculator.inputs) out << ' ' << name;
+            auto const outputs = calculator.outputs();
+            out << "\n    outputs:";
+            if (outputs.size() > 20) {
+                out << ' ' << outputs.size() << " fields, " << outputs.front() << " ... " << outputs.back();
+            } else {
+                for (auto const &name : outputs) out << ' ' << name;
+            }
+            out << '\n';
+        }
+    }
+
+    std::vector<std::string> splitList(const std::string &list) {
+        std::vector<std::string> items;
+        std::istringstream stream(list);
+        std::string item;
+        while (std::getline(stream, item, ',')) {
+            if (!item.empty()) items.push_back(item);
+        }
+        return items;
+    }
+
+    std::size_t parseCount(const std::string &option, const std::string &value) {
+        char *end = nullptr;
+        const long result = std::strtol(value.c_str(), &end, 10);
+        if (end == value.c_str() || *end != '\0' || result < 1) {
+            throw std::invalid_argument(option + " must be a positive whole number");
+        }
+        return static_cast<std::size_t>(result);
+    }
+
+    std::string formatFromExtension(const std::string &file) {
+        auto const dot = file.rfind('.');
+        if (file == "-" || dot == std::string::npos) return "";
+        const std::string extension = file.substr(dot + 1);
+        if (extension == "csv") return "csv";
+        if (extension == "ndjson" || extension == "jsonl" || extension == "json") return "ndjson";
+        return "";
+    }
+
+    Options parseOptions(const int argc, char *argv[]) {
+        Options options;
+        options.pipeline.threads = std::max(1u, std::thread::hardware_concurrency());
+
+        for (int i = 1; i < argc; i++) {
+            const std::string arg = argv[i];
+            auto const value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument(arg + " requires a value");
+                return argv[++i];
+            };
+
+            if (arg == "--help" || arg == "-h") {
+                printUsage(std::cout);
+                std::exit(0);
+            } else if (arg == "--list") {
+                options.list = true;
+            } else if (arg == "--input") {
+                options.input = value();
+            } else if (arg == "--output") {
+                options.output = value();
+            } else if (arg == "--input-format") {
+                options.inputFormat = value();
+            } else if (arg == "--output-format") {
+                options.outputFormat = value();
+            } else if (arg == "--passthrough") {
+                options.passthrough = splitList(value());
+            } else if (arg == "--threads") {
+                options.pipeline.threads = static_cast<unsigned>(parseCount(arg, value()));
+            } else if (arg == "--chunk-size") {
+                options.pipeline.chunkSize = parseCount(arg, value());
+            } else if (arg == "--quiet") {
+                options.quiet = true;
+            } else if (arg.compare(0, 1, "-") == 0 && arg != "-") {
+                throw std::invalid_argument("unknown option " + arg);
+            } else if (options.calculator.empty()) {
+                options.calculator = arg;
+            } else {
+                throw std::invalid_argument("unexpected argument " + arg);
+            }
+        }
+
+        if (options.inputFormat.empty()) options.inputFormat = formatFromExtension(options.input);
+        if (options.inputFormat.empty()) options.inputFormat = "csv";
+        if (options.outputFormat.empty()) options.outputFormat = formatFromExtension(options.output);
+        if (options.outputFormat.empty()) options.outputFormat = options.inputFormat;
+        for (auto const &format : {options.inputFormat, options.outputFormat}) {
+            if (format != "csv" && format != "ndjson") {
+                throw std::invalid_argument("unknown format '" + format + "', expected csv or ndjson");
+            }
+        }
+        return options;
+    }
+
+    std::unique_ptr<BatchRecordReader> makeReader(const Options &options) {
+        std::unique_ptr<io::LineReader> lines(options.input == "-" ? new io::LineReader("stdin", std::cin)
+                                                                   : new io::LineReader(options.input));
+        if (options.inputFormat == "ndjson") {
+            return std::unique_ptr<BatchRecordReader>(new NdjsonRecordReader(std::move(lines)));
+        }
+        return std::unique_ptr<BatchRecordReader>(new CsvRecordReader(std::move(lines)));
+    }
+
+    std::unique_ptr<BatchResultFormatter> makeFormatter(const Options &options, const BatchCalculator &calculator) {
+        if (options.outputFormat == "ndjson") {
+            return std::unique_ptr<BatchResultFormatter>(
+                    new NdjsonResultFormatter(calculator.outputs(), options.passthrough));
+        }
+        return std::unique_ptr<BatchResultFormatter>(new CsvResultFormatter(calculator.outputs(), options.passthrough));
+    }
+}
+
+int main(int argc, char *argv[]) {
+    Options options;
+    const BatchCalculator *calculator = nullptr;
+    try {
+        options = parseOptions(argc, argv);
+        if (options.list) {
+            printCalculators(std::cout);
+            return 0;
+        }
+        if (options.calculator.empty()) {
+            printUsage(std::cerr);
+            return 2;
+        }
+        calculator = BatchCalculatorRegistry::instance().find(options.calculator);
+        if (calculator == nullptr) {
+            throw std::invalid_argument("unknown calculator '" + options.calculator + "', see --list");
+        }
+    } catch (std::exception const &e) {
+        std::cerr << "amo_tools_suite: " << e.what() << std::endl;
+        return 2;
+    }
+
+    try {
+        auto const start = std::chrono::steady_clock::now();
+        std::unique_ptr<BatchRecordReader> reader = makeReader(options);
+        std::unique_ptr<BatchResultFormatter> formatter = makeFormatter(options, *calculator);
+
+        std::ofstream file;
+        if (options.output != "-") {
+            file.open(options.output, std::ios::binary);
+            if (!file) throw std::runtime_error("cannot open " + options.output + " for writing");
+        }
+
+        // the workers may print diagnostics to std::cout, which stays synchronized with stdio for them; the
+        // pipeline has joined its threads when it returns or throws, before std::cout is restored
+        BatchPipelineSummary summary;
+        {
+            const SilencedCout silencedCout;
+            std::ostream standardOutput(silencedCout.getStandardOutput());
+            std::ostream &out = options.output == "-" ? standardOutput : file;
+            summary = BatchPipeline::run(*reader, *calculator, *formatter, out, options.pipeline);
+            out.flush();
+            if (!out) throw std::runtime_error("writing " + options.output + " failed");
+        }
+
+        if (!options.quiet) {
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::cerr << calculator->name << ": " << summary.records << " records, " << summary.errors
+                      << " errors in " << seconds << " s on " << options.pipeline.threads << " threads" << std::endl;
+        }
+        return summary.errors == 0 ? 0 : 1;
+    } catch (std::exception const &e) {
+        std::cerr << "amo_tools_suite: " << e.what() << std::endl;
+        return 2;
+    }
+}
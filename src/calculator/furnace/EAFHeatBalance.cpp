@@ -0,0 +1,68 @@
+/**
+ * @file
+ * @brief Contains the implementation of the EAF heat-by-heat energy balance.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <stdexcept>
+#include "calculator/furnace/EAFHeatBalance.h"
+#include "calculator/losses/EnergyInputEAF.h"
+#include "calculator/losses/ExhaustGasEAF.h"
+#include "calculator/util/ParallelFor.h"
+
+EAFHeatBalance::EAFHeatBalance(const double tapWeight, const double coalHeatingValue,
+                               const double electrodeHeatingValue,
+                               const std::vector<SlagOtherMaterialLosses> &slags)
+        : tapWeight(tapWeight), coalHeatingValue(coalHeatingValue), electrodeHeatingValue(electrodeHeatingValue)
+{
+    // the slag weights are per heat, so getHeatLoss gives btu per heat
+    for (auto slag : slags) slagLosses += slag.getHeatLoss();
+}
+
+void EAFHeatBalance::addSample(const Sample &sample) {
+    if (!(sample.duration >= 0)) {
+        throw std::runtime_error("EAFHeatBalance: the duration of a sample must not be negative");
+    }
+
+    // the calculators give rates in btu/hr
+    EnergyInputEAF energyInput(sample.naturalGasHeatInput, sample.coalCarbonInjection, coalHeatingValue,
+                               sample.electrodeUse, electrodeHeatingValue, sample.otherFuels, sample.electricityInput);
+    ExhaustGasEAF exhaustGas(sample.offGasTemp, sample.CO, sample.H2, sample.combustibleGases, sample.vfr,
+                             sample.dustLoading);
+
+    duration += sample.duration;
+    electricityUse += sample.electricityInput * sample.duration;
+    chemicalEnergyInput += energyInput.getTotalChemicalEnergyInput() * sample.duration;
+    totalEnergyInput += energyInput.getHeatDelivered() * sample.duration;
+    exhaustGasLosses += exhaustGas.getTotalHeatExhaust() * sample.duration;
+}
+
+EAFHeatBalance::Results EAFHeatBalance::getResults() const {
+    Results results;
+    results.duration = duration;
+    results.electricityUse = electricityUse;
+    results.chemicalEnergyInput = chemicalEnergyInput;
+    results.totalEnergyInput = totalEnergyInput;
+    results.exhaustGasLosses = exhaustGasLosses;
+    results.slagLosses = slagLosses;
+    results.otherLosses = totalEnergyInput - exhaustGasLosses - slagLosses;
+    results.electricityPerTon = tapWeight == 0 ? 0 : electricityUse / tapWeight;
+    results.energyPerTon = tapWeight == 0 ? 0 : totalEnergyInput / 3412 / tapWeight;
+    return results;
+}
+
+EAFHeatBalance::Results EAFHeatBalance::calculate(const Heat &heat) {
+    EAFHeatBalance balance(heat.tapWeight, heat.coalHeatingValue, heat.electrodeHeatingValue, heat.slags);
+    for (auto const &sample : heat.samples) balance.addSample(sample);
+    return balance.getResults();
+}
+
+std::vector<EAFHeatBalance::Results> EAFHeatBalance::calculate(const std::vector<Heat> &heats, const unsigned threads) {
+    std::vector<Results> results(heats.size());
+    ParallelFor::run(heats.size(), threads, [&](const std::size_t begin, const std::size_t end, unsigned) {
+        for (std::size_t i = begin; i < end; i++) results[i] = calculate(heats[i]);
+    });
+    return results;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file
+ * @brief Contains the implementation of the furnace efficiency optimizer.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "calculator/furnace/FurnaceEfficiencyOptimizer.h"
+#include "calculator/furnace/O2Enrichment.h"
+#include "calculator/processHeat/AirHeatingUsingExhaust.h"
+
+namespace {
+    bool isCheaper(const FurnaceEfficiencyOptimizer::Candidate &a, const FurnaceEfficiencyOptimizer::Candidate &b) {
+        if (a.fuelCost != b.fuelCost) return a.fuelCost < b.fuelCost;
+        if (a.oxygenCost != b.oxygenCost) return a.oxygenCost < b.oxygenCost;
+        if (a.combAirTemp != b.combAirTemp) return a.combAirTemp < b.combAirTemp;
+        if (a.o2FlueGas != b.o2FlueGas) return a.o2FlueGas < b.o2FlueGas;
+        return a.o2CombAir < b.o2CombAir;
+    }
+}
+
+FurnaceEfficiencyOptimizer::Candidate FurnaceEfficiencyOptimizer::evaluate(const Inputs &inputs, const double combAirTemp,
+                                                                           const double o2FlueGas, const double o2CombAir) {
+    O2Enrichment o2Enrichment(inputs.o2CombAir, o2CombAir, inputs.flueGasTemp, inputs.flueGasTemp, inputs.o2FlueGas,
+                              o2FlueGas, inputs.combAirTemp, combAirTemp, inputs.fuelConsumption);
+
+    Candidate candidate;
+    candidate.combAirTemp = combAirTemp;
+    candidate.o2FlueGas = o2FlueGas;
+    candidate.o2CombAir = o2CombAir;
+    candidate.excessAir = o2Enrichment.getExcessAirEnriched();
+    candidate.availableHeat = o2Enrichment.getAvailableHeatEnriched();
+
+    // scaled by the available heat of the current operation rather than its standard available heat, as
+    // getFuelConsumptionEnriched does, so that the current operation evaluates to the current fuel consumption when
+    // the combustion air is already enriched
+    candidate.fuelConsumption = inputs.fuelConsumption * o2Enrichment.getAvailableHeat() / candidate.availableHeat;
+    candidate.fuelSavings = (inputs.fuelConsumption - candidate.fuelConsumption) / inputs.fuelConsumption * 100;
+
+    // oxygen enriched air is air mixed with purchased oxygen, which supplies (x - 0.21) / (0.79 * x) of the oxygen
+    // at an O2 fraction x
+    const double o2Fraction = o2CombAir / 100;
+    const double purchasedFraction = (o2Fraction - 0.21) / (0.79 * o2Fraction);
+    candidate.oxygenFlow = inputs.stoichiometricOxygen * (1 + candidate.excessAir)
+                           * candidate.fuelConsumption * purchasedFraction;
+
+    candidate.fuelCost = candidate.fuelConsumption * inputs.operatingHours * inputs.fuelCost;
+    candidate.oxygenCost = candidate.oxygenFlow * inputs.operatingHours / 1000 * inputs.oxygenCost;
+    candidate.totalCost = candidate.fuelCost + candidate.oxygenCost;
+    return candidate;
+}
+
+bool FurnaceEfficiencyOptimizer::isFeasible(const Inputs &inputs, const Candidate &candidate) {
+    if (!(candidate.availableHeat > 0 && std::isfinite(candidate.fuelConsumption) && candidate.fuelConsumption > 0)) {
+        return false;
+    }
+
+    // the recuperator heats the combustion air of the configuration from ambient with its own flue gas
+    const double stoichAir = inputs.stoichiometricOxygen / 0.21 * inputs.fuelHeatingValue / 1000000;
+    const double combAirFlow = inputs.stoichiometricOxygen * (1 + candidate.excessAir) * candidate.fuelConsumption
+                               / (candidate.o2CombAir / 100) / 60;
+    auto const recuperator = AirHeatingUsingExhaust(inputs.fuelHeatingValue, stoichAir).calculate(
+            inputs.flueGasTemp, candidate.excessAir, candidate.fuelConsumption, combAirFlow, inputs.ambientTemp, 1,
+            inputs.recuperatorEffectiveness, inputs.operatingHours);
+
+    // 0.0186 Btu/scf-°F is the heat capacity of air in AirHeatingUsingExhaust
+    const double maxCombAirTemp = inputs.ambientTemp + recuperator.hxColdAir / (0.0186 * combAirFlow * 60);
+    return candidate.combAirTemp <= maxCombAirTemp;
+}
+
+std::vector<FurnaceEfficiencyOptimizer::Candidate> FurnaceEfficiencyOptimizer::getParetoSet(
+        std::vector<Candidate> candidates) {
+    return GridSearch::getParetoSet(std::move(candidates), isCheaper,
+                                    [](const Candidate &candidate) { return candidate.oxygenCost; });
+}
+
+FurnaceEfficiencyOptimizer::Results FurnaceEfficiencyOptimizer::optimize(const Inputs &inputs, unsigned threads) {
+    if (!(inputs.fuelConsumption > 0)) {
+        throw std::runtime_error("FurnaceEfficiencyOptimizer: fuel consumption must be positive");
+    }
+    const auto combAirTemps = GridSearch::getValues(inputs.combAirTemps, "FurnaceEfficiencyOptimizer",
+                                                    "combustion air temperature");
+    const auto o2FlueGases = GridSearch::getValues(inputs.o2FlueGases, "FurnaceEfficiencyOptimizer", "flue gas O2");
+    const auto o2CombAirs = GridSearch::getValues(inputs.o2CombAirs, "FurnaceEfficiencyOptimizer", "combustion air O2");
+    if (o2FlueGases.front() < 0 || o2FlueGases.back() >= 21) {
+        throw std::runtime_error("FurnaceEfficiencyOptimizer: flue gas O2 must be at least 0 and below 21%");
+    }
+    if (o2CombAirs.front() < 21 || o2CombAirs.back() > 100) {
+        throw std::runtime_error("FurnaceEfficiencyOptimizer: combustion air O2 must be between 21 and 100%");
+    }
+
+    Results results;
+    results.baseline = evaluate(inputs, inputs.combAirTemp, inputs.o2FlueGas, inputs.o2CombAir);
+    results.candidates = combAirTemps.size() * o2FlueGases.size() * o2CombAirs.size();
+
+    auto search = GridSearch::search<Candidate>(results.candidates, threads, [&](const std::size_t i) {
+        const std::size_t o2CombAir = i % o2CombAirs.size();
+        const std::size_t o2FlueGas = i / o2CombAirs.size() % o2FlueGases.size();
+        const std::size_t combAirTemp = i / o2CombAirs.size() / o2FlueGases.size();
+        return evaluate(inputs, combAirTemps[combAirTemp], o2FlueGases[o2FlueGas], o2CombAirs[o2CombAir]);
+    }, [&](const Candidate &candidate) { return isFeasible(inputs, candidate); }, getParetoSet);
+    results.feasibleCandidates = search.feasibleCandidates;
+    results.paretoSet = std::move(search.paretoSet);
+    std::stable_sort(results.paretoSet.begin(), results.paretoSet.end(), [](const Candidate &a, const Candidate &b) {
+        return a.totalCost < b.totalCost;
+    });
+    return results;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file
+ * @brief Contains the implementation of the furnace heat balance.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <stdexcept>
+#include "calculator/furnace/FurnaceHeatBalance.h"
+
+namespace {
+    /**
+     * Sums a loss over every item of a list. The loss calculators compute their results in non-const methods, so
+     * each item is evaluated on a copy.
+     */
+    template <typename Loss, typename Method>
+    double sumLosses(const std::vector<Loss> &losses, Method method) {
+        double total = 0;
+        for (Loss loss : losses) total += (loss.*method)();
+        return total;
+    }
+
+    double getPercentSavings(const double baseline, const double modification) {
+        return baseline == 0 ? 0 : (baseline - modification) / baseline * 100;
+    }
+}
+
+FurnaceHeatBalance::Results FurnaceHeatBalance::calculate(const Furnace &furnace) {
+    if (furnace.gasFlueGas && furnace.solidLiquidFlueGas) {
+        throw std::runtime_error("FurnaceHeatBalance: a furnace has either a gas or a solid/liquid fuel flue gas");
+    }
+
+    Results results;
+    results.chargeMaterials = sumLosses(furnace.gasChargeMaterials, &GasLoadChargeMaterial::getTotalHeat)
+                              + sumLosses(furnace.liquidChargeMaterials, &LiquidLoadChargeMaterial::getTotalHeat)
+                              + sumLosses(furnace.solidChargeMaterials, &SolidLoadChargeMaterial::getTotalHeat);
+    results.fixtures = sumLosses(furnace.fixtures, &FixtureLosses::getHeatLoss);
+    results.walls = sumLosses(furnace.walls, &WallLosses::getHeatLoss);
+    results.openings = sumLosses(furnace.openings, &OpeningLosses::getHeatLoss);
+    results.atmospheres = sumLosses(furnace.atmospheres, &Atmosphere::getTotalHeat);
+    results.leakages = sumLosses(furnace.leakages, &LeakageLosses::getExfiltratedGasesHeatContent);
+    results.coolings = sumLosses(furnace.gasCoolings, &GasCoolingLosses::getHeatLoss)
+                       + sumLosses(furnace.liquidCoolings, &LiquidCoolingLosses::getHeatLoss)
+                       + sumLosses(furnace.waterCoolings, &WaterCoolingLosses::getHeatLoss);
+    results.slags = sumLosses(furnace.slags, &SlagOtherMaterialLosses::getHeatLoss);
+    results.otherLosses = 0;
+    for (const double loss : furnace.otherLosses) results.otherLosses += loss;
+
+    results.totalNetHeatRequired = results.chargeMaterials + results.fixtures + results.walls + results.openings
+                                   + results.atmospheres + results.leakages + results.coolings + results.slags
+                                   + results.otherLosses;
+
+    // the flue gas calculators return the fraction of the heat input that is available to the furnace
+    double availableHeat = 1;
+    if (furnace.gasFlueGas) {
+        availableHeat = GasFlueGasMaterial(*furnace.gasFlueGas).getHeatLoss();
+    } else if (furnace.solidLiquidFlueGas) {
+        availableHeat = SolidLiquidFlueGasMaterial(*furnace.solidLiquidFlueGas).getHeatLoss();
+    }
+    if (!(availableHeat > 0)) {
+        throw std::runtime_error("FurnaceHeatBalance: the flue gas leaves no available heat");
+    }
+
+    results.availableHeat = availableHeat * 100;
+    results.grossHeatInput = results.totalNetHeatRequired / availableHeat;
+    results.flueGasLosses = results.grossHeatInput - results.totalNetHeatRequired;
+    results.auxiliaryPower = sumLosses(furnace.auxiliaryPowers, &AuxiliaryPower::getPowerUsed);
+
+    results.chargeFeedRate = 0;
+    for (auto const &charge : furnace.gasChargeMaterials) results.chargeFeedRate += charge.getFeedRate();
+    for (auto const &charge : furnace.liquidChargeMaterials) results.chargeFeedRate += charge.getChargeFeedRate();
+    for (auto const &charge : furnace.solidChargeMaterials) results.chargeFeedRate += charge.getChargeFeedRate();
+
+    results.efficiency = results.grossHeatInput == 0 ? 0 : results.chargeMaterials / results.grossHeatInput * 100;
+    results.energyIntensity = results.chargeFeedRate == 0 ? 0 : results.grossHeatInput / results.chargeFeedRate;
+    return results;
+}
+
+FurnaceHeatBalance::AssessmentResults FurnaceHeatBalance::calculate(const Assessment &assessment) {
+    AssessmentResults results;
+    results.baseline = calculate(assessment.baseline);
+    results.modification = calculate(assessment.modification);
+    results.energySavings = results.baseline.grossHeatInput - results.modification.grossHeatInput;
+    results.percentSavings = getPercentSavings(results.baseline.grossHeatInput, results.modification.grossHeatInput);
+    return results;
+}
+
+FurnaceHeatBalance::PlantResults FurnaceHeatBalance::calculate(const std::vector<Assessment> &assessments) {
+    PlantResults results;
+    results.furnaces.reserve(assessments.size());
+    results.baselineGrossHeatInput = 0;
+    results.modificationGrossHeatInput = 0;
+    for (auto const &assessment : assessments) {
+        results.furnaces.push_back(calculate(assessment));
+        results.baselineGrossHeatInput += results.furnaces.back().baseline.grossHeatInput;
+        results.modificationGrossHeatInput += results.furnaces.back().modification.grossHeatInput;
+    }
+    results.energySavings = results.baselineGrossHeatInput - results.modificationGrossHeatInput;
+    results.percentSavings = getPercentSavings(results.baselineGrossHeatInput, results.modificationGrossHeatInput);
+    return results;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file
+ * @brief Contains the implementation of the multi-zone continuous furnace simulation.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <stdexcept>
+#include "calculator/furnace/MultiZoneFurnace.h"
+#include "calculator/losses/LoadChargeEnthalpy.h"
+#include "calculator/util/ParallelFor.h"
+
+MultiZoneFurnace::Results MultiZoneFurnace::simulate(const Furnace &furnace) {
+    const double dryChargeFeedRate = furnace.charge.getChargeFeedRate()
+                                     * (1 - furnace.charge.getWaterContentCharged() / 100.0);
+    if (!(dryChargeFeedRate > 0)) {
+        throw std::runtime_error("MultiZoneFurnace: the charge feed rate must be positive");
+    }
+
+    Results results;
+    results.zones.resize(furnace.zones.size());
+    results.grossHeatInput = 0;
+    results.heatToCharge = 0;
+
+    // the losses of a zone do not depend on the charge temperature, so every zone balance is found before the charge
+    // is passed from zone to zone
+    for (std::size_t i = 0; i < furnace.zones.size(); i++) {
+        auto const &zone = furnace.zones[i];
+        if (!zone.losses.gasChargeMaterials.empty() || !zone.losses.liquidChargeMaterials.empty()
+            || !zone.losses.solidChargeMaterials.empty()) {
+            throw std::runtime_error("MultiZoneFurnace: the charge belongs to the furnace, not to a zone");
+        }
+        auto const balance = FurnaceHeatBalance::calculate(zone.losses);
+        auto &zoneResults = results.zones[i];
+        zoneResults.walls = balance.walls;
+        zoneResults.openings = balance.openings;
+        zoneResults.atmospheres = balance.atmospheres;
+        zoneResults.totalLosses = balance.totalNetHeatRequired;
+        zoneResults.availableHeat = balance.availableHeat;
+        zoneResults.flueGasLosses = zone.grossHeatInput * (1 - balance.availableHeat / 100);
+        zoneResults.heatToCharge = zone.grossHeatInput - zoneResults.flueGasLosses - zoneResults.totalLosses;
+        results.grossHeatInput += zone.grossHeatInput;
+        results.heatToCharge += zoneResults.heatToCharge;
+    }
+
+    // moisture, reaction and additional heat: the total heat of the charge when it is not heated
+    SolidLoadChargeMaterial charge = furnace.charge;
+    charge.setDischargeTemperature(charge.getInitialTemperature());
+    const double firstZoneHeat = charge.getTotalHeat();
+
+    const LoadChargeEnthalpy enthalpy(furnace.charge);
+    double temperature = furnace.charge.getInitialTemperature();
+    for (std::size_t i = 0; i < results.zones.size(); i++) {
+        auto &zoneResults = results.zones[i];
+        const double sensibleHeat = zoneResults.heatToCharge - (i == 0 ? firstZoneHeat : 0);
+        zoneResults.chargeInletTemperature = temperature;
+        temperature = enthalpy.getTemperature(enthalpy.getEnthalpy(temperature) + sensibleHeat / dryChargeFeedRate);
+        zoneResults.chargeOutletTemperature = temperature;
+    }
+
+    results.dischargeTemperature = temperature;
+    results.efficiency = results.grossHeatInput == 0 ? 0 : results.heatToCharge / results.grossHeatInput * 100;
+    return results;
+}
+
+std::vector<MultiZoneFurnace::Results> MultiZoneFurnace::simulate(const std::vector<Furnace> &furnaces,
+                                                                  const unsigned threads) {
+    std::vector<Results> results(furnaces.size());
+    ParallelFor::run(furnaces.size(), threads, [&](const std::size_t begin, const std::size_t end, unsigned) {
+        for (std::size_t i = begin; i < end; i++) results[i] = simulate(furnaces[i]);
+    });
+    return results;
+}
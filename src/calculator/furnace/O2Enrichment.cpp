@@ -26,4 +26,5 @@ void O2Enrichment::calculate() {
     availableHeatEnriched = stdAvailableHeatEnriched + 100 * (9.38 * (o2CombAirEnriched - 0.21) / o2CombAirEnriched * 0.02 * ((flueGasTempEnriched - 60) / 980));
     fuelConsumptionEnriched = fuelConsumption * (stdAvailableHeat / availableHeatEnriched);
     fuelSavingsEnriched = ((fuelConsumption - fuelConsumptionEnriched)/ fuelConsumption) * 100;
+    calculated = true;
 }
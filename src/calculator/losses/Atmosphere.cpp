@@ -13,3 +13,15 @@ double Atmosphere::getTotalHeat() {
     totalHeat = flowRate * specificHeat * (outletTemperature - inletTemperature) * correctionFactor;
     return totalHeat;
 }
+
+
+void Atmosphere::getTotalHeatSeries(const std::size_t count, const double *inletTemperature,
+                                    const double *outletTemperature, const double *flowRate,
+                                    double *totalHeat) const {
+    for (std::size_t i = 0; i < count; i++) {
+        totalHeat[i] = (flowRate ? flowRate[i] : this->flowRate) * specificHeat
+                       * ((outletTemperature ? outletTemperature[i] : this->outletTemperature)
+                          - (inletTemperature ? inletTemperature[i] : this->inletTemperature))
+                       * correctionFactor;
+    }
+}
@@ -7,9 +7,49 @@
  *
  */
 
-#include <array>
 #include "calculator/losses/GasFlueGasMaterial.h"
 
+std::array<GasProperties, GasCompositions::GAS_COUNT>
+GasCompositions::makeGasses(const double CH4, const double C2H6, const double N2, const double H2, const double C3H8,
+                            const double C4H10_CnH2n, const double H2O, const double CO, const double CO2,
+                            const double SO2, const double O2, const double totalPercent) {
+    // specific heat coefficients: constant, t, 1/t, 1/t^2, 1/sqrt(t)
+    return {{
+            GasProperties({4.23, 0.01177, 0, 0, 0}, 16.042, 0.042417, CH4, CH4 / totalPercent,
+                          64, 23875, 1012, 36.032, 44.01),
+            GasProperties({4.04, 0.01636, 0, 0, 0}, 30.068, 0.079503, C2H6, C2H6 / totalPercent,
+                          112, 22323, 1773, 54.048, 88.02),
+            GasProperties({9.47, 0, -3.47 * 1000, 1.07 * 1000000, 0}, 28.016, 0.074077, N2, N2 / totalPercent,
+                          0, 0, 0, 0, 0),
+            GasProperties({5.76, 0.578 / 1000, 0, 0, 20}, 2.016, 0.005331, H2, H2 / totalPercent,
+                          16, 61095, 325, 18.016, 0),
+            GasProperties({17.108, 0, 0, 0, 0}, 44.094, 0.116589, C3H8, C3H8 / totalPercent,
+                          160, 21669, 2523, 72.064, 132.03),
+            GasProperties({22.202, 0, 0, 0, 0}, 58.12, 0.153675, C4H10_CnH2n, C4H10_CnH2n / totalPercent,
+                          208, 21321, 3270, 90.08, 176.04),
+            GasProperties({19.86, 0, 7500, 0, -597}, 18.016, 0.047636, H2O, H2O / totalPercent,
+                          0, 0, 0, 18.016, 0),
+            GasProperties({9.46, 0, -3.29 * 1000, 1.07 * 1000000, 0}, 28.01, 0.074061, CO, CO / totalPercent,
+                          16, 4347, 321, 0, 44.01),
+            GasProperties({16.2, 0, -6.53 * 1000, 1.41 * 1000000, 0}, 44.01, 0.116367, CO2, CO2 / totalPercent,
+                          0, 0, 0, 0, 44.01),
+            GasProperties({17.472, 0, 0, 0, 0}, 64.06, 0.169381, SO2, SO2 * 100 / totalPercent,
+                          0, 0, 0, 0, 0),
+            GasProperties({11.515, 0, 1530, 0, -172}, 32.00, 0.084611, O2, O2 / totalPercent,
+                          -32, 0, 0, 0, 0)
+    }};
+}
+
+double GasCompositions::getGasByVol(const std::string & gasName) const {
+    static const std::array<const char *, GAS_COUNT> names = {
+            {"CH4", "C2H6", "N2", "H2", "C3H8", "C4H10_CnH2n", "H2O", "CO", "CO2", "SO2", "O2"}
+    };
+    for (std::size_t i = 0; i < GAS_COUNT; i++) {
+        if (gasName == names[i]) return gasses[i].compByVol;
+    }
+    throw std::runtime_error("Cannot find " + gasName + " in gasses");
+}
+
 std::string GasCompositions::getSubstance() const {
     return substance;
 }
@@ -17,21 +57,7 @@ std::string GasCompositions::getSubstance() const {
 // used for calculating excess air in flue gas given O2 levels
 double GasCompositions::calculateExcessAir(const double flueGasO2) {
     calculateCompByWeight();
-    double excessAir = (8.52381 * flueGasO2) / (2 - (9.52381 * flueGasO2));
-	if (excessAir == 0) return 0;
-
-    for (auto i = 0; i < 100; i++) {
-        calculateMassFlueGasComponents(excessAir);
-        auto const O2i = mO2 / (mH2O + mCO2 + mN2 + mO2 + mSO2);
-        auto const error = std::fabs((flueGasO2 - O2i) / flueGasO2);
-        if (error < 0.02) break;
-        if (O2i > flueGasO2) {
-            excessAir -= (excessAir * 0.01);
-        } else {
-            excessAir += (excessAir * 0.01);
-        }
-    }
-	return excessAir;
+    return calculateFlueGasMasses().excessAir(flueGasO2);
 }
 
 // used for calculating O2 in flue gas given excess air as a decimal
@@ -44,18 +70,18 @@ double GasCompositions::calculateO2(const double excessAir) {
 void GasCompositions::calculateCompByWeight() {
     double summationDenom = 0;
     for ( auto const & compound : gasses ) {
-        summationDenom += compound.second->compAdjByVol * compound.second->specificWeight;
+        summationDenom += compound.compAdjByVol * compound.specificWeight;
     }
 
     for ( auto & comp : gasses ) {
-        comp.second->compByWeight = (comp.second->compAdjByVol * comp.second->specificWeight) / summationDenom;
+        comp.compByWeight = (comp.compAdjByVol * comp.specificWeight) / summationDenom;
     }
 }
 
 double GasCompositions::calculateSensibleHeat(const double fuelTemp) {
     double specificHeatFuel = 0;
     for ( auto const & comp : gasses ) {
-        specificHeatFuel += comp.second->compByWeight * (comp.second->specificHeat(520) / comp.second->molecularWeight);
+        specificHeatFuel += comp.compByWeight * (comp.specificHeat(520) / comp.molecularWeight);
     }
 
     return 1 * specificHeatFuel * (fuelTemp - 32);
@@ -64,17 +90,17 @@ double GasCompositions::calculateSensibleHeat(const double fuelTemp) {
 double GasCompositions::calculateHeatCombustionAir(const double combustionAirTemp, const double excessAir) {
     double o2Air = 0;
     for ( auto const & comp : gasses ) {
-        o2Air += comp.second->compByWeight * (comp.second->o2Generated / comp.second->molecularWeight);
+        o2Air += comp.compByWeight * (comp.o2Generated / comp.molecularWeight);
     }
 
     double mAir = o2Air / 0.231;
     double mCombustionAir = mAir * (1 + excessAir);
     double rAir = combustionAirTemp + 460;
-    auto const & O2 = gasses["O2"];
-    auto const & N2 = gasses["N2"];
+    auto const & O2 = get(Gas::O2);
+    auto const & N2 = get(Gas::N2);
 
-    double cpCombustionAir = 0.231 * (O2->specificHeat(rAir) / O2->molecularWeight)
-                             + 0.769 * (N2->specificHeat(rAir) / N2->molecularWeight);
+    double cpCombustionAir = 0.231 * (O2.specificHeat(rAir) / O2.molecularWeight)
+                             + 0.769 * (N2.specificHeat(rAir) / N2.molecularWeight);
 
     return mCombustionAir * cpCombustionAir * (combustionAirTemp - 32);
 }
@@ -82,7 +108,7 @@ double GasCompositions::calculateHeatCombustionAir(const double combustionAirTem
 double GasCompositions::calculateSpecificGravity() {
     double summationNumerator = 0;
     for ( auto const & compound : gasses ) {
-        summationNumerator += compound.second->compAdjByVol * compound.second->molecularWeight;
+        summationNumerator += compound.compAdjByVol * compound.molecularWeight;
     }
     return summationNumerator / (22.4 * 1.205);
 }
@@ -90,7 +116,7 @@ double GasCompositions::calculateSpecificGravity() {
 double GasCompositions::calculateStoichometricAir() {
     double o2Required = 0;
     for ( auto const & compound : gasses ) {
-        o2Required  += compound.second->compAdjByVol * compound.second->o2Generated;
+        o2Required  += compound.compAdjByVol * compound.o2Generated;
     }
     return o2Required * (1+ (1-0.209)/0.209);
 }
@@ -98,7 +124,7 @@ double GasCompositions::calculateStoichometricAir() {
 double GasCompositions::calculateHeatingValueFuel() {
     double heatValueFuel = 0;
 	for ( auto const & comp : gasses ) {
-        heatValueFuel += comp.second->compByWeight * comp.second->heatingValue;
+        heatValueFuel += comp.compByWeight * comp.heatingValue;
     }
     return heatValueFuel;
 }
@@ -106,7 +132,7 @@ double GasCompositions::calculateHeatingValueFuel() {
 double GasCompositions::calculateHeatingValueFuelVolume() {
     double heatValueFuel = 0;
     for ( auto const & comp : gasses ) {
-        heatValueFuel += comp.second->compAdjByVol * comp.second->heatingValueVolume;
+        heatValueFuel += comp.compAdjByVol * comp.heatingValueVolume;
     }
     return heatValueFuel;
 }
@@ -114,63 +140,74 @@ double GasCompositions::calculateHeatingValueFuelVolume() {
 void GasCompositions::calculateMassFlueGasComponents(const double excessAir) {
 	mH2O = 0, mCO2 = 0, mO2 = 0, mN2 = 0, mSO2 = 0;
     for ( auto const & comp : gasses ) {
-        mH2O += (comp.second->h2oGenerated * comp.second->compByWeight) / comp.second->molecularWeight;
-        mCO2 += (comp.second->co2Generated * comp.second->compByWeight) / comp.second->molecularWeight;
-        mO2 += (comp.second->o2Generated * comp.second->compByWeight) / comp.second->molecularWeight;
+        mH2O += (comp.h2oGenerated * comp.compByWeight) / comp.molecularWeight;
+        mCO2 += (comp.co2Generated * comp.compByWeight) / comp.molecularWeight;
+        mO2 += (comp.o2Generated * comp.compByWeight) / comp.molecularWeight;
+        mSO2 += comp.so2Generated * comp.compByWeight / comp.molecularWeight;
     }
+    // the N2 carried in with the stoichiometric O2 is taken before mO2 is scaled to the excess air
+    mN2 = mO2;
     mO2 *= excessAir;
 
-	auto const & N2 = gasses["N2"];
-    for ( auto const & comp : gasses ) {
-        auto const & c = comp.second;
-        mN2 += ((c->o2Generated * c->compByWeight) / c->molecularWeight);
-    }
+    mN2 = ((1 - 0.231) / 0.231) * mN2 + mO2 * (1 - 0.231) / 0.231 + get(Gas::N2).compByWeight;
+}
 
-    mN2 = ((1 - 0.231) / 0.231) * mN2 + mO2 * (1 - 0.231) / 0.231 + N2->compByWeight;
+GasCompositions::FlueGasMasses GasCompositions::calculateFlueGasMasses() {
+    calculateMassFlueGasComponents(0);
+    FlueGasMasses masses = {mH2O, mCO2, mSO2, mN2, 0, 0};
+    calculateMassFlueGasComponents(1);
+    masses.o2PerExcessAir = mO2;
+    masses.n2PerExcessAir = mN2 - masses.n2Stoichiometric;
+    return masses;
+}
 
-    for ( auto const & comp : gasses ) {
-        mSO2 += comp.second->so2Generated * comp.second->compByWeight / comp.second->molecularWeight;
-    }
+double GasCompositions::FlueGasMasses::excessAir(const double flueGasO2) const {
+    // flueGasO2 = mO2 / (mH2O + mCO2 + mSO2 + mN2 + mO2), solved for the excess air
+    const double denominator = o2PerExcessAir - flueGasO2 * (o2PerExcessAir + n2PerExcessAir);
+    const double excessAir = flueGasO2 * (h2o + co2 + so2 + n2Stoichiometric) / denominator;
+    // O2 levels at or above those of air have no solution
+    if (denominator <= 0 || excessAir > FlueGasExcessAir::MAX_EXCESS_AIR) return FlueGasExcessAir::MAX_EXCESS_AIR;
+    return excessAir < -1 ? -1 : excessAir;
+}
+
+void GasCompositions::FlueGasMasses::set(GasCompositions & compositions, const double excessAir) const {
+    compositions.mH2O = h2o;
+    compositions.mCO2 = co2;
+    compositions.mSO2 = so2;
+    compositions.mO2 = o2PerExcessAir * excessAir;
+    compositions.mN2 = n2Stoichiometric + n2PerExcessAir * excessAir;
 }
 
 void GasCompositions::calculateEnthalpy() {
-    auto const & H2O = gasses["H2O"];
-    auto const & CO2 = gasses["CO2"];
-    auto const & N2 = gasses["N2"];
-    auto const & O2 = gasses["O2"];
-    auto const & SO2 = gasses["SO2"];
+    auto const & H2O = get(Gas::H2O);
+    auto const & CO2 = get(Gas::CO2);
+    auto const & N2 = get(Gas::N2);
+    auto const & O2 = get(Gas::O2);
+    auto const & SO2 = get(Gas::SO2);
 
-    const double ppH2O = (mH2O / H2O->specificWeight) /
-            (mCO2 / CO2->specificWeight + mH2O / H2O->specificWeight + mN2 / N2->specificWeight
-             + mO2 / O2->specificWeight + mSO2 / SO2->specificWeight);
+    const double ppH2O = (mH2O / H2O.specificWeight) /
+            (mCO2 / CO2.specificWeight + mH2O / H2O.specificWeight + mN2 / N2.specificWeight
+             + mO2 / O2.specificWeight + mSO2 / SO2.specificWeight);
 
     hH2Osat = 1096.7 * pow(ppH2O * 29.926, 0.013);
     tH2Osat = 36.009 * log(ppH2O * 29.926) + 81.054;
 }
 
 double GasCompositions::calculateTotalHeatContentFlueGas(const double flueGasTemp) {
-    auto const & H2O = gasses["H2O"];
+    auto const & H2O = get(Gas::H2O);
 
     const double hH2O = mH2O
                         * (hH2Osat
-                           + 0.5 * ((H2O->specificHeat(flueGasTemp + 460) / H2O->molecularWeight)
-                                    + (H2O->specificHeat(520) / H2O->molecularWeight)) * (flueGasTemp - tH2Osat));
-
-    std::array<std::tuple<std::shared_ptr<GasProperties>, const double>, 4> gasArray = {
-            {
-                    std::make_tuple(gasses["CO2"], mCO2),
-                    std::make_tuple(gasses["N2"], mN2),
-                    std::make_tuple(gasses["O2"], mO2),
-                    std::make_tuple(gasses["SO2"], mSO2)
-            }
-    };
+                           + 0.5 * ((H2O.specificHeat(flueGasTemp + 460) / H2O.molecularWeight)
+                                    + (H2O.specificHeat(520) / H2O.molecularWeight)) * (flueGasTemp - tH2Osat));
+
+    const std::array<Gas, 4> gasArray = {{Gas::CO2, Gas::N2, Gas::O2, Gas::SO2}};
+    const std::array<double, 4> masses = {{mCO2, mN2, mO2, mSO2}};
 
 	double result = 0.0;
-    for ( auto const & gas : gasArray ) {
-//	    auto const & tup = gas;
-	    auto const & c = std::get<0>(gas);
-        const double mass = std::get<1>(gas);
-        result += mass * (0.5 * ((c->specificHeat(flueGasTemp + 460) / c->molecularWeight) + (c->specificHeat(520) / c->molecularWeight)) * (flueGasTemp - 32));
+    for (std::size_t i = 0; i < gasArray.size(); i++) {
+	    auto const & c = get(gasArray[i]);
+        result += masses[i] * (0.5 * ((c.specificHeat(flueGasTemp + 460) / c.molecularWeight) + (c.specificHeat(520) / c.molecularWeight)) * (flueGasTemp - 32));
     }
 
     return hH2O + result;
@@ -188,4 +225,31 @@ double GasFlueGasMaterial::getHeatLoss() {
     const double heatInput = heatInFlueGasses + hCombustionAir + hValueFuel;
 
     return (heatInput - totalHeatContentFlueGas) / hValueFuel;
-}
\ No newline at end of file
+}
+
+void GasFlueGasMaterial::getHeatLossSeries(const std::size_t count, const double *flueGasTemperature,
+                                           const double *flueGasO2, const double *combustionAirTemperature,
+                                           double *availableHeat) const {
+    // the compositions hold intermediate results, so the series is evaluated on a copy; everything that depends on
+    // the fuel alone is computed once
+    GasCompositions comps = compositions;
+    comps.calculateCompByWeight();
+    const double heatInFlueGasses = comps.calculateSensibleHeat(fuelTemperature);
+    const double hValueFuel = comps.calculateHeatingValueFuel();
+    const GasCompositions::FlueGasMasses masses = comps.calculateFlueGasMasses();
+    // the combustion air heat is proportional to 1 + excess air
+    const double hStoichiometricAir = comps.calculateHeatCombustionAir(this->combustionAirTemperature, 0);
+
+    for (std::size_t i = 0; i < count; i++) {
+        const double excessAir = flueGasO2 ? masses.excessAir(flueGasO2[i]) : excessAirPercentage;
+        const double hCombustionAir = combustionAirTemperature
+                                      ? comps.calculateHeatCombustionAir(combustionAirTemperature[i], excessAir)
+                                      : hStoichiometricAir * (1 + excessAir);
+        masses.set(comps, excessAir);
+        comps.calculateEnthalpy();
+        const double totalHeatContentFlueGas = comps.calculateTotalHeatContentFlueGas(
+                flueGasTemperature ? flueGasTemperature[i] : this->flueGasTemperature);
+
+        availableHeat[i] = (heatInFlueGasses + hCombustionAir + hValueFuel - totalHeatContentFlueGas) / hValueFuel;
+    }
+}
@@ -7,29 +7,84 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 #include "calculator/losses/OpeningLosses.h"
 
-double OpeningLosses::getHeatLoss() {
-    const double pi = 3.141592653589793238463;
-    const double stephenBoltzman = 0.1713 * std::pow(10, -8);
-    double area;
+const std::array<double (*)(double), 8> OpeningLosses::viewFactorEquations = {
+    {
+        [](const double tr) {
+            return (1.10000000001829 + 92.8571428570049 * tr - 57.5892857139671 * std::pow(tr, 2) +
+                   15.6249999998005 * std::pow(tr, 3)) / 100;
+        }, // case 1
+        [](const double tr) {
+            return (29.4999999989821 + 26.8416666684161 * tr - 4.35416666785322 * std::pow(tr, 2) -
+                   8.33333330461522E-02 * std::pow(tr, 3) + 0.104166666655532 * std::pow(tr, 4) -
+                   8.33333333686747E-03 * std::pow(tr, 5)) / 100;
+        }, // case 2
+        [](const double tr) {
+            return (3.50000000001719 + 89.5833333332039 * tr - 49.9999999997023 * std::pow(tr, 2) +
+                   10.4166666664804 * std::pow(tr, 3)) / 100;
+        }, // case 3
+        [](const double tr) {
+            return (23.9999999965639 + 39.3916666718743 * tr - 11.6041666697487 * std::pow(tr, 2) +
+                   1.85416666706894 * std::pow(tr, 3) - 0.145833333217932 * std::pow(tr, 4) +
+                   4.16666663902102E-03 * std::pow(tr, 5)) / 100;
+        }, // case 4
+        [](const double tr) {
+            return (2.70000000002409 + 112.678571428391 * tr - 70.9821428567315 * std::pow(tr, 2) +
+                   15.6249999997447 * std::pow(tr, 3)) / 100;
+        }, // case 5
+        [](const double tr) {
+            return (35.4999999992976 + 29.4583333347815 * tr - 4.52083333446976 * std::pow(tr, 2) -
+                   0.687499999606652 * std::pow(tr, 3) + 0.270833333273064 * std::pow(tr, 4) -
+                   2.08333333303721E-02 * std::pow(tr, 5)) / 100;
+        }, // case 6
+        [](const double tr) {
+            return (13.0000000000278 + 123.74999999979 * tr - 99.9999999995182 * std::pow(tr, 2) +
+                   31.249999999699 * std::pow(tr, 3)) / 100;
+        }, // case 7
+        [](const double tr) {
+            return (26.9999999903567 + 64.5666666806646 * tr - 29.9166666745008 * std::pow(tr, 2) +
+                   7.14583333396145 * std::pow(tr, 3) - 0.833333332874441 * std::pow(tr, 4) +
+                   3.74999999085373E-02 * std::pow(tr, 5)) / 100;
+        }, // case 8
+    }
+};
 
+double OpeningLosses::getArea() const {
+    const double pi = 3.141592653589793238463;
     if ( openingShape == OpeningShape::CIRCULAR ) {
         const double d = diameter / 12;
-        area = pi * (d / 2) * (d / 2);
-    } else {
-        area = (length * width) / 144;
+        return pi * (d / 2) * (d / 2);
     }
+    return (length * width) / 144;
+}
 
+double OpeningLosses::getHeatLoss() {
+    const double stephenBoltzman = 0.1713 * std::pow(10, -8);
     const double hlRad = emissivity * stephenBoltzman * (std::pow(insideTemperature + 460, 4) -
-                          std::pow(ambientTemperature + 460, 4)) * area;
+                          std::pow(ambientTemperature + 460, 4)) * getArea();
 
     heatLoss = hlRad * viewFactor * percentTimeOpen / 100;
     return heatLoss;
 }
 
+void OpeningLosses::getHeatLossSeries(const std::size_t count, const double *insideTemperature,
+                                      const double *ambientTemperature, const double *percentTimeOpen,
+                                      double *heatLoss) const {
+    const double stephenBoltzman = 0.1713 * std::pow(10, -8);
+    const double hlRad = emissivity * stephenBoltzman * getArea() * viewFactor / 100;
+
+    for (std::size_t i = 0; i < count; i++) {
+        const double ri = (insideTemperature ? insideTemperature[i] : this->insideTemperature) + 460;
+        const double ra = (ambientTemperature ? ambientTemperature[i] : this->ambientTemperature) + 460;
+        heatLoss[i] = hlRad * (ri * ri * ri * ri - ra * ra * ra * ra)
+                      * (percentTimeOpen ? percentTimeOpen[i] : this->percentTimeOpen);
+    }
+}
+
 double OpeningLosses::calculateViewFactor(const double thickness, const double diameter)
 {
     if (!diameter) return 0;
@@ -79,3 +134,90 @@ double OpeningLosses::calculateViewFactor(const double thickness, const double l
         return viewFactorEquations[7](thicknessRatio);
     }
 }
+
+/**
+ * calculateViewFactor at nodes of the thickness ratio, for circular openings and for rectangular openings with a
+ * lateral dimension ratio of 1, 2 and 10. Thin walls (thickness ratio 0.1 to 1) and thick walls (1 to 6) use
+ * different equations, so each has its own grid; the curvature of the thin wall equations is higher, so their grid
+ * is finer. Linear interpolation between the nodes is within 2e-5 of the equations.
+ */
+struct OpeningLosses::ViewFactorTable {
+    typedef std::array<double, 4> Row; // circular, rectangular with lateral dimension ratio 1, 2 and 10
+
+    static constexpr double THIN_STEP = 0.005, THICK_STEP = 0.01;
+    static const std::size_t THIN_NODES = 181, THICK_NODES = 501;
+
+    ViewFactorTable() {
+        for (std::size_t i = 0; i < THIN_NODES; i++) {
+            const double tr = 0.1 + i * THIN_STEP;
+            thin[i] = {{viewFactorEquations[0](tr), viewFactorEquations[2](tr), viewFactorEquations[4](tr),
+                        viewFactorEquations[6](tr)}};
+        }
+        for (std::size_t i = 0; i < THICK_NODES; i++) {
+            const double tr = 1 + i * THICK_STEP;
+            thick[i] = {{viewFactorEquations[1](tr), viewFactorEquations[3](tr), viewFactorEquations[5](tr),
+                         viewFactorEquations[7](tr)}};
+        }
+    }
+
+    /**
+     * @param thicknessRatio double, within [0.1, 6]
+     * @return Row, interpolated view factors
+     */
+    Row operator()(const double thicknessRatio) const {
+        return thicknessRatio < 1 ? interpolate(thin, (thicknessRatio - 0.1) / THIN_STEP)
+                                  : interpolate(thick, (thicknessRatio - 1) / THICK_STEP);
+    }
+
+    std::array<Row, THIN_NODES> thin;
+    std::array<Row, THICK_NODES> thick;
+
+private:
+    template <std::size_t N>
+    static Row interpolate(const std::array<Row, N> &rows, const double position) {
+        const std::size_t i = std::min(static_cast<std::size_t>(std::max(position, 0.0)), N - 2);
+        const double fraction = position - i;
+        Row row;
+        for (std::size_t j = 0; j < row.size(); j++) {
+            row[j] = rows[i][j] + (rows[i + 1][j] - rows[i][j]) * fraction;
+        }
+        return row;
+    }
+};
+
+const OpeningLosses::ViewFactorTable & OpeningLosses::getViewFactorTable() {
+    static const ViewFactorTable table;
+    return table;
+}
+
+double OpeningLosses::interpolateViewFactor(const double thickness, const double diameter)
+{
+    if (!diameter) return 0;
+    const double thicknessRatio = (!thickness) ? 6 : diameter / thickness;
+    const ViewFactorTable &table = getViewFactorTable();
+    if (thicknessRatio >= 6) return table.thick.back()[0];
+    if (thicknessRatio < 0.1) return table.thin.front()[0] * thicknessRatio / 0.1;
+    return table(thicknessRatio)[0];
+}
+
+double OpeningLosses::interpolateViewFactor(const double thickness, const double length, const double height)
+{
+    double thicknessRatio, lateralDimensionRatio;
+    if (!length || !height) return 0;
+    if (height > length) {
+        lateralDimensionRatio = height / length;
+        thicknessRatio = (!thickness) ? 6 : length / thickness;
+    } else {
+        lateralDimensionRatio = length / height;
+        thicknessRatio = (!thickness) ? 6 : height / thickness;
+    }
+
+    const ViewFactorTable::Row row = getViewFactorTable()(std::min(std::max(thicknessRatio, 0.1), 6.0));
+    if (lateralDimensionRatio >= 1 && lateralDimensionRatio < 2) {
+        return row[1] + (row[2] - row[1]) * (lateralDimensionRatio - 1);
+    }
+    if (lateralDimensionRatio >= 2 && lateralDimensionRatio < 10) {
+        return row[2] + (row[3] - row[2]) * (lateralDimensionRatio - 2) / 8;
+    }
+    return thicknessRatio < 0.1 ? row[3] * thicknessRatio / 0.1 : row[3];
+}
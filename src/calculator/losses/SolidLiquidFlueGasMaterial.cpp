@@ -1,47 +1,39 @@
 #include "calculator/losses/SolidLiquidFlueGasMaterial.h"
+#include "calculator/util/SolverStatistics.h"
 #include <cmath>
 
 double SolidLiquidFlueGasMaterial::calculateExcessAirFromFlueGasO2(
 		const double flueGasO2, const double carbon, const double hydrogen, const double sulphur, const double inertAsh,
 		const double o2, const double moisture, const double nitrogen, const double moistureInAirCombustion) {
+	return solveExcessAirFromFlueGasO2(flueGasO2, carbon, hydrogen, sulphur, inertAsh, o2, moisture, nitrogen,
+	                                   moistureInAirCombustion, FlueGasExcessAir::TOLERANCE).root;
+}
 
-	// adjust input by weight - step 1
-	const double percentTotalFuelComponents = carbon + hydrogen + sulphur + inertAsh + o2 + moisture + nitrogen;
-	const double carbonBar = carbon / percentTotalFuelComponents;
-	const double hydrogenBar = hydrogen / percentTotalFuelComponents;
-	const double sulphurBar = sulphur / percentTotalFuelComponents;
-	const double o2Bar = o2 / percentTotalFuelComponents;
-	const double moistureBar = moisture / percentTotalFuelComponents;
-
-	double excessAir = (8.52381 * flueGasO2) / (2 - (9.52381 * flueGasO2));
-	if (excessAir == 0) return 0;
-
-	// loop a max of 100 times, this loop doesn't take more than roughly 10 iterations right now
-	for (auto i = 0; i < 100; i++) {
-		// steps 2 and 3
-		const double o2sair = carbonBar * (32.0 / 12) + hydrogenBar * 8 + sulphurBar - o2Bar;
-		const double n2sair = o2sair * (76.85 / 23.15);
-		const double msair = o2sair + n2sair;
-		const double mCombustionAir = msair * (1 + excessAir);
-
-		// steps 4 and 5
-		const double mCO2 = carbonBar * (44.0 / 12);
-		const double mH2O = hydrogenBar * 9 + moistureBar + (moistureInAirCombustion / 100.0) * mCombustionAir;
-		const double mSO2 = sulphurBar * 2;
-		const double mO2 = o2sair * excessAir;
-		const double mN2 = n2sair * (1 + excessAir);
-
-		auto const O2i = mO2 / (mH2O + mCO2 + mN2 + mO2 + mSO2);
-		auto const error = fabs((flueGasO2 - O2i) / flueGasO2);
-		if (error < 0.02) break;
-		if (O2i > flueGasO2) {
-			excessAir -= (excessAir * 0.01);
-		} else {
-			excessAir += (excessAir * 0.01);
-		}
+RootFinder::Result SolidLiquidFlueGasMaterial::solveExcessAirFromFlueGasO2(
+		const double flueGasO2, const double carbon, const double hydrogen, const double sulphur, const double inertAsh,
+		const double o2, const double moisture, const double nitrogen, const double moistureInAirCombustion,
+		const double tolerance, const int maxIterations) {
+	AMO_SOLVER_SCOPE(solverScope, Solver::SOLID_LIQUID_EXCESS_AIR);
+	const double estimate = (8.52381 * flueGasO2) / (2 - (9.52381 * flueGasO2));
+	if (estimate == 0) {
+		AMO_SOLVER_CONVERGED(solverScope);
+		return {0, 0, true};
 	}
 
-	return excessAir;
+	auto const residual = [=](const double excessAir) {
+		AMO_SOLVER_ITERATION(Solver::SOLID_LIQUID_EXCESS_AIR);
+		return calculateFlueGasO2(excessAir, carbon, hydrogen, sulphur, inertAsh, o2, moisture, nitrogen,
+		                          moistureInAirCombustion) - flueGasO2;
+	};
+
+	// no O2 is left at 0 excess air, the origin, and O2 approaches that of air as excess air grows, so the search
+	// stops at MAX_EXCESS_AIR, the bound, for O2 levels that have no solution
+	const double bound = flueGasO2 > 0 ? FlueGasExcessAir::MAX_EXCESS_AIR : -1;
+	const double start = std::isfinite(estimate) && estimate * (bound - estimate) > 0 ? estimate : bound / 2;
+	const RootFinder::Result result = RootFinder::bracketAndSolve(residual, 0, start, bound, tolerance,
+	                                                              maxIterations);
+	if (result.converged) AMO_SOLVER_CONVERGED(solverScope);
+	return result;
 }
 
 double SolidLiquidFlueGasMaterial::calculateFlueGasO2(const double excessAir, const double carbon,
@@ -23,4 +23,22 @@ double WallLosses::getHeatLoss() {
     const double hl_rad = surfaceEmissivity * boltzman * hl_rad3 * surfaceArea;
 	heatLoss = (hl_conv + hl_rad) * correctionFactor;
     return heatLoss;
-}
\ No newline at end of file
+}
+
+void WallLosses::getHeatLossSeries(const std::size_t count, const double *surfaceTemperature,
+                                   const double *ambientTemperature, double *heatLoss) const {
+    // the terms that do not depend on the temperatures are computed once for the whole series
+    const double boltzman = 0.1713 * std::pow(10, -8);
+    const double hl_conv = conditionFactor * std::pow((1 / 24.0), 0.2) * std::sqrt(1 + (1.277 * windVelocity))
+                           * surfaceArea * correctionFactor;
+    const double hl_rad = surfaceEmissivity * boltzman * surfaceArea * correctionFactor;
+
+    for (std::size_t i = 0; i < count; i++) {
+        const double ts = surfaceTemperature ? surfaceTemperature[i] : this->surfaceTemperature;
+        const double ta = ambientTemperature ? ambientTemperature[i] : this->ambientTemperature;
+        const double rs = ts + RAD_CONSTANT, ra = ta + RAD_CONSTANT;
+        heatLoss[i] = hl_conv * std::pow(2 / (ta + ts), 0.181)
+                      * std::pow(ts - ta, 0.266) * (ts - ta)
+                      + hl_rad * (rs * rs * rs * rs - ra * ra * ra * ra);
+    }
+}
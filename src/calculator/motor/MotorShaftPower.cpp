@@ -4,14 +4,17 @@
 #include "calculator/motor/MotorPower.h"
 #include "calculator/motor/MotorCurrent.h"
 #include "calculator/motor/MotorPowerFactor.h"
+#include "calculator/util/SolverStatistics.h"
 
 MotorShaftPower::Output MotorShaftPower::calculate() {
     double powerFactor, efficiency, current, power, estimatedFLA;
+    AMO_SOLVER_SCOPE(solverScope, Solver::MOTOR_SHAFT_POWER);
 
     if (loadEstimationMethod == Motor::LoadEstimationMethod::POWER) {
         double tempLoadFraction = 0.01;
 	    double powerE1 = 0, powerE2 = 0, lf1 = 0, lf2 = 0, eff1 = 0, eff2 = 0, pf1 = 0, pf2 = 0;
         while (true) {
+            AMO_SOLVER_ITERATION(Solver::MOTOR_SHAFT_POWER);
             MotorCurrent motorCurrent(motorRatedPower, motorRPM, lineFrequency, efficiencyClass,
                                       specifiedEfficiency, tempLoadFraction, ratedVoltage);
             current = motorCurrent.calculateCurrent(fullLoadAmps);
@@ -23,6 +26,7 @@ MotorShaftPower::Output MotorShaftPower::calculate() {
             MotorPower motorPower(ratedVoltage, current, powerFactor);
             power = motorPower.calculate();
             if (power > fieldPower || tempLoadFraction > 1.5) {
+                if (power > fieldPower) AMO_SOLVER_CONVERGED(solverScope);
                 powerE2 = power;
                 lf2 = tempLoadFraction;
                 eff2 = efficiency;
@@ -63,10 +67,12 @@ MotorShaftPower::Output MotorShaftPower::calculate() {
         double tempLoadFraction = 0.00;
         double powerE1, powerE2, lf1, lf2, eff1, eff2, current1, current2;
         while (true) {
+            AMO_SOLVER_ITERATION(Solver::MOTOR_SHAFT_POWER);
             MotorCurrent motorCurrent(motorRatedPower, motorRPM, lineFrequency, efficiencyClass,
                                       specifiedEfficiency, tempLoadFraction, ratedVoltage);
             current = motorCurrent.calculateCurrent(fullLoadAmps);
             if (current > fieldCurrent || tempLoadFraction > 1.5) {
+                if (current > fieldCurrent) AMO_SOLVER_CONVERGED(solverScope);
                 MotorEfficiency motorEfficiency(lineFrequency, motorRPM, efficiencyClass, motorRatedPower);
                 efficiency = motorEfficiency.calculate(tempLoadFraction, specifiedEfficiency);
                 MotorPowerFactor motorPowerFactor(lineFrequency, motorRPM, efficiencyClass, specifiedEfficiency,
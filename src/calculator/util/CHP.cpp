@@ -6,15 +6,31 @@ CHP::CHP(double annualOperatingHours, double annualElectricityConsumption, doubl
          double boilerThermalFuelCostsCHPcase, double CHPfuelCosts,
          double percentAvgkWhElectricCostAvoidedOrStandbyRate, double displacedThermalEfficiency,
          double chpAvailability, double thermalUtilization)
-		: annualOperatingHours(annualOperatingHours), annualElectricityConsumption(annualElectricityConsumption),
-		  annualThermalDemand(annualThermalDemand), boilerThermalFuelCosts(boilerThermalFuelCosts),
-		  chpFuelCosts(CHPfuelCosts), avgElectricityCosts(avgElectricityCosts), calculationOption(calculationOption),
-		  boilerThermalFuelCostsCHPcase(boilerThermalFuelCostsCHPcase),
-		  displacedThermalEfficiency(displacedThermalEfficiency / 100), chpAvailability(chpAvailability / 100),
-		  thermalUtilization(thermalUtilization / 100)
 {
+	setInputs(annualOperatingHours, annualElectricityConsumption, annualThermalDemand, boilerThermalFuelCosts,
+	          avgElectricityCosts, calculationOption, boilerThermalFuelCostsCHPcase, CHPfuelCosts,
+	          percentAvgkWhElectricCostAvoidedOrStandbyRate, displacedThermalEfficiency, chpAvailability,
+	          thermalUtilization);
+}
+
+void CHP::setInputs(double annualOperatingHours, double annualElectricityConsumption, double annualThermalDemand,
+                    double boilerThermalFuelCosts, double avgElectricityCosts, Option calculationOption,
+                    double boilerThermalFuelCostsCHPcase, double CHPfuelCosts,
+                    double percentAvgkWhElectricCostAvoidedOrStandbyRate, double displacedThermalEfficiency,
+                    double chpAvailability, double thermalUtilization) {
+	this->annualOperatingHours = annualOperatingHours;
+	this->annualElectricityConsumption = annualElectricityConsumption;
+	this->annualThermalDemand = annualThermalDemand;
+	this->boilerThermalFuelCosts = boilerThermalFuelCosts;
+	this->chpFuelCosts = CHPfuelCosts;
+	this->avgElectricityCosts = avgElectricityCosts;
+	this->boilerThermalFuelCostsCHPcase = boilerThermalFuelCostsCHPcase;
+	this->displacedThermalEfficiency = displacedThermalEfficiency / 100;
+	this->chpAvailability = chpAvailability / 100;
+	this->thermalUtilization = thermalUtilization / 100;
+	percentAvgkWhElectricCostAvoided = 0;
+	standbyRate = 0;
 	setCalculationOption(calculationOption, percentAvgkWhElectricCostAvoidedOrStandbyRate);
-	calculate();
 }
 
 std::map<double, std::size_t>::const_iterator CHP::findNearest(const double val, const std::size_t index) const {
@@ -23,7 +39,7 @@ std::map<double, std::size_t>::const_iterator CHP::findNearest(const double val,
 	return nearest;
 };
 
-void CHP::calculate() {
+void CHP::calculate() const {
 	avgPowerDemand = annualElectricityConsumption / annualOperatingHours;
 	avgThermalDemand = annualThermalDemand / annualOperatingHours;
 
@@ -116,36 +132,37 @@ void CHP::calculate() {
 			{"incrementalOandM", incrementalOandMDollarsKwH},
 			{"totalOperatingCosts", totalOperatingCostsToGenerate}
 	};
+	calculated = true;
 }
 
 void CHP::setAnnualOperatingHours(const double annualOperatingHours) {
 	this->annualOperatingHours = annualOperatingHours;
-	calculate();
+	calculated = false;
 }
 
 void CHP::setAnnualElectricityConsumption(const double annualElectricityConsumption) {
 	this->annualElectricityConsumption = annualElectricityConsumption;
-	calculate();
+	calculated = false;
 }
 
 void CHP::setAnnualThermalDemand(const double annualThermalDemand) {
 	this->annualThermalDemand = annualThermalDemand;
-	calculate();
+	calculated = false;
 }
 
 void CHP::setBoilerThermalFuelCosts(const double boilerThermalFuelCosts) {
 	this->boilerThermalFuelCosts = boilerThermalFuelCosts;
-	calculate();
+	calculated = false;
 }
 
 void CHP::setChpFuelCosts(const double chpFuelCosts) {
 	this->chpFuelCosts = chpFuelCosts;
-	calculate();
+	calculated = false;
 }
 
 void CHP::setAvgElectricityCosts(const double avgElectricityCosts) {
 	this->avgElectricityCosts = avgElectricityCosts;
-	calculate();
+	calculated = false;
 }
 
 void CHP::setCalculationOption(const CHP::Option calculationOption,
@@ -156,50 +173,62 @@ void CHP::setCalculationOption(const CHP::Option calculationOption,
 	} else {
 		standbyRate = percentAvgkWhElectricCostAvoidedOrStandbyRate;
 	}
-	calculate();
+	calculated = false;
 }
 
 void CHP::setBoilerThermalFuelCostsCHPcase(const double boilerThermalFuelCostsCHPcase) {
 	this->boilerThermalFuelCostsCHPcase = boilerThermalFuelCostsCHPcase;
+	calculated = false;
 }
 
 
 void CHP::setPercentAvgkWhElectricCostAvoided(const double percentAvgkWhElectricCostAvoided) {
 	this->percentAvgkWhElectricCostAvoided = percentAvgkWhElectricCostAvoided;
+	calculated = false;
 }
 
 void CHP::setStandbyRate(const double standbyRate) {
 	this->standbyRate = standbyRate;
+	calculated = false;
 }
 
 void CHP::setDisplacedThermalEfficiency(const double displacedThermalEfficiency) {
 	this->displacedThermalEfficiency = displacedThermalEfficiency;
+	calculated = false;
 }
 
 void CHP::setChpElectricEfficiency(const double chpElectricEfficiency) {
+	// the setters of results override the calculated value until an input changes
+	calculateIfNeeded();
 	this->chpElectricEfficiency = chpElectricEfficiency;
 }
 
 void CHP::setChpThermalOutput(const double chpThermalOutput) {
+	calculateIfNeeded();
 	this->chpThermalOutput = chpThermalOutput;
 }
 
 void CHP::setChpAvailability(const double chpAvailability) {
 	this->chpAvailability = chpAvailability;
+	calculated = false;
 }
 
 void CHP::setThermalUtilization(const double thermalUtilization) {
 	this->thermalUtilization = thermalUtilization;
+	calculated = false;
 }
 
 void CHP::setAvgPowerDemand(const double avgPowerDemand) {
+	calculateIfNeeded();
 	this->avgPowerDemand = avgPowerDemand;
 }
 
 void CHP::setAvgThermalDemand(const double avgThermalDemand) {
+	calculateIfNeeded();
 	this->avgThermalDemand = avgThermalDemand;
 }
 
 void CHP::setNetCHPpower(const double netCHPpower) {
+	calculateIfNeeded();
 	this->netCHPpower = netCHPpower;
 }
@@ -1,4 +1,5 @@
 #include "calculator/util/CompressedAir.h"
+#include "calculator/util/DecibelsLeakRateGrid.h"
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
@@ -205,11 +206,8 @@ DecibelsMethod::Output DecibelsMethod::calculate() {
     double secondFlowB; // Q22
 	*/
 
-	const double denominator = (pressureB - pressureA) * (decibelRatingB - decibelRatingA);
-	const double leakRateEstimate = ((pressureB - linePressure) * (decibelRatingB - decibels)) / denominator * firstFlowA
-							      + ((linePressure - pressureA) * (decibelRatingB - decibels)) / denominator * secondFlowA
-							      + ((pressureB - linePressure) * (decibels - decibelRatingA)) / denominator * firstFlowB
-							      + ((linePressure - pressureA) * (decibels - decibelRatingA)) / denominator * secondFlowB;
+	const double leakRateEstimate = DecibelsLeakRateGrid::interpolate(linePressure, decibels, decibelRatingA, pressureA, firstFlowA,
+																  secondFlowA, decibelRatingB, pressureB, firstFlowB, secondFlowB);
 	const double annualConsumption = (leakRateEstimate * operatingTime * 60) / 1000;
 	DecibelsMethod::Output output(leakRateEstimate, annualConsumption);
 
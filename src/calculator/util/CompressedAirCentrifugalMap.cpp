@@ -0,0 +1,97 @@
+/**
+ * @file
+ * @brief Contains the implementation of the centrifugal compressor performance map.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <stdexcept>
+#include "calculator/util/CompressedAirCentrifugalMap.h"
+
+CompressedAirCentrifugalMap::CompressedAirCentrifugalMap(const CompressedAirCentrifugalBase::ControlType controlType,
+                                                         const double kW_fl, const double C_fl,
+                                                         const std::vector<double> &capacity,
+                                                         const std::vector<double> &dischargePressure)
+        : controlType(controlType), kW_fl(kW_fl), C_fl(C_fl), capacityFit(dischargePressure, capacity, 2)
+{
+    if (!(kW_fl > 0) || !(C_fl > 0)) {
+        throw std::runtime_error("CompressedAirCentrifugalMap: the power and capacity at full load must be positive");
+    }
+    if (dischargePressure.size() < 3) {
+        throw std::runtime_error("CompressedAirCentrifugalMap: the performance curve needs at least three points");
+    }
+}
+
+CompressedAirCentrifugalMap
+CompressedAirCentrifugalMap::loadUnload(const double kW_fl, const double C_fl, const double kW_nl,
+                                        const std::vector<double> &capacity,
+                                        const std::vector<double> &dischargePressure) {
+    CompressedAirCentrifugalMap map(CompressedAirCentrifugalBase::LoadUnload, kW_fl, C_fl, capacity, dischargePressure);
+    map.kW_nl = kW_nl;
+    return map;
+}
+
+CompressedAirCentrifugalMap
+CompressedAirCentrifugalMap::modulationUnload(const double kW_fl, const double C_fl, const double kW_nl,
+                                              const double C_max, const double kW_ul, const double C_ul,
+                                              const std::vector<double> &capacity,
+                                              const std::vector<double> &dischargePressure, const double P_max) {
+    CompressedAirCentrifugalMap map(CompressedAirCentrifugalBase::ModulationUnload, kW_fl, C_fl, capacity,
+                                    dischargePressure);
+    map.kW_nl = kW_nl;
+    map.C_max = P_max > 0 ? map.capacityFit.calculate(P_max) : C_max;
+    map.kW_ul = kW_ul;
+    map.C_ul = C_ul;
+    return map;
+}
+
+CompressedAirCentrifugalMap
+CompressedAirCentrifugalMap::blowOff(const double kW_fl, const double C_fl, const double kW_blow, const double C_blow,
+                                     const std::vector<double> &capacity,
+                                     const std::vector<double> &dischargePressure) {
+    CompressedAirCentrifugalMap map(CompressedAirCentrifugalBase::BlowOff, kW_fl, C_fl, capacity, dischargePressure);
+    map.kW_blow = kW_blow;
+    map.C_blow = C_blow;
+    return map;
+}
+
+// the control type models hold no curves, so each evaluation builds the model adjusted to the discharge pressure
+// on the stack; its ratios to the full load capacity are the ones AdjustDischargePressure sets
+
+CompressedAirCentrifugalBase::Output CompressedAirCentrifugalMap::calculateFromPerC(const double P_fl,
+                                                                                   const double C_Per) const {
+    const double capacity = getFullLoadCapacity(P_fl);
+    switch (controlType) {
+        case CompressedAirCentrifugalBase::LoadUnload:
+            return CompressedAirCentrifugal_LoadUnload(kW_fl, capacity, kW_nl).calculateFromPerC(C_Per);
+        case CompressedAirCentrifugalBase::ModulationUnload:
+            return CompressedAirCentrifugal_ModulationUnload(kW_fl, capacity, kW_nl, C_max, kW_ul, C_ul)
+                    .calculateFromPerC(C_Per);
+        case CompressedAirCentrifugalBase::BlowOff: {
+            auto const output = CompressedAirCentrifugal_BlowOff(kW_fl, capacity, kW_blow, C_blow)
+                    .calculateFromPerC_BlowOff(C_Per);
+            return {output.kW_Calc, output.C_Calc, output.PerkW, output.C_Per};
+        }
+    }
+    throw std::runtime_error("CompressedAirCentrifugalMap: unknown control type");
+}
+
+CompressedAirCentrifugalBase::Output CompressedAirCentrifugalMap::calculateFromPerkW(const double P_fl,
+                                                                                    const double PerkW,
+                                                                                    const double blowPer) const {
+    const double capacity = getFullLoadCapacity(P_fl);
+    switch (controlType) {
+        case CompressedAirCentrifugalBase::LoadUnload:
+            return CompressedAirCentrifugal_LoadUnload(kW_fl, capacity, kW_nl).calculateFromPerkW(PerkW);
+        case CompressedAirCentrifugalBase::ModulationUnload:
+            return CompressedAirCentrifugal_ModulationUnload(kW_fl, capacity, kW_nl, C_max, kW_ul, C_ul)
+                    .calculateFromPerkW(PerkW);
+        case CompressedAirCentrifugalBase::BlowOff: {
+            auto const output = CompressedAirCentrifugal_BlowOff(kW_fl, capacity, kW_blow, C_blow)
+                    .calculateFromPerkW_BlowOff(PerkW, blowPer);
+            return {output.kW_Calc, output.C_Calc, output.PerkW, output.C_Per};
+        }
+    }
+    throw std::runtime_error("CompressedAirCentrifugalMap: unknown control type");
+}
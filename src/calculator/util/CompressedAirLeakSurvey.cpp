@@ -1,6 +1,7 @@
 #include <iostream>
 #include <cmath>
 #include "calculator/util/CompressedAirLeakSurvey.h"
+#include "calculator/util/DecibelsLeakRateGrid.h"
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
@@ -11,59 +12,66 @@ CompressedAirLeakSurvey::Output CompressedAirLeakSurvey::calculate()
 
     for (auto &compressedAirLeakSurveyInput : compressedAirLeakSurveyInputVec)
     {
-        double tmpAnnualTotalElectricity = 0, tmpAnnualTotalElectricityCost = 0, tmpTotalFlowRate = 0, tmpSingleNozzleFlowRate = 0, tmpAnnualTotalFlowRate = 0;
-
-        // estimate method
-        if(compressedAirLeakSurveyInput.getMeasurementMethod() == 0)
-        {
-            EstimateMethodData estimateMethodData = compressedAirLeakSurveyInput.getEstimateMethodData();
-            tmpTotalFlowRate = estimateMethodData.getLeakRateEstimate() * compressedAirLeakSurveyInput.getUnits();
-            tmpAnnualTotalFlowRate = (compressedAirLeakSurveyInput.getHoursPerYear() * tmpTotalFlowRate * 60);
-        }
-        // decibels method
-        else if(compressedAirLeakSurveyInput.getMeasurementMethod() == 1)
-        {
-            DecibelsMethodData decibelsMethodData = compressedAirLeakSurveyInput.getDecibelsMethodData();
-            tmpTotalFlowRate = decibelsMethodData.calculate() * compressedAirLeakSurveyInput.getUnits();
-            tmpAnnualTotalFlowRate = (compressedAirLeakSurveyInput.getHoursPerYear() * tmpTotalFlowRate * 60);
-        }
-        // bag method
-        else if (compressedAirLeakSurveyInput.getMeasurementMethod() == 2)
-        {
-            BagMethodData bagMethodData = compressedAirLeakSurveyInput.getBagMethodData();
-            tmpTotalFlowRate = ((60.0 / bagMethodData.getFillTime()) * M_PI * bagMethodData.getHeight() * pow((bagMethodData.getDiameter() / 2.0), 2.0) * (1.0 / pow(12.0, 3.0))) * compressedAirLeakSurveyInput.getUnits();
-            tmpAnnualTotalFlowRate = tmpTotalFlowRate * 60.0 * compressedAirLeakSurveyInput.getHoursPerYear();
-        }
-        // orifice method
-        else if(compressedAirLeakSurveyInput.getMeasurementMethod() == 3)
-        {
-            OrificeMethodData orificeMethodData = compressedAirLeakSurveyInput.getOrificeMethodData();
-            tmpTotalFlowRate = orificeMethodData.calculate() * compressedAirLeakSurveyInput.getUnits();
-            tmpAnnualTotalFlowRate = (compressedAirLeakSurveyInput.getHoursPerYear() * tmpTotalFlowRate * 60);
-        }
-
-        //electricity calculation
-        if (compressedAirLeakSurveyInput.getUtilityType() == 0)
-        {
-            tmpAnnualTotalElectricityCost = compressedAirLeakSurveyInput.getUtilityCost() * tmpAnnualTotalFlowRate;
-        }
-        else if (compressedAirLeakSurveyInput.getUtilityType() == 1)
-        {
-            CompressorElectricityData compressorElectricityData = compressedAirLeakSurveyInput.getCompressorElectricityData();
-            double electricityCalculation = compressorElectricityData.calculate();
-            tmpAnnualTotalElectricity = electricityCalculation * tmpAnnualTotalFlowRate;
-            tmpAnnualTotalElectricityCost = tmpAnnualTotalElectricity * compressedAirLeakSurveyInput.getUtilityCost();
-        }
-
-        annualTotalElectricity += tmpAnnualTotalElectricity;
-        annualTotalElectricityCost += tmpAnnualTotalElectricityCost;
-        totalFlowRate += tmpTotalFlowRate;
-        annualTotalFlowRate += tmpAnnualTotalFlowRate;
+        const CompressedAirLeakSurvey::Output leak = calculateLeak(compressedAirLeakSurveyInput);
+
+        annualTotalElectricity += leak.annualTotalElectricity;
+        annualTotalElectricityCost += leak.annualTotalElectricityCost;
+        totalFlowRate += leak.totalFlowRate;
+        annualTotalFlowRate += leak.annualTotalFlowRate;
     }
 
     return CompressedAirLeakSurvey::Output(annualTotalElectricity, annualTotalElectricityCost, totalFlowRate, annualTotalFlowRate);
 }
 
+CompressedAirLeakSurvey::Output CompressedAirLeakSurvey::calculateLeak(const CompressedAirLeakSurveyInput &compressedAirLeakSurveyInput)
+{
+    double tmpAnnualTotalElectricity = 0, tmpAnnualTotalElectricityCost = 0, tmpTotalFlowRate = 0, tmpAnnualTotalFlowRate = 0;
+
+    // estimate method
+    if(compressedAirLeakSurveyInput.getMeasurementMethod() == 0)
+    {
+        EstimateMethodData estimateMethodData = compressedAirLeakSurveyInput.getEstimateMethodData();
+        tmpTotalFlowRate = estimateMethodData.getLeakRateEstimate() * compressedAirLeakSurveyInput.getUnits();
+        tmpAnnualTotalFlowRate = (compressedAirLeakSurveyInput.getHoursPerYear() * tmpTotalFlowRate * 60);
+    }
+    // decibels method
+    else if(compressedAirLeakSurveyInput.getMeasurementMethod() == 1)
+    {
+        DecibelsMethodData decibelsMethodData = compressedAirLeakSurveyInput.getDecibelsMethodData();
+        tmpTotalFlowRate = decibelsMethodData.calculate() * compressedAirLeakSurveyInput.getUnits();
+        tmpAnnualTotalFlowRate = (compressedAirLeakSurveyInput.getHoursPerYear() * tmpTotalFlowRate * 60);
+    }
+    // bag method
+    else if (compressedAirLeakSurveyInput.getMeasurementMethod() == 2)
+    {
+        BagMethodData bagMethodData = compressedAirLeakSurveyInput.getBagMethodData();
+        tmpTotalFlowRate = ((60.0 / bagMethodData.getFillTime()) * M_PI * bagMethodData.getHeight() * pow((bagMethodData.getDiameter() / 2.0), 2.0) * (1.0 / pow(12.0, 3.0))) * compressedAirLeakSurveyInput.getUnits();
+        tmpAnnualTotalFlowRate = tmpTotalFlowRate * 60.0 * compressedAirLeakSurveyInput.getHoursPerYear();
+    }
+    // orifice method
+    else if(compressedAirLeakSurveyInput.getMeasurementMethod() == 3)
+    {
+        OrificeMethodData orificeMethodData = compressedAirLeakSurveyInput.getOrificeMethodData();
+        tmpTotalFlowRate = orificeMethodData.calculate() * compressedAirLeakSurveyInput.getUnits();
+        tmpAnnualTotalFlowRate = (compressedAirLeakSurveyInput.getHoursPerYear() * tmpTotalFlowRate * 60);
+    }
+
+    //electricity calculation
+    if (compressedAirLeakSurveyInput.getUtilityType() == 0)
+    {
+        tmpAnnualTotalElectricityCost = compressedAirLeakSurveyInput.getUtilityCost() * tmpAnnualTotalFlowRate;
+    }
+    else if (compressedAirLeakSurveyInput.getUtilityType() == 1)
+    {
+        CompressorElectricityData compressorElectricityData = compressedAirLeakSurveyInput.getCompressorElectricityData();
+        double electricityCalculation = compressorElectricityData.calculate();
+        tmpAnnualTotalElectricity = electricityCalculation * tmpAnnualTotalFlowRate;
+        tmpAnnualTotalElectricityCost = tmpAnnualTotalElectricity * compressedAirLeakSurveyInput.getUtilityCost();
+    }
+
+    return CompressedAirLeakSurvey::Output(tmpAnnualTotalElectricity, tmpAnnualTotalElectricityCost, tmpTotalFlowRate, tmpAnnualTotalFlowRate);
+}
+
 double DecibelsMethodData::calculate()
 {
     
@@ -79,11 +87,8 @@ double DecibelsMethodData::calculate()
     //double secondFlowB; // Q22
 	
 
-	const double denominator = (pressureB - pressureA) * (decibelRatingB - decibelRatingA);
-	const double leakRateEstimate = ((pressureB - linePressure) * (decibelRatingB - decibels)) / denominator * firstFlowA
-							      + ((linePressure - pressureA) * (decibelRatingB - decibels)) / denominator * secondFlowA
-							      + ((pressureB - linePressure) * (decibels - decibelRatingA)) / denominator * firstFlowB
-							      + ((linePressure - pressureA) * (decibels - decibelRatingA)) / denominator * secondFlowB;
+	const double leakRateEstimate = DecibelsLeakRateGrid::interpolate(linePressure, decibels, decibelRatingA, pressureA, firstFlowA,
+																  secondFlowA, decibelRatingB, pressureB, firstFlowB, secondFlowB);
 
     return leakRateEstimate;
 }
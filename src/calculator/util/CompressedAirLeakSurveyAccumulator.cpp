@@ -0,0 +1,209 @@
+/**
+ * @file
+ * @brief Contains the implementation of the compressed air leak survey accumulator.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <cstdlib>
+#include <stdexcept>
+#include "calculator/util/CompressedAirLeakSurveyAccumulator.h"
+#include "calculator/util/CsvLine.h"
+#include "calculator/util/ParallelFor.h"
+
+namespace {
+    enum Field {
+        HOURS_PER_YEAR, UTILITY_TYPE, UTILITY_COST, MEASUREMENT_METHOD, UNITS, LEAK_RATE_ESTIMATE, LINE_PRESSURE,
+        DECIBELS, DECIBEL_RATING_A, PRESSURE_A, FIRST_FLOW_A, SECOND_FLOW_A, DECIBEL_RATING_B, PRESSURE_B,
+        FIRST_FLOW_B, SECOND_FLOW_B, HEIGHT, DIAMETER, FILL_TIME, AIR_TEMP, ATMOSPHERIC_PRESSURE, DISCHARGE_COEFFICIENT,
+        ORIFICE_DIAMETER, SUPPLY_PRESSURE, NUMBER_OF_ORIFICES, CONTROL_ADJUSTMENT, SPECIFIC_POWER, FIELD_COUNT
+    };
+
+    const char *fieldNames[FIELD_COUNT] = {
+            "hoursPerYear", "utilityType", "utilityCost", "measurementMethod", "units", "leakRateEstimate",
+            "linePressure", "decibels", "decibelRatingA", "pressureA", "firstFlowA", "secondFlowA", "decibelRatingB",
+            "pressureB", "firstFlowB", "secondFlowB", "height", "diameter", "fillTime", "compressorAirTemp",
+            "atmosphericPressure", "dischargeCoefficient", "orificeDiameter", "supplyPressure", "numberOfOrifices",
+            "compressorControlAdjustment", "compressorSpecificPower"
+    };
+
+    bool isBlank(const char *line) {
+        while (*line == ' ' || *line == '\t' || *line == '\r') line++;
+        return *line == '\0';
+    }
+}
+
+CompressedAirLeakSurveyAccumulator::CompressedAirLeakSurveyAccumulator(const std::size_t batchSize,
+                                                                       const unsigned threads)
+        : batchSize(batchSize), threads(threads)
+{
+    if (batchSize == 0) {
+        throw std::runtime_error("CompressedAirLeakSurveyAccumulator: the batch size must be positive");
+    }
+}
+
+std::size_t CompressedAirLeakSurveyAccumulator::getMethod(const int measurementMethod) {
+    return measurementMethod >= 0 && measurementMethod < static_cast<int>(METHOD_COUNT) - 1
+           ? static_cast<std::size_t>(measurementMethod) : METHOD_COUNT - 1;
+}
+
+void CompressedAirLeakSurveyAccumulator::addTotals(Totals &totals, const Totals &leaks) {
+    totals.leaks += leaks.leaks;
+    totals.annualTotalElectricity += leaks.annualTotalElectricity;
+    totals.annualTotalElectricityCost += leaks.annualTotalElectricityCost;
+    totals.totalFlowRate += leaks.totalFlowRate;
+    totals.annualTotalFlowRate += leaks.annualTotalFlowRate;
+}
+
+void CompressedAirLeakSurveyAccumulator::add(const CompressedAirLeakSurveyInput &leak, const std::string &area) {
+    // leaks are usually tagged area by area, so the area of the previous leak is checked first
+    if (areas.empty() || areas[lastArea] != area) {
+        auto found = areaIndexes.find(area);
+        if (found == areaIndexes.end()) {
+            found = areaIndexes.emplace(area, areas.size()).first;
+            areas.push_back(area);
+            totals.resize(areas.size() * METHOD_COUNT);
+        }
+        lastArea = found->second;
+    }
+
+    pending[getMethod(leak.getMeasurementMethod())].push_back({leak, lastArea});
+    if (++pendingCount >= batchSize) flush();
+}
+
+void CompressedAirLeakSurveyAccumulator::flush() {
+    if (pendingCount == 0) return;
+
+    // the batch is evaluated in method order, so each thread's block runs through one or two methods only
+    std::size_t methodEnd[METHOD_COUNT];
+    for (std::size_t method = 0, end = 0; method < METHOD_COUNT; method++) {
+        end += pending[method].size();
+        methodEnd[method] = end;
+    }
+
+    // each block only totals the area and method pairs it sees, so a batch costs the same however many areas
+    // the survey has; the blocks are merged in order, which keeps the sums independent of thread timing
+    const unsigned threadCount = ParallelFor::getThreadCount(threads, pendingCount);
+    std::vector<std::unordered_map<std::size_t, Totals>> threadTotals(threadCount);
+    ParallelFor::run(pendingCount, threadCount, [&](const std::size_t begin, const std::size_t end,
+                                                    const unsigned thread) {
+        auto &blockTotals = threadTotals[thread];
+        std::size_t method = 0;
+        for (std::size_t i = begin; i < end; i++) {
+            while (i >= methodEnd[method]) method++;
+            auto const &leak = pending[method][i - (methodEnd[method] - pending[method].size())];
+            const CompressedAirLeakSurvey::Output output = CompressedAirLeakSurvey::calculateLeak(leak.input);
+            auto &leakTotals = blockTotals[leak.area * METHOD_COUNT + method];
+            leakTotals.leaks++;
+            leakTotals.annualTotalElectricity += output.annualTotalElectricity;
+            leakTotals.annualTotalElectricityCost += output.annualTotalElectricityCost;
+            leakTotals.totalFlowRate += output.totalFlowRate;
+            leakTotals.annualTotalFlowRate += output.annualTotalFlowRate;
+        }
+    });
+
+    for (auto const &blockTotals : threadTotals) {
+        for (auto const &areaMethod : blockTotals) addTotals(totals[areaMethod.first], areaMethod.second);
+    }
+    for (auto &leaks : pending) leaks.clear();
+    pendingCount = 0;
+}
+
+std::size_t CompressedAirLeakSurveyAccumulator::addCsv(io::LineReader &lines) {
+    auto const where = [&lines] {
+        return std::string(lines.get_truncated_file_name()) + " line " + std::to_string(lines.get_file_line());
+    };
+
+    char *line = lines.next_line();
+    while (line != nullptr && isBlank(line)) line = lines.next_line();
+    if (line == nullptr) {
+        throw std::runtime_error("CompressedAirLeakSurveyAccumulator: " + where() + ": no header row");
+    }
+
+    // column of each field, -1 when the field is absent
+    auto const header = CsvLine::split(line);
+    long columns[FIELD_COUNT];
+    long areaColumn = -1;
+    for (auto &column : columns) column = -1;
+    for (std::size_t c = 0; c < header.size(); c++) {
+        if (header[c] == "area") areaColumn = static_cast<long>(c);
+        for (int field = 0; field < FIELD_COUNT; field++) {
+            if (header[c] == fieldNames[field]) columns[field] = static_cast<long>(c);
+        }
+    }
+    for (const Field field : {HOURS_PER_YEAR, UTILITY_TYPE, UTILITY_COST, MEASUREMENT_METHOD, UNITS}) {
+        if (columns[field] < 0) {
+            throw std::runtime_error("CompressedAirLeakSurveyAccumulator: " + where() + ": no "
+                                     + fieldNames[field] + " column");
+        }
+    }
+
+    std::size_t count = 0;
+    double values[FIELD_COUNT];
+    while ((line = lines.next_line()) != nullptr) {
+        if (isBlank(line)) continue;
+        auto const cells = CsvLine::split(line);
+        if (cells.size() != header.size()) {
+            throw std::runtime_error("CompressedAirLeakSurveyAccumulator: " + where() + " has "
+                                     + std::to_string(cells.size()) + " columns, expected "
+                                     + std::to_string(header.size()));
+        }
+
+        for (int field = 0; field < FIELD_COUNT; field++) {
+            values[field] = 0;
+            if (columns[field] < 0) continue;
+            auto const &cell = cells[columns[field]];
+            if (cell.find_first_not_of(" \t") == std::string::npos) continue;
+            char *end;
+            values[field] = std::strtod(cell.c_str(), &end);
+            while (*end == ' ' || *end == '\t') end++;
+            if (end == cell.c_str() || *end != '\0') {
+                throw std::runtime_error("CompressedAirLeakSurveyAccumulator: " + where() + ": " + fieldNames[field]
+                                         + " is not a number");
+            }
+        }
+
+        add(CompressedAirLeakSurveyInput(
+                static_cast<int>(values[HOURS_PER_YEAR]), static_cast<int>(values[UTILITY_TYPE]), values[UTILITY_COST],
+                static_cast<int>(values[MEASUREMENT_METHOD]), EstimateMethodData(values[LEAK_RATE_ESTIMATE]),
+                DecibelsMethodData(values[LINE_PRESSURE], values[DECIBELS], values[DECIBEL_RATING_A],
+                                   values[PRESSURE_A], values[FIRST_FLOW_A], values[SECOND_FLOW_A],
+                                   values[DECIBEL_RATING_B], values[PRESSURE_B], values[FIRST_FLOW_B],
+                                   values[SECOND_FLOW_B]),
+                BagMethodData(values[HEIGHT], values[DIAMETER], values[FILL_TIME]),
+                OrificeMethodData(values[AIR_TEMP], values[ATMOSPHERIC_PRESSURE], values[DISCHARGE_COEFFICIENT],
+                                  values[ORIFICE_DIAMETER], values[SUPPLY_PRESSURE],
+                                  static_cast<int>(values[NUMBER_OF_ORIFICES])),
+                CompressorElectricityData(values[CONTROL_ADJUSTMENT], values[SPECIFIC_POWER]),
+                static_cast<int>(values[UNITS])), areaColumn < 0 ? "" : cells[areaColumn]);
+        count++;
+    }
+    return count;
+}
+
+CompressedAirLeakSurveyAccumulator::Totals CompressedAirLeakSurveyAccumulator::getTotals() {
+    flush();
+    Totals survey;
+    for (auto const &areaMethod : totals) addTotals(survey, areaMethod);
+    return survey;
+}
+
+CompressedAirLeakSurveyAccumulator::Totals CompressedAirLeakSurveyAccumulator::getAreaTotals(const std::string &area) {
+    flush();
+    Totals areaTotals;
+    auto const found = areaIndexes.find(area);
+    if (found == areaIndexes.end()) return areaTotals;
+    for (std::size_t method = 0; method < METHOD_COUNT; method++) {
+        addTotals(areaTotals, totals[found->second * METHOD_COUNT + method]);
+    }
+    return areaTotals;
+}
+
+CompressedAirLeakSurveyAccumulator::Totals CompressedAirLeakSurveyAccumulator::getMethodTotals(const int measurementMethod) {
+    flush();
+    Totals methodTotals;
+    const std::size_t method = getMethod(measurementMethod);
+    for (std::size_t area = 0; area < areas.size(); area++) addTotals(methodTotals, totals[area * METHOD_COUNT + method]);
+    return methodTotals;
+}
@@ -0,0 +1,357 @@
+/**
+ * @file
+ * @brief Contains the implementation of the compressed air distribution network solver.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "calculator/util/CompressedAirNetwork.h"
+#include "calculator/util/SolverStatistics.h"
+
+namespace {
+    // flows below this carry the Newton step on a linear pressure drop, since the slope of Q^2 vanishes at zero flow
+    const double MIN_FLOW = 1e-3;
+
+    // first guess of the flow of a new pipe, at a typical design velocity of the compressed air - ft/s
+    const double START_VELOCITY = 20;
+
+    // reduction of the residual of the junction pressure system by each conjugate gradient solve
+    const double FORCING = 1e-4;
+}
+
+CompressedAirNetwork::CompressedAirNetwork(const double atmosphericPressure)
+        : atmosphericPressure(atmosphericPressure)
+{
+    if (!(atmosphericPressure > 0)) {
+        throw std::runtime_error("CompressedAirNetwork: the atmospheric pressure must be positive");
+    }
+}
+
+std::size_t CompressedAirNetwork::addJunction(const double demand) {
+    nodes.push_back({false, demand});
+    prepared = false;
+    return nodes.size() - 1;
+}
+
+std::size_t CompressedAirNetwork::addSupply(const double pressure) {
+    nodes.push_back({true, pressure});
+    prepared = false;
+    return nodes.size() - 1;
+}
+
+std::size_t CompressedAirNetwork::addPipe(const std::size_t from, const std::size_t to, const double length,
+                                          const double diameter) {
+    if (from >= nodes.size() || to >= nodes.size() || from == to) {
+        throw std::runtime_error("CompressedAirNetwork: a pipe must join two different nodes of the network");
+    }
+    if (!(length > 0) || !(diameter > 0)) {
+        throw std::runtime_error("CompressedAirNetwork: the length and diameter of a pipe must be positive");
+    }
+    pipes.push_back({from, to, length, diameter});
+    prepared = false;
+    return pipes.size() - 1;
+}
+
+void CompressedAirNetwork::setDemand(const std::size_t node, const double demand) {
+    if (node >= nodes.size() || nodes[node].supply) {
+        throw std::runtime_error("CompressedAirNetwork: the demand is set at a junction");
+    }
+    nodes[node].value = demand;
+}
+
+void CompressedAirNetwork::setSupplyPressure(const std::size_t node, const double pressure) {
+    if (node >= nodes.size() || !nodes[node].supply) {
+        throw std::runtime_error("CompressedAirNetwork: the pressure is set at a supply point");
+    }
+    nodes[node].value = pressure;
+}
+
+void CompressedAirNetwork::setPipeDiameter(const std::size_t pipe, const double diameter) {
+    if (pipe >= pipes.size() || !(diameter > 0)) {
+        throw std::runtime_error("CompressedAirNetwork: the diameter of a pipe of the network must be positive");
+    }
+    pipes[pipe].diameter = diameter;
+}
+
+void CompressedAirNetwork::prepare() {
+    unknown.assign(nodes.size(), -1);
+    std::size_t count = 0;
+    double supplyPressure = 0;
+    bool hasSupply = false;
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].supply) {
+            supplyPressure = hasSupply ? std::max(supplyPressure, nodes[i].value) : nodes[i].value;
+            hasSupply = true;
+        } else {
+            unknown[i] = static_cast<long>(count++);
+        }
+    }
+
+    // every junction must be reached from a supply point, or its pressure is undetermined
+    std::vector<std::vector<std::size_t>> adjacent(nodes.size());
+    for (auto const &pipe : pipes) {
+        adjacent[pipe.from].push_back(pipe.to);
+        adjacent[pipe.to].push_back(pipe.from);
+    }
+    std::vector<bool> reached(nodes.size(), false);
+    std::vector<std::size_t> queue;
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].supply) {
+            reached[i] = true;
+            queue.push_back(i);
+        }
+    }
+    for (std::size_t q = 0; q < queue.size(); q++) {
+        for (auto const next : adjacent[queue[q]]) {
+            if (!reached[next]) {
+                reached[next] = true;
+                queue.push_back(next);
+            }
+        }
+    }
+    if (queue.size() != nodes.size()) {
+        throw std::runtime_error("CompressedAirNetwork: every junction must be connected to a supply point");
+    }
+
+    // compressed sparse rows of the junction pressure system, one row per junction with its diagonal
+    std::vector<std::vector<std::size_t>> rows(count);
+    for (std::size_t i = 0; i < count; i++) rows[i].push_back(i);
+    for (auto const &pipe : pipes) {
+        const long a = unknown[pipe.from], b = unknown[pipe.to];
+        if (a >= 0 && b >= 0) {
+            rows[a].push_back(static_cast<std::size_t>(b));
+            rows[b].push_back(static_cast<std::size_t>(a));
+        }
+    }
+    rowStart.assign(1, 0);
+    columns.clear();
+    diagonal.resize(count);
+    for (std::size_t i = 0; i < count; i++) {
+        std::sort(rows[i].begin(), rows[i].end());
+        rows[i].erase(std::unique(rows[i].begin(), rows[i].end()), rows[i].end());
+        for (auto const column : rows[i]) {
+            if (column == i) diagonal[i] = columns.size();
+            columns.push_back(column);
+        }
+        rowStart.push_back(columns.size());
+    }
+    auto const entry = [this](const std::size_t row, const std::size_t column) {
+        return static_cast<std::size_t>(std::lower_bound(columns.begin() + rowStart[row],
+                                                         columns.begin() + rowStart[row + 1], column)
+                                        - columns.begin());
+    };
+    fromEntry.assign(pipes.size(), 0);
+    toEntry.assign(pipes.size(), 0);
+    for (std::size_t k = 0; k < pipes.size(); k++) {
+        const long a = unknown[pipes[k].from], b = unknown[pipes[k].to];
+        if (a >= 0 && b >= 0) {
+            fromEntry[k] = entry(static_cast<std::size_t>(a), static_cast<std::size_t>(b));
+            toEntry[k] = entry(static_cast<std::size_t>(b), static_cast<std::size_t>(a));
+        }
+    }
+    values.resize(columns.size());
+    rhs.resize(count);
+
+    // nodes and pipes added since the last solve start at the highest supply pressure and the design velocity
+    pressures.resize(nodes.size(), supplyPressure);
+    for (std::size_t k = flows.size(); k < pipes.size(); k++) {
+        const double area = 3.14159265358979 * pipes[k].diameter * pipes[k].diameter / 4;
+        flows.push_back(START_VELOCITY * 60 * area / 144 * (supplyPressure + atmosphericPressure) / atmosphericPressure);
+    }
+    prepared = true;
+}
+
+void CompressedAirNetwork::factorize() {
+    // incomplete Cholesky factor on the sparsity pattern of the lower triangle
+    factor.resize(values.size());
+    for (std::size_t i = 0; i < rhs.size(); i++) {
+        for (std::size_t e = rowStart[i]; e < diagonal[i]; e++) {
+            const std::size_t k = columns[e];
+            double sum = values[e];
+            for (std::size_t a = rowStart[i], b = rowStart[k]; a < e && b < diagonal[k];) {
+                if (columns[a] < columns[b]) {
+                    a++;
+                } else if (columns[b] < columns[a]) {
+                    b++;
+                } else {
+                    sum -= factor[a++] * factor[b++];
+                }
+            }
+            factor[e] = sum / factor[diagonal[k]];
+        }
+        double pivot = values[diagonal[i]];
+        for (std::size_t e = rowStart[i]; e < diagonal[i]; e++) pivot -= factor[e] * factor[e];
+        factor[diagonal[i]] = std::sqrt(pivot > 0 ? pivot : values[diagonal[i]]);
+    }
+}
+
+void CompressedAirNetwork::solveLinearSystem(std::vector<double> &x) {
+    const std::size_t n = rhs.size();
+    std::vector<double> residual(n), z(n), direction(n), product(n);
+    factorize();
+
+    auto const multiply = [this, n](const std::vector<double> &v, std::vector<double> &out) {
+        for (std::size_t i = 0; i < n; i++) {
+            double sum = 0;
+            for (std::size_t e = rowStart[i]; e < rowStart[i + 1]; e++) sum += values[e] * v[columns[e]];
+            out[i] = sum;
+        }
+    };
+    auto const precondition = [this, n, &residual, &z] {
+        for (std::size_t i = 0; i < n; i++) {
+            double sum = residual[i];
+            for (std::size_t e = rowStart[i]; e < diagonal[i]; e++) sum -= factor[e] * z[columns[e]];
+            z[i] = sum / factor[diagonal[i]];
+        }
+        for (std::size_t i = n; i-- > 0;) {
+            z[i] /= factor[diagonal[i]];
+            for (std::size_t e = rowStart[i]; e < diagonal[i]; e++) z[columns[e]] -= factor[e] * z[i];
+        }
+    };
+
+    multiply(x, product);
+    double rhsNorm = 0, startNorm = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        residual[i] = rhs[i] - product[i];
+        rhsNorm += rhs[i] * rhs[i];
+        startNorm += residual[i] * residual[i];
+    }
+    precondition();
+    double rz = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        direction[i] = z[i];
+        rz += residual[i] * z[i];
+    }
+
+    // an inexact Newton step: the residual left in the flow balance shrinks by the same factor at every iteration
+    const double limit = std::max(FORCING * FORCING * startNorm, 1e-30 * rhsNorm);
+
+    for (std::size_t iteration = 0; iteration < 10 * n + 100; iteration++) {
+        double residualNorm = 0;
+        for (std::size_t i = 0; i < n; i++) residualNorm += residual[i] * residual[i];
+        if (residualNorm <= limit) return;
+
+        multiply(direction, product);
+        double curvature = 0;
+        for (std::size_t i = 0; i < n; i++) curvature += direction[i] * product[i];
+        const double step = rz / curvature;
+        for (std::size_t i = 0; i < n; i++) {
+            x[i] += step * direction[i];
+            residual[i] -= step * product[i];
+        }
+
+        precondition();
+        double rzNext = 0;
+        for (std::size_t i = 0; i < n; i++) rzNext += residual[i] * z[i];
+        const double beta = rzNext / rz;
+        rz = rzNext;
+        for (std::size_t i = 0; i < n; i++) direction[i] = z[i] + beta * direction[i];
+    }
+}
+
+CompressedAirNetwork::Results CompressedAirNetwork::solve(const double tolerance, const int maxIterations) {
+    AMO_SOLVER_SCOPE(solverScope, Solver::AIR_NETWORK);
+    if (!prepared) prepare();
+
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].supply) pressures[i] = nodes[i].value;
+    }
+
+    const std::size_t count = rhs.size();
+    std::vector<double> x(count), conductance(pipes.size()), carried(pipes.size());
+    Results results;
+    results.iterations = 0;
+    results.converged = false;
+
+    while (results.iterations < maxIterations && !results.converged) {
+        AMO_SOLVER_ITERATION(Solver::AIR_NETWORK);
+        results.iterations++;
+
+        std::fill(values.begin(), values.end(), 0);
+        for (std::size_t i = 0; i < nodes.size(); i++) {
+            if (unknown[i] >= 0) {
+                rhs[unknown[i]] = -nodes[i].value;
+                x[unknown[i]] = pressures[i];
+            }
+        }
+
+        // Newton step of each pipe: Q' = Q - h(Q) / h'(Q) + (P_from - P_to) / h'(Q), h = R Q |Q|
+        for (std::size_t k = 0; k < pipes.size(); k++) {
+            auto const &pipe = pipes[k];
+            const double meanPressure = (pressures[pipe.from] + pressures[pipe.to]) / 2;
+            const double ratio = std::max((meanPressure + atmosphericPressure) / atmosphericPressure, 0.01);
+            const double resistance = 0.1025 * pipe.length / (3600 * ratio * std::pow(pipe.diameter, 5.31));
+            const double flow = flows[k];
+            const double slope = 2 * resistance * std::max(std::fabs(flow), MIN_FLOW);
+            conductance[k] = 1 / slope;
+            carried[k] = flow - resistance * flow * std::fabs(flow) / slope;
+
+            const long a = unknown[pipe.from], b = unknown[pipe.to];
+            if (a >= 0) {
+                values[diagonal[a]] += conductance[k];
+                rhs[a] -= carried[k];
+                if (b < 0) rhs[a] += conductance[k] * pressures[pipe.to];
+            }
+            if (b >= 0) {
+                values[diagonal[b]] += conductance[k];
+                rhs[b] += carried[k];
+                if (a < 0) rhs[b] += conductance[k] * pressures[pipe.from];
+            }
+            if (a >= 0 && b >= 0) {
+                values[fromEntry[k]] -= conductance[k];
+                values[toEntry[k]] -= conductance[k];
+            }
+        }
+
+        solveLinearSystem(x);
+        double largestPressureChange = 0, largestPressure = 0;
+        for (std::size_t i = 0; i < nodes.size(); i++) {
+            if (unknown[i] >= 0) {
+                largestPressureChange = std::max(largestPressureChange, std::fabs(x[unknown[i]] - pressures[i]));
+                pressures[i] = x[unknown[i]];
+            }
+            largestPressure = std::max(largestPressure, pressures[i] + atmosphericPressure);
+        }
+
+        // the compression ratio lags one iteration behind, so the pressures must settle as well as the flows
+        double largestChange = 0, largestFlow = 0;
+        for (std::size_t k = 0; k < pipes.size(); k++) {
+            const double flow = carried[k] + conductance[k] * (pressures[pipes[k].from] - pressures[pipes[k].to]);
+            largestChange = std::max(largestChange, std::fabs(flow - flows[k]));
+            largestFlow = std::max(largestFlow, std::fabs(flow));
+            flows[k] = flow;
+        }
+        results.converged = largestChange <= tolerance * std::max(largestFlow, MIN_FLOW)
+                            && largestPressureChange <= tolerance * largestPressure;
+    }
+
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        if (!(pressures[i] + atmosphericPressure > 0)) {
+            throw std::runtime_error("CompressedAirNetwork: the supply pressure cannot deliver the demand");
+        }
+    }
+
+    results.pressures = pressures;
+    results.flows = flows;
+    results.supplies.assign(nodes.size(), 0);
+    results.pressureDrops.resize(pipes.size());
+    results.velocities.resize(pipes.size());
+    for (std::size_t k = 0; k < pipes.size(); k++) {
+        auto const &pipe = pipes[k];
+        if (nodes[pipe.from].supply) results.supplies[pipe.from] += flows[k];
+        if (nodes[pipe.to].supply) results.supplies[pipe.to] -= flows[k];
+        results.pressureDrops[k] = std::fabs(pressures[pipe.from] - pressures[pipe.to]);
+
+        const double meanPressure = (pressures[pipe.from] + pressures[pipe.to]) / 2;
+        const double area = 3.14159265358979 * pipe.diameter * pipe.diameter / 4;
+        results.velocities[k] = std::fabs(flows[k]) * atmosphericPressure / (meanPressure + atmosphericPressure)
+                                * (144 / area) / 60;
+    }
+
+    if (results.converged) AMO_SOLVER_CONVERGED(solverScope);
+    return results;
+}
@@ -0,0 +1,139 @@
+/**
+ * @file
+ * @brief Contains the implementation of the compressed air sequencing strategy optimizer.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include "calculator/util/CompressedAirSequencingOptimizer.h"
+#include "calculator/util/ParallelFor.h"
+
+namespace {
+    bool isPermutation(std::vector<std::size_t> order, const std::size_t size) {
+        if (order.size() != size) return false;
+        std::sort(order.begin(), order.end());
+        for (std::size_t i = 0; i < size; i++) {
+            if (order[i] != i) return false;
+        }
+        return true;
+    }
+}
+
+CompressedAirSequencingOptimizer::Results
+CompressedAirSequencingOptimizer::optimize(const Inputs &inputs, const std::size_t strategies, const unsigned threads) {
+    const std::size_t units = inputs.compressors.size();
+    if (units == 0 || strategies == 0) {
+        throw std::runtime_error("CompressedAirSequencingOptimizer: there must be compressors and strategies to rank");
+    }
+    if (inputs.pressureBands.empty() || inputs.storageAdditions.empty()) {
+        throw std::runtime_error("CompressedAirSequencingOptimizer: there must be pressure bands and storage additions to try");
+    }
+
+    std::vector<std::vector<std::size_t>> orders = inputs.loadingOrders;
+    if (orders.empty()) {
+        orders.emplace_back(units);
+        for (std::size_t i = 0; i < units; i++) orders[0][i] = i;
+    }
+    for (auto const &order : orders) {
+        if (!isPermutation(order, units)) {
+            throw std::runtime_error("CompressedAirSequencingOptimizer: a loading order must list each compressor once");
+        }
+    }
+
+    std::vector<int> trims = {-1};
+    if (inputs.tryTrimCompressors && units > 1) {
+        for (std::size_t i = 0; i < units; i++) trims.push_back(static_cast<int>(i));
+    }
+
+    std::vector<Strategy> candidates;
+    for (auto const &order : orders) {
+        for (auto const trim : trims) {
+            for (auto const band : inputs.pressureBands) {
+                for (auto const addition : inputs.storageAdditions) {
+                    Strategy candidate;
+                    candidate.loadingOrder = order;
+                    candidate.trimCompressor = trim;
+                    candidate.pressureBand = band;
+                    candidate.storageAddition = addition;
+                    candidates.push_back(candidate);
+                }
+            }
+        }
+    }
+
+    Results results;
+    results.candidates = candidates.size();
+
+    std::mutex mutex;
+    std::vector<std::size_t> ranked; // indexes of the cheapest candidates so far, cheapest first
+    std::atomic<double> threshold(std::numeric_limits<double>::infinity());
+    std::atomic<std::size_t> pruned(0), infeasible(0);
+
+    ParallelFor::run(candidates.size(), threads, [&](const std::size_t begin, const std::size_t end, unsigned) {
+        std::vector<CompressedAirSystemSimulation::CompressorUnit> ordered;
+        for (std::size_t c = begin; c < end; c++) {
+            auto &candidate = candidates[c];
+            ordered.clear();
+            int trimPosition = -1;
+            for (std::size_t i = 0; i < units; i++) {
+                ordered.push_back(inputs.compressors[candidate.loadingOrder[i]]);
+                if (static_cast<int>(candidate.loadingOrder[i]) == candidate.trimCompressor) {
+                    trimPosition = static_cast<int>(i);
+                }
+            }
+
+            // the wider the band, the higher the average pressure above the load pressure
+            const double pressureFactor = 1 + 0.005 * candidate.pressureBand / 2;
+            candidate.storageCost = candidate.storageAddition * inputs.storageCost;
+            const double energyLimit = inputs.electricityCost > 0
+                                       ? (threshold.load() - candidate.storageCost)
+                                         / (inputs.electricityCost * pressureFactor)
+                                       : std::numeric_limits<double>::infinity();
+
+            const CompressedAirSystemSimulation system(ordered,
+                                                       inputs.storageCapacity + candidate.storageAddition / 7.48,
+                                                       candidate.pressureBand, inputs.timeStep, trimPosition);
+            auto simulation = system.simulate(inputs.demand.size(), inputs.demand.data(), nullptr, nullptr,
+                                              energyLimit);
+            if (simulation.steps < inputs.demand.size()) {
+                pruned++;
+                continue;
+            }
+            if (simulation.unmetDemand > 0) {
+                infeasible++;
+                continue;
+            }
+
+            // back to inventory order
+            candidate.simulation = simulation;
+            for (std::size_t i = 0; i < units; i++) {
+                candidate.simulation.compressors[candidate.loadingOrder[i]] = simulation.compressors[i];
+            }
+            candidate.energy = simulation.energy * pressureFactor;
+            candidate.energyCost = candidate.energy * inputs.electricityCost;
+            candidate.totalCost = candidate.energyCost + candidate.storageCost;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            auto const position = std::lower_bound(ranked.begin(), ranked.end(), c, [&](std::size_t a, std::size_t b) {
+                if (candidates[a].totalCost != candidates[b].totalCost) {
+                    return candidates[a].totalCost < candidates[b].totalCost;
+                }
+                return a < b;
+            });
+            ranked.insert(position, c);
+            if (ranked.size() > strategies) ranked.pop_back();
+            if (ranked.size() == strategies) threshold.store(candidates[ranked.back()].totalCost);
+        }
+    });
+
+    results.pruned = pruned.load();
+    results.infeasible = infeasible.load();
+    for (auto const c : ranked) results.strategies.push_back(candidates[c]);
+    return results;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file
+ * @brief Contains the implementation of the compressed air system simulation.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include "calculator/util/CompressedAir.h"
+#include "calculator/util/CompressedAirSystemSimulation.h"
+
+CompressedAirSystemSimulation::CompressorUnit::CompressorUnit(const CompressedAirCentrifugalBase::ControlType controlType,
+                                                              const double fullLoadCapacity,
+                                                              std::function<double(double)> power)
+        : controlType(controlType), fullLoadCapacity(fullLoadCapacity), power(std::move(power))
+{
+    if (!(fullLoadCapacity > 0)) {
+        throw std::runtime_error("CompressedAirSystemSimulation: the full load capacity of a compressor must be positive");
+    }
+    fullLoadPower = this->power(1);
+}
+
+CompressedAirSystemSimulation::CompressorUnit
+CompressedAirSystemSimulation::CompressorUnit::loadUnload(const double kW_fl, const double C_fl, const double kW_nl) {
+    // the models are built for each call, as CompressedAirCentrifugalMap does, since their methods are not const
+    return CompressorUnit(CompressedAirCentrifugalBase::LoadUnload, C_fl, [kW_fl, C_fl, kW_nl](const double CPer) {
+        return CompressedAirCentrifugal_LoadUnload(kW_fl, C_fl, kW_nl).calculateFromPerC(CPer).kW_Calc;
+    });
+}
+
+CompressedAirSystemSimulation::CompressorUnit
+CompressedAirSystemSimulation::CompressorUnit::modulationUnload(const double kW_fl, const double C_fl,
+                                                                const double kW_nl, const double C_max,
+                                                                const double kW_ul, const double C_ul) {
+    return CompressorUnit(CompressedAirCentrifugalBase::ModulationUnload, C_fl,
+                          [kW_fl, C_fl, kW_nl, C_max, kW_ul, C_ul](const double CPer) {
+        return CompressedAirCentrifugal_ModulationUnload(kW_fl, C_fl, kW_nl, C_max, kW_ul, C_ul)
+                .calculateFromPerC(CPer).kW_Calc;
+    });
+}
+
+CompressedAirSystemSimulation::CompressorUnit
+CompressedAirSystemSimulation::CompressorUnit::blowOff(const double kW_fl, const double C_fl, const double kW_blow,
+                                                       const double C_blow) {
+    return CompressorUnit(CompressedAirCentrifugalBase::BlowOff, C_fl,
+                          [kW_fl, C_fl, kW_blow, C_blow](const double CPer) {
+        return CompressedAirCentrifugal_BlowOff(kW_fl, C_fl, kW_blow, C_blow).calculateFromPerC_BlowOff(CPer).kW_Calc;
+    });
+}
+
+CompressedAirSystemSimulation::CompressorUnit
+CompressedAirSystemSimulation::CompressorUnit::centrifugal(const CompressedAirCentrifugalMap &map, const double P_fl) {
+    return CompressorUnit(map.getControlType(), map.getFullLoadCapacity(P_fl), [map, P_fl](const double CPer) {
+        return map.calculateFromPerC(P_fl, CPer).kW_Calc;
+    });
+}
+
+CompressedAirSystemSimulation::CompressedAirSystemSimulation(std::vector<CompressorUnit> compressors,
+                                                             const double storageCapacity, const double pressureBand,
+                                                             const double timeStep, const int trimCompressor)
+        : compressors(std::move(compressors)), timeStep(timeStep), trimCompressor(trimCompressor)
+{
+    if (!(timeStep > 0)) {
+        throw std::runtime_error("CompressedAirSystemSimulation: the time step must be positive");
+    }
+    if (!(storageCapacity >= 0) || !(pressureBand >= 0)) {
+        throw std::runtime_error("CompressedAirSystemSimulation: the storage capacity and pressure band must not be negative");
+    }
+    if (trimCompressor < -1 || trimCompressor >= static_cast<int>(this->compressors.size())) {
+        throw std::runtime_error("CompressedAirSystemSimulation: the trim compressor is not in the inventory");
+    }
+    // free air released by the storage between the unload and load pressures
+    usableStorage = ReceiverTank::calculateUsableCapacity(storageCapacity * 7.48, pressureBand, 0);
+    for (auto const &compressor : this->compressors) totalCapacity += compressor.getFullLoadCapacity();
+}
+
+CompressedAirSystemSimulation::Results
+CompressedAirSystemSimulation::simulate(const std::size_t count, const double *demand, LoadState *states,
+                                        double *power, const double energyLimit) const {
+    const std::size_t units = compressors.size();
+    const double minutes = timeStep * 60;
+
+    Results results;
+    results.compressors.resize(units);
+    std::vector<double> flows(units);
+    double stored = usableStorage;
+
+    std::size_t step = 0;
+    while (step < count && !(results.energy > energyLimit)) {
+        const double required = demand[step];
+        if (!(required >= 0)) {
+            throw std::runtime_error("CompressedAirSystemSimulation: the air demand must not be negative");
+        }
+
+        // the compressors recharge the storage within the step when they have the capacity to spare
+        double remaining = std::min(required + (usableStorage - stored) / minutes, totalCapacity);
+        stored += (remaining - required) * minutes;
+        if (stored < 0) {
+            results.unmetDemand -= stored;
+            stored = 0;
+        }
+        results.airDemand += required * minutes;
+
+        if (trimCompressor < 0) {
+            for (std::size_t i = 0; i < units; i++) {
+                flows[i] = std::min(remaining, compressors[i].getFullLoadCapacity());
+                remaining -= flows[i];
+            }
+        } else {
+            // base compressors load in order until the trim compressor can take what is left; a base compressor that
+            // cannot run at full load supplies only the demand above the trim capacity, so the trim compressor never
+            // sits off behind a base compressor
+            const double trimCapacity = compressors[trimCompressor].getFullLoadCapacity();
+            for (std::size_t i = 0; i < units; i++) {
+                if (static_cast<int>(i) == trimCompressor) continue;
+                const double capacity = compressors[i].getFullLoadCapacity();
+                flows[i] = remaining <= trimCapacity ? 0 : remaining >= capacity ? capacity : remaining - trimCapacity;
+                remaining -= flows[i];
+            }
+            flows[trimCompressor] = std::min(remaining, trimCapacity);
+        }
+
+        double systemPower = 0;
+        for (std::size_t i = 0; i < units; i++) {
+            auto const &compressor = compressors[i];
+            auto &unitResults = results.compressors[i];
+            const double capacity = compressor.getFullLoadCapacity();
+            const double flow = flows[i];
+
+            LoadState state;
+            double unitPower = 0;
+            if (flow >= capacity) {
+                state = LoadState::FULL_LOAD;
+                unitPower = compressor.getFullLoadPower();
+                unitResults.fullLoadHours += timeStep;
+            } else if (flow > 0) {
+                state = LoadState::PART_LOAD;
+                unitPower = compressor.getPower(flow / capacity);
+                unitResults.partLoadHours += timeStep;
+                if (compressor.getControlType() == CompressedAirCentrifugalBase::LoadUnload && usableStorage > 0) {
+                    // loaded for usableStorage / (capacity - flow) and unloaded for usableStorage / flow
+                    unitResults.loadUnloadCycles += minutes * flow * (capacity - flow) / (usableStorage * capacity);
+                }
+            } else {
+                state = LoadState::OFF;
+                unitResults.offHours += timeStep;
+            }
+
+            unitResults.airDelivered += flow * minutes;
+            unitResults.energy += unitPower * timeStep;
+            unitResults.peakPower = std::max(unitResults.peakPower, unitPower);
+            systemPower += unitPower;
+            if (states != nullptr) states[step * units + i] = state;
+            if (power != nullptr) power[step * units + i] = unitPower;
+        }
+
+        results.energy += systemPower * timeStep;
+        results.peakPower = std::max(results.peakPower, systemPower);
+        step++;
+    }
+
+    results.steps = step;
+    results.hours = step * timeStep;
+    return results;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file
+ * @brief Contains the implementation of the decibels method leak rate grid.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "calculator/util/DecibelsLeakRateGrid.h"
+#include "calculator/util/CompressedAirLeakSurvey.h"
+
+namespace {
+    // bins of the axis index; a table with closer points than its range allows scans a few points per lookup
+    const std::size_t MAX_BINS = 4096;
+}
+
+DecibelsLeakRateGrid::Axis::Axis(std::vector<double> points) : points(std::move(points)) {
+    const std::size_t size = this->points.size();
+    if (size < 2) {
+        throw std::runtime_error("DecibelsLeakRateGrid: each axis of the table needs at least two points");
+    }
+    double spacing = this->points[1] - this->points[0];
+    for (std::size_t i = 0; i + 1 < size; i++) {
+        const double step = this->points[i + 1] - this->points[i];
+        if (!(step > 0) || !std::isfinite(step)) {
+            throw std::runtime_error("DecibelsLeakRateGrid: the points of each axis of the table must increase");
+        }
+        spacing = std::min(spacing, step);
+    }
+
+    // bins no wider than the closest points, so a bin overlaps at most two cells
+    const double range = this->points.back() - this->points.front();
+    const auto binCount = static_cast<std::size_t>(std::min(std::ceil(range / spacing), static_cast<double>(MAX_BINS)));
+    binWidth = range / binCount;
+    bins.resize(binCount);
+    std::size_t cell = 0;
+    for (std::size_t bin = 0; bin < binCount; bin++) {
+        const double start = this->points.front() + bin * binWidth;
+        while (cell + 2 < size && this->points[cell + 1] <= start) cell++;
+        bins[bin] = cell;
+    }
+}
+
+std::size_t DecibelsLeakRateGrid::Axis::findCell(const double value) const {
+    if (!(value > points.front())) return 0;
+    if (value >= points.back()) return points.size() - 2;
+
+    const auto bin = std::min(static_cast<std::size_t>((value - points.front()) / binWidth), bins.size() - 1);
+    std::size_t cell = bins[bin];
+    while (cell + 2 < points.size() && value >= points[cell + 1]) cell++;
+    while (cell > 0 && value < points[cell]) cell--;
+    return cell;
+}
+
+DecibelsLeakRateGrid::DecibelsLeakRateGrid(std::vector<double> pressures, std::vector<double> decibelRatings,
+                                           std::vector<double> leakRates)
+        : pressures(std::move(pressures)), decibelRatings(std::move(decibelRatings)), leakRates(std::move(leakRates))
+{
+    if (this->leakRates.size() != this->pressures.getPoints().size() * this->decibelRatings.getPoints().size()) {
+        throw std::runtime_error("DecibelsLeakRateGrid: the table needs a leak rate at each decibel rating and pressure");
+    }
+}
+
+double DecibelsLeakRateGrid::interpolate(const double linePressure, const double decibels, const double decibelRatingA,
+                                         const double pressureA, const double firstFlowA, const double secondFlowA,
+                                         const double decibelRatingB, const double pressureB, const double firstFlowB,
+                                         const double secondFlowB) {
+    const double denominator = (pressureB - pressureA) * (decibelRatingB - decibelRatingA);
+    return ((pressureB - linePressure) * (decibelRatingB - decibels)) / denominator * firstFlowA
+           + ((linePressure - pressureA) * (decibelRatingB - decibels)) / denominator * secondFlowA
+           + ((pressureB - linePressure) * (decibels - decibelRatingA)) / denominator * firstFlowB
+           + ((linePressure - pressureA) * (decibels - decibelRatingA)) / denominator * secondFlowB;
+}
+
+double DecibelsLeakRateGrid::interpolateCell(const std::size_t pressureCell, const std::size_t decibelCell,
+                                             const double linePressure, const double decibels) const {
+    auto const &x = pressures.getPoints();
+    auto const &y = decibelRatings.getPoints();
+    const double *rowA = leakRates.data() + decibelCell * x.size();
+    const double *rowB = rowA + x.size();
+    return interpolate(linePressure, decibels, y[decibelCell], x[pressureCell], rowA[pressureCell],
+                       rowA[pressureCell + 1], y[decibelCell + 1], x[pressureCell + 1], rowB[pressureCell],
+                       rowB[pressureCell + 1]);
+}
+
+double DecibelsLeakRateGrid::calculate(const double linePressure, const double decibels) const {
+    return interpolateCell(pressures.findCell(linePressure), decibelRatings.findCell(decibels), linePressure, decibels);
+}
+
+void DecibelsLeakRateGrid::calculate(const std::size_t count, const double *linePressures, const double *decibels,
+                                     double *leakRates) const {
+    for (std::size_t i = 0; i < count; i++) {
+        leakRates[i] = interpolateCell(pressures.findCell(linePressures[i]), decibelRatings.findCell(decibels[i]),
+                                       linePressures[i], decibels[i]);
+    }
+}
+
+DecibelsMethodData DecibelsLeakRateGrid::getReferencePoints(const double linePressure, const double decibels) const {
+    auto const &x = pressures.getPoints();
+    auto const &y = decibelRatings.getPoints();
+    const std::size_t i = pressures.findCell(linePressure), j = decibelRatings.findCell(decibels);
+    const double *rowA = leakRates.data() + j * x.size();
+    const double *rowB = rowA + x.size();
+    return {linePressure, decibels, y[j], x[i], rowA[i], rowA[i + 1], y[j + 1], x[i + 1], rowB[i], rowB[i + 1]};
+}
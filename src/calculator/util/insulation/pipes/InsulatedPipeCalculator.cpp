@@ -1,5 +1,6 @@
 #include "calculator/util/insulation/pipes/InsulatedPipeCalculator.h"
 #include "calculator/util/insulation/objects/AirProperties.h"
+#include "calculator/util/SolverStatistics.h"
 #include <cmath>
 #include <vector>
 #include <string>
@@ -59,13 +60,16 @@ InsulatedPipeOutput InsulatedPipeCalculator::calculateInsulation(InsulatedPipeIn
     interfaceTemperature = input.getPipeTemperature() - 1.0;
 
     //start iteration
+    AMO_SOLVER_SCOPE(solverScope, Solver::INSULATED_PIPE);
     heatLength = InsulatedPipeCalculator::insulationRecursive(input, innerPipeDiameter, outerInsulationDiameter, surfaceTemperature, interfaceTemperature, 0, 0);
+    AMO_SOLVER_CONVERGED(solverScope);
     annualHeatLoss = heatLength * input.getPipeLength() * input.getOperatingHours() / input.getSystemEfficiency();
     return InsulatedPipeOutput(heatLength, annualHeatLoss);
 }
 
 double InsulatedPipeCalculator::insulationRecursive(InsulatedPipeInput input, double innerPipeDiameter, double insulationOuterDiameter, double surfaceTemperature, double interfaceTemperature, double heatLength, int i)
 {
+    AMO_SOLVER_ITERATION(Solver::INSULATED_PIPE);
     double filmTemperature;
     filmTemperature = (surfaceTemperature + input.getAmbientTemperature()) / 2.0;
 
@@ -129,13 +133,16 @@ InsulatedPipeOutput InsulatedPipeCalculator::calculateNoInsulation(InsulatedPipe
     interfaceTemperature = input.getPipeTemperature() - 1.0;
 
     //start iteration
+    AMO_SOLVER_SCOPE(solverScope, Solver::INSULATED_PIPE);
     heatLength = InsulatedPipeCalculator::noInsulationRecursive(input, innerPipeDiameter, insulationOuterDiameter, surfaceTemperature, interfaceTemperature, 0.0, 0);
+    AMO_SOLVER_CONVERGED(solverScope);
     annualHeatLoss = heatLength * input.getPipeLength() * input.getOperatingHours() / input.getSystemEfficiency();
     return InsulatedPipeOutput(heatLength, annualHeatLoss);
 }
 
 double InsulatedPipeCalculator::noInsulationRecursive(InsulatedPipeInput input, double innerPipeDiameter, double insulationOuterDiameter, double surfaceTemperature, double interfaceTemperature, double heatLength, int i)
 {
+    AMO_SOLVER_ITERATION(Solver::INSULATED_PIPE);
     double filmTemperature;
     filmTemperature = (surfaceTemperature + input.getAmbientTemperature()) / 2.0;
     //step 1: establish air properties
@@ -0,0 +1,190 @@
+/**
+ * @file
+ * @brief Contains the implementation of the chiller plant model.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include "chillers/ChillerPlant.h"
+#include "calculator/util/ParallelFor.h"
+
+namespace {
+    const double BTU_PER_TON_HOUR = 12000;
+    const double BTU_PER_KWH = 3412.14;
+}
+
+ChillerPlant::Chiller::Chiller(const double capacity, const double fullLoadEfficiency, CurveFitVal partLoadCurve,
+                               CurveFitVal condenserWaterCurve, const double condenserWaterFlow,
+                               const double chilledWaterPumpPower, const double condenserWaterPumpPower)
+        : capacity(capacity), fullLoadEfficiency(fullLoadEfficiency), partLoadCurve(std::move(partLoadCurve)),
+          condenserWaterCurve(std::move(condenserWaterCurve)), condenserWaterFlow(condenserWaterFlow),
+          chilledWaterPumpPower(chilledWaterPumpPower), condenserWaterPumpPower(condenserWaterPumpPower)
+{
+    if (!(capacity > 0) || !(fullLoadEfficiency > 0)) {
+        throw std::runtime_error("ChillerPlant: the capacity and full load efficiency of a chiller must be positive");
+    }
+    if (condenserWaterFlow < 0 || chilledWaterPumpPower < 0 || condenserWaterPumpPower < 0) {
+        throw std::runtime_error("ChillerPlant: the condenser water flow and pump power of a chiller must not be negative");
+    }
+}
+
+ChillerPlant::ChillerPlant(std::vector<Chiller> chillers, CoolingTower coolingTower, const Staging staging,
+                           const double maxPartLoadRatio)
+        : chillers(std::move(chillers)), coolingTower(std::move(coolingTower)), staging(staging),
+          maxPartLoadRatio(maxPartLoadRatio)
+{
+    if (this->chillers.empty()) {
+        throw std::runtime_error("ChillerPlant: the plant needs at least one chiller");
+    }
+    if (!(maxPartLoadRatio > 0) || maxPartLoadRatio > 1) {
+        throw std::runtime_error("ChillerPlant: the maximum part load ratio must be above 0 and at most 1");
+    }
+    if (!(this->coolingTower.approach > 0) || this->coolingTower.fanPower < 0) {
+        throw std::runtime_error("ChillerPlant: the tower approach must be positive and its fan power not negative");
+    }
+    if (this->coolingTower.waterConservationData.getCyclesOfConcentration() < 2) {
+        throw std::runtime_error("ChillerPlant: the cycles of concentration must be above 1");
+    }
+
+    stagedCapacity.assign(1, 0);
+    stagedCondenserWaterFlow.assign(1, 0);
+    stagedPumpPower.assign(1, 0);
+    for (auto const &chiller : this->chillers) {
+        stagedCapacity.push_back(stagedCapacity.back() + chiller.getCapacity());
+        stagedCondenserWaterFlow.push_back(stagedCondenserWaterFlow.back() + chiller.getCondenserWaterFlow());
+        stagedPumpPower.push_back(stagedPumpPower.back() + chiller.getPumpPower());
+        designHeatRejection += chiller.getCapacity() * (BTU_PER_TON_HOUR + chiller.getFullLoadEfficiency() * BTU_PER_KWH);
+    }
+}
+
+double ChillerPlant::getCondenserWaterTemperature(const double wetBulbTemperature) const {
+    const double setpoint = coolingTower.condenserWaterReset ? coolingTower.minimumCondenserWaterTemperature
+                                                             : coolingTower.condenserWaterSetpoint;
+    return std::max(setpoint, wetBulbTemperature + coolingTower.approach);
+}
+
+void ChillerPlant::calculatePower(const int chillersRunning, const double coolingLoad,
+                                  const double condenserWaterTemperature, const double wetBulbTemperature,
+                                  HourResults &hour) const {
+    const double capacity = stagedCapacity[chillersRunning];
+    const double served = std::min(coolingLoad, capacity);
+
+    hour.chillersRunning = chillersRunning;
+    hour.partLoadRatio = served / capacity;
+    hour.condenserWaterTemperature = condenserWaterTemperature;
+    hour.chillerPower = 0;
+    for (int i = 0; i < chillersRunning; i++) {
+        hour.chillerPower += chillers[i].getPower(hour.partLoadRatio, condenserWaterTemperature);
+    }
+    hour.pumpPower = stagedPumpPower[chillersRunning];
+
+    // fan airflow in proportion to the heat rejected and inversely to the approach the setpoint allows; the fan power
+    // follows the cube of the airflow
+    const double heatRejection = served * BTU_PER_TON_HOUR + hour.chillerPower * BTU_PER_KWH;
+    const double fanSpeed = std::min(1.0, heatRejection / designHeatRejection * coolingTower.approach
+                                          / (condenserWaterTemperature - wetBulbTemperature));
+    hour.towerFanPower = coolingTower.fanPower * fanSpeed * fanSpeed * fanSpeed;
+    hour.plantPower = hour.chillerPower + hour.pumpPower + hour.towerFanPower;
+    hour.unmetLoad = coolingLoad - served;
+}
+
+ChillerPlant::HourResults ChillerPlant::calculate(const double coolingLoad, const double wetBulbTemperature) const {
+    if (!(coolingLoad >= 0)) {
+        throw std::runtime_error("ChillerPlant: the cooling load must not be negative");
+    }
+    HourResults hour;
+    if (coolingLoad == 0) return hour;
+
+    const int allChillers = static_cast<int>(chillers.size());
+    int chillersRunning = 1;
+    while (chillersRunning < allChillers && stagedCapacity[chillersRunning] * maxPartLoadRatio < coolingLoad) {
+        chillersRunning++;
+    }
+
+    const double condenserWaterTemperature = getCondenserWaterTemperature(wetBulbTemperature);
+    calculatePower(chillersRunning, coolingLoad, condenserWaterTemperature, wetBulbTemperature, hour);
+    if (staging == Staging::LOWEST_POWER) {
+        HourResults more;
+        for (int i = chillersRunning + 1; i <= allChillers; i++) {
+            calculatePower(i, coolingLoad, condenserWaterTemperature, wetBulbTemperature, more);
+            if (more.plantPower < hour.plantPower) hour = more;
+        }
+    }
+
+    // the tower water over the hour
+    auto const &waterConservationData = coolingTower.waterConservationData;
+    const double heatRejection = (coolingLoad - hour.unmetLoad) * BTU_PER_TON_HOUR + hour.chillerPower * BTU_PER_KWH;
+    const double evaporationLoss = CoolingTowerMakeupWaterCalculator::calculateEvaporationLoss(
+            heatRejection / 1000000, coolingTower.lossCorrectionFactor);
+    hour.evaporation = evaporationLoss * 60;
+    hour.drift = CoolingTowerMakeupWaterCalculator::calculateDriftLoss(
+            stagedCondenserWaterFlow[hour.chillersRunning], waterConservationData.getDriftLossFactor()) * 60;
+    hour.blowDown = CoolingTowerMakeupWaterCalculator::calculateBlowDown(
+            evaporationLoss, waterConservationData.getCyclesOfConcentration()) * 60;
+    hour.makeupWater = hour.evaporation + hour.drift + hour.blowDown;
+    return hour;
+}
+
+ChillerPlant::Results ChillerPlant::simulate(const std::size_t count, const double *coolingLoad,
+                                             const double *wetBulbTemperature, HourResults *hours,
+                                             unsigned threads) const {
+    // the hours carry no state from one to the next, so each thread sums a block of hours
+    threads = ParallelFor::getThreadCount(threads, count);
+    std::vector<Results> blocks(threads);
+    ParallelFor::run(count, threads, [&](const std::size_t begin, const std::size_t end, const unsigned thread) {
+        Results &block = blocks[thread];
+        block.chillerRunHours.assign(chillers.size(), 0);
+        for (std::size_t i = begin; i < end; i++) {
+            const HourResults hour = calculate(coolingLoad[i], wetBulbTemperature[i]);
+            if (hours) hours[i] = hour;
+
+            block.operatingHours += hour.chillersRunning > 0;
+            for (int chiller = 0; chiller < hour.chillersRunning; chiller++) block.chillerRunHours[chiller]++;
+            block.coolingDelivered += coolingLoad[i] - hour.unmetLoad;
+            block.unmetLoad += hour.unmetLoad;
+            block.chillerEnergy += hour.chillerPower;
+            block.pumpEnergy += hour.pumpPower;
+            block.towerFanEnergy += hour.towerFanPower;
+            block.energy += hour.plantPower;
+            block.peakPower = std::max(block.peakPower, hour.plantPower);
+            block.evaporation += hour.evaporation;
+            block.drift += hour.drift;
+            block.blowDown += hour.blowDown;
+            block.makeupWater += hour.makeupWater;
+        }
+    });
+
+    Results results;
+    results.chillerRunHours.assign(chillers.size(), 0);
+    results.hours = count;
+    for (auto const &block : blocks) {
+        for (std::size_t chiller = 0; chiller < chillers.size(); chiller++) {
+            results.chillerRunHours[chiller] += block.chillerRunHours[chiller];
+        }
+        results.operatingHours += block.operatingHours;
+        results.coolingDelivered += block.coolingDelivered;
+        results.unmetLoad += block.unmetLoad;
+        results.chillerEnergy += block.chillerEnergy;
+        results.pumpEnergy += block.pumpEnergy;
+        results.towerFanEnergy += block.towerFanEnergy;
+        results.energy += block.energy;
+        results.peakPower = std::max(results.peakPower, block.peakPower);
+        results.evaporation += block.evaporation;
+        results.drift += block.drift;
+        results.blowDown += block.blowDown;
+        results.makeupWater += block.makeupWater;
+    }
+    results.efficiency = results.coolingDelivered > 0 ? results.energy / results.coolingDelivered : 0;
+    return results;
+}
+
+ChillerPlant::Results ChillerPlant::simulate(const std::vector<double> &coolingLoad,
+                                             const std::vector<double> &wetBulbTemperature) const {
+    if (coolingLoad.size() != wetBulbTemperature.size()) {
+        throw std::runtime_error("ChillerPlant: the cooling load and wet bulb temperature series must have the same number of hours");
+    }
+    return simulate(coolingLoad.size(), coolingLoad.data(), wetBulbTemperature.data());
+}
@@ -1,5 +1,7 @@
 #include <iostream>
 #include <cmath>
+#include <algorithm>
+#include <stdexcept>
 #include "chillers/CoolingTower.h"
 #include <fstream>
 
@@ -10,11 +12,11 @@ CoolingTowerMakeupWaterCalculator::Output CoolingTowerMakeupWaterCalculator::cal
     {
         double evaporationLoss, driftLoss, blowDown, waterConsumption;
 
-        evaporationLoss = operatingConditionsData.getLossCorrectionFactor() * 0.01 * operatingConditionsData.getCoolingLoad() * 1000000 / (500 * 10); // 0.01 = evaporation loss for ideal case
+        evaporationLoss = calculateEvaporationLoss(operatingConditionsData.getCoolingLoad(), operatingConditionsData.getLossCorrectionFactor());
         
-        driftLoss = waterConservationData.getDriftLossFactor() * operatingConditionsData.getFlowRate();
+        driftLoss = calculateDriftLoss(operatingConditionsData.getFlowRate(), waterConservationData.getDriftLossFactor());
         
-        blowDown = evaporationLoss / (waterConservationData.getCyclesOfConcentration() - 1);
+        blowDown = calculateBlowDown(evaporationLoss, waterConservationData.getCyclesOfConcentration());
         
         waterConsumption = (evaporationLoss + driftLoss + blowDown) * operatingConditionsData.getOperationalHours() * 60;
         
@@ -68,4 +70,166 @@ void CoolingTowerMakeupWaterCalculator::setWaterConservationBaselineData(Cooling
 void CoolingTowerMakeupWaterCalculator::setWaterConservationModificationData(CoolingTowerWaterConservationData waterConservationModificationData)
 {
     this->waterConservationModificationData = waterConservationModificationData;
-}
\ No newline at end of file
+}
+
+namespace
+{
+    double interpolate(const CoolingTowerHourlySimulation::EvaporationCurve &curve, const double dryBulbTemperature)
+    {
+        auto const &x = curve.dryBulbTemperature;
+        auto const &y = curve.lossCorrectionFactor;
+        if (dryBulbTemperature <= x.front()) return y.front();
+        if (dryBulbTemperature >= x.back()) return y.back();
+        const std::size_t i = std::upper_bound(x.begin(), x.end(), dryBulbTemperature) - x.begin();
+        return y[i - 1] + (y[i] - y[i - 1]) * (dryBulbTemperature - x[i - 1]) / (x[i] - x[i - 1]);
+    }
+
+    void validate(const CoolingTowerWaterConservationData &waterConservationData)
+    {
+        if (waterConservationData.getCyclesOfConcentration() < 2)
+        {
+            throw std::runtime_error("CoolingTowerHourlySimulation: cycles of concentration must be above 1");
+        }
+    }
+}
+
+CoolingTowerHourlySimulation::CoolingTowerHourlySimulation(const double flowRate, const std::vector<double> &coolingLoad,
+                                                           const double lossCorrectionFactor)
+        : flowRate(flowRate)
+{
+    setFlowRates(coolingLoad);
+    evaporationLoss.resize(coolingLoad.size());
+    for (std::size_t hour = 0; hour < coolingLoad.size(); hour++)
+    {
+        evaporationLoss[hour] = CoolingTowerMakeupWaterCalculator::calculateEvaporationLoss(coolingLoad[hour], lossCorrectionFactor);
+    }
+    setTotals();
+}
+
+CoolingTowerHourlySimulation::CoolingTowerHourlySimulation(const double flowRate, const std::vector<double> &coolingLoad,
+                                                           const std::vector<double> &dryBulbTemperature,
+                                                           const EvaporationCurve &evaporationCurve)
+        : flowRate(flowRate)
+{
+    if (dryBulbTemperature.size() != coolingLoad.size())
+    {
+        throw std::runtime_error("CoolingTowerHourlySimulation: the dry bulb temperature and cooling load series must have the same number of hours");
+    }
+    auto const &x = evaporationCurve.dryBulbTemperature;
+    if (x.empty() || x.size() != evaporationCurve.lossCorrectionFactor.size())
+    {
+        throw std::runtime_error("CoolingTowerHourlySimulation: the evaporation curve needs a correction factor for each of its dry bulb temperatures");
+    }
+    for (std::size_t i = 1; i < x.size(); i++)
+    {
+        if (!(x[i - 1] < x[i]))
+        {
+            throw std::runtime_error("CoolingTowerHourlySimulation: the dry bulb temperatures of the evaporation curve must be increasing");
+        }
+    }
+
+    setFlowRates(coolingLoad);
+    evaporationLoss.resize(coolingLoad.size());
+    for (std::size_t hour = 0; hour < coolingLoad.size(); hour++)
+    {
+        evaporationLoss[hour] = CoolingTowerMakeupWaterCalculator::calculateEvaporationLoss(
+                coolingLoad[hour], interpolate(evaporationCurve, dryBulbTemperature[hour]));
+    }
+    setTotals();
+}
+
+void CoolingTowerHourlySimulation::setFlowRates(const std::vector<double> &coolingLoad)
+{
+    if (!(flowRate >= 0))
+    {
+        throw std::runtime_error("CoolingTowerHourlySimulation: the flow rate must not be negative");
+    }
+    flowRates.resize(coolingLoad.size());
+    operationalHours = 0;
+    for (std::size_t hour = 0; hour < coolingLoad.size(); hour++)
+    {
+        if (!(coolingLoad[hour] >= 0))
+        {
+            throw std::runtime_error("CoolingTowerHourlySimulation: the cooling load must not be negative");
+        }
+        const bool operating = coolingLoad[hour] > 0;
+        flowRates[hour] = operating ? flowRate : 0;
+        operationalHours += operating;
+    }
+}
+
+void CoolingTowerHourlySimulation::setTotals()
+{
+    double evaporation = 0, circulation = 0;
+    for (std::size_t hour = 0; hour < evaporationLoss.size(); hour++)
+    {
+        evaporation += evaporationLoss[hour];
+        circulation += flowRates[hour];
+    }
+    totalEvaporation = evaporation * 60;
+    totalCirculation = circulation * 60;
+}
+
+CoolingTowerHourlySimulation::Output
+CoolingTowerHourlySimulation::calculate(const CoolingTowerWaterConservationData &waterConservationData) const
+{
+    validate(waterConservationData);
+    const double driftLossFactor = waterConservationData.getDriftLossFactor();
+    const int cyclesOfConcentration = waterConservationData.getCyclesOfConcentration();
+
+    const std::size_t hours = getHours();
+    Output output;
+    output.evaporation.resize(hours);
+    output.drift.resize(hours);
+    output.blowDown.resize(hours);
+    output.makeupWater.resize(hours);
+    for (std::size_t hour = 0; hour < hours; hour++)
+    {
+        const double evaporation = evaporationLoss[hour] * 60;
+        const double drift = CoolingTowerMakeupWaterCalculator::calculateDriftLoss(flowRates[hour], driftLossFactor) * 60;
+        const double blowDown = CoolingTowerMakeupWaterCalculator::calculateBlowDown(evaporationLoss[hour], cyclesOfConcentration) * 60;
+        output.evaporation[hour] = evaporation;
+        output.drift[hour] = drift;
+        output.blowDown[hour] = blowDown;
+        output.makeupWater[hour] = evaporation + drift + blowDown;
+    }
+    output.totals = calculateTotals(waterConservationData);
+    return output;
+}
+
+CoolingTowerHourlySimulation::Comparison
+CoolingTowerHourlySimulation::calculate(const CoolingTowerWaterConservationData &waterConservationBaselineData,
+                                        const CoolingTowerWaterConservationData &waterConservationModificationData) const
+{
+    Comparison comparison;
+    comparison.baseline = calculate(waterConservationBaselineData);
+    comparison.modification = calculate(waterConservationModificationData);
+    comparison.waterSavings = comparison.baseline.totals.makeupWater - comparison.modification.totals.makeupWater;
+    return comparison;
+}
+
+// drift and blowdown are linear in the circulation and the evaporation, so the totals of a scenario follow from the
+// totals of the series
+CoolingTowerHourlySimulation::Totals
+CoolingTowerHourlySimulation::calculateTotals(const CoolingTowerWaterConservationData &waterConservationData) const
+{
+    validate(waterConservationData);
+    Totals totals;
+    totals.evaporation = totalEvaporation;
+    totals.drift = CoolingTowerMakeupWaterCalculator::calculateDriftLoss(totalCirculation, waterConservationData.getDriftLossFactor());
+    totals.blowDown = CoolingTowerMakeupWaterCalculator::calculateBlowDown(totalEvaporation, waterConservationData.getCyclesOfConcentration());
+    totals.makeupWater = totals.evaporation + totals.drift + totals.blowDown;
+    return totals;
+}
+
+std::vector<CoolingTowerHourlySimulation::Totals>
+CoolingTowerHourlySimulation::calculateTotals(const std::vector<CoolingTowerWaterConservationData> &scenarios) const
+{
+    std::vector<Totals> totals;
+    totals.reserve(scenarios.size());
+    for (auto const &scenario : scenarios)
+    {
+        totals.push_back(calculateTotals(scenario));
+    }
+    return totals;
+}
@@ -1,4 +1,5 @@
 #include <fans/FanCurve.h>
+#include <calculator/util/SolverStatistics.h>
 #include <cmath>
 
 std::vector<ResultData> FanCurve::calculate() {
@@ -16,7 +17,9 @@ std::vector<ResultData> FanCurve::calculateBaseCurve() {
 	for (auto const & row : this->curveData.baseCurveData) {
 		double kp = 1, kpC = 1;
 		double estPt, estPtc;
+		AMO_SOLVER_SCOPE(solverScope, Solver::FAN_CURVE);
 		for (auto i = 0; i < 7; i++) {
+			AMO_SOLVER_ITERATION(Solver::FAN_CURVE);
 			auto saveKpOverKpc = kp / kpC;
 			auto const qC = row.flow * (this->speedCorrected / this->speed) * (kp / kpC); // eq 17
 
@@ -56,10 +59,12 @@ std::vector<ResultData> FanCurve::calculateBaseCurve() {
 			// see page 61 eq 38
 			if (fabs(saveKpOverKpc - kp / kpC) < 0.00001) {
 				results.emplace_back(ResultData(qC, pBoxC, hC, efficiency));
+				AMO_SOLVER_CONVERGED(solverScope);
 				break;
 			}
 			if (!row.flow) {
 				results.emplace_back(ResultData(0, pBoxC, hC, 0));
+				AMO_SOLVER_CONVERGED(solverScope);
 				break;
 			}
 		}
@@ -72,7 +77,9 @@ std::vector<ResultData> FanCurve::calculateRatedPoint() {
 	for (auto const & row : this->curveData.ratedPointData) {
 		double kp = 1, kpC = 1;
 		double estPt, estPtc;
+		AMO_SOLVER_SCOPE(solverScope, Solver::FAN_CURVE);
 		for (auto i = 0; i < 7; i++) {
+			AMO_SOLVER_ITERATION(Solver::FAN_CURVE);
 			auto saveKpOverKpc = kp / kpC;
 			auto const qC = row.flow * (row.speedCorrected / row.speed) * (kp / kpC); // eq 17
 
@@ -112,10 +119,12 @@ std::vector<ResultData> FanCurve::calculateRatedPoint() {
 			// see page 61 eq 38
 			if (fabs(saveKpOverKpc - kp / kpC) < 0.00001) {
 				results.emplace_back(ResultData(qC, pBoxC, hC, efficiency));
+				AMO_SOLVER_CONVERGED(solverScope);
 				break;
 			}
 			if (!row.flow) {
 				results.emplace_back(ResultData(0, pBoxC, hC, 0));
+				AMO_SOLVER_CONVERGED(solverScope);
 				break;
 			}
 		}
@@ -129,7 +138,9 @@ std::vector<ResultData> FanCurve::calculateBaseOperatingPoint() {
 	for (auto const & row : this->curveData.baseOperatingPointData) {
 		double kp = 1, kpC = 1;
 		double estPt, estPtc;
+		AMO_SOLVER_SCOPE(solverScope, Solver::FAN_CURVE);
 		for (auto i = 0; i < 7; i++) {
+			AMO_SOLVER_ITERATION(Solver::FAN_CURVE);
 			auto saveKpOverKpc = kp / kpC;
 			auto const qC = row.flow * (row.speedCorrected / row.speed) * (kp / kpC); // eq 17
 
@@ -169,10 +180,12 @@ std::vector<ResultData> FanCurve::calculateBaseOperatingPoint() {
 			// see page 61 eq 38
 			if (fabs(saveKpOverKpc - kp / kpC) < 0.00001) {
 				results.emplace_back(ResultData(qC, pBoxC, hC, efficiency));
+				AMO_SOLVER_CONVERGED(solverScope);
 				break;
 			}
 			if (!row.flow) {
 				results.emplace_back(ResultData(0, pBoxC, hC, 0));
+				AMO_SOLVER_CONVERGED(solverScope);
 				break;
 			}
 		}
@@ -1,4 +1,5 @@
 #include <ssmt/SteamSystemModelerTool.h>
+#include <calculator/util/SolverStatistics.h>
 #include <array>
 #include <cmath>
 #include <iostream>
@@ -128,6 +129,7 @@ SteamSystemModelerTool::SteamPropertiesOutput SteamSystemModelerTool::region2(co
 }
 
 SteamSystemModelerTool::SteamPropertiesOutput SteamSystemModelerTool::region3(const double t, const double p) {
+	AMO_SOLVER_SCOPE(solverScope, Solver::STEAM_REGION3);
 	auto boundary13Properties = region1(TEMPERATURE_Tp, p);
 	auto densityA = boundary13Properties.density;
 	auto region3propNew = region3Density( densityA, t);
@@ -141,6 +143,7 @@ SteamSystemModelerTool::SteamPropertiesOutput SteamSystemModelerTool::region3(co
 
 	double pressureNew = 0;
 	for (std::size_t i = 0; i < 4; i++) {
+		AMO_SOLVER_ITERATION(Solver::STEAM_REGION3);
 		auto const densityNew = (densityA + densityB) / 2.0;
 		region3propNew = region3Density(densityNew, t);
 		pressureNew = region3propNew.pressure;
@@ -157,6 +160,7 @@ SteamSystemModelerTool::SteamPropertiesOutput SteamSystemModelerTool::region3(co
 	// Uses Linear Interpolation
 	std::size_t counter = 0;
 	while ((fabs(pressureNew - p) > 1e-10) && (counter++ < 50) && (testPressureA != testPressureB)) {
+		AMO_SOLVER_ITERATION(Solver::STEAM_REGION3);
 		auto const densityNew = p * (densityA - densityB) / (testPressureA - testPressureB) + densityA - testPressureA * (densityA - densityB) / (testPressureA - testPressureB);
 		region3propNew = region3Density(densityNew, t);
 		pressureNew = region3propNew.pressure;
@@ -165,6 +169,8 @@ SteamSystemModelerTool::SteamPropertiesOutput SteamSystemModelerTool::region3(co
 		testPressureB = testPressureA;
 		testPressureA = pressureNew;
 	}
+	// the counter passes 50 only when the iteration limit ended the loop
+	if (counter <= 50) AMO_SOLVER_CONVERGED(solverScope);
 
 	return region3propNew;
 
@@ -223,6 +229,7 @@ SteamSystemModelerTool::SteamPropertiesOutput SteamSystemModelerTool::region3Den
 }
 
 double SteamSystemModelerTool::backwardRegion3Exact(const double pressure, const double X, SteamSystemModelerTool::Key key) {
+    AMO_SOLVER_SCOPE(solverScope, Solver::STEAM_BACKWARD_REGION3);
     double temperature = SteamSystemModelerTool::TEMPERATURE_Tp;
     Point pointA = SteamSystemModelerTool::generatePoint(1, key, pressure, temperature);
     Point pointB = SteamSystemModelerTool::generatePoint(2, key, pressure, SteamSystemModelerTool::boundaryByPressureRegion3to2(pressure));
@@ -230,11 +237,13 @@ double SteamSystemModelerTool::backwardRegion3Exact(const double pressure, const
     int counter = 0;
 
     while((fabs(temperature - temperatureB) > 1e-6) && (counter++ < 15)) {
+        AMO_SOLVER_ITERATION(Solver::STEAM_BACKWARD_REGION3);
         pointA = pointB;
         pointB = SteamSystemModelerTool::generatePoint(3, key, pressure, temperatureB);
         temperature = temperatureB;
         temperatureB = SteamSystemModelerTool::linearTestPoint(X, pointA, pointB);
     }
+    if (counter <= 15) AMO_SOLVER_CONVERGED(solverScope);
 
     return temperatureB;
 }
@@ -0,0 +1,230 @@
+#include "ssmt/api/SteamModelerOutputFlattener.h"
+
+namespace {
+    typedef SteamModelerOutputFlattener::Field Field;
+    typedef SteamSystemModelerTool::FluidProperties FluidProperties;
+    typedef SteamSystemModelerTool::SteamPropertiesOutput SteamPropertiesOutput;
+
+    /**
+     * Appends the fields of one output component; a null component adds its fields as not present.
+     * The field names and order follow bindings/steam/SteamModelerOutputDataMapper.h.
+     */
+    class FieldWriter {
+    public:
+        explicit FieldWriter(std::vector<Field> &fields) : fields(fields) {}
+
+        void add(const std::string &group, const std::string &name, const double *value) {
+            fields.push_back({group + "_" + name, value == nullptr ? 0 : *value, value != nullptr});
+        }
+
+        void addSteamProperties(const std::string &group, const std::string &prefix,
+                                const SteamPropertiesOutput *properties, const std::string &volumeName = "Volume") {
+            add(group, prefix + "Pressure", properties ? &properties->pressure : nullptr);
+            add(group, prefix + "Temperature", properties ? &properties->temperature : nullptr);
+            add(group, prefix + "SpecificEnthalpy", properties ? &properties->specificEnthalpy : nullptr);
+            add(group, prefix + "SpecificEntropy", properties ? &properties->specificEntropy : nullptr);
+            add(group, prefix + "Quality", properties ? &properties->quality : nullptr);
+            add(group, prefix + volumeName, properties ? &properties->specificVolume : nullptr);
+        }
+
+        void addFluidProperties(const std::string &group, const std::string &prefix,
+                                const FluidProperties *properties, const std::string &volumeName = "Volume") {
+            addSteamProperties(group, prefix, properties, volumeName);
+            add(group, prefix + "MassFlow", properties ? &properties->massFlow : nullptr);
+            add(group, prefix + "EnergyFlow", properties ? &properties->energyFlow : nullptr);
+        }
+
+        /**
+         * A component output that is a single FluidProperties, with lower case field names
+         */
+        void addFluid(const std::string &group, const FluidProperties *properties,
+                      const std::string &volumeName = "specificVolume") {
+            add(group, "pressure", properties ? &properties->pressure : nullptr);
+            add(group, "temperature", properties ? &properties->temperature : nullptr);
+            add(group, "specificEnthalpy", properties ? &properties->specificEnthalpy : nullptr);
+            add(group, "specificEntropy", properties ? &properties->specificEntropy : nullptr);
+            add(group, "quality", properties ? &properties->quality : nullptr);
+            add(group, volumeName, properties ? &properties->specificVolume : nullptr);
+            add(group, "massFlow", properties ? &properties->massFlow : nullptr);
+            add(group, "energyFlow", properties ? &properties->energyFlow : nullptr);
+        }
+
+        void addHeatLoss(const std::string &group, const HeatLoss *heatLoss) {
+            const double heatLossValue = heatLoss ? heatLoss->getHeatLoss() : 0;
+            add(group, "heatLoss", heatLoss ? &heatLossValue : nullptr);
+            addFluidProperties(group, "inlet", heatLoss ? &heatLoss->getInletProperties() : nullptr, "SpecificVolume");
+            addFluidProperties(group, "outlet", heatLoss ? &heatLoss->getOutletProperties() : nullptr,
+                               "SpecificVolume");
+        }
+
+        void addFlashTank(const std::string &group, const std::shared_ptr<FlashTank> &flashTank) {
+            const FlashTank *tank = flashTank.get();
+            addFluidProperties(group, "inletWater", tank ? &tank->getInletWaterProperties() : nullptr);
+            addFluidProperties(group, "outletGas", tank ? &tank->getOutletGasSaturatedProperties() : nullptr);
+            addFluidProperties(group, "outletLiquid", tank ? &tank->getOutletLiquidSaturatedProperties() : nullptr);
+        }
+
+        void addPrv(const std::string &group, const std::shared_ptr<PrvWithoutDesuperheating> &prvWithout) {
+            const PrvWithoutDesuperheating *prv = prvWithout.get();
+            addPrvFlow(group, "inlet", prv ? &prv->getInletProperties() : nullptr,
+                       prv ? prv->getInletMassFlow() : 0, prv ? prv->getInletEnergyFlow() : 0);
+            addPrvFlow(group, "outlet", prv ? &prv->getOutletProperties() : nullptr,
+                       prv ? prv->getOutletMassFlow() : 0, prv ? prv->getOutletEnergyFlow() : 0);
+
+            const PrvWithDesuperheating *prvWith = prv != nullptr && prv->isWithDesuperheating()
+                                                   ? static_cast<const PrvWithDesuperheating *>(prv) : nullptr;
+            addPrvFlow(group, "feedwater", prvWith ? &prvWith->getFeedwaterProperties() : nullptr,
+                       prvWith ? prvWith->getFeedwaterMassFlow() : 0, prvWith ? prvWith->getFeedwaterEnergyFlow() : 0);
+        }
+
+        void addTurbine(const std::string &group, const std::shared_ptr<Turbine> &turbinePtr) {
+            const Turbine *turbine = turbinePtr.get();
+            const SteamPropertiesOutput *inlet = turbine ? &turbine->getInletProperties() : nullptr;
+            const SteamPropertiesOutput *outlet = turbine ? &turbine->getOutletProperties() : nullptr;
+            const double energyOut = turbine ? turbine->getEnergyOut() : 0;
+            const double generatorEfficiency = turbine ? turbine->getGeneratorEfficiency() : 0;
+            const double inletEnergyFlow = turbine ? turbine->getInletEnergyFlow() : 0;
+            const double isentropicEfficiency = turbine ? turbine->getIsentropicEfficiency() : 0;
+            const double massFlow = turbine ? turbine->getMassFlow() : 0;
+            const double outletEnergyFlow = turbine ? turbine->getOutletEnergyFlow() : 0;
+            const double powerOut = turbine ? turbine->getPowerOut() : 0;
+
+            add(group, "energyOut", turbine ? &energyOut : nullptr);
+            add(group, "generatorEfficiency", turbine ? &generatorEfficiency : nullptr);
+            add(group, "inletEnergyFlow", turbine ? &inletEnergyFlow : nullptr);
+            add(group, "inletPressure", inlet ? &inlet->pressure : nullptr);
+            add(group, "inletQuality", inlet ? &inlet->quality : nullptr);
+            add(group, "inletVolume", inlet ? &inlet->specificVolume : nullptr);
+            add(group, "inletSpecificEnthalpy", inlet ? &inlet->specificEnthalpy : nullptr);
+            add(group, "inletSpecificEntropy", inlet ? &inlet->specificEntropy : nullptr);
+            add(group, "inletTemperature", inlet ? &inlet->temperature : nullptr);
+            add(group, "isentropicEfficiency", turbine ? &isentropicEfficiency : nullptr);
+            add(group, "massFlow", turbine ? &massFlow : nullptr);
+            add(group, "outletEnergyFlow", turbine ? &outletEnergyFlow : nullptr);
+            add(group, "outletPressure", outlet ? &outlet->pressure : nullptr);
+            add(group, "outletQuality", outlet ? &outlet->quality : nullptr);
+            add(group, "outletVolume", outlet ? &outlet->specificVolume : nullptr);
+            add(group, "outletSpecificEnthalpy", outlet ? &outlet->specificEnthalpy : nullptr);
+            add(group, "outletSpecificEntropy", outlet ? &outlet->specificEntropy : nullptr);
+            add(group, "outletTemperature", outlet ? &outlet->temperature : nullptr);
+            add(group, "powerOut", turbine ? &powerOut : nullptr);
+        }
+
+        void addProcessSteamUsage(const std::string &group, const ProcessSteamUsage *usage) {
+            add(group, "energyFlow", usage ? &usage->energyFlow : nullptr);
+            add(group, "massFlow", usage ? &usage->massFlow : nullptr);
+            add(group, "temperature", usage ? &usage->temperature : nullptr);
+            add(group, "pressure", usage ? &usage->pressure : nullptr);
+            add(group, "processUsage", usage ? &usage->processUsage : nullptr);
+        }
+
+    private:
+        void addPrvFlow(const std::string &group, const std::string &prefix, const SteamPropertiesOutput *properties,
+                        const double massFlow, const double energyFlow) {
+            addSteamProperties(group, prefix, properties);
+            add(group, prefix + "MassFlow", properties ? &massFlow : nullptr);
+            add(group, prefix + "EnergyFlow", properties ? &energyFlow : nullptr);
+        }
+
+        std::vector<Field> &fields;
+    };
+}
+
+std::vector<SteamModelerOutputFlattener::Field> SteamModelerOutputFlattener::flatten(const SteamModelerOutput &output) {
+    std::vector<Field> fields;
+    fields.reserve(536);
+    FieldWriter writer(fields);
+
+    const EnergyAndCostCalculationsDomain &energyDomain = output.energyAndCostCalculationsDomain;
+    const MakeupWaterAndCondensateHeaderCalculationsDomain &waterDomain =
+            output.makeupWaterAndCondensateHeaderCalculationsDomain;
+    const HighPressureHeaderCalculationsDomain &highDomain = output.highPressureHeaderCalculationsDomain;
+    const MediumPressureHeaderCalculationsDomain *mediumDomain = output.mediumPressureHeaderCalculationsDomain.get();
+    const LowPressureHeaderCalculationsDomain *lowDomain = output.lowPressureHeaderCalculationsDomain.get();
+    const ProcessSteamUsageCalculationsDomain &usageDomain = output.processSteamUsageCalculationsDomain;
+
+    const Boiler &boiler = output.boiler;
+    const double boilerEnergy = boiler.getBoilerEnergy();
+    const double fuelEnergy = boiler.getFuelEnergy();
+    const double blowdownRate = boiler.getBlowdownRate();
+    const double combustionEff = boiler.getCombustionEfficiency();
+    writer.addFluidProperties("boilerOutput", "steam", &boiler.getSteamProperties());
+    writer.addFluidProperties("boilerOutput", "blowdown", &boiler.getBlowdownProperties());
+    writer.addFluidProperties("boilerOutput", "feedwater", &boiler.getFeedwaterProperties());
+    writer.add("boilerOutput", "boilerEnergy", &boilerEnergy);
+    writer.add("boilerOutput", "fuelEnergy", &fuelEnergy);
+    writer.add("boilerOutput", "blowdownRate", &blowdownRate);
+    writer.add("boilerOutput", "combustionEff", &combustionEff);
+
+    writer.addFlashTank("blowdownFlashTankOutput", output.blowdownFlashTank);
+
+    writer.addHeatLoss("highPressureSteamHeatLossOutput", &highDomain.highPressureHeaderHeatLoss);
+    writer.addFluid("highPressureCondensateOutput", &highDomain.highPressureCondensate);
+    writer.addFluid("highPressureHeaderSteamOutput", &highDomain.highPressureHeaderOutput);
+    writer.addFluid("combinedCondensateOutput", &waterDomain.combinedCondensate, "volume");
+    writer.addFluid("returnCondensateOutput", &waterDomain.returnCondensate, "volume");
+    writer.addFlashTank("highPressureCondensateFlashTankOutput", highDomain.highPressureCondensateFlashTank);
+
+    writer.addTurbine("condensingTurbineOutput", highDomain.condensingTurbine);
+    writer.addTurbine("condensingTurbineIdealOutput", highDomain.condensingTurbineIdeal);
+    writer.addTurbine("highPressureToLowPressureTurbineOutput", highDomain.highToLowPressureTurbine);
+    writer.addTurbine("highPressureToLowPressureTurbineIdealOutput", highDomain.highToLowPressureTurbineIdeal);
+    writer.addTurbine("highPressureToMediumPressureTurbineOutput", highDomain.highToMediumPressureTurbine);
+    writer.addTurbine("highPressureToMediumPressureTurbineIdealOutput", highDomain.highToMediumPressureTurbineIdeal);
+
+    const std::shared_ptr<PrvWithoutDesuperheating> noPrv;
+    const std::shared_ptr<Turbine> noTurbine;
+    writer.addPrv("highPressureToMediumPressurePrvOutput", mediumDomain ? mediumDomain->highToMediumPressurePrv : noPrv);
+    writer.addFluid("mediumPressureHeaderSteamOutput", mediumDomain ? &mediumDomain->mediumPressureHeaderOutput : nullptr);
+    writer.addHeatLoss("mediumPressureSteamHeatLossOutput",
+                       mediumDomain ? &mediumDomain->mediumPressureHeaderHeatLoss : nullptr);
+    writer.addFluid("mediumPressureCondensateOutput", mediumDomain ? &mediumDomain->mediumPressureCondensate : nullptr);
+    writer.addFlashTank("mediumPressureCondensateFlashTankOutput",
+                        lowDomain ? lowDomain->lowPressureFlashedSteamIntoHeaderCalculatorDomain
+                                .mediumPressureCondensateFlashTank : std::shared_ptr<FlashTank>());
+    writer.addTurbine("mediumPressureToLowPressureTurbineOutput",
+                      mediumDomain ? mediumDomain->mediumToLowPressureTurbine : noTurbine);
+    writer.addTurbine("mediumPressureToLowPressureTurbineIdealOutput",
+                      mediumDomain ? mediumDomain->mediumToLowPressureTurbineIdeal : noTurbine);
+
+    writer.addPrv("mediumPressureToLowPressurePrvOutput", lowDomain ? lowDomain->lowPressurePrv : noPrv);
+    writer.addFluid("lowPressureHeaderSteamOutput", lowDomain ? &lowDomain->lowPressureHeaderOutput : nullptr);
+    writer.addHeatLoss("lowPressureSteamHeatLossOutput", lowDomain ? &lowDomain->lowPressureHeaderHeatLoss : nullptr);
+    writer.addFluid("lowPressureCondensateOutput", lowDomain ? &lowDomain->lowPressureCondensate : nullptr);
+
+    writer.addFlashTank("condensateFlashTankOutput",
+                        waterDomain.returnCondensateCalculationsDomain.condensateFlashTank);
+    writer.addFluid("makeupWaterOutput", &waterDomain.makeupWater);
+    const HeatExchanger::Output *heatExchanger = waterDomain.heatExchangerOutput.get();
+    writer.addFluid("heatExchangerColdOutletOutput", heatExchanger ? &heatExchanger->coldOutlet : nullptr);
+    writer.addFluid("heatExchangerHotOutletOutput", heatExchanger ? &heatExchanger->hotOutlet : nullptr);
+    writer.addFluid("makeupWaterAndCondensateOutput", &waterDomain.makeupWaterAndCondensateHeaderOutput);
+
+    const Deaerator &deaerator = output.deaerator;
+    writer.addFluidProperties("deaeratorOutput", "feedwater", &deaerator.getFeedwaterProperties());
+    writer.addFluidProperties("deaeratorOutput", "inletSteam", &deaerator.getInletSteamProperties());
+    writer.addFluidProperties("deaeratorOutput", "inletWater", &deaerator.getInletWaterProperties());
+    writer.addFluidProperties("deaeratorOutput", "ventedSteam", &deaerator.getVentedSteamProperties());
+
+    writer.addFluid("lowPressureVentedSteamOutput",
+                    output.powerBalanceCheckerCalculationsDomain.lowPressureVentedSteam.get());
+
+    writer.addProcessSteamUsage("highPressureProcessSteamUsageOutput", &usageDomain.highPressureProcessSteamUsage);
+    writer.addProcessSteamUsage("mediumPressureProcessSteamUsageOutput",
+                                usageDomain.mediumPressureProcessUsagePtr.get());
+    writer.addProcessSteamUsage("lowPressureProcessSteamUsageOutput", usageDomain.lowPressureProcessUsagePtr.get());
+
+    const MakeupWaterVolumeFlowCalculationsDomain &volumeDomain = waterDomain.makeupWaterVolumeFlowCalculationsDomain;
+    writer.add("operationsOutput", "powerGenerated", &energyDomain.powerGenerated);
+    writer.add("operationsOutput", "boilerFuelCost", &energyDomain.boilerFuelCost);
+    writer.add("operationsOutput", "makeupWaterVolumeFlow", &volumeDomain.makeupWaterVolumeFlow);
+    writer.add("operationsOutput", "makeupWaterVolumeFlowAnnual", &volumeDomain.makeupWaterVolumeFlowAnnual);
+    writer.add("operationsOutput", "makeupWaterCost", &energyDomain.makeupWaterCost);
+    writer.add("operationsOutput", "totalOperatingCost", &energyDomain.totalOperatingCost);
+    writer.add("operationsOutput", "powerGenerationCost", &energyDomain.powerGenerationCost);
+    writer.add("operationsOutput", "boilerFuelUsage", &energyDomain.boilerFuelUsage);
+    writer.add("operationsOutput", "sitePowerImport", &energyDomain.sitePowerImport);
+    writer.add("operationsOutput", "sitePowerDemand", &energyDomain.powerDemand);
+
+    return fields;
+}
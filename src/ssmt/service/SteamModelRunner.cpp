@@ -1,4 +1,5 @@
 #include "ssmt/service/SteamModelRunner.h"
+#include "calculator/util/SolverStatistics.h"
 
 SteamModelCalculationsDomain
 SteamModelRunner::run(const bool isBaselineCalc, const double baselinePowerDemand, const HeaderInput &headerInput,
@@ -11,14 +12,18 @@ SteamModelRunner::run(const bool isBaselineCalc, const double baselinePowerDeman
 
     double initialMassFlow = massFlowCalculator.calcInitialMassFlow(headerInput);
 
+    AMO_SOLVER_SCOPE(solverScope, Solver::STEAM_MODEL_RUNNER);
     int iterationCount = 0;
     while (iterationCount < maxIterationCount) {
         iterationCount++;
+        AMO_SOLVER_ITERATION(Solver::STEAM_MODEL_RUNNER);
         logSection(methodName + "iterationCount=" + std::to_string(iterationCount));
 
         try {
-            return steamModelCalculator.calc(isBaselineCalc, baselinePowerDemand, headerInput, boilerInput,
-                                             turbineInput, operationsInput, initialMassFlow);
+            auto domain = steamModelCalculator.calc(isBaselineCalc, baselinePowerDemand, headerInput,
+                                                    boilerInput, turbineInput, operationsInput, initialMassFlow);
+            AMO_SOLVER_CONVERGED(solverScope);
+            return domain;
         } catch (const SteamBalanceException &e) {
             initialMassFlow = handleSteamBalanceException(e, iterationCount, initialMassFlow);
         }
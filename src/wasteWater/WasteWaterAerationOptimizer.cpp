@@ -0,0 +1,100 @@
+/**
+ * @file
+ * @brief Contains the implementation of the waste water aeration optimizer.
+ *
+ * @bug No known bugs.
+ *
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include "wasteWater/WasteWaterAerationOptimizer.h"
+
+namespace {
+    bool isCheaper(const WasteWaterAerationOptimizer::Candidate &a, const WasteWaterAerationOptimizer::Candidate &b) {
+        if (a.AeCost != b.AeCost) return a.AeCost < b.AeCost;
+        if (a.EffluentAmmonia_N != b.EffluentAmmonia_N) return a.EffluentAmmonia_N < b.EffluentAmmonia_N;
+        if (a.Speed != b.Speed) return a.Speed < b.Speed;
+        if (a.OperatingTime != b.OperatingTime) return a.OperatingTime < b.OperatingTime;
+        if (a.OperatingDO != b.OperatingDO) return a.OperatingDO > b.OperatingDO;
+        return a.MLSSpar < b.MLSSpar;
+    }
+}
+
+WasteWaterAerationOptimizer::Candidate
+WasteWaterAerationOptimizer::evaluate(const WasteWater_Treatment &plant, const Inputs &inputs, const double Speed,
+                                      const double OperatingTime, const double OperatingDO, const double MLSSpar) {
+    WasteWater_Treatment setting = plant;
+    setting.setSpeed(Speed);
+    setting.setOperatingTime(OperatingTime);
+    setting.setOperatingDO(OperatingDO);
+    setting.setMLSSpar(MLSSpar);
+    const WasteWater_Treatment::Output output = setting.calculate(false);
+
+    Candidate candidate;
+    candidate.Speed = Speed;
+    candidate.OperatingTime = OperatingTime;
+    candidate.OperatingDO = OperatingDO;
+    candidate.MLSSpar = MLSSpar;
+    candidate.SolidsRetentionTime = output.SolidsRetentionTime;
+    candidate.MLSS = output.MLSS;
+    candidate.EffluentCBOD5 = output.EffluentCBOD5;
+    candidate.EffluentAmmonia_N = output.EffluentAmmonia_N;
+    candidate.TotalOxygenSupplied = output.TotalOxygenSupplied;
+    candidate.OxygenRequired = inputs.denitrification ? output.TotalOxygenReqWDenit : output.TotalOxygenRequirements;
+    candidate.AeEnergy = output.AeEnergy;
+    candidate.AeCost = output.AeCost;
+    return candidate;
+}
+
+bool WasteWaterAerationOptimizer::isFeasible(const Inputs &inputs, const Candidate &candidate) {
+    return candidate.TotalOxygenSupplied >= candidate.OxygenRequired
+           && candidate.EffluentCBOD5 <= inputs.maxEffluentCBOD5
+           && candidate.EffluentAmmonia_N <= inputs.maxEffluentAmmonia_N
+           && candidate.MLSS >= inputs.minMLSS && candidate.MLSS <= inputs.maxMLSS
+           && std::isfinite(candidate.AeCost);
+}
+
+std::vector<WasteWaterAerationOptimizer::Candidate> WasteWaterAerationOptimizer::getParetoSet(
+        std::vector<Candidate> candidates) {
+    return GridSearch::getParetoSet(std::move(candidates), isCheaper,
+                                    [](const Candidate &candidate) { return candidate.EffluentAmmonia_N; });
+}
+
+WasteWaterAerationOptimizer::Results
+WasteWaterAerationOptimizer::optimize(const WasteWater_Treatment &plant, const Inputs &inputs, unsigned threads) {
+    const auto speeds = GridSearch::getValues(inputs.speeds, "WasteWaterAerationOptimizer", "speed");
+    const auto operatingTimes = GridSearch::getValues(inputs.operatingTimes, "WasteWaterAerationOptimizer",
+                                                      "operating time");
+    const auto operatingDOs = GridSearch::getValues(inputs.operatingDOs, "WasteWaterAerationOptimizer", "DO setpoint");
+    const auto MLSSpars = GridSearch::getValues(inputs.MLSSpars, "WasteWaterAerationOptimizer", "MLSS target");
+    if (!(speeds.front() > 0) || speeds.back() > 100) {
+        throw std::runtime_error("WasteWaterAerationOptimizer: speed must be above 0 and at most 100%");
+    }
+    if (!(operatingTimes.front() > 0) || operatingTimes.back() > 24) {
+        throw std::runtime_error("WasteWaterAerationOptimizer: operating time must be above 0 and at most 24 hr/day");
+    }
+    if (operatingDOs.front() < 0) {
+        throw std::runtime_error("WasteWaterAerationOptimizer: DO setpoint must not be negative");
+    }
+    if (!(MLSSpars.front() > 0)) {
+        throw std::runtime_error("WasteWaterAerationOptimizer: MLSS target must be positive");
+    }
+
+    Results results;
+    results.baseline = evaluate(plant, inputs, plant.getSpeed(), plant.getOperatingTime(), plant.getOperatingDO(),
+                                plant.getMLSSpar());
+    results.candidates = speeds.size() * operatingTimes.size() * operatingDOs.size() * MLSSpars.size();
+
+    auto search = GridSearch::search<Candidate>(results.candidates, threads, [&](const std::size_t i) {
+        const std::size_t speed = i % speeds.size();
+        const std::size_t operatingTime = i / speeds.size() % operatingTimes.size();
+        const std::size_t operatingDO = i / speeds.size() / operatingTimes.size() % operatingDOs.size();
+        const std::size_t MLSSpar = i / speeds.size() / operatingTimes.size() / operatingDOs.size();
+        return evaluate(plant, inputs, speeds[speed], operatingTimes[operatingTime], operatingDOs[operatingDO],
+                        MLSSpars[MLSSpar]);
+    }, [&](const Candidate &candidate) { return isFeasible(inputs, candidate); }, getParetoSet);
+    results.feasibleCandidates = search.feasibleCandidates;
+    results.paretoSet = std::move(search.paretoSet);
+    return results;
+}
@@ -9,11 +9,14 @@
  */
 
 #include "wasteWater/WasteWater_Treatment.h"
+#include <algorithm>
 #include <cmath>
+#include <stdexcept>
+#include "calculator/util/ParallelFor.h"
 #include <vector>
 using namespace std;
 
-double interpolate(vector<double> &xData, vector<double> &yData, double x, bool extrapolate)
+double interpolate(const vector<double> &xData, const vector<double> &yData, double x, bool extrapolate)
 {
     int size = xData.size();
     int i = 0; // find left end of interval for interpolation
@@ -22,9 +25,8 @@ double interpolate(vector<double> &xData, vector<double> &yData, double x, bool
         i = size - 2;
     }
     else
-    {
-        while (x > xData[i + 1])
-            i++;
+    { // the interval whose right end is the first point at or after x
+        i = std::lower_bound(xData.begin() + 1, xData.end(), x) - xData.begin() - 1;
     }
     double xL = xData[i], yL = yData[i], xR = xData[i + 1], yR = yData[i + 1]; // points on either side (unless beyond ends)
     if (!extrapolate)
@@ -38,7 +40,170 @@ double interpolate(vector<double> &xData, vector<double> &yData, double x, bool
     return yL + dydx * (x - xL);         // linear interpolation
 }
 
-WasteWater_Treatment::Output WasteWater_Treatment::calculate()
+WasteWater_Treatment::CalculationsTable WasteWater_Treatment::calculateRow(const double SRT, const double AdjustedMicrobialDecay,
+                                                                          const double AdjustedMaxUtilizationRate,
+                                                                          const CalculationsTable *first) const
+{
+    CalculationsTable row;
+    row.SRT = SRT;
+    // Compute Se
+    row.Se = (HalfSaturation * (1 + AdjustedMicrobialDecay * row.SRT)) / (row.SRT * (BiomassYeild * AdjustedMaxUtilizationRate - AdjustedMicrobialDecay) - 1);
+    //Compute Heter Biomass
+    row.HeterBio = (row.SRT / (Volume / FlowRate)) * BiomassYeild * (So - row.Se) / (1 + AdjustedMicrobialDecay * row.SRT);
+    //Compute CellDeb
+    row.CellDeb = row.HeterBio * FractionBiomass * AdjustedMicrobialDecay * row.SRT;
+    //Compute InterVes
+    row.InterVes = InertVSS * row.SRT / (Volume / FlowRate);
+    //Compute MLVSS
+    row.MLVSS = row.HeterBio + row.CellDeb + row.InterVes;
+    //Compute MLSS
+    row.MLSS = (row.HeterBio + row.CellDeb) / Biomass + row.InterVes + InertInOrgTSS * row.SRT / (Volume / FlowRate);
+    //Compute BiomassProd
+    row.BiomassProd = (row.HeterBio + row.CellDeb) * Volume * 8.34 / row.SRT;
+    //Compute SludgeProd
+    row.SludgeProd = row.MLVSS * Volume * 8.34 / row.SRT;
+    //Compute SolidProd
+    row.SolidProd = row.MLSS * Volume * 8.34 / row.SRT;
+    //Compute Effluent
+    row.Effluent = EffluentTSS * FlowRate * 8.34;
+    //Compue IntentWaste
+    row.IntentWaste = row.SolidProd - row.Effluent;
+    //Compute OxygenRqd
+    row.OxygenRqd = 1.5 * FlowRate * (So - row.Se) * 8.34 - 1.42 * row.BiomassProd;
+    //Compute FlowMgd
+    row.FlowMgd = row.IntentWaste / (RASTSS * 8.34);
+    //Compute NRemoved
+    if (row.SRT < 40)
+    {
+        row.NRemoved = row.BiomassProd * (0.12 + (-0.001 * (row.SRT - 1)));
+    }
+    else
+    {
+        row.NRemoved = row.BiomassProd * 0.08;
+    }
+    if (row.NRemoved > FlowRate * OxidizableN * 8.34)
+    {
+        row.NRemoved = FlowRate * OxidizableN * 8.34;
+    }
+    //Compute NremovedMgl
+    row.NRemovedMgl = row.NRemoved / (FlowRate * 8.34);
+    //Compute Fraction Nox : FrNox
+    double FrNox;
+    if (Temperature < 15)
+    {
+        if (row.SRT < 40)
+        {
+            static const vector<double> xData = {1, 2, 3, 4, 6, 8, 10, 12, 15, 20, 30, 40};
+            static const vector<double> yData = {0.1, 0.2, 0.3, 0.4, 0.6, 0.78, 0.88, 0.93, 0.955, 0.97, 0.98, 0.99};
+            FrNox = interpolate(xData, yData, row.SRT, true);
+        }
+        else
+        {
+            FrNox = 0.99;
+        }
+    }
+    else if (Temperature > 15 && Temperature < 24)
+    {
+        if (row.SRT < 40)
+        {
+            static const vector<double> xData = {1, 2, 3, 4, 6, 8, 10, 12, 15, 20, 30, 40};
+            static const vector<double> yData = {0.1, 0.22, 0.33, 0.43, 0.63, 0.82, 0.92, 0.96, 0.975, 0.98, 0.99, 0.995};
+            FrNox = interpolate(xData, yData, row.SRT, true);
+        }
+        else
+        {
+            FrNox = 0.995;
+        }
+    }
+    else
+    {
+        if (row.SRT < 40)
+        {
+            static const vector<double> xData = {1, 2, 3, 4, 6, 8, 10, 12, 15, 20, 30, 40};
+            static const vector<double> yData = {0.1, 0.25, 0.35, 0.45, 0.65, 0.85, 0.95, 0.98, 0.988, 0.99, 0.995, 0.999};
+            FrNox = interpolate(xData, yData, row.SRT, true);
+        }
+        else
+        {
+            FrNox = 0.999;
+        }
+    }
+    //Compute NitO2Dem
+    row.NitO2Dem = FlowRate * (OxidizableN - row.NRemovedMgl) * 8.34 * 4.33 * FrNox;
+    if (row.NitO2Dem < 0)
+    {
+        row.NitO2Dem = 0;
+    }
+    //Compute O2Reqd
+    row.O2Reqd = row.OxygenRqd + row.NitO2Dem;
+    //Compute EffNH3N
+    row.EffNH3N = (OxidizableN - row.NRemovedMgl) * (1 - FrNox);
+    if (row.EffNH3N < 0)
+    {
+        row.EffNH3N = 0;
+    }
+    //Compute EffNo3N
+    if (OxidizableN > row.NRemovedMgl && first != nullptr)
+    {
+        if (row.SRT < 30)
+        {
+            static const vector<double> xData = {1, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32};
+            static const vector<double> yData = {0, 0.1, 0.25, 0.4, 0.5, 0.55, 0.58, 0.6, 0.62, 0.63, 0.65, 0.66, 0.68, 0.69, 0.7, 0.7};
+            double Coef = interpolate(xData, yData, row.SRT, true);
+            row.EffNo3N = (first->EffNH3N - row.EffNH3N) + Coef * (first->NRemovedMgl - row.NRemovedMgl);
+        }
+        else
+        {
+            row.EffNo3N = (first->EffNH3N - row.EffNH3N) + 0.7 * (first->NRemovedMgl - row.NRemovedMgl);
+        }
+        if (row.EffNo3N < 0)
+        {
+            row.EffNo3N = 0;
+        }
+    }
+    else
+    {
+        row.EffNo3N = 0;
+    }
+    //Compute TotalO2Rqd
+    row.TotalO2Rqd = row.O2Reqd - (FlowRate)*row.EffNo3N * 8.34 * 2.86 * 0.7;
+    //Compute WAS
+    row.WAS = row.IntentWaste / (RASTSS * 8.34);
+    //Compute EstimatedEff
+    if (row.SRT < 40)
+    {
+        row.EstimatedEff = row.Se + EffluentTSS * (-0.00000000014086 * pow(row.SRT, 5) + 0.000000057556 * pow(row.SRT, 4) - 0.0000091279 * pow(row.SRT, 3) + 0.0007014 * pow(row.SRT, 2) - 0.0262 * row.SRT + 0.6322);
+    }
+    else
+    {
+        row.EstimatedEff = row.Se + EffluentTSS * (0.25);
+    }
+    if ((row.MLSS / (RASTSS - row.MLSS) * FlowRate) > 0)
+    {
+        row.EstimRas = row.MLSS / (RASTSS - row.MLSS) * FlowRate;
+    }
+    else
+    {
+        row.EstimRas = 0;
+    }
+    //Compute FmRatio
+    row.FmRatio = (So * FlowRate * 8.34) / (row.MLVSS * Volume * 8.34);
+    //Compute Square of Differences for The Best Match
+    row.Diff_MLSS = pow(row.MLSS - MLSSpar, 2);
+    return row;
+}
+
+bool WasteWater_Treatment::isMLSSIncreasing(const double AdjustedMicrobialDecay, const double AdjustedMaxUtilizationRate,
+                                            const CalculationsTable &first) const
+{
+    // past the washout SRT Se falls as SRT grows, so while So stays above it the heterotrophic biomass, cell debris
+    // and inert solids, and with them MLSS, all grow with SRT
+    const double growth = BiomassYeild * AdjustedMaxUtilizationRate - AdjustedMicrobialDecay;
+    return first.SRT * growth - 1 > 0 && So >= first.Se && AdjustedMicrobialDecay >= 0 && FractionBiomass >= 0
+           && InertVSS >= 0 && InertInOrgTSS >= 0 && Biomass > 0 && Volume / FlowRate > 0 && TimeIncrement > 0;
+}
+
+WasteWater_Treatment::Output WasteWater_Treatment::calculate(const bool calculationsTable) const
 {
     double AdjustedMicrobialDecay = MicrobialDecay * pow((1.04), (Temperature - 20.0));
     double AdjustedMaxUtilizationRate = MaxUtilizationRate * pow((1.07), (Temperature - 20.0));
@@ -64,169 +229,70 @@ WasteWater_Treatment::Output WasteWater_Treatment::calculate()
 
     //----------------------------------- Current Conditions Calculation--------------------------------------
     int numberRows = round(MaxDays / TimeIncrement);
-    std::vector<CalculationsTable> calcTable(numberRows);
-    for (int i = 0; i < numberRows; i++)
+    if (numberRows < 1)
     {
-        calcTable[i].SRT = 1.0 + TimeIncrement * i;
+        throw std::runtime_error("WasteWater_Treatment: MaxDays must cover at least one time increment");
     }
-    //The main loop to make the calculations
-    for (int i = 0; i < numberRows; i++)
+    const CalculationsTable first = calculateRow(1.0, AdjustedMicrobialDecay, AdjustedMaxUtilizationRate, nullptr);
+    auto const row = [&](const int i) {
+        return i == 0 ? first : calculateRow(1.0 + TimeIncrement * i, AdjustedMicrobialDecay, AdjustedMaxUtilizationRate, &first);
+    };
+
+    std::vector<CalculationsTable> calcTable;
+    CalculationsTable best = first;
+    if (calculationsTable)
     {
-        // Compute Se
-        calcTable[i].Se = (HalfSaturation * (1 + AdjustedMicrobialDecay * calcTable[i].SRT)) / (calcTable[i].SRT * (BiomassYeild * AdjustedMaxUtilizationRate - AdjustedMicrobialDecay) - 1);
-        //Compute Heter Biomass
-        calcTable[i].HeterBio = (calcTable[i].SRT / (Volume / FlowRate)) * BiomassYeild * (So - calcTable[i].Se) / (1 + AdjustedMicrobialDecay * calcTable[i].SRT);
-        //Compute CellDeb
-        calcTable[i].CellDeb = calcTable[i].HeterBio * FractionBiomass * AdjustedMicrobialDecay * calcTable[i].SRT;
-        //Compute InterVes
-        calcTable[i].InterVes = InertVSS * calcTable[i].SRT / (Volume / FlowRate);
-        //Compute MLVSS
-        calcTable[i].MLVSS = calcTable[i].HeterBio + calcTable[i].CellDeb + calcTable[i].InterVes;
-        //Compute MLSS
-        calcTable[i].MLSS = (calcTable[i].HeterBio + calcTable[i].CellDeb) / Biomass + calcTable[i].InterVes + InertInOrgTSS * calcTable[i].SRT / (Volume / FlowRate);
-        //Compute BiomassProd
-        calcTable[i].BiomassProd = (calcTable[i].HeterBio + calcTable[i].CellDeb) * Volume * 8.34 / calcTable[i].SRT;
-        //Compute SludgeProd
-        calcTable[i].SludgeProd = calcTable[i].MLVSS * Volume * 8.34 / calcTable[i].SRT;
-        //Compute SolidProd
-        calcTable[i].SolidProd = calcTable[i].MLSS * Volume * 8.34 / calcTable[i].SRT;
-        //Compute Effluent
-        calcTable[i].Effluent = EffluentTSS * FlowRate * 8.34;
-        //Compue IntentWaste
-        calcTable[i].IntentWaste = calcTable[i].SolidProd - calcTable[i].Effluent;
-        //Compute OxygenRqd
-        calcTable[i].OxygenRqd = 1.5 * FlowRate * (So - calcTable[i].Se) * 8.34 - 1.42 * calcTable[i].BiomassProd;
-        //Compute FlowMgd
-        calcTable[i].FlowMgd = calcTable[i].IntentWaste / (RASTSS * 8.34);
-        //Compute NRemoved
-        if (calcTable[i].SRT < 40)
-        {
-            calcTable[i].NRemoved = calcTable[i].BiomassProd * (0.12 + (-0.001 * (calcTable[i].SRT - 1)));
-        }
-        else
-        {
-            calcTable[i].NRemoved = calcTable[i].BiomassProd * 0.08;
-        }
-        if (calcTable[i].NRemoved > FlowRate * OxidizableN * 8.34)
-        {
-            calcTable[i].NRemoved = FlowRate * OxidizableN * 8.34;
-        }
-        //Compute NremovedMgl
-        calcTable[i].NRemovedMgl = calcTable[i].NRemoved / (FlowRate * 8.34);
-        //Compute Fraction Nox : FrNox
-        double FrNox;
-        if (Temperature < 15)
-        {
-            if (calcTable[i].SRT < 40)
-            {
-                vector<double> xData = {1, 2, 3, 4, 6, 8, 10, 12, 15, 20, 30, 40};
-                vector<double> yData = {0.1, 0.2, 0.3, 0.4, 0.6, 0.78, 0.88, 0.93, 0.955, 0.97, 0.98, 0.99};
-                FrNox = interpolate(xData, yData, calcTable[i].SRT, true);
-            }
-            else
+        calcTable.reserve(numberRows);
+        for (int i = 0; i < numberRows; i++)
+            calcTable.push_back(row(i));
+        //Finding The best MLSS match
+        int iCount = 0;
+        double temp = calcTable[0].Diff_MLSS;
+        for (int i = 1; i < numberRows; i++)
+            if (temp > calcTable[i].Diff_MLSS)
             {
-                FrNox = 0.99;
+                iCount = i;
+                temp = calcTable[i].Diff_MLSS;
             }
-        }
-        else if (Temperature > 15 && Temperature < 24)
-        {
-            if (calcTable[i].SRT < 40)
-            {
-                vector<double> xData = {1, 2, 3, 4, 6, 8, 10, 12, 15, 20, 30, 40};
-                vector<double> yData = {0.1, 0.22, 0.33, 0.43, 0.63, 0.82, 0.92, 0.96, 0.975, 0.98, 0.99, 0.995};
-                FrNox = interpolate(xData, yData, calcTable[i].SRT, true);
-            }
-            else
-            {
-                FrNox = 0.995;
-            }
-        }
-        else
+        best = calcTable[iCount];
+    }
+    else if (isMLSSIncreasing(AdjustedMicrobialDecay, AdjustedMaxUtilizationRate, first))
+    {
+        // bisection for the first row whose MLSS reaches MLSSpar; the best match is that row or the one before it
+        int low = 0, high = numberRows;
+        while (low < high)
         {
-            if (calcTable[i].SRT < 40)
-            {
-                vector<double> xData = {1, 2, 3, 4, 6, 8, 10, 12, 15, 20, 30, 40};
-                vector<double> yData = {0.1, 0.25, 0.35, 0.45, 0.65, 0.85, 0.95, 0.98, 0.988, 0.99, 0.995, 0.999};
-                FrNox = interpolate(xData, yData, calcTable[i].SRT, true);
-            }
+            const int middle = low + (high - low) / 2;
+            if (row(middle).MLSS < MLSSpar)
+                low = middle + 1;
             else
-            {
-                FrNox = 0.999;
-            }
-        }
-        //Compute NitO2Dem
-        calcTable[i].NitO2Dem = FlowRate * (OxidizableN - calcTable[i].NRemovedMgl) * 8.34 * 4.33 * FrNox;
-        if (calcTable[i].NitO2Dem < 0)
-        {
-            calcTable[i].NitO2Dem = 0;
-        }
-        //Compute O2Reqd
-        calcTable[i].O2Reqd = calcTable[i].OxygenRqd + calcTable[i].NitO2Dem;
-        //Compute EffNH3N
-        calcTable[i].EffNH3N = (OxidizableN - calcTable[i].NRemovedMgl) * (1 - FrNox);
-        if (calcTable[i].EffNH3N < 0)
-        {
-            calcTable[i].EffNH3N = 0;
+                high = middle;
         }
-        //Compute EffNo3N
-        if (OxidizableN > calcTable[i].NRemovedMgl && i > 0)
+        int iCount = std::min(low, numberRows - 1);
+        best = row(iCount);
+        if (iCount > 0)
         {
-            if (calcTable[i].SRT < 30)
-            {
-                vector<double> xData = {1, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32};
-                vector<double> yData = {0, 0.1, 0.25, 0.4, 0.5, 0.55, 0.58, 0.6, 0.62, 0.63, 0.65, 0.66, 0.68, 0.69, 0.7, 0.7};
-                double Coef = interpolate(xData, yData, calcTable[i].SRT, true);
-                calcTable[i].EffNo3N = (calcTable[0].EffNH3N - calcTable[i].EffNH3N) + Coef * (calcTable[0].NRemovedMgl - calcTable[i].NRemovedMgl);
-            }
-            else
+            CalculationsTable before = row(iCount - 1);
+            // the first row of equal differences wins, as in the table scan
+            while (!(best.Diff_MLSS < before.Diff_MLSS))
             {
-                calcTable[i].EffNo3N = (calcTable[0].EffNH3N - calcTable[i].EffNH3N) + 0.7 * (calcTable[0].NRemovedMgl - calcTable[i].NRemovedMgl);
+                best = before;
+                if (--iCount == 0)
+                    break;
+                before = row(iCount - 1);
             }
-            if (calcTable[i].EffNo3N < 0)
-            {
-                calcTable[i].EffNo3N = 0;
-            }
-        }
-        else
-        {
-            calcTable[i].EffNo3N = 0;
-        }
-        //Compute TotalO2Rqd
-        calcTable[i].TotalO2Rqd = calcTable[i].O2Reqd - (FlowRate)*calcTable[i].EffNo3N * 8.34 * 2.86 * 0.7;
-        //Compute WAS
-        calcTable[i].WAS = calcTable[i].IntentWaste / (RASTSS * 8.34);
-        //Compute EstimatedEff
-        if (calcTable[i].SRT < 40)
-        {
-            calcTable[i].EstimatedEff = calcTable[i].Se + EffluentTSS * (-0.00000000014086 * pow(calcTable[i].SRT, 5) + 0.000000057556 * pow(calcTable[i].SRT, 4) - 0.0000091279 * pow(calcTable[i].SRT, 3) + 0.0007014 * pow(calcTable[i].SRT, 2) - 0.0262 * calcTable[i].SRT + 0.6322);
         }
-        else
-        {
-            calcTable[i].EstimatedEff = calcTable[i].Se + EffluentTSS * (0.25);
-        }
-        if ((calcTable[i].MLSS / (RASTSS - calcTable[i].MLSS) * FlowRate) > 0)
-        {
-            calcTable[i].EstimRas = calcTable[i].MLSS / (RASTSS - calcTable[i].MLSS) * FlowRate;
-        }
-        else
-        {
-            calcTable[i].EstimRas = 0;
-        }
-        //Compute FmRatio
-        calcTable[i].FmRatio = (So * FlowRate * 8.34) / (calcTable[i].MLVSS * Volume * 8.34);
-        //Compute Square of Differences for The Best Match
-        calcTable[i].Diff_MLSS = pow(calcTable[i].MLSS - MLSSpar, 2);
     }
-    //end of for loop
-    //Finding The best MLSS match
-    int iCount = 0;
-    double temp = calcTable[0].Diff_MLSS;
-    for (int i = 1; i < numberRows; i++)
-        if (temp > calcTable[i].Diff_MLSS)
+    else
+    {
+        // MLSS may turn back below the washout SRT, so every row is checked without keeping the table
+        for (int i = 1; i < numberRows; i++)
         {
-            iCount = i;
-            temp = calcTable[i].Diff_MLSS;
+            const CalculationsTable current = row(i);
+            if (best.Diff_MLSS > current.Diff_MLSS)
+                best = current;
         }
+    }
     //Setting the Output Table
     double TotalAverageDailyFlowRate = FlowRate;
     double VolumeInService = Volume;
@@ -234,27 +300,27 @@ WasteWater_Treatment::Output WasteWater_Treatment::calculate()
     double InfluentBOD5MassLoading = So * FlowRate * 8.34;
     double SecWWOxidNLoad = FlowRate * OxidizableN * 8.34;
     double SecWWTSSLoad = FlowRate * InfluentTSS * 8.34;
-    double FM_ratio = calcTable[iCount].FmRatio;
-    double SolidsRetentionTime = calcTable[iCount].SRT;
-    double MLSS = calcTable[iCount].MLSS;
-    double MLVSS = calcTable[iCount].MLVSS;
-    double TSSSludgeProduction = calcTable[iCount].IntentWaste;
-    double TSSInActivatedSludgeEffluent = calcTable[iCount].Effluent;
-    double TotalOxygenRequirements = calcTable[iCount].O2Reqd;
-    double TotalOxygenReqWDenit = calcTable[iCount].TotalO2Rqd;
+    double FM_ratio = best.FmRatio;
+    double SolidsRetentionTime = best.SRT;
+    double MLSS = best.MLSS;
+    double MLVSS = best.MLVSS;
+    double TSSSludgeProduction = best.IntentWaste;
+    double TSSInActivatedSludgeEffluent = best.Effluent;
+    double TotalOxygenRequirements = best.O2Reqd;
+    double TotalOxygenReqWDenit = best.TotalO2Rqd;
     double TotalOxygenSupplied = Aeration * OperatingTime * Speed * ae / 100;
     double MixingIntensityInReactor = (Aeration * Speed / 100) / Volume;
-    double RASFlowRate = calcTable[iCount].EstimRas;
-    double RASRecyclePercentage = calcTable[iCount].EstimRas / FlowRate * 100;
-    double WASFlowRate = calcTable[iCount].WAS;
+    double RASFlowRate = best.EstimRas;
+    double RASRecyclePercentage = best.EstimRas / FlowRate * 100;
+    double WASFlowRate = best.WAS;
     double RASTSSConcentration = RASTSS;
-    double TotalSludgeProduction = calcTable[iCount].SolidProd;
+    double TotalSludgeProduction = best.SolidProd;
     double ReactorDetentionTime = Volume / FlowRate * 24;
     double VOLR = So * FlowRate * 8.34 / (Volume * 133.69);
-    double EffluentCBOD5 = calcTable[iCount].EstimatedEff;
-    double EffluentAmmonia_N = calcTable[iCount].EffNH3N;
-    double EffluentNO3_N = calcTable[iCount].EffNo3N;
-    double EffluentNO3_N_W_Denit = calcTable[iCount].EffNo3N * 0.3;
+    double EffluentCBOD5 = best.EstimatedEff;
+    double EffluentAmmonia_N = best.EffNH3N;
+    double EffluentNO3_N = best.EffNo3N;
+    double EffluentNO3_N_W_Denit = best.EffNo3N * 0.3;
 
     WasteWater_Treatment::Output output(
         TotalAverageDailyFlowRate,
@@ -288,6 +354,17 @@ WasteWater_Treatment::Output WasteWater_Treatment::calculate()
         AeEnergy,
         AeCost,
         FieldOTR,
-        calcTable);
+        std::move(calcTable));
     return output;
 }
+
+std::vector<WasteWater_Treatment::Output> WasteWater_Treatment::calculate(const std::vector<WasteWater_Treatment> &scenarios,
+                                                                         const unsigned threads)
+{
+    std::vector<Output> results(scenarios.size());
+    ParallelFor::run(scenarios.size(), threads, [&](const std::size_t begin, const std::size_t end, unsigned) {
+        for (std::size_t i = begin; i < end; i++)
+            results[i] = scenarios[i].calculate(false);
+    });
+    return results;
+}
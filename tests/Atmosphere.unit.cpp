@@ -1,6 +1,19 @@
 #include "catch.hpp"
 #include <calculator/losses/Atmosphere.h>
+#include <vector>
 
 TEST_CASE( "Calculate Total Heat for Atmospheric Gas", "[Total Heat][Atmosphere][Gas]") {
     CHECK( Atmosphere(100.0, 1400.0, 1200.0, 1.0, 0.02).getTotalHeat() == Approx(31200.0));
 }
+
+TEST_CASE( "Calculate Total Heat for a series of atmosphere flows", "[Total Heat][Atmosphere][Gas]") {
+    const Atmosphere atmosphere(100.0, 1400.0, 1200.0, 1.0, 0.02);
+    const std::vector<double> outletTemperature = {1400.0, 1500.0, 1300.0};
+    const std::vector<double> flowRate = {1200.0, 1000.0, 1500.0};
+    std::vector<double> totalHeat(3);
+
+    atmosphere.getTotalHeatSeries(3, nullptr, outletTemperature.data(), flowRate.data(), totalHeat.data());
+    CHECK( totalHeat[0] == Approx(31200.0));
+    CHECK( totalHeat[1] == Approx(28000.0));
+    CHECK( totalHeat[2] == Approx(36000.0));
+}
@@ -0,0 +1,98 @@
+#include <catch.hpp>
+#include "../cli/BatchPipeline.h"
+#include <sstream>
+
+namespace {
+    std::unique_ptr<io::LineReader> makeLines(const std::string &text) {
+        return std::unique_ptr<io::LineReader>(new io::LineReader("test", text.data(), text.data() + text.size()));
+    }
+
+    BatchCalculator makeSumCalculator() {
+        return BatchCalculator("test", "sum", "a + b", {"a", "b"}, [] { return std::vector<std::string>{"sum"}; },
+                               [](const BatchRecord &record, std::vector<double> &results) {
+                                   if (record.getDouble("a") < 0) throw std::runtime_error("negative a");
+                                   results[0] = record.getDouble("a") + record.getDouble("b");
+                               });
+    }
+}
+
+TEST_CASE( "Batch CSV records", "[BatchPipeline]") {
+	CsvRecordReader reader(makeLines("id,a,b\r\n\"x,1\",1.5,\n\ny,abc,2\n"));
+	BatchRecord record;
+
+	REQUIRE(reader.next(record));
+	CHECK(record.getNumber() == 1);
+	CHECK(record.getString("id") == "x,1");
+	CHECK(record.getDouble("a") == Approx(1.5));
+	CHECK(std::isnan(record.getDouble("b")));
+	CHECK_FALSE(record.has("c"));
+	CHECK_THROWS(record.getString("c"));
+
+	REQUIRE(reader.next(record));
+	CHECK(record.getNumber() == 2);
+	CHECK_THROWS(record.getDouble("a"));
+	CHECK(record.getInteger("b") == 2);
+	CHECK_FALSE(reader.next(record));
+
+	CHECK_THROWS(CsvRecordReader(makeLines("a,b\n1,2,3\n")).next(record));
+}
+
+TEST_CASE( "Batch NDJSON records", "[BatchPipeline]") {
+	NdjsonRecordReader reader(makeLines("{\"a\": 1e2, \"b\": null, \"name\": \"q\\\"\\u00e9\", \"on\": true}\n"
+	                                    "{}\n{\"a\": [1]}\n"));
+	BatchRecord record;
+
+	REQUIRE(reader.next(record));
+	CHECK(record.getDouble("a") == Approx(100));
+	CHECK(std::isnan(record.getDouble("b")));
+	CHECK(record.getString("name") == "q\"\xc3\xa9");
+	CHECK(record.getBool("on"));
+
+	REQUIRE(reader.next(record));
+	CHECK_FALSE(record.has("a"));
+	CHECK_THROWS(reader.next(record));
+}
+
+TEST_CASE( "BatchPipeline keeps input order and reports failed records", "[BatchPipeline]") {
+	std::string input = "a,b\n";
+	for (int i = 0; i < 1000; i++) input += std::to_string(i % 7 == 3 ? -i : i) + ",0.5\n";
+
+	auto const calculator = makeSumCalculator();
+	BatchPipelineSettings settings;
+	settings.threads = 4;
+	settings.chunkSize = 3;
+	settings.chunksInFlight = 5;
+
+	CsvRecordReader reader(makeLines(input));
+	CsvResultFormatter formatter(calculator.outputs(), {"a"});
+	std::ostringstream out;
+	auto const summary = BatchPipeline::run(reader, calculator, formatter, out, settings);
+
+	CHECK(summary.records == 1000);
+	CHECK(summary.errors == 143);
+
+	std::istringstream lines(out.str());
+	std::string line;
+	std::getline(lines, line);
+	CHECK(line == "record,a,sum,error");
+	for (int i = 0; i < 1000; i++) {
+		REQUIRE(std::getline(lines, line));
+		if (i % 7 == 3) {
+			CHECK(line == std::to_string(i + 1) + "," + std::to_string(-i) + ",,negative a");
+		} else {
+			CHECK(line == std::to_string(i + 1) + "," + std::to_string(i) + "," + std::to_string(i) + ".5,");
+		}
+	}
+	CHECK_FALSE(std::getline(lines, line));
+}
+
+TEST_CASE( "Batch NDJSON results", "[BatchPipeline]") {
+	auto const calculator = makeSumCalculator();
+	NdjsonRecordReader reader(makeLines("{\"a\": 0.1, \"b\": 0.2, \"id\": \"p\"}\n{\"a\": -1, \"b\": 0}\n"));
+	NdjsonResultFormatter formatter(calculator.outputs(), {"id"});
+	std::ostringstream out;
+	BatchPipeline::run(reader, calculator, formatter, out, BatchPipelineSettings());
+
+	CHECK(out.str() == "{\"record\":1,\"id\":\"p\",\"sum\":0.30000000000000004}\n"
+	                   "{\"record\":2,\"id\":null,\"sum\":null,\"error\":\"negative a\"}\n");
+}
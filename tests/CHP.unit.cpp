@@ -25,4 +25,22 @@ TEST_CASE( "CHP", "[CHP]") {
 	CHECK(costInfo2.at("thermalCredit") == Approx(-0.0284427212));
 	CHECK(costInfo2.at("incrementalOandM") == Approx(0.0123));
 	CHECK(costInfo2.at("totalOperatingCosts") == Approx(0.0486734726));
-}
\ No newline at end of file
+}
+
+TEST_CASE( "CHP inputs set at once and changed after a read", "[CHP]") {
+	auto chp = CHP(4160, 23781908, 122581, 5.49, 0.214, CHP::Option::PercentAvgkWhElectricCostAvoided, 5.49, 5.49, 90.0, 85.0, 95, 90);
+	CHECK(chp.getCostInfo().at("simplePayback") == Approx(3.595330381));
+
+	chp.setInputs(4160, 23781908, 122581, 5.49, 0.214, CHP::Option::StandbyRate, 5.49, 5.49, 9.75, 85.0, 95, 90);
+	CHECK(chp.getCostInfo().at("annualOperationSavings") == Approx(3066325.0889664106));
+	CHECK(chp.getCostInfo().at("simplePayback") == Approx(3.8126922817));
+
+	const double savings = chp.getCostInfo().at("annualOperationSavings");
+	chp.setAvgElectricityCosts(0.25);
+	CHECK(chp.getCostInfo().at("annualOperationSavings") > savings);
+
+	chp.setAvgElectricityCosts(0.214);
+	chp.setNetCHPpower(1000);
+	CHECK(chp.getNetCHPpower() == Approx(1000));
+	CHECK(chp.getCostInfo().at("annualOperationSavings") == Approx(savings));
+}
@@ -0,0 +1,167 @@
+#include "catch.hpp"
+#include <cmath>
+#include <vector>
+#include <chillers/ChillerPlant.h>
+
+namespace {
+    // power fraction 0.1 + 0.2 PLR + 0.7 PLR^2 and multiplier 0.8 at 65°F to 1 at 85°F, both fit exactly
+    ChillerPlant::Chiller makeChiller(const double chilledWaterPumpPower, const double condenserWaterPumpPower) {
+        return {500, 0.6, CurveFitVal({0.25, 0.5, 0.75, 1}, {0.19375, 0.375, 0.64375, 1}, 2),
+                CurveFitVal({65, 75, 85}, {0.8, 0.9, 1}, 1), 1500, chilledWaterPumpPower, condenserWaterPumpPower};
+    }
+
+    // the pump of the PSATResults tests in tests/Results.unit.cpp
+    double getPSATPumpPower() {
+        Pump::Input pump(Pump::Style::END_SUCTION_ANSI_API, 0.80, 1780, Motor::Drive::DIRECT_DRIVE, 1.0, 1.0, 2.0,
+                         Pump::SpecificSpeed::NOT_FIXED_SPEED, 1.0);
+        Motor motor(Motor::LineFrequency::FREQ60, 200, 1780, Motor::EfficiencyClass::SPECIFIED, 95, 460, 225.0, 0);
+        Pump::FieldData fd(1840, 174.85, Motor::LoadEstimationMethod::POWER, 80, 125.857, 480);
+        PSATResult psat(pump, motor, fd, 8760, 0.05);
+        return ChillerPlant::Chiller::getPumpPower(psat.calculateExisting());
+    }
+
+    ChillerPlant::CoolingTower makeCoolingTower(const bool condenserWaterReset) {
+        return {7, 85, condenserWaterReset, 65, 60, CoolingTowerWaterConservationData(4, 0.0005), 1.0};
+    }
+
+    double fanPower(const double chillerPower, const double served, const double condenserWaterTemperature,
+                    const double wetBulbTemperature) {
+        const double heatRejection = served * 12000 + chillerPower * 3412.14;
+        const double fanSpeed = std::min(1.0, heatRejection / (1000 * (12000 + 0.6 * 3412.14)) * 7
+                                              / (condenserWaterTemperature - wetBulbTemperature));
+        return 60 * std::pow(fanSpeed, 3);
+    }
+}
+
+TEST_CASE( "Chiller plant hour", "[ChillerPlant][Chillers]" ) {
+    const double pumpPower = getPSATPumpPower();
+    CHECK(pumpPower == Approx(80));
+    const ChillerPlant plant({makeChiller(pumpPower, 40), makeChiller(pumpPower, 40)}, makeCoolingTower(false));
+    const ChillerPlant resetPlant({makeChiller(pumpPower, 40), makeChiller(pumpPower, 40)}, makeCoolingTower(true));
+
+    CHECK(plant.getCondenserWaterTemperature(60) == 85);
+    CHECK(plant.getCondenserWaterTemperature(80) == 87);
+    CHECK(resetPlant.getCondenserWaterTemperature(60) == 67);
+    CHECK(resetPlant.getCondenserWaterTemperature(50) == 65);
+
+    // one chiller at 60% load and the 85°F setpoint
+    auto const hour = plant.calculate(300, 60);
+    CHECK(hour.chillersRunning == 1);
+    CHECK(hour.partLoadRatio == Approx(0.6));
+    CHECK(hour.condenserWaterTemperature == 85);
+    CHECK(hour.chillerPower == Approx(300 * (0.1 + 0.2 * 0.6 + 0.7 * 0.36)));
+    CHECK(hour.pumpPower == Approx(120));
+    CHECK(hour.towerFanPower == Approx(fanPower(hour.chillerPower, 300, 85, 60)));
+    CHECK(hour.plantPower == Approx(hour.chillerPower + hour.pumpPower + hour.towerFanPower));
+    CHECK(hour.unmetLoad == 0);
+
+    // the tower water is the makeup water calculator over one hour of the heat rejected
+    const double heatRejection = (300 * 12000 + hour.chillerPower * 3412.14) / 1000000;
+    CoolingTowerMakeupWaterCalculator calculator({1500, heatRejection, 1, 1.0}, CoolingTowerWaterConservationData(4, 0.0005),
+                                                 CoolingTowerWaterConservationData(4, 0.0005));
+    CHECK(hour.makeupWater == Approx(calculator.calculate().wcBaseline));
+    CHECK(hour.evaporation == Approx(CoolingTowerMakeupWaterCalculator::calculateEvaporationLoss(heatRejection, 1.0) * 60));
+    CHECK(hour.blowDown == Approx(hour.evaporation / 3));
+    CHECK(hour.drift == Approx(0.0005 * 1500 * 60));
+
+    // condenser water reset trades chiller power for tower fan power
+    auto const resetHour = resetPlant.calculate(300, 60);
+    CHECK(resetHour.condenserWaterTemperature == 67);
+    CHECK(resetHour.chillerPower == Approx(hour.chillerPower * 0.82));
+    CHECK(resetHour.towerFanPower > hour.towerFanPower);
+    CHECK(resetHour.plantPower < hour.plantPower);
+
+    // the second chiller is staged on above the capacity of the first, and the load above both is unmet
+    CHECK(plant.calculate(500, 60).chillersRunning == 1);
+    CHECK(plant.calculate(501, 60).chillersRunning == 2);
+    auto const overload = plant.calculate(1200, 90);
+    CHECK(overload.chillersRunning == 2);
+    CHECK(overload.partLoadRatio == 1);
+    CHECK(overload.unmetLoad == Approx(200));
+    CHECK(overload.condenserWaterTemperature == 97);
+
+    CHECK(plant.calculate(0, 60).plantPower == 0);
+    CHECK(plant.calculate(0, 60).makeupWater == 0);
+    CHECK_THROWS_AS(plant.calculate(-1, 60), std::runtime_error &);
+}
+
+TEST_CASE( "Chiller plant staging", "[ChillerPlant][Chillers]" ) {
+    const double pumpPower = getPSATPumpPower();
+
+    // at 90% of one chiller the second chiller saves 55 kW, less than its pumps with the PSAT pump but more with
+    // small pumps
+    const ChillerPlant plant({makeChiller(pumpPower, 40), makeChiller(pumpPower, 40)}, makeCoolingTower(false),
+                             ChillerPlant::Staging::LOWEST_POWER);
+    const ChillerPlant smallPumps({makeChiller(5, 5), makeChiller(5, 5)}, makeCoolingTower(false),
+                                  ChillerPlant::Staging::LOWEST_POWER);
+    CHECK(plant.calculate(450, 60).chillersRunning == 1);
+    auto const hour = smallPumps.calculate(450, 60);
+    CHECK(hour.chillersRunning == 2);
+    CHECK(hour.partLoadRatio == Approx(0.45));
+    CHECK(hour.chillerPower == Approx(600 * (0.1 + 0.2 * 0.45 + 0.7 * 0.45 * 0.45)));
+    CHECK(hour.plantPower < ChillerPlant({makeChiller(5, 5), makeChiller(5, 5)}, makeCoolingTower(false))
+            .calculate(450, 60).plantPower);
+
+    // staging on at 90% part load
+    const ChillerPlant sequence({makeChiller(pumpPower, 40), makeChiller(pumpPower, 40)}, makeCoolingTower(false),
+                                ChillerPlant::Staging::SEQUENCE, 0.9);
+    CHECK(sequence.calculate(450, 60).chillersRunning == 1);
+    CHECK(sequence.calculate(460, 60).chillersRunning == 2);
+}
+
+TEST_CASE( "Chiller plant year", "[ChillerPlant][Chillers]" ) {
+    const ChillerPlant plant({makeChiller(getPSATPumpPower(), 40), makeChiller(20, 20)}, makeCoolingTower(true),
+                             ChillerPlant::Staging::LOWEST_POWER, 0.9);
+
+    // loads follow the seasons and the day; the plant is off in winter nights
+    std::vector<double> coolingLoad, wetBulbTemperature;
+    for (int i = 0; i < 8760; i++) {
+        const double season = -std::cos(2 * 3.14159265358979 * i / 8760), day = -std::cos(2 * 3.14159265358979 * i / 24);
+        wetBulbTemperature.push_back(55 + 20 * season + 5 * day);
+        coolingLoad.push_back(std::max(0.0, 440 + 400 * season + 150 * day));
+    }
+
+    std::vector<ChillerPlant::HourResults> hours(coolingLoad.size());
+    auto const results = plant.simulate(coolingLoad.size(), coolingLoad.data(), wetBulbTemperature.data(), hours.data(), 4);
+    CHECK(results.hours == 8760);
+
+    double energy = 0, makeupWater = 0, coolingDelivered = 0, peakPower = 0;
+    std::size_t operatingHours = 0, secondChillerHours = 0;
+    for (std::size_t i = 0; i < hours.size(); i++) {
+        auto const hour = plant.calculate(coolingLoad[i], wetBulbTemperature[i]);
+        CHECK(hours[i].plantPower == hour.plantPower);
+        energy += hour.plantPower;
+        makeupWater += hour.makeupWater;
+        coolingDelivered += coolingLoad[i] - hour.unmetLoad;
+        peakPower = std::max(peakPower, hour.plantPower);
+        operatingHours += hour.chillersRunning > 0;
+        secondChillerHours += hour.chillersRunning > 1;
+    }
+    CHECK(results.energy == Approx(energy));
+    CHECK(results.energy == Approx(results.chillerEnergy + results.pumpEnergy + results.towerFanEnergy));
+    CHECK(results.makeupWater == Approx(makeupWater));
+    CHECK(results.makeupWater == Approx(results.evaporation + results.drift + results.blowDown));
+    CHECK(results.coolingDelivered == Approx(coolingDelivered));
+    CHECK(results.efficiency == Approx(energy / coolingDelivered));
+    CHECK(results.peakPower == peakPower);
+    CHECK(results.operatingHours == operatingHours);
+    CHECK(results.chillerRunHours[0] == operatingHours);
+    CHECK(results.chillerRunHours[1] == secondChillerHours);
+    CHECK(results.unmetLoad == Approx(0));
+    CHECK(secondChillerHours > 0);
+    CHECK(secondChillerHours < operatingHours);
+    CHECK(operatingHours < 8760);
+
+    // the same totals on one thread
+    auto const serial = plant.simulate(coolingLoad.size(), coolingLoad.data(), wetBulbTemperature.data(), nullptr, 1);
+    CHECK(serial.energy == Approx(results.energy));
+    CHECK(serial.makeupWater == Approx(results.makeupWater));
+    CHECK(serial.chillerRunHours == results.chillerRunHours);
+
+    CHECK_THROWS_AS(plant.simulate(coolingLoad, {60, 70}), std::runtime_error &);
+    CHECK_THROWS_AS(ChillerPlant({}, makeCoolingTower(true)), std::runtime_error &);
+    CHECK_THROWS_AS(ChillerPlant({makeChiller(5, 5)}, {7, 85, false, 65, 60, CoolingTowerWaterConservationData(1, 0.0005)}),
+                    std::runtime_error &);
+    CHECK_THROWS_AS(ChillerPlant({makeChiller(5, 5)}, makeCoolingTower(true), ChillerPlant::Staging::SEQUENCE, 1.2),
+                    std::runtime_error &);
+}
@@ -0,0 +1,70 @@
+#include "catch.hpp"
+#include <vector>
+#include <calculator/util/CompressedAirCentrifugalMap.h>
+#include <calculator/util/CompressedAirSystemSimulation.h>
+
+namespace {
+    // capacity curve of the tests in CompressedAirCentrifugal.unit.cpp
+    const std::vector<double> capacity = {3200, 3138, 2885}, dischargePressure = {91, 100, 117};
+
+    void compare(const CompressedAirCentrifugalBase::Output &results, const CompressedAirCentrifugalBase::Output &expected) {
+        CHECK(results.kW_Calc == expected.kW_Calc);
+        CHECK(results.C_Calc == expected.C_Calc);
+        CHECK(results.PerkW == expected.PerkW);
+        CHECK(results.C_Per == expected.C_Per);
+    }
+
+    void compare(const CompressedAirCentrifugalBase::Output &results, const CompressedAirCentrifugalBase::OutputBlowOff &expected) {
+        compare(results, CompressedAirCentrifugalBase::Output(expected.kW_Calc, expected.C_Calc, expected.PerkW, expected.C_Per));
+    }
+}
+
+TEST_CASE( "Centrifugal compressor performance map", "[Power-Flow-Calculations]" ) {
+    auto const loadUnload = CompressedAirCentrifugalMap::loadUnload(452.3, 3138, 71.3, capacity, dischargePressure);
+    auto const modulationUnload = CompressedAirCentrifugalMap::modulationUnload(452.3, 3138, 71.3, 3005, 411.9, 2731,
+                                                                                capacity, dischargePressure, 58.23);
+    auto const blowOff = CompressedAirCentrifugalMap::blowOff(452.3, 3138, 370.9, 2510, capacity, dischargePressure);
+
+    CHECK(loadUnload.getControlType() == CompressedAirCentrifugalBase::LoadUnload);
+    CHECK(loadUnload.getFullLoadCapacity(0) == 3138);
+    CHECK(loadUnload.getFullLoadCapacity(100) == Approx(3138));
+
+    // each evaluation matches the control type model adjusted to the discharge pressure
+    for (const double pressure : {85.0, 91.0, 96.5, 100.0, 108.0, 117.0, 125.0}) {
+        auto const fullLoadCapacity = CurveFitVal(dischargePressure, capacity, 2).calculate(pressure);
+        CHECK(loadUnload.getFullLoadCapacity(pressure) == fullLoadCapacity);
+
+        auto ccLUL = CompressedAirCentrifugal_LoadUnload(452.3, 3138, 71.3);
+        ccLUL.AdjustDischargePressure(capacity, dischargePressure, pressure);
+        auto ccMUL = CompressedAirCentrifugal_ModulationUnload(452.3, 3138, 71.3, 3005, 411.9, 2731);
+        ccMUL.AdjustDischargePressure(capacity, dischargePressure, pressure, 58.23);
+        auto ccBlow = CompressedAirCentrifugal_BlowOff(452.3, 3138, 370.9, 2510);
+        ccBlow.AdjustDischargePressure(capacity, dischargePressure, pressure);
+
+        for (const double load : {0.01, 0.24, 0.5, 0.82, 0.94, 1.0}) {
+            compare(loadUnload.calculateFromPerC(pressure, load), ccLUL.calculateFromPerC(load));
+            compare(loadUnload.calculateFromPerkW(pressure, load), ccLUL.calculateFromPerkW(load));
+            compare(modulationUnload.calculateFromPerC(pressure, load), ccMUL.calculateFromPerC(load));
+            compare(modulationUnload.calculateFromPerkW(pressure, load), ccMUL.calculateFromPerkW(load));
+            compare(blowOff.calculateFromPerC(pressure, load), ccBlow.calculateFromPerC_BlowOff(load));
+            compare(blowOff.calculateFromPerkW(pressure, load, 0.6798), ccBlow.calculateFromPerkW_BlowOff(load, 0.6798));
+        }
+    }
+
+    // at the rated discharge pressure the map is the unadjusted model
+    compare(blowOff.calculateFromPerkW(0, 0.82, 0.6798),
+            CompressedAirCentrifugal_BlowOff(452.3, 3138, 370.9, 2510).calculateFromPerkW_BlowOff(0.82, 0.6798));
+    auto const result = loadUnload.calculateFromPerC(0, 0.24);
+    CHECK(result.kW_Calc == Approx(162.828));
+    CHECK(result.C_Calc == Approx(753.12));
+
+    // a simulated compressor at a discharge pressure
+    auto const unit = CompressedAirSystemSimulation::CompressorUnit::centrifugal(blowOff, 108);
+    CHECK(unit.getControlType() == CompressedAirCentrifugalBase::BlowOff);
+    CHECK(unit.getFullLoadCapacity() == blowOff.getFullLoadCapacity(108));
+    CHECK(unit.getPower(0.5) == blowOff.calculateFromPerC(108, 0.5).kW_Calc);
+
+    CHECK_THROWS_AS(CompressedAirCentrifugalMap::loadUnload(452.3, 3138, 71.3, {3200, 3138}, {91, 100}), std::runtime_error &);
+    CHECK_THROWS_AS(CompressedAirCentrifugalMap::loadUnload(452.3, 3138, 71.3, {3200, 3138}, dischargePressure), std::runtime_error &);
+    CHECK_THROWS_AS(CompressedAirCentrifugalMap::blowOff(0, 3138, 370.9, 2510, capacity, dischargePressure), std::runtime_error &);
+}
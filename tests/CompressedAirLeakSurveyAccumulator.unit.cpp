@@ -0,0 +1,95 @@
+#include <catch.hpp>
+#include <string>
+#include <fast-cpp-csv-parser/csv.h>
+#include "calculator/util/CompressedAirLeakSurveyAccumulator.h"
+
+namespace {
+    CompressedAirLeakSurveyInput makeLeak(const int measurementMethod, const int utilityType, const int units)
+    {
+        return CompressedAirLeakSurveyInput(8640, utilityType, 0.12, measurementMethod,
+                                            EstimateMethodData(0.1),
+                                            DecibelsMethodData(130, 25, 20, 150, 1.04, 1.2, 30, 125, 1.85, 1.65),
+                                            BagMethodData(15, 10, 12),
+                                            OrificeMethodData(250.0, 14.7, 1.0, 6.0, 6.2, 4),
+                                            CompressorElectricityData(0.40, 0.16),
+                                            units);
+    }
+}
+
+TEST_CASE("Compressed Air Leak Survey Accumulator", "[CompressedAirLeakSurvey][Util]")
+{
+    const std::string areaNames[3] = {"north", "south", "east"};
+    std::vector<CompressedAirLeakSurveyInput> inputs;
+    CompressedAirLeakSurveyAccumulator accumulator(64, 4);
+    for (int i = 0; i < 1000; i++)
+    {
+        inputs.push_back(makeLeak(i % 5, i % 2, 1 + i % 3));
+        accumulator.add(inputs.back(), areaNames[i % 3]);
+    }
+
+    // the totals match the survey of every leak at once
+    auto const expected = CompressedAirLeakSurvey(inputs).calculate();
+    auto const totals = accumulator.getTotals();
+    CHECK(totals.leaks == 1000);
+    CHECK(totals.annualTotalElectricity == Approx(expected.annualTotalElectricity));
+    CHECK(totals.annualTotalElectricityCost == Approx(expected.annualTotalElectricityCost));
+    CHECK(totals.totalFlowRate == Approx(expected.totalFlowRate));
+    CHECK(totals.annualTotalFlowRate == Approx(expected.annualTotalFlowRate));
+
+    REQUIRE(accumulator.getAreas().size() == 3);
+    CHECK(accumulator.getAreas()[2] == "east");
+    for (int area = 0; area < 3; area++)
+    {
+        std::vector<CompressedAirLeakSurveyInput> areaInputs;
+        for (int i = area; i < 1000; i += 3) areaInputs.push_back(inputs[i]);
+        auto const areaTotals = accumulator.getAreaTotals(areaNames[area]);
+        CHECK(areaTotals.leaks == areaInputs.size());
+        CHECK(areaTotals.annualTotalElectricityCost == Approx(CompressedAirLeakSurvey(areaInputs).calculate().annualTotalElectricityCost));
+    }
+    CHECK(accumulator.getAreaTotals("west").leaks == 0);
+
+    for (int method = 0; method < 4; method++)
+    {
+        auto const methodTotals = accumulator.getMethodTotals(method);
+        CHECK(methodTotals.leaks == 200);
+        CHECK(methodTotals.totalFlowRate > 0);
+    }
+    // other measurement methods are counted without flow
+    CHECK(accumulator.getMethodTotals(4).leaks == 200);
+    CHECK(accumulator.getMethodTotals(-1).totalFlowRate == 0);
+
+    // leaks added after the totals were taken are included in the next ones
+    accumulator.add(makeLeak(0, 1, 1), "west");
+    CHECK(accumulator.getTotals().leaks == 1001);
+    CHECK(accumulator.getAreaTotals("west").annualTotalElectricity == Approx(55.296));
+
+    CHECK_THROWS(CompressedAirLeakSurveyAccumulator(0));
+}
+
+TEST_CASE("Compressed Air Leak Survey Accumulator CSV", "[CompressedAirLeakSurvey][Util]")
+{
+    const std::string csv =
+            "area,hoursPerYear,utilityType,utilityCost,measurementMethod,units,leakRateEstimate,height,diameter,"
+            "fillTime,compressorControlAdjustment,compressorSpecificPower\r\n"
+            "\"Line 1, north\",8640,1,0.12,0,1,0.1,,,,0.40,0.16\r\n"
+            "\n"
+            "Line 2,8640,1,0.12,2,1,,15,10,12,0.40,0.16\r\n";
+    io::LineReader lines("leaks.csv", csv.data(), csv.data() + csv.size());
+    CompressedAirLeakSurveyAccumulator accumulator;
+    CHECK(accumulator.addCsv(lines) == 2);
+
+    auto const estimate = CompressedAirLeakSurvey::calculateLeak(makeLeak(0, 1, 1));
+    auto const bag = CompressedAirLeakSurvey::calculateLeak(makeLeak(2, 1, 1));
+    CHECK(accumulator.getAreaTotals("Line 1, north").annualTotalElectricity == Approx(55.296));
+    CHECK(accumulator.getAreaTotals("Line 2").totalFlowRate == Approx(bag.totalFlowRate));
+    CHECK(accumulator.getTotals().annualTotalElectricityCost == Approx(estimate.annualTotalElectricityCost
+                                                                       + bag.annualTotalElectricityCost));
+
+    const std::string missing = "hoursPerYear,utilityType,utilityCost,units\n8640,1,0.12,1\n";
+    io::LineReader missingLines("missing.csv", missing.data(), missing.data() + missing.size());
+    CHECK_THROWS(accumulator.addCsv(missingLines));
+
+    const std::string invalid = "hoursPerYear,utilityType,utilityCost,measurementMethod,units\n8640,1,abc,0,1\n";
+    io::LineReader invalidLines("invalid.csv", invalid.data(), invalid.data() + invalid.size());
+    CHECK_THROWS(accumulator.addCsv(invalidLines));
+}
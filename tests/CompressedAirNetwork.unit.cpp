@@ -0,0 +1,164 @@
+#include "catch.hpp"
+#include <cmath>
+#include <calculator/util/CompressedAirNetwork.h>
+
+namespace {
+    // square grid of junctions fed at two corners, pipes numbered rows first
+    CompressedAirNetwork makeGrid(const std::size_t size, std::size_t &first, std::size_t &second) {
+        CompressedAirNetwork network;
+        for (std::size_t i = 0; i < size * size; i++) network.addJunction(2 + static_cast<double>(i % 7));
+        for (std::size_t row = 0; row < size; row++) {
+            for (std::size_t column = 0; column + 1 < size; column++) {
+                network.addPipe(row * size + column, row * size + column + 1, 50, 2);
+            }
+        }
+        for (std::size_t row = 0; row + 1 < size; row++) {
+            for (std::size_t column = 0; column < size; column++) {
+                network.addPipe(row * size + column, (row + 1) * size + column, 50, 2);
+            }
+        }
+        first = network.addSupply(110);
+        second = network.addSupply(105);
+        network.addPipe(first, 0, 100, 4);
+        network.addPipe(second, size * size - 1, 100, 4);
+        return network;
+    }
+
+    double getHarrisDrop(const double length, const double diameter, const double flow, const double meanPressure) {
+        return 0.1025 * length * flow * flow / (3600 * (meanPressure + 14.7) / 14.7 * std::pow(diameter, 5.31));
+    }
+}
+
+TEST_CASE( "Compressed air network single pipe", "[CompressedAirNetwork][CompressedAir]") {
+    CompressedAirNetwork network;
+    auto const supply = network.addSupply(100);
+    auto const junction = network.addJunction(500);
+    network.addPipe(supply, junction, 1000, 2);
+    auto const results = network.solve();
+
+    CHECK( results.converged);
+    CHECK( results.flows[0] == Approx(500));
+    CHECK( results.supplies[supply] == Approx(500));
+    CHECK( results.supplies[junction] == 0);
+    CHECK( results.pressures[supply] == 100);
+    CHECK( results.pressureDrops[0] == Approx(100 - results.pressures[junction]));
+    CHECK( results.pressureDrops[0] == Approx(getHarrisDrop(1000, 2, 500, 100 - results.pressureDrops[0] / 2)));
+
+    const double meanPressure = 100 - results.pressureDrops[0] / 2;
+    const double area = 3.14159265358979 * 4 / 4;
+    CHECK( results.velocities[0] == Approx(500 * 14.7 / (meanPressure + 14.7) * 144 / area / 60));
+
+    // a pipe laid the other way carries a negative flow
+    CompressedAirNetwork reversed;
+    auto const end = reversed.addJunction(500);
+    reversed.addPipe(end, reversed.addSupply(100), 1000, 2);
+    auto const reversedResults = reversed.solve();
+    CHECK( reversedResults.flows[0] == Approx(-500));
+    CHECK( reversedResults.pressures[end] == Approx(results.pressures[junction]));
+}
+
+TEST_CASE( "Compressed air network loops", "[CompressedAirNetwork][CompressedAir]") {
+    // two equal pipes in parallel share the flow
+    CompressedAirNetwork parallel;
+    auto const supply = parallel.addSupply(100);
+    auto const junction = parallel.addJunction(600);
+    parallel.addPipe(supply, junction, 500, 1.5);
+    parallel.addPipe(junction, supply, 500, 1.5);
+    auto const split = parallel.solve();
+    CHECK( split.flows[0] == Approx(300));
+    CHECK( split.flows[1] == Approx(-300));
+    CHECK( split.pressureDrops[0] == Approx(getHarrisDrop(500, 1.5, 300, 100 - split.pressureDrops[0] / 2)));
+
+    std::size_t first, second;
+    auto grid = makeGrid(10, first, second);
+    REQUIRE( grid.getNodeCount() == 102);
+    REQUIRE( grid.getPipeCount() == 182);
+    auto const results = grid.solve();
+    REQUIRE( results.converged);
+
+    // flow is conserved at every junction and every pipe follows the Harris formula
+    std::vector<double> net(grid.getNodeCount(), 0);
+    double demand = 0;
+    for (std::size_t i = 0; i < 100; i++) {
+        net[i] = 2 + static_cast<double>(i % 7);
+        demand += net[i];
+    }
+    std::size_t pipe = 0;
+    auto const check = [&](const std::size_t from, const std::size_t to, const double length, const double diameter) {
+        const double flow = results.flows[pipe];
+        const double drop = results.pressures[from] - results.pressures[to];
+        const double meanPressure = (results.pressures[from] + results.pressures[to]) / 2;
+        CHECK( std::fabs(drop) == Approx(getHarrisDrop(length, diameter, flow, meanPressure)).epsilon(1e-6));
+        CHECK( drop * flow >= 0);
+        net[from] += flow;
+        net[to] -= flow;
+        pipe++;
+    };
+    for (std::size_t row = 0; row < 10; row++) {
+        for (std::size_t column = 0; column < 9; column++) check(row * 10 + column, row * 10 + column + 1, 50, 2);
+    }
+    for (std::size_t row = 0; row < 9; row++) {
+        for (std::size_t column = 0; column < 10; column++) check(row * 10 + column, (row + 1) * 10 + column, 50, 2);
+    }
+    check(first, 0, 100, 4);
+    check(second, 99, 100, 4);
+    for (std::size_t i = 0; i < 100; i++) CHECK( net[i] == Approx(0).margin(1e-6));
+    CHECK( results.supplies[first] + results.supplies[second] == Approx(demand));
+    CHECK( results.supplies[first] > results.supplies[second]);
+}
+
+TEST_CASE( "Compressed air network re-solve", "[CompressedAirNetwork][CompressedAir]") {
+    std::size_t first, second;
+    auto network = makeGrid(20, first, second);
+    auto const cold = network.solve();
+    REQUIRE( cold.converged);
+
+    // resizing one pipe starts from the last solution and matches a cold solve of the resized network
+    network.setPipeDiameter(5, 1);
+    auto const warm = network.solve();
+    CHECK( warm.converged);
+    CHECK( warm.iterations < cold.iterations);
+
+    auto resized = makeGrid(20, first, second);
+    resized.setPipeDiameter(5, 1);
+    auto const expected = resized.solve();
+    CHECK( expected.iterations == cold.iterations);
+    for (std::size_t i = 0; i < resized.getNodeCount(); i++) {
+        CHECK( warm.pressures[i] == Approx(expected.pressures[i]));
+    }
+    for (std::size_t k = 0; k < resized.getPipeCount(); k++) {
+        CHECK( warm.flows[k] == Approx(expected.flows[k]).margin(1e-6));
+    }
+    CHECK( std::fabs(warm.flows[5]) < std::fabs(cold.flows[5]));
+
+    // demand and supply changes are picked up as well
+    network.setDemand(0, 50);
+    network.setSupplyPressure(second, 110);
+    auto const changed = network.solve();
+    CHECK( changed.converged);
+    CHECK( changed.pressures[second] == 110);
+    CHECK( changed.supplies[first] + changed.supplies[second] == Approx(warm.supplies[first]
+                                                                         + warm.supplies[second] + 48));
+}
+
+TEST_CASE( "Compressed air network errors", "[CompressedAirNetwork][CompressedAir]") {
+    CompressedAirNetwork network;
+    auto const supply = network.addSupply(100);
+    auto const junction = network.addJunction(100);
+    CHECK_THROWS( network.addPipe(supply, supply, 100, 2));
+    CHECK_THROWS( network.addPipe(supply, 5, 100, 2));
+    CHECK_THROWS( network.addPipe(supply, junction, 0, 2));
+    CHECK_THROWS( network.setDemand(supply, 10));
+    CHECK_THROWS( network.setSupplyPressure(junction, 10));
+
+    network.addPipe(supply, junction, 100, 2);
+    auto const isolated = network.addJunction(10);
+    CHECK_THROWS( network.solve());
+    network.addPipe(isolated, junction, 100, 2);
+    CHECK( network.solve().converged);
+    CHECK_THROWS( network.setPipeDiameter(1, 0));
+
+    // a pipe far too small for the demand
+    network.setPipeDiameter(1, 0.1);
+    CHECK_THROWS( network.solve());
+}
@@ -0,0 +1,91 @@
+#include "catch.hpp"
+#include <calculator/util/CompressedAirSequencingOptimizer.h>
+
+namespace {
+    CompressedAirSequencingOptimizer::Inputs makeInputs() {
+        CompressedAirSequencingOptimizer::Inputs inputs;
+        inputs.compressors = {CompressedAirSystemSimulation::CompressorUnit::loadUnload(452.3, 3138, 71.3),
+                              CompressedAirSystemSimulation::CompressorUnit::modulationUnload(452.3, 3138, 71.3, 3005,
+                                                                                              411.9, 2731),
+                              CompressedAirSystemSimulation::CompressorUnit::blowOff(452.3, 3138, 370.9, 2510)};
+        for (int hour = 0; hour < 24; hour++) inputs.demand.push_back(hour >= 7 && hour < 19 ? 4000 : 1500);
+        inputs.timeStep = 1;
+        inputs.storageCapacity = 100;
+        inputs.electricityCost = 0.1;
+        inputs.storageCost = 0.01;
+        inputs.pressureBands = {5, 10};
+        inputs.storageAdditions = {0, 5000};
+        return inputs;
+    }
+
+    double getTotalCost(const CompressedAirSequencingOptimizer::Inputs &inputs,
+                        const CompressedAirSequencingOptimizer::Strategy &strategy) {
+        const CompressedAirSystemSimulation system(inputs.compressors,
+                                                   inputs.storageCapacity + strategy.storageAddition / 7.48,
+                                                   strategy.pressureBand, inputs.timeStep, strategy.trimCompressor);
+        return system.simulate(inputs.demand).energy * (1 + 0.005 * strategy.pressureBand / 2)
+               * inputs.electricityCost + strategy.storageAddition * inputs.storageCost;
+    }
+}
+
+TEST_CASE( "Compressed air sequencing optimizer", "[CompressedAirSequencingOptimizer][CompressedAir]") {
+    auto const inputs = makeInputs();
+    auto const results = CompressedAirSequencingOptimizer::optimize(inputs, 16, 1);
+    CHECK( results.candidates == 16);
+    CHECK( results.infeasible == 0);
+    REQUIRE( results.strategies.size() + results.pruned == 16);
+
+    for (std::size_t i = 0; i < results.strategies.size(); i++) {
+        auto const &strategy = results.strategies[i];
+        if (i > 0) CHECK( strategy.totalCost >= results.strategies[i - 1].totalCost);
+        CHECK( strategy.totalCost == Approx(getTotalCost(inputs, strategy)));
+        CHECK( strategy.totalCost == Approx(strategy.energyCost + strategy.storageCost));
+    }
+
+    // the cheapest strategy runs the narrow band without added storage
+    auto const &best = results.strategies.front();
+    CHECK( best.pressureBand == 5);
+    CHECK( best.storageAddition == 0);
+    CHECK( best.energy == Approx(best.simulation.energy * 1.0125));
+    for (int trim = -1; trim < 3; trim++) {
+        CompressedAirSequencingOptimizer::Strategy strategy;
+        strategy.trimCompressor = trim;
+        strategy.pressureBand = 5;
+        strategy.storageAddition = 0;
+        CHECK( best.totalCost <= getTotalCost(inputs, strategy));
+    }
+
+    auto const top = CompressedAirSequencingOptimizer::optimize(inputs, 3, 4);
+    REQUIRE( top.strategies.size() == 3);
+    for (std::size_t i = 0; i < 3; i++) {
+        CHECK( top.strategies[i].totalCost == results.strategies[i].totalCost);
+        CHECK( top.strategies[i].trimCompressor == results.strategies[i].trimCompressor);
+    }
+    CHECK( CompressedAirSequencingOptimizer::optimize(inputs, 1, 1).pruned > 0);
+}
+
+TEST_CASE( "Compressed air sequencing optimizer, loading orders and storage", "[CompressedAirSequencingOptimizer][CompressedAir]") {
+    auto inputs = makeInputs();
+    inputs.loadingOrders = {{0, 1, 2}, {2, 1, 0}};
+    inputs.tryTrimCompressors = false;
+    inputs.demand = {9514, 9000};
+    inputs.timeStep = 1 / 60.0;
+    inputs.storageCapacity = 0;
+
+    // 100 acf above the system capacity is only met from the added storage
+    auto const results = CompressedAirSequencingOptimizer::optimize(inputs);
+    CHECK( results.candidates == 8);
+    CHECK( results.infeasible == 4);
+    REQUIRE( results.strategies.size() == 4);
+    for (auto const &strategy : results.strategies) {
+        CHECK( strategy.storageAddition == 5000);
+        CHECK( strategy.simulation.unmetDemand == 0);
+    }
+    CHECK( results.strategies[0].pressureBand == 5);
+
+    inputs.loadingOrders = {{0, 1, 1}};
+    CHECK_THROWS_AS( CompressedAirSequencingOptimizer::optimize(inputs), std::runtime_error &);
+    inputs.loadingOrders.clear();
+    inputs.pressureBands.clear();
+    CHECK_THROWS_AS( CompressedAirSequencingOptimizer::optimize(inputs), std::runtime_error &);
+}
@@ -0,0 +1,140 @@
+#include "catch.hpp"
+#include <calculator/util/CompressedAir.h>
+#include <calculator/util/CompressedAirSystemSimulation.h>
+
+namespace {
+    std::vector<CompressedAirSystemSimulation::CompressorUnit> makeInventory() {
+        return {CompressedAirSystemSimulation::CompressorUnit::loadUnload(452.3, 3138, 71.3),
+                CompressedAirSystemSimulation::CompressorUnit::modulationUnload(452.3, 3138, 71.3, 3005, 411.9, 2731),
+                CompressedAirSystemSimulation::CompressorUnit::blowOff(452.3, 3138, 370.9, 2510)};
+    }
+}
+
+TEST_CASE( "Compressed air system simulation, sequencing", "[CompressedAirSystemSimulation][CompressedAir]") {
+    CompressedAirSystemSimulation single({CompressedAirSystemSimulation::CompressorUnit::loadUnload(452.3, 3138, 71.3)},
+                                         0, 10, 1);
+    auto results = single.simulate({753.12, 3138, 0});
+    CHECK( results.compressors[0].energy == Approx(162.828 + 452.3));
+    CHECK( results.compressors[0].partLoadHours == Approx(1));
+    CHECK( results.compressors[0].fullLoadHours == Approx(1));
+    CHECK( results.compressors[0].offHours == Approx(1));
+    CHECK( results.compressors[0].loadUnloadCycles == 0);
+    CHECK( results.peakPower == Approx(452.3));
+    CHECK( results.hours == Approx(3));
+
+    auto const inventory = makeInventory();
+    CompressedAirSystemSimulation system(inventory, 0, 10, 0.5);
+    CHECK( system.getTotalCapacity() == Approx(9414));
+    const std::vector<double> demand = {4000, 7000, 1000};
+    std::vector<CompressedAirSystemSimulation::LoadState> states(demand.size() * 3);
+    std::vector<double> power(demand.size() * 3);
+    results = system.simulate(demand.size(), demand.data(), states.data(), power.data());
+
+    CHECK( states[0] == CompressedAirSystemSimulation::LoadState::FULL_LOAD);
+    CHECK( states[1] == CompressedAirSystemSimulation::LoadState::PART_LOAD);
+    CHECK( states[2] == CompressedAirSystemSimulation::LoadState::OFF);
+    CHECK( power[1] == Approx(inventory[1].getPower(862.0 / 3138)));
+    CHECK( power[1] == Approx(CompressedAirCentrifugal_ModulationUnload(452.3, 3138, 71.3, 3005, 411.9, 2731)
+                                      .calculateFromPerC(862.0 / 3138).kW_Calc));
+    CHECK( states[5] == CompressedAirSystemSimulation::LoadState::PART_LOAD);
+    CHECK( power[5] == Approx(CompressedAirCentrifugal_BlowOff(452.3, 3138, 370.9, 2510)
+                                      .calculateFromPerC_BlowOff(724.0 / 3138).kW_Calc));
+    CHECK( states[6] == CompressedAirSystemSimulation::LoadState::PART_LOAD);
+    CHECK( states[7] == CompressedAirSystemSimulation::LoadState::OFF);
+
+    double energy = 0;
+    for (std::size_t i = 0; i < 3; i++) {
+        CHECK( results.compressors[i].energy == Approx((power[i] + power[3 + i] + power[6 + i]) * 0.5));
+        energy += results.compressors[i].energy;
+    }
+    CHECK( results.energy == Approx(energy));
+    CHECK( results.compressors[0].airDelivered == Approx((3138 + 3138 + 1000) * 30));
+    CHECK( results.airDemand == Approx(12000 * 30));
+    CHECK( results.unmetDemand == 0);
+}
+
+TEST_CASE( "Compressed air system simulation, storage", "[CompressedAirSystemSimulation][CompressedAir]") {
+    // 1470 ft3 of receivers and piping over a 10 psi band stores 1000 acf of usable air
+    Compressor::PipeData const pipes(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    auto const capacity = Compressor::AirSystemCapacity(pipes, {1470 * 7.48}).calculate();
+    CompressedAirSystemSimulation system(makeInventory(), capacity.totalCapacityOfCompressedAirSystem, 10, 1 / 60.0);
+    CHECK( system.getUsableStorage() == Approx(1000));
+
+    auto results = system.simulate({9914, 9000, 9000, 9000});
+    CHECK( results.unmetDemand == 0);
+    CHECK( results.compressors[2].airDelivered == Approx(3138 + 3138 + 2810 + 2724));
+    results = system.simulate({9914, 10914});
+    CHECK( results.unmetDemand == Approx(1000));
+
+    CompressedAirSystemSimulation single({CompressedAirSystemSimulation::CompressorUnit::loadUnload(452.3, 3138, 71.3)},
+                                         1470, 10, 1);
+    results = single.simulate({1569});
+    CHECK( results.compressors[0].loadUnloadCycles == Approx(60 * 1569 * 1569 / (1000 * 3138.0)));
+
+    // a year at one minute resolution
+    std::vector<double> year(525600);
+    for (std::size_t i = 0; i < year.size(); i++) year[i] = i % 1440 < 960 ? 7000 : 2000;
+    results = system.simulate(year);
+    CHECK( results.hours == Approx(8760));
+    CHECK( results.compressors[0].fullLoadHours == Approx(5840));
+    CHECK( results.compressors[0].partLoadHours == Approx(2920));
+    CHECK( results.compressors[1].offHours == Approx(2920));
+    CHECK( results.compressors[2].partLoadHours == Approx(5840));
+
+    CHECK_THROWS_AS( system.simulate({-1}), std::runtime_error &);
+    CHECK_THROWS_AS( CompressedAirSystemSimulation(makeInventory(), 0, 10, 0), std::runtime_error &);
+    CHECK_THROWS_AS( CompressedAirSystemSimulation::CompressorUnit::loadUnload(452.3, 0, 71.3), std::runtime_error &);
+}
+
+TEST_CASE( "Compressed air system simulation, designated trim compressor and energy limit",
+           "[CompressedAirSystemSimulation][CompressedAir]") {
+    CompressedAirSystemSimulation system(makeInventory(), 0, 10, 1, 0);
+    std::vector<CompressedAirSystemSimulation::LoadState> states(9);
+    const std::vector<double> demand = {2000, 4000, 9000};
+    auto results = system.simulate(demand.size(), demand.data(), states.data());
+
+    // the load/unload compressor trims alone, then behind the base compressors
+    CHECK( states[0] == CompressedAirSystemSimulation::LoadState::PART_LOAD);
+    CHECK( states[1] == CompressedAirSystemSimulation::LoadState::OFF);
+    CHECK( states[3] == CompressedAirSystemSimulation::LoadState::PART_LOAD);
+    CHECK( states[4] == CompressedAirSystemSimulation::LoadState::FULL_LOAD);
+    CHECK( states[5] == CompressedAirSystemSimulation::LoadState::OFF);
+    CHECK( states[6] == CompressedAirSystemSimulation::LoadState::PART_LOAD);
+    CHECK( states[7] == CompressedAirSystemSimulation::LoadState::FULL_LOAD);
+    CHECK( states[8] == CompressedAirSystemSimulation::LoadState::FULL_LOAD);
+    CHECK( results.compressors[0].airDelivered == Approx((2000 + 4000 - 3138 + 9000 - 6276) * 60));
+    CHECK( results.compressors[1].airDelivered == Approx((3138 + 3138) * 60));
+    CHECK( results.steps == 3);
+
+    auto const limited = system.simulate(demand.size(), demand.data(), nullptr, nullptr, 100);
+    CHECK( limited.steps == 1);
+    CHECK( limited.hours == Approx(1));
+    CHECK( limited.energy == Approx(system.simulate({2000}).energy));
+    CHECK_THROWS_AS( CompressedAirSystemSimulation(makeInventory(), 0, 10, 1, 3), std::runtime_error &);
+}
+
+TEST_CASE( "Compressed air system simulation, trim compressor smaller than the base compressors",
+           "[CompressedAirSystemSimulation][CompressedAir]") {
+    auto inventory = makeInventory();
+    inventory[0] = CompressedAirSystemSimulation::CompressorUnit::loadUnload(150, 1000, 30);
+    CompressedAirSystemSimulation system(inventory, 0, 10, 1, 0);
+    std::vector<CompressedAirSystemSimulation::LoadState> states(9);
+
+    // between the base capacity and the base and trim capacity, then between the trim and one base capacity, then
+    // between the trim capacity and the capacity of one base compressor with the trim compressor
+    const std::vector<double> demand = {7000, 2000, 4000};
+    auto results = system.simulate(demand.size(), demand.data(), states.data());
+
+    CHECK( states[0] == CompressedAirSystemSimulation::LoadState::PART_LOAD);
+    CHECK( states[1] == CompressedAirSystemSimulation::LoadState::FULL_LOAD);
+    CHECK( states[2] == CompressedAirSystemSimulation::LoadState::FULL_LOAD);
+    CHECK( states[3] == CompressedAirSystemSimulation::LoadState::FULL_LOAD);
+    CHECK( states[4] == CompressedAirSystemSimulation::LoadState::PART_LOAD);
+    CHECK( states[5] == CompressedAirSystemSimulation::LoadState::OFF);
+    CHECK( states[6] == CompressedAirSystemSimulation::LoadState::PART_LOAD);
+    CHECK( states[7] == CompressedAirSystemSimulation::LoadState::FULL_LOAD);
+    CHECK( states[8] == CompressedAirSystemSimulation::LoadState::OFF);
+    CHECK( results.compressors[0].airDelivered == Approx((7000 - 6276 + 1000 + 4000 - 3138) * 60));
+    CHECK( results.compressors[1].airDelivered == Approx((3138 + 1000 + 3138) * 60));
+    CHECK( results.compressors[2].airDelivered == Approx(3138 * 60));
+}
@@ -1,6 +1,8 @@
 #include <catch.hpp>
 #include "chillers/CoolingTower.h"
 #include <tuple>
+#include <algorithm>
+#include <vector>
 
 TEST_CASE("Cooling Tower Makeup Water Calculator", "[CoolingTower][Chillers]")
 {
@@ -95,4 +97,88 @@ TEST_CASE("Cooling Tower Makeup Water Calculator", "[CoolingTower][Chillers]")
     expectedOutput3 = std::make_tuple(1980000.0, 1125000.0, 855000.0);
 
     test(input3, expectedOutput3);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Cooling Tower Hourly Simulation", "[CoolingTower][Chillers]")
+{
+    // Test 1 of the makeup water calculator, with the tower off in the rest of the year
+    std::vector<double> coolingLoad(8760, 0);
+    std::fill(coolingLoad.begin(), coolingLoad.begin() + 1000, 10.00);
+    CoolingTowerHourlySimulation simulation(2500, coolingLoad, 1.00);
+    CHECK(simulation.getHours() == 8760);
+    CHECK(simulation.getOperationalHours() == 1000);
+
+    const CoolingTowerWaterConservationData baseline(3, 0.002), modification(3, 0.0001);
+    auto const results = simulation.calculate(baseline, modification);
+    CHECK(results.baseline.totals.makeupWater == Approx(2100000.0));
+    CHECK(results.modification.totals.makeupWater == Approx(1815000.0));
+    CHECK(results.waterSavings == Approx(285000.0));
+    CHECK(results.baseline.makeupWater[0] == Approx(2100.0));
+    CHECK(results.baseline.makeupWater[1000] == 0);
+
+    // the totals are the sums of the hours
+    double evaporation = 0, drift = 0, blowDown = 0, makeupWater = 0;
+    for (std::size_t hour = 0; hour < simulation.getHours(); hour++)
+    {
+        evaporation += results.modification.evaporation[hour];
+        drift += results.modification.drift[hour];
+        blowDown += results.modification.blowDown[hour];
+        makeupWater += results.modification.makeupWater[hour];
+    }
+    CHECK(results.modification.totals.evaporation == Approx(evaporation));
+    CHECK(results.modification.totals.drift == Approx(drift));
+    CHECK(results.modification.totals.blowDown == Approx(blowDown));
+    CHECK(results.modification.totals.makeupWater == Approx(makeupWater));
+
+    // a sweep gives the totals of each scenario
+    std::vector<CoolingTowerWaterConservationData> scenarios;
+    for (int cyclesOfConcentration = 2; cyclesOfConcentration <= 10; cyclesOfConcentration++)
+    {
+        for (const double driftLossFactor : {0.002, 0.0005, 0.0001})
+        {
+            scenarios.emplace_back(cyclesOfConcentration, driftLossFactor);
+        }
+    }
+    auto const sweep = simulation.calculateTotals(scenarios);
+    REQUIRE(sweep.size() == scenarios.size());
+    for (std::size_t i = 0; i < scenarios.size(); i++)
+    {
+        auto const totals = simulation.calculate(scenarios[i]).totals;
+        CHECK(sweep[i].makeupWater == totals.makeupWater);
+        CHECK(sweep[i].blowDown == totals.blowDown);
+
+        CoolingTowerMakeupWaterCalculator calculator({2500, 10.00, 1000, 1.00}, scenarios[i], scenarios[i]);
+        CHECK(sweep[i].makeupWater == Approx(calculator.calculate().wcBaseline));
+    }
+}
+
+TEST_CASE("Cooling Tower Hourly Simulation with weather", "[CoolingTower][Chillers]")
+{
+    const std::vector<double> coolingLoad = {0, 2.5, 5, 10, 10, 7.5};
+    const std::vector<double> dryBulbTemperature = {30, 20, 55, 70, 100, 115};
+    const CoolingTowerHourlySimulation::EvaporationCurve curve = {{40, 70, 100}, {0.6, 0.8, 1.0}};
+    const std::vector<double> lossCorrectionFactor = {0.6, 0.6, 0.7, 0.8, 1.0, 1.0};
+
+    CoolingTowerHourlySimulation simulation(2500, coolingLoad, dryBulbTemperature, curve);
+    CHECK(simulation.getOperationalHours() == 5);
+
+    const CoolingTowerWaterConservationData waterConservationData(4, 0.0005);
+    auto const results = simulation.calculate(waterConservationData);
+    for (std::size_t hour = 0; hour < coolingLoad.size(); hour++)
+    {
+        // each hour is the makeup water calculator at the hour's load and correction factor
+        const CoolingTowerOperatingConditionsData operatingConditionsData(2500, coolingLoad[hour], coolingLoad[hour] > 0,
+                                                                          lossCorrectionFactor[hour]);
+        CoolingTowerMakeupWaterCalculator calculator(operatingConditionsData, waterConservationData, waterConservationData);
+        CHECK(results.makeupWater[hour] == Approx(calculator.calculate().wcBaseline));
+        CHECK(results.evaporation[hour] == Approx(CoolingTowerMakeupWaterCalculator::calculateEvaporationLoss(
+                coolingLoad[hour], lossCorrectionFactor[hour]) * 60));
+    }
+    CHECK(results.totals.makeupWater == simulation.calculateTotals(waterConservationData).makeupWater);
+
+    CHECK_THROWS_AS(simulation.calculate(CoolingTowerWaterConservationData(1, 0.0005)), std::runtime_error &);
+    CHECK_THROWS_AS(CoolingTowerHourlySimulation(2500, coolingLoad, {30, 20}, curve), std::runtime_error &);
+    CHECK_THROWS_AS(CoolingTowerHourlySimulation(2500, coolingLoad, dryBulbTemperature, {{70, 40}, {0.8, 0.6}}), std::runtime_error &);
+    CHECK_THROWS_AS(CoolingTowerHourlySimulation(2500, coolingLoad, dryBulbTemperature, {{40, 70}, {0.6}}), std::runtime_error &);
+    CHECK_THROWS_AS(CoolingTowerHourlySimulation(2500, {5, -1}), std::runtime_error &);
+}
@@ -0,0 +1,66 @@
+#include <catch.hpp>
+#include <random>
+#include <vector>
+#include "calculator/util/CompressedAir.h"
+#include "calculator/util/CompressedAirLeakSurvey.h"
+#include "calculator/util/DecibelsLeakRateGrid.h"
+
+namespace {
+    // a detector table of 6 pressures and 5 decibel ratings, unevenly spaced
+    DecibelsLeakRateGrid makeGrid()
+    {
+        const std::vector<double> pressures = {50, 75, 90, 125, 150, 200};
+        const std::vector<double> decibelRatings = {10, 20, 25, 30, 45};
+        std::vector<double> leakRates;
+        for (auto const decibels : decibelRatings) {
+            for (auto const pressure : pressures) leakRates.push_back(0.01 * pressure * (1 + decibels / 20) + decibels / 100);
+        }
+        return {pressures, decibelRatings, leakRates};
+    }
+}
+
+TEST_CASE("Decibels Leak Rate Grid", "[CompressedAirLeakSurvey][Util]")
+{
+    // the 2 x 2 table of the decibels method tests, with its axes sorted
+    DecibelsLeakRateGrid table({125, 150}, {20, 30}, {1.2, 1.04, 1.65, 1.85});
+    CHECK(table.calculate(130, 25) == Approx(1.429));
+    CHECK(DecibelsMethod(1280, 130, 25, 20, 150, 1.04, 1.2, 30, 125, 1.85, 1.65).calculate().leakRateEstimate
+          == DecibelsLeakRateGrid::interpolate(130, 25, 20, 150, 1.04, 1.2, 30, 125, 1.85, 1.65));
+
+    auto const grid = makeGrid();
+
+    // the corners of the cell of each reading, inside, outside and on the points of the table
+    std::mt19937 random(7);
+    std::uniform_real_distribution<double> pressureDistribution(30, 230), decibelDistribution(0, 55);
+    std::vector<double> pressures = {50, 75, 90, 125, 150, 200, 200, 50, 30};
+    std::vector<double> decibels = {10, 20, 25, 30, 45, 10, 45, 45, 0};
+    for (int i = 0; i < 1000; i++) {
+        pressures.push_back(pressureDistribution(random));
+        decibels.push_back(decibelDistribution(random));
+    }
+
+    std::vector<double> leakRates(pressures.size());
+    grid.calculate(pressures.size(), pressures.data(), decibels.data(), leakRates.data());
+    for (std::size_t i = 0; i < pressures.size(); i++) {
+        auto reference = grid.getReferencePoints(pressures[i], decibels[i]);
+        const bool inside = pressures[i] >= 50 && pressures[i] <= 200 && decibels[i] >= 10 && decibels[i] <= 45;
+        if (inside) {
+            CHECK(reference.getPressureA() <= pressures[i]);
+            CHECK(pressures[i] <= reference.getPressureB());
+            CHECK(reference.getDecibelRatingA() <= decibels[i]);
+            CHECK(decibels[i] <= reference.getDecibelRatingB());
+        }
+        CHECK(grid.calculate(pressures[i], decibels[i]) == reference.calculate());
+        CHECK(leakRates[i] == reference.calculate());
+    }
+
+    // the leak rates of the table at its points
+    CHECK(grid.calculate(90, 25) == Approx(0.01 * 90 * 2.25 + 0.25));
+    CHECK(grid.calculate(200, 45) == Approx(0.01 * 200 * 3.25 + 0.45));
+    CHECK(grid.calculate(50, 10) == Approx(0.01 * 50 * 1.5 + 0.1));
+
+    CHECK_THROWS_AS(DecibelsLeakRateGrid({125}, {20, 30}, {1.2, 1.65}), std::runtime_error &);
+    CHECK_THROWS_AS(DecibelsLeakRateGrid({150, 125}, {20, 30}, {1.04, 1.2, 1.85, 1.65}), std::runtime_error &);
+    CHECK_THROWS_AS(DecibelsLeakRateGrid({125, 150}, {20, 20}, {1.2, 1.04, 1.65, 1.85}), std::runtime_error &);
+    CHECK_THROWS_AS(DecibelsLeakRateGrid({125, 150}, {20, 30}, {1.2, 1.04, 1.65}), std::runtime_error &);
+}
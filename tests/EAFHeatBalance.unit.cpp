@@ -0,0 +1,63 @@
+#include "catch.hpp"
+#include <calculator/furnace/EAFHeatBalance.h>
+
+namespace {
+    EAFHeatBalance::Heat makeHeat() {
+        EAFHeatBalance::Heat heat;
+        heat.tapWeight = 100;
+        heat.coalHeatingValue = 9000;
+        heat.electrodeHeatingValue = 12000;
+        heat.slags.push_back(SlagOtherMaterialLosses(3000, 500, 2800, 0.25, 1.0));
+        heat.samples.push_back(EAFHeatBalance::Sample{0.5, 18000, 50, 3300, 500, 20, 2800, 12, 10, 3, 8000, 0.001});
+        heat.samples.push_back(EAFHeatBalance::Sample{0.25, 18000, 15, 900, 200, 0, 2800, 8, 6, 3, 6500, 0.001});
+        return heat;
+    }
+}
+
+TEST_CASE( "EAF heat balance", "[EAFHeatBalance][EAF]") {
+    auto const results = EAFHeatBalance::calculate(makeHeat());
+    CHECK( results.duration == Approx(0.75));
+    CHECK( results.electricityUse == Approx(13500));
+    CHECK( results.chemicalEnergyInput == Approx(105700000 * 0.5 + 25500000.0 * 0.25));
+    CHECK( results.totalEnergyInput == Approx(167116000.0 * 0.5 + 86916000 * 0.25));
+    CHECK( results.exhaustGasLosses == Approx(12553119.02 * 0.5 + 8591939.26 * 0.25));
+    CHECK( results.slagLosses == Approx(1725000));
+    CHECK( results.otherLosses == Approx(results.totalEnergyInput - results.exhaustGasLosses - 1725000));
+    CHECK( results.electricityPerTon == Approx(135));
+    CHECK( results.energyPerTon == Approx(results.totalEnergyInput / 3412 / 100));
+
+    // streaming the samples gives the same balance
+    auto const heat = makeHeat();
+    EAFHeatBalance balance(heat.tapWeight, heat.coalHeatingValue, heat.electrodeHeatingValue, heat.slags);
+    balance.addSample(heat.samples[0]);
+    CHECK( balance.getResults().duration == Approx(0.5));
+    balance.addSample(heat.samples[1]);
+    CHECK( balance.getResults().totalEnergyInput == Approx(results.totalEnergyInput));
+
+    CHECK( EAFHeatBalance(0, 9000, 12000).getResults().energyPerTon == 0);
+    CHECK_THROWS_AS( balance.addSample(EAFHeatBalance::Sample{-1, 18000, 0, 0, 0, 0, 2800, 0, 0, 0, 0, 0}),
+                     std::runtime_error &);
+}
+
+TEST_CASE( "EAF heat balance, batch of heats", "[EAFHeatBalance][EAF]") {
+    std::vector<EAFHeatBalance::Heat> heats;
+    for (int i = 0; i < 11; i++) {
+        heats.push_back(makeHeat());
+        heats.back().tapWeight = 90 + i;
+        heats.back().samples.resize(i % 3);
+    }
+    auto const serial = EAFHeatBalance::calculate(heats, 1);
+    auto const parallel = EAFHeatBalance::calculate(heats, 4);
+    REQUIRE( parallel.size() == 11);
+    for (std::size_t i = 0; i < heats.size(); i++) {
+        CHECK( parallel[i].energyPerTon == serial[i].energyPerTon);
+        CHECK( parallel[i].energyPerTon == EAFHeatBalance::calculate(heats[i]).energyPerTon);
+    }
+    CHECK( parallel[0].totalEnergyInput == 0);
+    CHECK( parallel[0].otherLosses == Approx(-1725000));
+    CHECK( parallel[2].electricityPerTon == Approx(13500.0 / 92));
+    CHECK( EAFHeatBalance::calculate(std::vector<EAFHeatBalance::Heat>()).empty());
+
+    heats[8].samples[1].duration = -0.25;
+    CHECK_THROWS_AS( EAFHeatBalance::calculate(heats, 3), std::runtime_error &);
+}
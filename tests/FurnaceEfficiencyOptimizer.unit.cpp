@@ -0,0 +1,139 @@
+#include "catch.hpp"
+#include <algorithm>
+#include <calculator/furnace/FurnaceEfficiencyOptimizer.h>
+#include <calculator/furnace/O2Enrichment.h>
+
+namespace {
+    FurnaceEfficiencyOptimizer::Inputs makeInputs() {
+        FurnaceEfficiencyOptimizer::Inputs inputs;
+        inputs.flueGasTemp = 1600;
+        inputs.o2FlueGas = 5;
+        inputs.combAirTemp = 80;
+        inputs.o2CombAir = 21;
+        inputs.fuelConsumption = 10;
+        inputs.operatingHours = 8000;
+        inputs.fuelCost = 5;
+        inputs.oxygenCost = 4;
+        inputs.stoichiometricOxygen = 1980;
+        inputs.fuelHeatingValue = 1020;
+        inputs.ambientTemp = 80;
+        inputs.recuperatorEffectiveness = 0.6;
+        inputs.combAirTemps = {80, 1180, 100};
+        inputs.o2FlueGases = {1, 5, 1};
+        inputs.o2CombAirs = {21, 35, 2};
+        return inputs;
+    }
+
+    bool dominates(const FurnaceEfficiencyOptimizer::Candidate &a, const FurnaceEfficiencyOptimizer::Candidate &b) {
+        return a.fuelCost <= b.fuelCost && a.oxygenCost <= b.oxygenCost
+               && (a.fuelCost < b.fuelCost || a.oxygenCost < b.oxygenCost);
+    }
+}
+
+TEST_CASE( "Furnace efficiency optimizer candidates", "[FurnaceEfficiencyOptimizer][PHAST]") {
+    auto const inputs = makeInputs();
+
+    auto const baseline = FurnaceEfficiencyOptimizer::evaluate(inputs, 80, 5, 21);
+    CHECK( baseline.fuelConsumption == Approx(10));
+    CHECK( baseline.fuelSavings == Approx(0).margin(1e-12));
+    CHECK( baseline.oxygenFlow == Approx(0).margin(1e-12));
+    CHECK( baseline.fuelCost == Approx(400000));
+    CHECK( baseline.totalCost == Approx(400000));
+
+    auto const preheat = FurnaceEfficiencyOptimizer::evaluate(inputs, 880, 2, 21);
+    O2Enrichment o2Enrichment(21, 21, 1600, 1600, 5, 2, 80, 880, 10);
+    CHECK( preheat.excessAir == Approx(o2Enrichment.getExcessAirEnriched()));
+    CHECK( preheat.availableHeat == Approx(o2Enrichment.getAvailableHeatEnriched()));
+    CHECK( preheat.fuelConsumption == Approx(o2Enrichment.getFuelConsumptionEnriched()));
+    CHECK( preheat.fuelSavings == Approx(o2Enrichment.getFuelSavingsEnriched()));
+    CHECK( FurnaceEfficiencyOptimizer::isFeasible(inputs, preheat));
+
+    // half of the O2 of 42% enriched air is purchased
+    auto const enriched = FurnaceEfficiencyOptimizer::evaluate(inputs, 80, 0, 42);
+    CHECK( enriched.oxygenFlow == Approx(1980 * enriched.fuelConsumption * (0.21 / (0.79 * 0.42))));
+    CHECK( enriched.oxygenCost == Approx(enriched.oxygenFlow * 8000 / 1000 * 4));
+    CHECK( enriched.totalCost == Approx(enriched.fuelCost + enriched.oxygenCost));
+    CHECK( enriched.fuelConsumption < 10);
+
+    CHECK_FALSE( FurnaceEfficiencyOptimizer::isFeasible(inputs, FurnaceEfficiencyOptimizer::evaluate(inputs, 1000, 2, 21)));
+}
+
+TEST_CASE( "Furnace efficiency optimizer Pareto set", "[FurnaceEfficiencyOptimizer][PHAST]") {
+    auto const inputs = makeInputs();
+    auto const results = FurnaceEfficiencyOptimizer::optimize(inputs, 1);
+
+    CHECK( results.baseline.fuelConsumption == Approx(10));
+    CHECK( results.candidates == 12 * 5 * 8);
+    // preheat temperatures above 80 + 0.6 * (1600 - 80) = 992 are out of reach of the recuperator
+    CHECK( results.feasibleCandidates == 10 * 5 * 8);
+    REQUIRE( results.paretoSet.size() > 1);
+
+    // every feasible candidate is either in the set or dominated by a member of it
+    std::size_t feasible = 0;
+    for (double combAirTemp = 80; combAirTemp < 1200; combAirTemp += 100) {
+        for (double o2FlueGas = 1; o2FlueGas <= 5; o2FlueGas++) {
+            for (double o2CombAir = 21; o2CombAir <= 35; o2CombAir += 2) {
+                auto const candidate = FurnaceEfficiencyOptimizer::evaluate(inputs, combAirTemp, o2FlueGas, o2CombAir);
+                if (!FurnaceEfficiencyOptimizer::isFeasible(inputs, candidate)) continue;
+                feasible++;
+                bool covered = false;
+                for (auto const &member : results.paretoSet) {
+                    covered = covered || dominates(member, candidate)
+                              || (member.fuelCost == candidate.fuelCost && member.oxygenCost == candidate.oxygenCost);
+                }
+                CHECK( covered );
+            }
+        }
+    }
+    CHECK( feasible == results.feasibleCandidates);
+
+    for (std::size_t i = 0; i < results.paretoSet.size(); i++) {
+        auto const &member = results.paretoSet[i];
+        CHECK( FurnaceEfficiencyOptimizer::isFeasible(inputs, member));
+        if (i > 0) CHECK( results.paretoSet[i - 1].totalCost <= member.totalCost);
+        for (auto const &other : results.paretoSet) CHECK_FALSE( dominates(other, member));
+    }
+
+    // without oxygen purchases the highest reachable preheat and lowest flue gas O2 burn the least fuel
+    auto const noEnrichment = std::find_if(results.paretoSet.begin(), results.paretoSet.end(),
+                                           [](const FurnaceEfficiencyOptimizer::Candidate &c) { return c.o2CombAir == 21; });
+    REQUIRE( noEnrichment != results.paretoSet.end());
+    CHECK( noEnrichment->combAirTemp == Approx(980));
+    CHECK( noEnrichment->o2FlueGas == Approx(1));
+    CHECK( noEnrichment->oxygenCost == Approx(0).margin(1e-9));
+}
+
+TEST_CASE( "Furnace efficiency optimizer threads", "[FurnaceEfficiencyOptimizer][PHAST]") {
+    auto const inputs = makeInputs();
+    auto const serial = FurnaceEfficiencyOptimizer::optimize(inputs, 1);
+    for (unsigned threads : {0u, 3u, 7u, 1000u}) {
+        auto const parallel = FurnaceEfficiencyOptimizer::optimize(inputs, threads);
+        CHECK( parallel.feasibleCandidates == serial.feasibleCandidates);
+        REQUIRE( parallel.paretoSet.size() == serial.paretoSet.size());
+        for (std::size_t i = 0; i < serial.paretoSet.size(); i++) {
+            CHECK( parallel.paretoSet[i].combAirTemp == serial.paretoSet[i].combAirTemp);
+            CHECK( parallel.paretoSet[i].o2FlueGas == serial.paretoSet[i].o2FlueGas);
+            CHECK( parallel.paretoSet[i].o2CombAir == serial.paretoSet[i].o2CombAir);
+            CHECK( parallel.paretoSet[i].totalCost == serial.paretoSet[i].totalCost);
+        }
+    }
+
+    auto single = inputs;
+    single.combAirTemps = {500, 500, 0};
+    single.o2FlueGases = {2, 2, 0};
+    single.o2CombAirs = {21, 21, 0};
+    auto const one = FurnaceEfficiencyOptimizer::optimize(single);
+    CHECK( one.candidates == 1);
+    REQUIRE( one.paretoSet.size() == 1);
+    CHECK( one.paretoSet[0].combAirTemp == Approx(500));
+
+    auto invalid = inputs;
+    invalid.o2FlueGases = {5, 1, 1};
+    CHECK_THROWS_AS( FurnaceEfficiencyOptimizer::optimize(invalid), std::runtime_error &);
+    invalid = inputs;
+    invalid.combAirTemps.step = 0;
+    CHECK_THROWS_AS( FurnaceEfficiencyOptimizer::optimize(invalid), std::runtime_error &);
+    invalid = inputs;
+    invalid.o2CombAirs = {15, 30, 5};
+    CHECK_THROWS_AS( FurnaceEfficiencyOptimizer::optimize(invalid), std::runtime_error &);
+}
@@ -0,0 +1,100 @@
+#include "catch.hpp"
+#include <calculator/furnace/FurnaceHeatBalance.h>
+
+namespace {
+    FurnaceHeatBalance::Furnace makeFurnace() {
+        FurnaceHeatBalance::Furnace furnace;
+        furnace.gasChargeMaterials.push_back(GasLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC,
+                                                                   0.24, 1000, 15, 80, 1150, 0.5, 100, 80, 5000));
+        furnace.liquidChargeMaterials.push_back(LiquidLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC,
+                                                                         0.48, 240, 250, 0.25, 1000, 70, 320, 100, 25, 50, 0));
+        furnace.solidChargeMaterials.push_back(SolidLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC,
+                                                                       0.139957009792214, 117.15, 0.16, 2550, 20000, 1, 0,
+                                                                       70, 1500, 212, 0, 0, 100, 0));
+        furnace.fixtures.push_back(FixtureLosses(0.122, 1250, 300, 1800, 1));
+        furnace.walls.push_back(WallLosses(500, 80, 225, 10, 0.9, 1.394, 1));
+        furnace.openings.push_back(OpeningLosses(0.95, 12, 9, 1.33, 75, 1600, 100, 0.70));
+        furnace.openings.push_back(OpeningLosses(0.95, 48, 15, 9, 1.67, 75, 1600, 20, 0.64));
+        furnace.atmospheres.push_back(Atmosphere(100, 1400, 1200, 1, 0.02));
+        furnace.leakages.push_back(LeakageLosses(0.1, 3, 1600, 80, 0.8052, 1.02, 1));
+        furnace.gasCoolings.push_back(GasCoolingLosses(2500, 80, 280, 0.02, 1, 1));
+        furnace.liquidCoolings.push_back(LiquidCoolingLosses(100, 9.35, 80, 210, 0.52, 1));
+        furnace.waterCoolings.push_back(WaterCoolingLosses(100, 80, 120, 1));
+        furnace.otherLosses.push_back(10000);
+        furnace.auxiliaryPowers.push_back(AuxiliaryPower(3, 460, 19, 0.85, 100));
+        furnace.gasFlueGas = std::make_shared<GasFlueGasMaterial>(
+                700, 9.0, 125, GasCompositions("", 94.1, 2.4, 1.41, 0.03, 0.49, 0.29, 0, 0.42, 0.71, 0, 0), 125);
+        return furnace;
+    }
+}
+
+TEST_CASE( "Furnace heat balance", "[FurnaceHeatBalance][PHAST]") {
+    auto const results = FurnaceHeatBalance::calculate(makeFurnace());
+
+    const double chargeMaterials = 383530 + 364100 + 4185142.77525675;
+    const double coolings = 600000 + 3792360 + 1989032;
+    const double net = chargeMaterials + 228750 + 404627.551342992 + 16038.269976979091 + 18670.2258869289 + 31200
+                       + 2850767 + coolings + 10000;
+
+    CHECK( results.chargeMaterials == Approx(chargeMaterials));
+    CHECK( results.fixtures == Approx(228750));
+    CHECK( results.walls == Approx(404627.551342992));
+    CHECK( results.openings == Approx(16038.269976979091 + 18670.2258869289));
+    CHECK( results.atmospheres == Approx(31200));
+    CHECK( results.leakages == Approx(2850767));
+    CHECK( results.coolings == Approx(coolings));
+    CHECK( results.slags == Approx(0));
+    CHECK( results.otherLosses == Approx(10000));
+    CHECK( results.totalNetHeatRequired == Approx(net));
+    CHECK( results.availableHeat == Approx(76.899).epsilon(0.0001));
+    CHECK( results.grossHeatInput == Approx(net / 0.76899).epsilon(0.0001));
+    CHECK( results.flueGasLosses == Approx(results.grossHeatInput - net));
+    CHECK( results.auxiliaryPower == Approx(43905.3405494047));
+    CHECK( results.chargeFeedRate == Approx(22000));
+    CHECK( results.efficiency == Approx(chargeMaterials / results.grossHeatInput * 100));
+    CHECK( results.energyIntensity == Approx(results.grossHeatInput / 22000));
+}
+
+TEST_CASE( "Furnace heat balance without a flue gas", "[FurnaceHeatBalance][PHAST]") {
+    auto furnace = makeFurnace();
+    furnace.gasFlueGas.reset();
+    auto const results = FurnaceHeatBalance::calculate(furnace);
+    CHECK( results.availableHeat == Approx(100));
+    CHECK( results.grossHeatInput == Approx(results.totalNetHeatRequired));
+    CHECK( results.flueGasLosses == Approx(0));
+
+    auto const empty = FurnaceHeatBalance::calculate(FurnaceHeatBalance::Furnace());
+    CHECK( empty.grossHeatInput == Approx(0));
+    CHECK( empty.efficiency == Approx(0));
+    CHECK( empty.energyIntensity == Approx(0));
+
+    furnace = makeFurnace();
+    furnace.solidLiquidFlueGas = std::make_shared<SolidLiquidFlueGasMaterial>(
+            700, 0.15, 125, 70, 1.0, 100, 0, 75.0, 5.0, 1.0, 9.0, 7.0, 0.0, 1.5);
+    CHECK_THROWS_AS( FurnaceHeatBalance::calculate(furnace), std::runtime_error &);
+}
+
+TEST_CASE( "Furnace heat balance assessment", "[FurnaceHeatBalance][PHAST]") {
+    FurnaceHeatBalance::Assessment assessment{makeFurnace(), makeFurnace()};
+    assessment.modification.walls.clear();
+    assessment.modification.otherLosses.clear();
+
+    auto const results = FurnaceHeatBalance::calculate(assessment);
+    const double savedNet = 404627.551342992 + 10000;
+    CHECK( results.baseline.totalNetHeatRequired - results.modification.totalNetHeatRequired == Approx(savedNet));
+    CHECK( results.energySavings == Approx(savedNet * 100 / results.baseline.availableHeat));
+    CHECK( results.percentSavings == Approx(results.energySavings / results.baseline.grossHeatInput * 100));
+
+    std::vector<FurnaceHeatBalance::Assessment> plant{assessment, {makeFurnace(), makeFurnace()}};
+    plant[1].modification.gasFlueGas.reset();
+    auto const plantResults = FurnaceHeatBalance::calculate(plant);
+    REQUIRE( plantResults.furnaces.size() == 2);
+    CHECK( plantResults.furnaces[0].energySavings == Approx(results.energySavings));
+    CHECK( plantResults.baselineGrossHeatInput == Approx(2 * results.baseline.grossHeatInput));
+    CHECK( plantResults.modificationGrossHeatInput
+           == Approx(results.modification.grossHeatInput + plantResults.furnaces[1].modification.grossHeatInput));
+    CHECK( plantResults.energySavings
+           == Approx(plantResults.furnaces[0].energySavings + plantResults.furnaces[1].energySavings));
+    CHECK( plantResults.percentSavings
+           == Approx(plantResults.energySavings / plantResults.baselineGrossHeatInput * 100));
+}
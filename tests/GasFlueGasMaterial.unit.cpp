@@ -1,12 +1,13 @@
 #include "catch.hpp"
 #include <calculator/losses/GasFlueGasMaterial.h>
+#include <vector>
 
 TEST_CASE( "Calculate Heat Loss for flue gas Losses", "[Heat Loss]" ) {
 	GasCompositions composition("unit test gas", 94.1, 2.4, 1.41, 0.03, 0.49, 0.29, 0, 0.42, 0.71, 0, 0);
 
-	CHECK(composition.calculateExcessAir(0.005) == Approx(0.0231722));
-	CHECK(composition.calculateExcessAir(0.03) == Approx(0.1552234));
-	CHECK(composition.calculateExcessAir(0.07) == Approx(0.451975));
+	CHECK(composition.calculateExcessAir(0.005) == Approx(0.0234757572));
+	CHECK(composition.calculateExcessAir(0.03) == Approx(0.1583737647));
+	CHECK(composition.calculateExcessAir(0.07) == Approx(0.4613496624));
 
 	CHECK(composition.calculateO2(0.0231722) == Approx(0.0049367284));
 	CHECK(composition.calculateO2(0.1552234) == Approx(0.0294793974));
@@ -57,4 +58,62 @@ TEST_CASE( "Calculate Heat Loss for flue gas Losses", "[Heat Loss]" ) {
 	CHECK(composition.getHeatingValue() == Approx(20585.7766384286));
 	CHECK(composition.getSpecificGravity() == Approx(1.0774007113));
 	CHECK(composition.getHeatingValueVolume() == Approx(1581.14));
-}
\ No newline at end of file
+}
+
+TEST_CASE( "Gas compositions by name and by index", "[Heat Loss]" ) {
+	const GasCompositions composition("", 94.1, 2.4, 1.41, 0.03, 0.49, 0.29, 0, 0.42, 0.71, 0.2, 0.1);
+
+	CHECK(composition.getGasByVol("CH4") == Approx(94.1));
+	CHECK(composition.getGasByVol(GasCompositions::Gas::CH4) == Approx(94.1));
+	CHECK(composition.getGasByVol("C4H10_CnH2n") == Approx(0.29));
+	CHECK(composition.getGasByVol(GasCompositions::Gas::C4H10_CnH2n) == Approx(0.29));
+	CHECK(composition.getGasByVol("SO2") == Approx(0.2));
+	CHECK(composition.getGasByVol(GasCompositions::Gas::O2) == Approx(0.1));
+	CHECK_THROWS(composition.getGasByVol("C2H4"));
+
+	// copies hold their own gas properties
+	GasCompositions copy = composition;
+	CHECK(GasFlueGasMaterial(700, 9.0, 125, copy, 125).getHeatLoss()
+	      == Approx(GasFlueGasMaterial(700, 9.0, 125, composition, 125).getHeatLoss()));
+	CHECK(copy.calculateExcessAir(0.07) == Approx(GasCompositions(composition).calculateExcessAir(0.07)));
+}
+
+TEST_CASE( "Gas excess air solved in closed form", "[Heat Loss]" ) {
+	GasCompositions composition("unit test gas", 94.1, 2.4, 1.41, 0.03, 0.49, 0.29, 0, 0.42, 0.71, 0, 0);
+
+	for (auto const flueGasO2 : {0.005, 0.03, 0.07, 0.15}) {
+		CHECK(composition.calculateO2(composition.calculateExcessAir(flueGasO2)) == Approx(flueGasO2).epsilon(1e-9));
+	}
+
+	CHECK(composition.calculateExcessAir(0) == 0);
+
+	// flue gas can not hold more O2 than air
+	CHECK(composition.calculateExcessAir(0.25) == Approx(FlueGasExcessAir::MAX_EXCESS_AIR));
+}
+
+TEST_CASE( "Available heat for a series of flue gas measurements", "[Heat Loss]" ) {
+	GasCompositions composition("unit test gas", 94.1, 2.4, 1.41, 0.03, 0.49, 0.29, 0, 0.42, 0.71, 0, 0);
+	const GasFlueGasMaterial flueGas(700, 9.0, 125, composition, 125);
+	const std::vector<double> flueGasTemperature = {700, 900, 1600, 500};
+	const std::vector<double> flueGasO2 = {0.005, 0.03, 0.07, 0.15};
+	const std::vector<double> combustionAirTemperature = {125, 80, 600, 60};
+	std::vector<double> availableHeat(4);
+
+	flueGas.getHeatLossSeries(4, nullptr, nullptr, nullptr, availableHeat.data());
+	for (auto const heat : availableHeat) CHECK(heat == Approx(0.76899));
+
+	flueGas.getHeatLossSeries(4, flueGasTemperature.data(), flueGasO2.data(), nullptr, availableHeat.data());
+	for (std::size_t i = 0; i < 4; i++) {
+		const double excessAir = composition.calculateExcessAir(flueGasO2[i]) * 100;
+		CHECK(availableHeat[i] == Approx(GasFlueGasMaterial(flueGasTemperature[i], excessAir, 125, composition, 125)
+				                                 .getHeatLoss()));
+	}
+
+	flueGas.getHeatLossSeries(4, flueGasTemperature.data(), flueGasO2.data(), combustionAirTemperature.data(),
+	                          availableHeat.data());
+	for (std::size_t i = 0; i < 4; i++) {
+		const double excessAir = composition.calculateExcessAir(flueGasO2[i]) * 100;
+		CHECK(availableHeat[i] == Approx(GasFlueGasMaterial(flueGasTemperature[i], excessAir,
+		                                                    combustionAirTemperature[i], composition, 125).getHeatLoss()));
+	}
+}
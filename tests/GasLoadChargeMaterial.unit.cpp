@@ -1,7 +1,15 @@
 #include "catch.hpp"
 #include <calculator/losses/LoadChargeMaterial.h>
+#include <calculator/losses/LoadChargeEnthalpy.h>
 #include <calculator/losses/GasLoadChargeMaterial.h>
 
 TEST_CASE( "Calculate Total Heat for Charge Material - Gas", "[Total Heat][ChargeMaterial][Gas]") {
     CHECK( GasLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC, 0.24, 1000.0, 15.0, 80.0, 1150.0, 0.5, 100.0, 80.0, 5000.0).getTotalHeat() == Approx(383530.0));
-}
\ No newline at end of file
+}
+
+TEST_CASE( "Enthalpy curve of a gas charge material", "[Total Heat][ChargeMaterial][Gas]") {
+    GasLoadChargeMaterial gas(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC, 0.24, 1000.0, 15.0, 80.0, 1150.0, 0.5, 100.0, 80.0, 5000.0);
+    const LoadChargeEnthalpy enthalpy(gas);
+    CHECK( 1000.0 * (enthalpy.getHeatRequired(80.0, 1150.0) + enthalpy.getReactionHeat()) + 5000.0 == Approx(383530.0));
+    CHECK( enthalpy.getEnthalpy(1000.0) == Approx(279.0));
+}
@@ -1,9 +1,26 @@
 #include "catch.hpp"
+#include <vector>
 #include <calculator/losses/LoadChargeMaterial.h>
+#include <calculator/losses/LoadChargeEnthalpy.h>
 #include <calculator/losses/LiquidLoadChargeMaterial.h>
 
 TEST_CASE( "Calculate Total Heat for Charge Material - Liquids", "[Total Heat][ChargeMaterial][Liquids]") {
     CHECK( LiquidLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC, 0.48, 240.0, 250.0, 0.25, 1000.0, 70.0, 320.0, 100.0, 25.0, 50.0, 0).getTotalHeat() == Approx(364100));
     CHECK( LiquidLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC, 0.347026510628135, 129.992, 239.0, 0.40004776689754, 10000.0, 50.0, 135.0, 100.0, 0.0, 0.0, 0).getTotalHeat() == Approx(2687628));
     CHECK( LiquidLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC, 0.347026510628135, 129.992, 239.0, 0.40004776689754, 10000.0, 50.0, 130.0, 10.0, 0.0, 0.0, 0).getTotalHeat() == Approx(516622));
-}
\ No newline at end of file
+}
+
+TEST_CASE( "Enthalpy curve of a liquid charge material", "[Total Heat][ChargeMaterial][Liquids]") {
+    LiquidLoadChargeMaterial liquid(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC, 0.48, 240.0, 250.0, 0.25, 1000.0, 70.0, 320.0, 100.0, 25.0, 50.0, 0);
+    const LoadChargeEnthalpy enthalpy(liquid);
+    CHECK( 1000.0 * (enthalpy.getHeatRequired(70.0, 320.0) + enthalpy.getReactionHeat()) == Approx(364100));
+
+    // one query per discharge temperature, on both sides of the vaporizing temperature
+    std::vector<double> initial(200, 70.0), discharge(200), heatRequired(200);
+    for (std::size_t i = 0; i < discharge.size(); i++) discharge[i] = 80.0 + 2.0 * i;
+    enthalpy.getHeatRequired(discharge.size(), initial.data(), discharge.data(), heatRequired.data());
+    for (std::size_t i = 0; i < discharge.size(); i++) {
+        liquid.setDischargeTemperature(discharge[i]);
+        CHECK( 1000.0 * (heatRequired[i] + enthalpy.getReactionHeat()) == Approx(liquid.getTotalHeat()));
+    }
+}
@@ -0,0 +1,100 @@
+#include "catch.hpp"
+#include <calculator/furnace/MultiZoneFurnace.h>
+
+namespace {
+    SolidLoadChargeMaterial makeCharge() {
+        return SolidLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC, 0.247910198232625, 169.0,
+                                       0.260090757105326, 1214.996, 10000.0, 2.0, 1.0, 70.0, 0.0, 250.0, 10.0, 10.0,
+                                       100.0, 0);
+    }
+
+    MultiZoneFurnace::Zone makeZone(const double grossHeatInput, const double flueGasTemperature) {
+        MultiZoneFurnace::Zone zone;
+        zone.grossHeatInput = grossHeatInput;
+        zone.losses.walls.push_back(WallLosses(500, 80, 225, 10, 0.9, 1.394, 1));
+        zone.losses.openings.push_back(OpeningLosses(0.95, 12, 9, 1.33, 75, 1600, 100, 0.70));
+        zone.losses.atmospheres.push_back(Atmosphere(100, 1400, 1200, 1, 0.02));
+        zone.losses.gasFlueGas = std::make_shared<GasFlueGasMaterial>(
+                flueGasTemperature, 9.0, 125, GasCompositions("", 94.1, 2.4, 1.41, 0.03, 0.49, 0.29, 0, 0.42, 0.71, 0, 0), 125);
+        return zone;
+    }
+
+    MultiZoneFurnace::Furnace makeFurnace() {
+        MultiZoneFurnace::Furnace furnace;
+        furnace.charge = makeCharge();
+        furnace.zones.push_back(makeZone(2000000, 700));
+        furnace.zones.push_back(makeZone(2500000, 900));
+        furnace.zones.push_back(makeZone(1500000, 1100));
+        furnace.zones.push_back(makeZone(1000000, 1200));
+        return furnace;
+    }
+}
+
+TEST_CASE( "Multi-zone furnace", "[MultiZoneFurnace][PHAST]") {
+    auto const furnace = makeFurnace();
+    auto const results = MultiZoneFurnace::simulate(furnace);
+    REQUIRE( results.zones.size() == 4);
+
+    auto const firstZone = FurnaceHeatBalance::calculate(furnace.zones[0].losses);
+    CHECK( results.zones[0].walls == Approx(404627.551342992));
+    CHECK( results.zones[0].openings == Approx(16038.269976979091));
+    CHECK( results.zones[0].atmospheres == Approx(31200));
+    CHECK( results.zones[0].totalLosses == Approx(firstZone.totalNetHeatRequired));
+    CHECK( results.zones[0].availableHeat == Approx(firstZone.availableHeat));
+    CHECK( results.zones[0].heatToCharge
+           == Approx(2000000 * firstZone.availableHeat / 100 - firstZone.totalNetHeatRequired));
+    CHECK( results.zones[0].chargeInletTemperature == Approx(70));
+
+    double heatToCharge = 0;
+    for (std::size_t i = 0; i < results.zones.size(); i++) {
+        heatToCharge += results.zones[i].heatToCharge;
+        if (i > 0) CHECK( results.zones[i].chargeInletTemperature == results.zones[i - 1].chargeOutletTemperature);
+        CHECK( results.zones[i].chargeOutletTemperature > results.zones[i].chargeInletTemperature);
+    }
+    CHECK( results.heatToCharge == Approx(heatToCharge));
+    CHECK( results.grossHeatInput == Approx(7000000));
+    CHECK( results.efficiency == Approx(heatToCharge / 7000000 * 100));
+    CHECK( results.dischargeTemperature == results.zones.back().chargeOutletTemperature);
+    CHECK( results.dischargeTemperature > 1214.996);
+
+    // the charge heated in one step to the discharge temperature takes up the same heat
+    auto charge = makeCharge();
+    charge.setDischargeTemperature(results.dischargeTemperature);
+    CHECK( charge.getTotalHeat() == Approx(results.heatToCharge));
+}
+
+TEST_CASE( "Multi-zone furnace, electric zones and parallel furnaces", "[MultiZoneFurnace][PHAST]") {
+    MultiZoneFurnace::Furnace electric;
+    electric.charge = makeCharge();
+    electric.charge.setWaterContentCharged(0);
+    electric.charge.setWaterContentDischarged(0);
+    electric.charge.setChargedReacted(0);
+    electric.zones.push_back(MultiZoneFurnace::Zone{FurnaceHeatBalance::Furnace(), 247910.198232625});
+    electric.zones.push_back(MultiZoneFurnace::Zone{FurnaceHeatBalance::Furnace(), -247910.198232625 / 2});
+    auto const results = MultiZoneFurnace::simulate(electric);
+    CHECK( results.zones[0].availableHeat == Approx(100));
+    CHECK( results.zones[0].chargeOutletTemperature == Approx(170));
+    CHECK( results.zones[1].chargeOutletTemperature == Approx(120));
+    CHECK( results.efficiency == Approx(100));
+
+    // the loss calculators are not assignable, so the furnaces are built in place
+    std::vector<MultiZoneFurnace::Furnace> furnaces;
+    for (int i = 0; i < 9; i++) furnaces.push_back(i == 4 ? electric : makeFurnace());
+    furnaces[7].zones.pop_back();
+    auto const serial = MultiZoneFurnace::simulate(furnaces, 1);
+    auto const parallel = MultiZoneFurnace::simulate(furnaces, 4);
+    REQUIRE( parallel.size() == 9);
+    for (std::size_t i = 0; i < furnaces.size(); i++) {
+        CHECK( parallel[i].dischargeTemperature == serial[i].dischargeTemperature);
+        CHECK( parallel[i].zones.size() == furnaces[i].zones.size());
+    }
+    CHECK( parallel[4].dischargeTemperature == Approx(120));
+    CHECK( parallel[7].dischargeTemperature < parallel[0].dischargeTemperature);
+    CHECK( MultiZoneFurnace::simulate(std::vector<MultiZoneFurnace::Furnace>()).empty());
+
+    auto invalid = makeFurnace();
+    invalid.zones[2].losses.solidChargeMaterials.push_back(makeCharge());
+    CHECK_THROWS_AS( MultiZoneFurnace::simulate(invalid), std::runtime_error &);
+    furnaces[3].charge.setChargeFeedRate(0);
+    CHECK_THROWS_AS( MultiZoneFurnace::simulate(furnaces, 3), std::runtime_error &);
+}
@@ -41,3 +41,20 @@ TEST_CASE( "Calculate o2 enrichment 4", "[O2Enrichment][Calculator]") {
     CHECK( o2Enrichment.getFuelSavingsEnriched() == Approx(25.9925816002));
     CHECK( o2Enrichment.getFuelConsumptionEnriched() == Approx(7.40074184));
 }
+
+TEST_CASE( "Calculate o2 enrichment - inputs set at once and changed after a read", "[O2Enrichment][Calculator]") {
+    auto o2Enrichment = O2Enrichment();
+    o2Enrichment.setInputs(21, 100, 2200, 2300, 8, 3, 1100, 110, 10);
+    CHECK( o2Enrichment.getAvailableHeat() == Approx( 49.1204784776));
+    CHECK( o2Enrichment.getFuelSavingsEnriched() == Approx(25.9925816002));
+
+    o2Enrichment.setCombAirTemp(900);
+    o2Enrichment.setCombAirTempEnriched(80);
+    CHECK( o2Enrichment.getAvailableHeat() == Approx(42.6248055296));
+    CHECK( o2Enrichment.getAvailableHeatEnriched() == Approx(65.7672982588));
+    CHECK( o2Enrichment.getFuelSavingsEnriched() == Approx(35.1884497948));
+
+    o2Enrichment.setInputs(21, 100, 1800, 1900, 5, 1, 900, 80, 10);
+    CHECK( o2Enrichment.getAvailableHeat() == Approx(61.97));
+    CHECK( o2Enrichment.getFuelConsumptionEnriched() == Approx(8.3494178697));
+}
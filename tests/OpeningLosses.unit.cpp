@@ -1,5 +1,8 @@
 #include "catch.hpp"
 #include <calculator/losses/OpeningLosses.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 TEST_CASE( "Calculate Heat Loss for opening Losses", "[Heat Loss]" ) {
     // Circular
@@ -29,3 +32,50 @@ TEST_CASE( "Calculate viewFactor for Opening Losses", "[Heat Loss][viewFactor]"
     CHECK(opening.calculateViewFactor(0.5, 3, 4) == Approx(0.876666666245));
     CHECK(opening.calculateViewFactor(14.05, 3, 3) == Approx(0.2044991347));
 }
+
+TEST_CASE( "Calculate Heat Loss for a series of opening temperatures", "[Heat Loss]" ) {
+    const OpeningLosses circular(0.95, 12.0, 9.0, 1.33, 75.0, 1600.0, 100.0, 0.70);
+    const std::vector<double> insideTemperature = {1600.0, 1800.0, 1200.0};
+    const std::vector<double> percentTimeOpen = {100.0, 50.0, 20.0};
+    std::vector<double> heatLoss(3);
+
+    circular.getHeatLossSeries(3, insideTemperature.data(), nullptr, percentTimeOpen.data(), heatLoss.data());
+    CHECK( heatLoss[0] == Approx(16038.269976979091) );
+    for (std::size_t i = 0; i < 3; i++) {
+        CHECK( heatLoss[i] == Approx(OpeningLosses(0.95, 12.0, 9.0, 1.33, 75.0, insideTemperature[i],
+                                                   percentTimeOpen[i], 0.70).getHeatLoss()) );
+    }
+
+    const OpeningLosses quad(0.95, 48.0, 15.0, 9.0, 1.67, 75.0, 1600.0, 20.0, 0.64);
+    quad.getHeatLossSeries(3, insideTemperature.data(), nullptr, nullptr, heatLoss.data());
+    CHECK( heatLoss[0] == Approx(18670.2258869289) );
+    for (std::size_t i = 0; i < 3; i++) {
+        CHECK( heatLoss[i] == Approx(OpeningLosses(0.95, 48.0, 15.0, 9.0, 1.67, 75.0, insideTemperature[i], 20.0,
+                                                   0.64).getHeatLoss()) );
+    }
+}
+
+TEST_CASE( "Interpolate viewFactor for Opening Losses", "[Heat Loss][viewFactor]" ) {
+    auto opening = OpeningLosses();
+    double maxError = 0;
+    for (double thickness = 0; thickness <= 60; thickness += 0.37) {
+        for (double diameter = 0.25; diameter <= 60; diameter += 0.53) {
+            maxError = std::max(maxError, std::fabs(OpeningLosses::interpolateViewFactor(thickness, diameter)
+                                                    - opening.calculateViewFactor(thickness, diameter)));
+            for (double height = 0.25; height <= 60; height += 2.9) {
+                maxError = std::max(maxError, std::fabs(OpeningLosses::interpolateViewFactor(thickness, diameter, height)
+                                                        - opening.calculateViewFactor(thickness, diameter, height)));
+            }
+        }
+    }
+    CHECK(maxError < 2e-5);
+
+    CHECK(OpeningLosses::interpolateViewFactor(3, 5) == Approx(0.624519890259).epsilon(1e-4));
+    CHECK(OpeningLosses::interpolateViewFactor(0, 5) == Approx(0.86));
+    CHECK(OpeningLosses::interpolateViewFactor(50, 5) == Approx(0.098254464286).epsilon(1e-4));
+    CHECK(OpeningLosses::interpolateViewFactor(5, 5, 10) == Approx(0.60).epsilon(1e-4));
+    CHECK(OpeningLosses::interpolateViewFactor(1, 10, 5) == Approx(0.88).epsilon(1e-4));
+    CHECK(OpeningLosses::interpolateViewFactor(14.05, 3, 3) == Approx(0.2044991347).epsilon(1e-4));
+    CHECK(OpeningLosses::interpolateViewFactor(5, 0) == 0);
+    CHECK(OpeningLosses::interpolateViewFactor(5, 0, 10) == 0);
+}
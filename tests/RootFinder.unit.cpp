@@ -0,0 +1,41 @@
+#include "catch.hpp"
+#include <calculator/util/RootFinder.h>
+
+TEST_CASE( "RootFinder brent", "[RootFinder]" ) {
+	int evaluations = 0;
+	auto const cubic = [&evaluations](const double x) {
+		evaluations++;
+		return x * x * x - 2 * x - 5;
+	};
+
+	auto const result = RootFinder::brent(cubic, 2, 3, 1e-12);
+	CHECK(result.converged);
+	CHECK(result.root == Approx(2.0945514815423265).epsilon(1e-12));
+	CHECK(result.iterations == evaluations);
+	CHECK(result.iterations < 15);
+
+	CHECK(RootFinder::brent(cubic, 3, 2, 1e-12).root == Approx(2.0945514815423265).epsilon(1e-12));
+	CHECK(RootFinder::brent(cubic, 2, 3, 1e-3).iterations < result.iterations);
+	CHECK_FALSE(RootFinder::brent(cubic, 2, 3, 1e-12, 4).converged);
+	CHECK_THROWS(RootFinder::brent(cubic, 3, 4, 1e-12));
+}
+
+TEST_CASE( "RootFinder bracketAndSolve", "[RootFinder]" ) {
+	auto const saturating = [](const double x) { return x / (1 + x) - 0.9; };
+
+	auto result = RootFinder::bracketAndSolve(saturating, 0, 0.5, 1000, 1e-12);
+	CHECK(result.converged);
+	CHECK(result.root == Approx(9).epsilon(1e-12));
+
+	result = RootFinder::bracketAndSolve(saturating, 0, 20, 1000, 1e-12);
+	CHECK(result.converged);
+	CHECK(result.root == Approx(9).epsilon(1e-12));
+
+	auto const unreachable = [](const double x) { return x / (1 + x) - 1.5; };
+	result = RootFinder::bracketAndSolve(unreachable, 0, 0.5, 1000, 1e-12);
+	CHECK_FALSE(result.converged);
+	CHECK(result.root == 1000);
+
+	CHECK_THROWS(RootFinder::bracketAndSolve(saturating, 0, 0, 1000, 1e-12));
+	CHECK_THROWS(RootFinder::bracketAndSolve(saturating, 0, 2000, 1000, 1e-12));
+}
@@ -3,13 +3,13 @@
 
 TEST_CASE( "Calculate SolidLiquidFlueGasMaterial Heat Loss", "[Heat Loss]" ) {
 	auto excessAir = SolidLiquidFlueGasMaterial::calculateExcessAirFromFlueGasO2(0.005, 1.0, 75.0, 5.0, 1.0, 9.0, 7.0, 0.0, 1.5);
-	CHECK(excessAir == Approx(0.0229427817));
+	CHECK(excessAir == Approx(0.0232418944));
 
 	excessAir = SolidLiquidFlueGasMaterial::calculateExcessAirFromFlueGasO2(0.03, 1.0, 75.0, 5.0, 1.0, 9.0, 7.0, 0.0, 1.5);
-	CHECK(excessAir == Approx(0.1536865757));
+	CHECK(excessAir == Approx(0.1570518558));
 
 	excessAir = SolidLiquidFlueGasMaterial::calculateExcessAirFromFlueGasO2(0.07, 1.0, 75.0, 5.0, 1.0, 9.0, 7.0, 0.0, 1.5);
-	CHECK(excessAir == Approx(0.4475000362));
+	CHECK(excessAir == Approx(0.4591813219));
 
 	CHECK(SolidLiquidFlueGasMaterial::calculateFlueGasO2(0.0229427817, 1.0, 75, 5, 1, 9, 7, 0, 1.5) == Approx(0.0049370451));
 	CHECK(SolidLiquidFlueGasMaterial::calculateFlueGasO2(0.1536865757, 1.0, 75, 5, 1, 9, 7, 0, 1.5) == Approx(0.0294401415));
@@ -19,4 +19,18 @@ TEST_CASE( "Calculate SolidLiquidFlueGasMaterial Heat Loss", "[Heat Loss]" ) {
 	CHECK(SolidLiquidFlueGasMaterial(700, 15.36865757, 125, 70, 1.0, 100, 1.5, 75.0, 5.0, 1.0, 9.0, 7.0, 0.0, 1.5).getHeatLoss() == Approx(0.8151987637));
 	CHECK(SolidLiquidFlueGasMaterial(700, 44.75000362, 125, 70, 1.0, 100, 1.5, 75.0, 5.0, 1.0, 9.0, 7.0, 0.0, 1.5).getHeatLoss() == Approx(0.7824331922));
 	CHECK(SolidLiquidFlueGasMaterial(700, 9.0, 125, 70, 1.0, 100, 1.5, 75.0, 5.0, 1.0, 9.0, 7.0, 0.0, 1.5).getHeatLoss() == Approx(0.8223));
-}
\ No newline at end of file
+}
+
+TEST_CASE( "SolidLiquidFlueGasMaterial excess air solved to tolerance", "[Heat Loss]" ) {
+	for (auto const flueGasO2 : {0.005, 0.03, 0.07, 0.15}) {
+		auto const result = SolidLiquidFlueGasMaterial::solveExcessAirFromFlueGasO2(
+				flueGasO2, 1.0, 75.0, 5.0, 1.0, 9.0, 7.0, 0.0, 1.5, 1e-10);
+		CHECK(result.converged);
+		CHECK(result.iterations <= 10);
+		CHECK(SolidLiquidFlueGasMaterial::calculateFlueGasO2(result.root, 1.0, 75.0, 5.0, 1.0, 9.0, 7.0, 0.0, 1.5)
+		      == Approx(flueGasO2).epsilon(1e-9));
+	}
+
+	CHECK_FALSE(SolidLiquidFlueGasMaterial::solveExcessAirFromFlueGasO2(
+			0.25, 1.0, 75.0, 5.0, 1.0, 9.0, 7.0, 0.0, 1.5, 1e-10).converged);
+}
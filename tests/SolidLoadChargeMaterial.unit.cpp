@@ -1,5 +1,6 @@
 #include "catch.hpp"
 #include <calculator/losses/LoadChargeMaterial.h>
+#include <calculator/losses/LoadChargeEnthalpy.h>
 #include <calculator/losses/SolidLoadChargeMaterial.h>
 
 TEST_CASE( "Calculate Total Heat for Charge Material - Solids", "[Total Heat][ChargeMaterial][Solids]") {
@@ -12,4 +13,21 @@ TEST_CASE( "Calculate Total Heat for Charge Material - Solids", "[Total Heat][Ch
     CHECK(SolidLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::EXOTHERMIC, 0.150, 60.0, 0.481, 2900.0, 10000.0, 0.1, 0.0, 70.0, 2200.0, 500.0, 0.0, 1.0, 100, 0).getTotalHeat() == Approx(3204310));
     CHECK(SolidLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::EXOTHERMIC, 0.247910198232625, 169.0, 0.260090757105326, 1214.996, 10000.0, 0.0, 0.0, 100.0, 1300.0, 220.0, 100.0, 0.0, 100.0, 0).getTotalHeat() == Approx(4675276));
     CHECK(SolidLoadChargeMaterial(LoadChargeMaterial::ThermicReactionType::EXOTHERMIC, 0.247910198232625, 169.0, 0.260090757105326, 1214.996, 10000.0, 0.0, 0.0, 100.0, 1215.0, 220.0, 10.0, 0.0, 100.0, 0).getTotalHeat() == Approx(2933199));
-}
\ No newline at end of file
+}
+
+TEST_CASE( "Enthalpy curve of a solid charge material", "[Total Heat][ChargeMaterial][Solids]") {
+    // dry charges, so the whole of the total heat is heat to the solid
+    SolidLoadChargeMaterial melted(LoadChargeMaterial::ThermicReactionType::EXOTHERMIC, 0.247910198232625, 169.0, 0.260090757105326, 1214.996, 10000.0, 0.0, 0.0, 100.0, 1300.0, 220.0, 100.0, 0.0, 100.0, 0);
+    CHECK( 10000.0 * LoadChargeEnthalpy(melted).getHeatRequired(100.0, 1300.0) == Approx(melted.getTotalHeat()));
+    CHECK( LoadChargeEnthalpy(melted).getReactionHeat() == Approx(0));
+
+    SolidLoadChargeMaterial partlyMelted(LoadChargeMaterial::ThermicReactionType::ENDOTHERMIC, 0.247910198232625, 169.0, 0.260090757105326, 1214.996, 10000.0, 0.0, 0.0, 100.0, 1215.0, 220.0, 10.0, 20.0, 100.0, 0);
+    const LoadChargeEnthalpy enthalpy(partlyMelted);
+    CHECK( 10000.0 * (enthalpy.getHeatRequired(100.0, 1215.0) + enthalpy.getReactionHeat()) == Approx(partlyMelted.getTotalHeat()));
+    CHECK( enthalpy.getReactionHeat() == Approx(20.0));
+
+    // heating in steps takes the same heat as heating in one step, and cooling gives it back
+    CHECK( enthalpy.getHeatRequired(100.0, 700.0) + enthalpy.getHeatRequired(700.0, 1400.0) == Approx(enthalpy.getHeatRequired(100.0, 1400.0)));
+    CHECK( enthalpy.getHeatRequired(1400.0, 100.0) == Approx(-enthalpy.getHeatRequired(100.0, 1400.0)));
+    CHECK( enthalpy.getEnthalpy(1214.996) - enthalpy.getEnthalpy(1214.995) == Approx(0.1 * 169.0).epsilon(0.001));
+}
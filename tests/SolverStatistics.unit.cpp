@@ -0,0 +1,66 @@
+#include <catch.hpp>
+#include <calculator/util/SolverStatistics.h>
+#include <calculator/losses/SolidLiquidFlueGasMaterial.h>
+#include <stdexcept>
+
+TEST_CASE( "SolverStatistics histogram buckets", "[SolverStatistics]") {
+	CHECK(SolverStatistics::getBucket(0) == 0);
+	CHECK(SolverStatistics::getBucket(1) == 1);
+	CHECK(SolverStatistics::getBucket(3) == 2);
+	CHECK(SolverStatistics::getBucket(4) == 3);
+	CHECK(SolverStatistics::getBucket(1000000) == SolverStatistics::HISTOGRAM_BUCKETS - 1);
+	CHECK(SolverStatistics::getBucketUpperBound(0) == 0);
+	CHECK(SolverStatistics::getBucketUpperBound(3) == 7);
+}
+
+TEST_CASE( "SolverScope records iterations, failures and nesting", "[SolverStatistics]") {
+	SolverStatistics::reset();
+	{
+		SolverScope outer(Solver::FAN_CURVE);
+		SolverScope::iteration(Solver::FAN_CURVE);
+		{
+			SolverScope inner(Solver::FAN_CURVE);
+			for (auto i = 0; i < 5; i++) SolverScope::iteration(Solver::FAN_CURVE);
+		}
+		SolverScope::iteration(Solver::FAN_CURVE);
+		outer.converged();
+	}
+	try {
+		SolverScope failing(Solver::FAN_CURVE);
+		SolverScope::iteration(Solver::FAN_CURVE);
+		throw std::runtime_error("did not converge");
+	} catch (std::runtime_error const &) {}
+
+	auto const summary = SolverStatistics::getSummary(Solver::FAN_CURVE);
+	CHECK(summary.name == "fanCurve");
+	CHECK(summary.calls == 3);
+	CHECK(summary.iterations == 8);
+	CHECK(summary.maxIterations == 5);
+	CHECK(summary.failures == 2);
+	CHECK(summary.histogram[1] == 1);
+	CHECK(summary.histogram[2] == 1);
+	CHECK(summary.histogram[3] == 1);
+
+	SolverStatistics::reset();
+	CHECK(SolverStatistics::getSummary(Solver::FAN_CURVE).calls == 0);
+	CHECK(SolverStatistics::getSummaries().size() == static_cast<std::size_t>(SolverStatistics::SOLVER_COUNT));
+}
+
+TEST_CASE( "SolverStatistics counts instrumented solvers only when enabled", "[SolverStatistics]") {
+	SolverStatistics::reset();
+	CHECK(SolidLiquidFlueGasMaterial::calculateExcessAirFromFlueGasO2(0.03, 1.0, 75.0, 5.0, 1.0, 9.0, 7.0, 0.0, 1.5)
+	      == Approx(0.1570518558));
+	CHECK(SolidLiquidFlueGasMaterial::calculateExcessAirFromFlueGasO2(0.07, 1.0, 75.0, 5.0, 1.0, 9.0, 7.0, 0.0, 1.5)
+	      == Approx(0.4591813219));
+
+	auto const summary = SolverStatistics::getSummary(Solver::SOLID_LIQUID_EXCESS_AIR);
+	if (SolverStatistics::isEnabled()) {
+		CHECK(summary.calls == 2);
+		CHECK(summary.failures == 0);
+		CHECK(summary.iterations >= 2);
+	} else {
+		CHECK(summary.calls == 0);
+		CHECK(summary.iterations == 0);
+	}
+	SolverStatistics::reset();
+}
@@ -1,6 +1,26 @@
 #include "catch.hpp"
 #include <calculator/losses/WallLosses.h>
+#include <vector>
 
 TEST_CASE( "Calculate Heat Loss for furnace walls", "[Heat Loss]" ) {
     REQUIRE( WallLosses(500.0, 80.0, 225.0, 10.0, 0.9, 1.394, 1.0).getHeatLoss() == Approx( 404627.551342992 ) );
-}
\ No newline at end of file
+}
+
+TEST_CASE( "Calculate Heat Loss for a series of furnace wall temperatures", "[Heat Loss]" ) {
+    const WallLosses wall(500.0, 80.0, 225.0, 10.0, 0.9, 1.394, 1.0);
+    const std::vector<double> surfaceTemperature = {225.0, 300.0, 150.0};
+    const std::vector<double> ambientTemperature = {80.0, 70.0, 90.0};
+    std::vector<double> heatLoss(3);
+
+    wall.getHeatLossSeries(3, surfaceTemperature.data(), nullptr, heatLoss.data());
+    for (std::size_t i = 0; i < 3; i++) {
+        CHECK( heatLoss[i] == Approx(WallLosses(500.0, 80.0, surfaceTemperature[i], 10.0, 0.9, 1.394, 1.0).getHeatLoss()) );
+    }
+
+    wall.getHeatLossSeries(3, surfaceTemperature.data(), ambientTemperature.data(), heatLoss.data());
+    CHECK( heatLoss[0] == Approx( 404627.551342992 ) );
+    for (std::size_t i = 0; i < 3; i++) {
+        CHECK( heatLoss[i] == Approx(WallLosses(500.0, ambientTemperature[i], surfaceTemperature[i], 10.0, 0.9, 1.394,
+                                                1.0).getHeatLoss()) );
+    }
+}
@@ -0,0 +1,137 @@
+#include "catch.hpp"
+#include <wasteWater/WasteWaterAerationOptimizer.h>
+
+namespace {
+    // the plant of tests/WasteWaterTreatment.unit.cpp
+    WasteWater_Treatment makePlant()
+    {
+        return WasteWater_Treatment(20, 200, 1, 1, 40, 35, 0.85, 200, 20, 8, 10000, 3000, 0.1, 0.6, 60, 0.1, 8, 72, 2,
+                                    4.5, 0.84, 0.92, 2.7, 150, 200, 24, 1, 100, 0.09);
+    }
+
+    WasteWaterAerationOptimizer::Inputs makeInputs()
+    {
+        WasteWaterAerationOptimizer::Inputs inputs;
+        inputs.speeds = {50, 100, 5};
+        inputs.operatingTimes = {12, 24, 2};
+        inputs.operatingDOs = {1, 4.5, 0.5};
+        inputs.MLSSpars = {2000, 4000, 250};
+        inputs.maxEffluentCBOD5 = 5;
+        inputs.maxEffluentAmmonia_N = 1;
+        inputs.minMLSS = 1500;
+        inputs.maxMLSS = 4500;
+        return inputs;
+    }
+
+    bool dominates(const WasteWaterAerationOptimizer::Candidate &a, const WasteWaterAerationOptimizer::Candidate &b)
+    {
+        return a.AeCost <= b.AeCost && a.EffluentAmmonia_N <= b.EffluentAmmonia_N
+               && (a.AeCost < b.AeCost || a.EffluentAmmonia_N < b.EffluentAmmonia_N);
+    }
+}
+
+TEST_CASE("Waste Water Aeration Optimizer candidates", "[WasteWaterAerationOptimizer]")
+{
+    auto const plant = makePlant();
+    auto inputs = makeInputs();
+
+    // the current settings are the plant's results
+    auto const output = plant.calculate();
+    auto const baseline = WasteWaterAerationOptimizer::evaluate(plant, inputs, 100, 24, 4.5, 3000);
+    CHECK(baseline.SolidsRetentionTime == output.SolidsRetentionTime);
+    CHECK(baseline.MLSS == output.MLSS);
+    CHECK(baseline.EffluentAmmonia_N == output.EffluentAmmonia_N);
+    CHECK(baseline.TotalOxygenSupplied == output.TotalOxygenSupplied);
+    CHECK(baseline.OxygenRequired == output.TotalOxygenRequirements);
+    CHECK(baseline.AeCost == Approx(6318));
+    CHECK(WasteWaterAerationOptimizer::isFeasible(inputs, baseline));
+
+    // at half speed the aerators supply half the oxygen the process needs
+    auto const halfSpeed = WasteWaterAerationOptimizer::evaluate(plant, inputs, 50, 24, 4.5, 3000);
+    CHECK(halfSpeed.AeCost == Approx(3159));
+    CHECK(halfSpeed.TotalOxygenSupplied == Approx(output.TotalOxygenSupplied / 2));
+    CHECK_FALSE(WasteWaterAerationOptimizer::isFeasible(inputs, halfSpeed));
+
+    // a lower DO setpoint raises the field oxygen transfer rate
+    CHECK(WasteWaterAerationOptimizer::evaluate(plant, inputs, 100, 24, 2, 3000).TotalOxygenSupplied
+          > output.TotalOxygenSupplied);
+
+    inputs.denitrification = true;
+    CHECK(WasteWaterAerationOptimizer::evaluate(plant, inputs, 100, 24, 4.5, 3000).OxygenRequired
+          == output.TotalOxygenReqWDenit);
+}
+
+TEST_CASE("Waste Water Aeration Optimizer Pareto set", "[WasteWaterAerationOptimizer]")
+{
+    auto const plant = makePlant();
+    auto const inputs = makeInputs();
+    auto const results = WasteWaterAerationOptimizer::optimize(plant, inputs, 4);
+
+    CHECK(results.candidates == 11 * 7 * 8 * 9);
+    CHECK(results.baseline.AeCost == Approx(6318));
+    REQUIRE(results.paretoSet.size() > 1);
+
+    // brute force over the grid
+    std::vector<WasteWaterAerationOptimizer::Candidate> feasible;
+    for (double MLSSpar = 2000; MLSSpar <= 4000; MLSSpar += 250)
+        for (double OperatingDO = 1; OperatingDO <= 4.5; OperatingDO += 0.5)
+            for (double OperatingTime = 12; OperatingTime <= 24; OperatingTime += 2)
+                for (double Speed = 50; Speed <= 100; Speed += 5)
+                {
+                    auto const candidate = WasteWaterAerationOptimizer::evaluate(plant, inputs, Speed, OperatingTime,
+                                                                                  OperatingDO, MLSSpar);
+                    if (WasteWaterAerationOptimizer::isFeasible(inputs, candidate)) feasible.push_back(candidate);
+                }
+    CHECK(results.feasibleCandidates == feasible.size());
+
+    for (auto const &candidate : results.paretoSet)
+    {
+        CHECK(WasteWaterAerationOptimizer::isFeasible(inputs, candidate));
+        CHECK(candidate.EffluentAmmonia_N <= 1);
+        CHECK(candidate.TotalOxygenSupplied >= candidate.OxygenRequired);
+        for (auto const &other : feasible) CHECK_FALSE(dominates(other, candidate));
+    }
+    for (std::size_t i = 1; i < results.paretoSet.size(); i++)
+    {
+        CHECK(results.paretoSet[i - 1].AeCost < results.paretoSet[i].AeCost);
+        CHECK(results.paretoSet[i - 1].EffluentAmmonia_N > results.paretoSet[i].EffluentAmmonia_N);
+    }
+
+    // the optimal setting is the cheapest feasible one, and cheaper than the current settings
+    for (auto const &candidate : feasible) CHECK(results.paretoSet.front().AeCost <= candidate.AeCost);
+    CHECK(results.paretoSet.front().AeCost < results.baseline.AeCost);
+
+    // the blocks of any number of threads give the same set
+    auto const serial = WasteWaterAerationOptimizer::optimize(plant, inputs, 1);
+    REQUIRE(serial.paretoSet.size() == results.paretoSet.size());
+    for (std::size_t i = 0; i < serial.paretoSet.size(); i++)
+    {
+        CHECK(serial.paretoSet[i].Speed == results.paretoSet[i].Speed);
+        CHECK(serial.paretoSet[i].OperatingTime == results.paretoSet[i].OperatingTime);
+        CHECK(serial.paretoSet[i].OperatingDO == results.paretoSet[i].OperatingDO);
+        CHECK(serial.paretoSet[i].MLSSpar == results.paretoSet[i].MLSSpar);
+    }
+}
+
+TEST_CASE("Waste Water Aeration Optimizer errors", "[WasteWaterAerationOptimizer]")
+{
+    auto const plant = makePlant();
+    auto inputs = makeInputs();
+    inputs.speeds = {100, 50, 5};
+    CHECK_THROWS_AS(WasteWaterAerationOptimizer::optimize(plant, inputs), std::runtime_error &);
+    inputs.speeds = {50, 120, 10};
+    CHECK_THROWS_AS(WasteWaterAerationOptimizer::optimize(plant, inputs), std::runtime_error &);
+    inputs = makeInputs();
+    inputs.operatingTimes = {12, 24, 0};
+    CHECK_THROWS_AS(WasteWaterAerationOptimizer::optimize(plant, inputs), std::runtime_error &);
+    inputs = makeInputs();
+    inputs.operatingDOs = {-1, 2, 1};
+    CHECK_THROWS_AS(WasteWaterAerationOptimizer::optimize(plant, inputs), std::runtime_error &);
+
+    // no setting meets an ammonia limit below what the plant can reach
+    inputs = makeInputs();
+    inputs.maxEffluentAmmonia_N = 0;
+    auto const results = WasteWaterAerationOptimizer::optimize(plant, inputs);
+    CHECK(results.paretoSet.empty());
+    CHECK(results.feasibleCandidates == 0);
+}
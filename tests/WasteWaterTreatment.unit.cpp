@@ -37,4 +37,53 @@ TEST_CASE("Waste Water Treatment", "[Test 1]")
     REQUIRE(output.FieldOTR == Approx(0.94282));
     REQUIRE(output.AeEnergy == Approx(70200));
     REQUIRE(output.AeCost == Approx(6318));
-}
\ No newline at end of file
+}
+
+TEST_CASE("Waste Water Treatment without the SRT table", "[Test 1]")
+{
+    auto const compare = [](const WasteWater_Treatment::Output &results, const WasteWater_Treatment::Output &expected) {
+        CHECK(results.calculationsTable.empty());
+        CHECK(results.SolidsRetentionTime == expected.SolidsRetentionTime);
+        CHECK(results.FM_ratio == expected.FM_ratio);
+        CHECK(results.MLSS == expected.MLSS);
+        CHECK(results.MLVSS == expected.MLVSS);
+        CHECK(results.TSSSludgeProduction == expected.TSSSludgeProduction);
+        CHECK(results.TotalOxygenRequirements == expected.TotalOxygenRequirements);
+        CHECK(results.TotalOxygenReqWDenit == expected.TotalOxygenReqWDenit);
+        CHECK(results.RASFlowRate == expected.RASFlowRate);
+        CHECK(results.WASFlowRate == expected.WASFlowRate);
+        CHECK(results.TotalSludgeProduction == expected.TotalSludgeProduction);
+        CHECK(results.EffluentCBOD5 == expected.EffluentCBOD5);
+        CHECK(results.EffluentAmmonia_N == expected.EffluentAmmonia_N);
+        CHECK(results.EffluentNO3_N == expected.EffluentNO3_N);
+        CHECK(results.AeCost == expected.AeCost);
+    };
+
+    // the bisection finds the SRT of the table scan, below, across and beyond the MLSS of the table
+    std::vector<WasteWater_Treatment> scenarios;
+    for (const double MLSSpar : {100.0, 1000.0, 2500.0, 3000.0, 3082.5, 4500.0, 20000.0})
+    {
+        for (const double temperature : {12.0, 20.0, 28.0})
+        {
+            scenarios.emplace_back(temperature, 200, 1, 1, 40, 35, 0.85, 200, 20, 8, 10000, MLSSpar, 0.1, 0.6, 60, 0.1,
+                                   8, 72, 2, 4.5, 0.84, 0.92, 2.7, 150, 200, 24, 1, 100, 0.09);
+            scenarios.emplace_back(temperature, 200, 1, 1, 40, 35, 0.85, 200, 20, 8, 10000, MLSSpar, 0.1, 0.6, 60, 0.1,
+                                   8, 500, 0.25, 4.5, 0.84, 0.92, 2.7, 150, 200, 24, 3, 80, 0.09);
+            // washout beyond the first SRT, where every row is checked
+            scenarios.emplace_back(temperature, 200, 1, 1, 40, 35, 0.85, 200, 20, 8, 10000, MLSSpar, 0.1, 0.6, 60, 0.1,
+                                   1.5, 72, 0.5, 4.5, 0.84, 0.92, 2.7, 150, 200, 24, 1, 100, 0.09);
+        }
+    }
+
+    auto const batch = WasteWater_Treatment::calculate(scenarios, 4);
+    REQUIRE(batch.size() == scenarios.size());
+    for (std::size_t i = 0; i < scenarios.size(); i++)
+    {
+        auto const expected = scenarios[i].calculate();
+        compare(scenarios[i].calculate(false), expected);
+        compare(batch[i], expected);
+    }
+
+    WasteWater_Treatment wasteWaterTreatment(20, 200, 1, 1, 40, 35, 0.85, 200, 20, 8, 10000, 3000, 0.1, 0.6, 60, 0.1, 8, 0.5, 2, 4.5, 0.84, 0.92, 2.7, 150, 200, 24, 1, 100, 0.09);
+    CHECK_THROWS_AS(wasteWaterTreatment.calculate(false), std::runtime_error &);
+}
@@ -0,0 +1,310 @@
+#ifndef AMO_TOOLS_SUITE_SSMTACCEPTANCEDATA_H
+#define AMO_TOOLS_SUITE_SSMTACCEPTANCEDATA_H
+
+#include <calculator/util/CsvLine.h>
+#include <ssmt/api/SteamModelerInput.h>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Column layout of one SSMT acceptance test data file (tests/at/csv), shared by all of the rows read from it.
+ * The expected data column range comes from ssmtTestConfig.csv.
+ */
+struct SsmtAcceptanceColumns {
+    std::string fileName;
+    std::vector<std::string> names;
+    std::unordered_map<std::string, std::size_t> indexes;
+    std::size_t expectedDataStartColumn;
+    std::size_t expectedDataEndColumn;
+
+    /**
+     * @param name std::string, column name from the header row
+     * @return std::size_t, index of the column
+     */
+    std::size_t index(const std::string &name) const {
+        auto const it = indexes.find(name);
+        if (it == indexes.end()) {
+            throw std::runtime_error("SsmtAcceptanceColumns: column '" + name + "' not found in " + fileName);
+        }
+        return it->second;
+    }
+};
+
+/**
+ * One row of an SSMT acceptance test data file. The conversions follow tests/at/js/ssmtTest.js and the
+ * SteamModelerInputDataMapper binding, so native tools build exactly the same SteamModelerInput as the Node
+ * acceptance tests do.
+ */
+class SsmtAcceptanceTestCase {
+public:
+    SsmtAcceptanceTestCase(std::shared_ptr<const SsmtAcceptanceColumns> columns, std::vector<std::string> values,
+                           const unsigned lineNumber)
+            : columns(std::move(columns)), values(std::move(values)), lineNumber(lineNumber) {}
+
+    /**
+     * @return bool, true when the 'enabled' column is "true" (case insensitive)
+     */
+    bool isEnabled() const { return isTrue(getString("enabled"), false); }
+
+    const std::string &getId() const { return getString("id"); }
+
+    const std::string &getTestName() const { return getString("testName"); }
+
+    const std::string &getTestDescription() const { return getString("testDescription"); }
+
+    const std::string &getFileName() const { return columns->fileName; }
+
+    unsigned getLineNumber() const { return lineNumber; }
+
+    /**
+     * @return std::string, identification of the row in the same form the Node acceptance tests log
+     */
+    std::string getIdentification() const {
+        return "id='" + getId() + "', name='" + getTestName() + "', description='" + getTestDescription() + "'";
+    }
+
+    /**
+     * @param name std::string, column name
+     * @return std::string, raw cell value
+     */
+    const std::string &getString(const std::string &name) const {
+        return values[columns->index(name)];
+    }
+
+    /**
+     * Same as JavaScript parseFloat: a blank or non-numeric cell is NaN.
+     * @param name std::string, column name
+     * @return double, cell value
+     */
+    double getDouble(const std::string &name) const {
+        return parseDouble(getString(name));
+    }
+
+    /**
+     * Same as JavaScript parseInt followed by the binding's integer conversion: a blank cell is 0.
+     * @param name std::string, column name
+     * @return int, cell value
+     */
+    int getInteger(const std::string &name) const {
+        const std::string &value = getString(name);
+        char *end = nullptr;
+        const long result = std::strtol(value.c_str(), &end, 10);
+        return end == value.c_str() ? 0 : static_cast<int>(result);
+    }
+
+    /**
+     * Same as the binding's getBoolFromString: "true" or "yes", case insensitive.
+     * @param name std::string, column name
+     * @return bool, cell value
+     */
+    bool getBool(const std::string &name) const { return isTrue(getString(name), true); }
+
+    /**
+     * @return std::vector<std::string>, names of the expected data (output) columns
+     */
+    std::vector<std::string> getExpectedDataNames() const {
+        return std::vector<std::string>(columns->names.begin() + columns->expectedDataStartColumn,
+                                        columns->names.begin() + columns->expectedDataEndColumn + 1);
+    }
+
+    /**
+     * @param name std::string, expected data column name
+     * @return bool, false when the expected cell is blank (unspecified)
+     */
+    bool isExpectedSpecified(const std::string &name) const { return !getString(name).empty(); }
+
+    SteamModelerInput makeSteamModelerInput() const {
+        // the Node tests pass baselinePowerDemand through as a string, which the binding converts to 0 when blank
+        const std::string &baselinePowerDemandValue = getString("baselinePowerDemand");
+        const double baselinePowerDemand = baselinePowerDemandValue.empty() ? 0 : parseDouble(baselinePowerDemandValue);
+
+        return {getBool("isBaselineCalc"), baselinePowerDemand, makeBoilerInput(), makeHeaderInput(),
+                makeOperationsInput(), makeTurbineInput()};
+    }
+
+private:
+    static double parseDouble(const std::string &value) {
+        char *end = nullptr;
+        const double result = std::strtod(value.c_str(), &end);
+        return end == value.c_str() ? std::numeric_limits<double>::quiet_NaN() : result;
+    }
+
+    static bool isTrue(const std::string &value, const bool acceptYes) {
+        std::string lower(value);
+        for (auto &c : lower) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        return lower == "true" || (acceptYes && lower == "yes");
+    }
+
+    BoilerInput makeBoilerInput() const {
+        return {getDouble("fuelType"), getDouble("fuel"), getDouble("combustionEfficiency"), getDouble("blowdownRate"),
+                getBool("blowdownFlashed"), getBool("preheatMakeupWater"), getDouble("steamTemperature"),
+                getDouble("deaeratorVentRate"), getDouble("deaeratorPressure"), getDouble("approachTemperature")};
+    }
+
+    HeaderInput makeHeaderInput() const {
+        const HeaderWithHighestPressure highPressureHeader(
+                getDouble("highPressureHeaderPressure"), getDouble("highPressureHeaderProcessSteamUsage"),
+                getDouble("highPressureHeaderCondensationRecoveryRate"), getDouble("highPressureHeaderHeatLoss"),
+                getDouble("highPressureHeaderCondensateReturnTemperature"),
+                getBool("highPressureHeaderFlashCondensateReturn"));
+
+        return {highPressureHeader, makeHeaderNotHighestPressure("mediumPressureHeader"),
+                makeHeaderNotHighestPressure("lowPressureHeader")};
+    }
+
+    std::shared_ptr<HeaderNotHighestPressure> makeHeaderNotHighestPressure(const std::string &prefix) const {
+        const double pressure = getDouble(prefix + "Pressure");
+        if (std::isnan(pressure)) return nullptr;
+
+        return std::make_shared<HeaderNotHighestPressure>(
+                pressure, getDouble(prefix + "ProcessSteamUsage"), getDouble(prefix + "CondensationRecoveryRate"),
+                getDouble(prefix + "HeatLoss"), getBool(prefix + "FlashCondensateIntoHeader"),
+                getBool(prefix + "DesuperheatSteamIntoNextHighest"), getDouble(prefix + "DesuperheatSteamTemperature"));
+    }
+
+    OperationsInput makeOperationsInput() const {
+        return {getDouble("sitePowerImport"), getDouble("makeUpWaterTemperature"), getDouble("operatingHoursPerYear"),
+                getDouble("fuelCosts"), getDouble("electricityCosts"), getDouble("makeUpWaterCosts")};
+    }
+
+    TurbineInput makeTurbineInput() const {
+        const CondensingTurbine condensingTurbine(
+                getDouble("condensingTurbineIsentropicEfficiency"), getDouble("condensingTurbineGenerationEfficiency"),
+                getDouble("condensingTurbineCondenserPressure"),
+                static_cast<CondensingTurbineOperation>(getInteger("condensingTurbineOperationType")),
+                getDouble("condensingTurbineOperationValue"), getBool("condensingTurbineUseTurbine"));
+
+        return {condensingTurbine, makePressureTurbine("highToLowTurbine"), makePressureTurbine("highToMediumTurbine"),
+                makePressureTurbine("mediumToLowTurbine")};
+    }
+
+    PressureTurbine makePressureTurbine(const std::string &prefix) const {
+        return {getDouble(prefix + "IsentropicEfficiency"), getDouble(prefix + "GenerationEfficiency"),
+                static_cast<PressureTurbineOperation>(getInteger(prefix + "OperationType")),
+                getDouble(prefix + "OperationValue1"), getDouble(prefix + "OperationValue2"),
+                getBool(prefix + "UseTurbine")};
+    }
+
+    std::shared_ptr<const SsmtAcceptanceColumns> columns;
+    std::vector<std::string> values;
+    unsigned lineNumber;
+};
+
+/**
+ * Reads the SSMT acceptance test data in tests/at/csv with the bundled fast-cpp-csv-parser. Rows are streamed one
+ * line at a time, so generated data files with thousands of cases are never held in memory as a whole.
+ */
+class SsmtAcceptanceTestData {
+public:
+    /**
+     * Converts a spreadsheet-format lettered column ("a", "bq", "wf") to a 0 based column index.
+     * @param column std::string, lettered column
+     * @return std::size_t, column index
+     */
+    static std::size_t convertColumnToIndex(const std::string &column) {
+        if (column.empty()) throw std::runtime_error("SsmtAcceptanceTestData: empty column title");
+        std::size_t index = 0;
+        for (auto const c : column) {
+            const int charNum = std::tolower(static_cast<unsigned char>(c)) - 'a' + 1;
+            if (charNum < 1 || charNum > 26) {
+                throw std::runtime_error("SsmtAcceptanceTestData: invalid column title '" + column
+                                         + "', column titles must contain only characters 'a'-'z'");
+            }
+            index = index * 26 + charNum;
+        }
+        return index - 1;
+    }
+
+    /**
+     * Streams every row of every data file listed in ssmtTestConfig.csv, disabled rows included.
+     * @param csvDirectory std::string, directory containing ssmtTestConfig.csv and the data files
+     * @param callback function called with each row in file order
+     */
+    static void forEachTestCase(const std::string &csvDirectory,
+                                const std::function<void(SsmtAcceptanceTestCase &&)> &callback) {
+        io::LineReader config(csvDirectory + "/ssmtTestConfig.csv");
+        const std::vector<std::string> configNames = splitLine(config.next_line(), config);
+        std::unordered_map<std::string, std::size_t> configIndexes;
+        for (std::size_t i = 0; i < configNames.size(); i++) configIndexes[configNames[i]] = i;
+
+        auto const configValue = [&configIndexes](const std::vector<std::string> &entry, const std::string &name) {
+            auto const it = configIndexes.find(name);
+            if (it == configIndexes.end() || it->second >= entry.size()) {
+                throw std::runtime_error("SsmtAcceptanceTestData: ssmtTestConfig.csv is missing '" + name + "'");
+            }
+            return entry[it->second];
+        };
+
+        while (char *line = config.next_line()) {
+            if (*line == '\0') continue;
+            const std::vector<std::string> entry = splitLine(line, config);
+            forEachTestCaseInFile(csvDirectory, configValue(entry, "testDataFileName"),
+                                  convertColumnToIndex(configValue(entry, "expectedDataStartColumn")),
+                                  convertColumnToIndex(configValue(entry, "expectedDataEndColumn")), callback);
+        }
+    }
+
+    /**
+     * @param csvDirectory std::string, directory containing ssmtTestConfig.csv and the data files
+     * @return std::vector<SsmtAcceptanceTestCase>, every row of every configured data file
+     */
+    static std::vector<SsmtAcceptanceTestCase> load(const std::string &csvDirectory) {
+        std::vector<SsmtAcceptanceTestCase> testCases;
+        forEachTestCase(csvDirectory, [&testCases](SsmtAcceptanceTestCase &&testCase) {
+            testCases.push_back(std::move(testCase));
+        });
+        return testCases;
+    }
+
+private:
+    static void forEachTestCaseInFile(const std::string &csvDirectory, const std::string &testDataFileName,
+                                      const std::size_t expectedDataStartColumn,
+                                      const std::size_t expectedDataEndColumn,
+                                      const std::function<void(SsmtAcceptanceTestCase &&)> &callback) {
+        io::LineReader data(csvDirectory + "/" + testDataFileName + ".csv");
+
+        auto columns = std::make_shared<SsmtAcceptanceColumns>();
+        columns->fileName = testDataFileName;
+        columns->names = splitLine(data.next_line(), data);
+        for (std::size_t i = 0; i < columns->names.size(); i++) columns->indexes[columns->names[i]] = i;
+        columns->expectedDataStartColumn = expectedDataStartColumn;
+        columns->expectedDataEndColumn = expectedDataEndColumn;
+
+        if (expectedDataStartColumn > expectedDataEndColumn || expectedDataEndColumn >= columns->names.size()) {
+            throw std::runtime_error("SsmtAcceptanceTestData: expected data columns are out of range for "
+                                     + testDataFileName);
+        }
+
+        const std::shared_ptr<const SsmtAcceptanceColumns> sharedColumns = columns;
+        while (char *line = data.next_line()) {
+            if (*line == '\0') continue;
+            std::vector<std::string> values = splitLine(line, data);
+            if (values.size() != sharedColumns->names.size()) {
+                throw std::runtime_error("SsmtAcceptanceTestData: " + testDataFileName + " line "
+                                         + std::to_string(data.get_file_line()) + " has "
+                                         + std::to_string(values.size()) + " columns, expected "
+                                         + std::to_string(sharedColumns->names.size()));
+            }
+            callback(SsmtAcceptanceTestCase(sharedColumns, std::move(values), data.get_file_line()));
+        }
+    }
+
+    static std::vector<std::string> splitLine(char *line, const io::LineReader &reader) {
+        if (line == nullptr) {
+            throw std::runtime_error("SsmtAcceptanceTestData: " + std::string(reader.get_truncated_file_name())
+                                     + " has no header row");
+        }
+
+        return CsvLine::split(line);
+    }
+};
+
+#endif //AMO_TOOLS_SUITE_SSMTACCEPTANCEDATA_H
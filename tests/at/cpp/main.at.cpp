@@ -0,0 +1,389 @@
+#include "SsmtAcceptanceData.h"
+#include <ssmt/api/SteamModeler.h>
+#include <ssmt/api/SteamModelerOutputFlattener.h>
+#include <calculator/util/SilencedCout.h>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#ifndef AMO_SUITE_SOURCE_DIR
+#define AMO_SUITE_SOURCE_DIR "."
+#endif
+
+namespace {
+    struct Options {
+        std::string dataDirectory = std::string(AMO_SUITE_SOURCE_DIR) + "/tests/at/csv";
+        std::string filter;
+        std::string report;
+        std::size_t threads = std::max(1u, std::thread::hardware_concurrency());
+        double tolerance = 0.01;
+        bool verbose = false;
+    };
+
+    struct FieldDiff {
+        std::string name;
+        double actual;
+        bool isActualPresent;
+        std::string expected; ///< raw expected cell, blank when unspecified
+        double compareResult;
+        std::string message;
+    };
+
+    enum class Status {
+        PASS, FAIL, ERROR, SKIP
+    };
+
+    struct RowResult {
+        std::string fileName;
+        unsigned lineNumber = 0;
+        std::string id;
+        std::string identification;
+        Status status = Status::SKIP;
+        double milliseconds = 0;
+        std::size_t comparedFields = 0;
+        std::vector<FieldDiff> diffs;
+        std::string error;
+    };
+
+    struct PendingRow {
+        RowResult result;
+        bool isComplete = false;
+    };
+
+    /**
+     * Hands rows from the reader to the worker threads. The queue is bounded so a generated data file with
+     * thousands of cases is streamed rather than read into memory up front.
+     */
+    class WorkQueue {
+    public:
+        explicit WorkQueue(const std::size_t capacity) : capacity(capacity) {}
+
+        void push(std::pair<SsmtAcceptanceTestCase, PendingRow *> &&work) {
+            std::unique_lock<std::mutex> lock(mutex);
+            notFull.wait(lock, [this] { return queue.size() < capacity; });
+            queue.push_back(std::move(work));
+            notEmpty.notify_one();
+        }
+
+        /**
+         * @return bool, false once the queue is closed and drained
+         */
+        bool pop(std::unique_ptr<std::pair<SsmtAcceptanceTestCase, PendingRow *>> &work) {
+            std::unique_lock<std::mutex> lock(mutex);
+            notEmpty.wait(lock, [this] { return !queue.empty() || closed; });
+            if (queue.empty()) return false;
+            work.reset(new std::pair<SsmtAcceptanceTestCase, PendingRow *>(std::move(queue.front())));
+            queue.pop_front();
+            notFull.notify_one();
+            return true;
+        }
+
+        void close() {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+            notEmpty.notify_all();
+        }
+
+    private:
+        const std::size_t capacity;
+        std::deque<std::pair<SsmtAcceptanceTestCase, PendingRow *>> queue;
+        std::mutex mutex;
+        std::condition_variable notEmpty, notFull;
+        bool closed = false;
+    };
+
+    /**
+     * Holds the rows in input order from when the reader adds them until their results are emitted. A completed row
+     * is emitted and dropped as soon as every earlier row has been; the reader waits while capacity rows are
+     * pending, so the completed rows behind a slow one cannot pile up.
+     */
+    class ResultSequence {
+    public:
+        ResultSequence(const std::size_t capacity, std::function<void(const RowResult &)> emit)
+                : capacity(capacity), emit(std::move(emit)) {}
+
+        /**
+         * @return PendingRow &, the next row, valid until it is completed
+         */
+        PendingRow &add() {
+            std::unique_lock<std::mutex> lock(mutex);
+            notFull.wait(lock, [this] { return rows.size() < capacity; });
+            rows.emplace_back();
+            return rows.back();
+        }
+
+        /**
+         * Emits the row, and the completed rows after it, if every earlier row has been emitted
+         */
+        void complete(PendingRow &row) {
+            std::lock_guard<std::mutex> lock(mutex);
+            row.isComplete = true;
+            if (&row != &rows.front()) return;
+            while (!rows.empty() && rows.front().isComplete) {
+                emit(rows.front().result);
+                rows.pop_front();
+            }
+            notFull.notify_one();
+        }
+
+    private:
+        const std::size_t capacity;
+        const std::function<void(const RowResult &)> emit;
+        std::deque<PendingRow> rows; // deque, so references to rows survive adding and dropping at the ends
+        std::mutex mutex;
+        std::condition_variable notFull;
+    };
+
+    /**
+     * Same as the Node acceptance tests: relative difference, absolute when expected is 0. A blank expected cell
+     * means the field must not be present in the output.
+     */
+    double calcCompareResult(const SteamModelerOutputFlattener::Field *actual, const std::string &expected) {
+        const bool isActualPresent = actual != nullptr && actual->isPresent;
+        if (expected.empty()) return isActualPresent ? NAN : 0;
+        if (!isActualPresent) return NAN;
+
+        char *end = nullptr;
+        const double expectedValue = std::strtod(expected.c_str(), &end);
+        while (std::isspace(static_cast<unsigned char>(*end))) end++;
+        if (end == expected.c_str() || *end != '\0') return NAN;
+        const double diff = expectedValue - actual->value;
+        return expectedValue == 0 ? diff : diff / expectedValue;
+    }
+
+    std::vector<FieldDiff> compare(const SsmtAcceptanceTestCase &testCase,
+                                   const std::vector<SteamModelerOutputFlattener::Field> &actualFields,
+                                   const double tolerance) {
+        std::unordered_map<std::string, const SteamModelerOutputFlattener::Field *> actualByName;
+        for (auto const &field : actualFields) actualByName[field.name] = &field;
+
+        std::vector<FieldDiff> diffs;
+        const std::vector<std::string> expectedNames = testCase.getExpectedDataNames();
+        for (auto const &name : expectedNames) {
+            auto const it = actualByName.find(name);
+            const SteamModelerOutputFlattener::Field *actual = it == actualByName.end() ? nullptr : it->second;
+            const std::string &expected = testCase.getString(name);
+            const double result = calcCompareResult(actual, expected);
+            if (actual == nullptr || !(std::fabs(result) < tolerance)) {
+                diffs.push_back({name, actual ? actual->value : 0, actual != nullptr && actual->isPresent, expected,
+                                 result, actual == nullptr ? "expected data has a field the output does not" : ""});
+            }
+            if (actual != nullptr) actualByName.erase(it);
+        }
+        for (auto const &field : actualFields) {
+            if (actualByName.count(field.name) == 0) continue;
+            diffs.push_back({field.name, field.value, field.isPresent, "", NAN,
+                             "output has a field the expected data does not"});
+        }
+        return diffs;
+    }
+
+    void runTestCase(const SsmtAcceptanceTestCase &testCase, RowResult &result, const double tolerance) {
+        try {
+            const SteamModelerInput input = testCase.makeSteamModelerInput();
+            auto const start = std::chrono::steady_clock::now();
+            const SteamModelerOutput output = SteamModeler().model(input);
+            auto const end = std::chrono::steady_clock::now();
+            result.milliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+
+            result.comparedFields = testCase.getExpectedDataNames().size();
+            result.diffs = compare(testCase, SteamModelerOutputFlattener::flatten(output), tolerance);
+            result.status = result.diffs.empty() ? Status::PASS : Status::FAIL;
+        } catch (std::exception const &e) {
+            result.status = Status::ERROR;
+            result.error = e.what();
+        }
+    }
+
+    const char *statusName(const Status status) {
+        switch (status) {
+            case Status::PASS: return "pass";
+            case Status::FAIL: return "fail";
+            case Status::ERROR: return "error";
+            default: return "skip";
+        }
+    }
+
+    std::string formatValue(const double value, const bool isPresent) {
+        if (!isPresent) return "(none)";
+        std::ostringstream stream;
+        stream.precision(10);
+        stream << value;
+        return stream.str();
+    }
+
+    std::string escapeCsv(const std::string &value) {
+        if (value.find_first_of(",\"\n") == std::string::npos) return value;
+        std::string escaped = "\"";
+        for (auto const c : value) {
+            if (c == '"') escaped += '"';
+            escaped += c;
+        }
+        return escaped + "\"";
+    }
+
+    void printUsage(std::ostream &out) {
+        out << "Usage: amo_tools_suite_at [options]\n"
+            << "  --data-dir <dir>      acceptance test data directory (default <source>/tests/at/csv)\n"
+            << "  --filter <text>       run only rows whose id or test name contains <text>\n"
+            << "  --threads <n>         worker threads (default: hardware concurrency)\n"
+            << "  --tolerance <value>   relative tolerance, absolute when expected is 0 (default 0.01)\n"
+            << "  --report <file>       write one CSV line per row with status and timing to <file>\n"
+            << "  --verbose             list every row, not only failures\n";
+    }
+
+    Options parseOptions(int argc, char *argv[]) {
+        Options options;
+        for (int i = 1; i < argc; i++) {
+            const std::string arg = argv[i];
+            auto const value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::runtime_error("missing value for " + arg);
+                return argv[++i];
+            };
+
+            if (arg == "--data-dir") {
+                options.dataDirectory = value();
+            } else if (arg == "--filter") {
+                options.filter = value();
+            } else if (arg == "--threads") {
+                options.threads = std::stoul(value());
+                if (options.threads == 0) throw std::runtime_error("--threads must be at least 1");
+            } else if (arg == "--tolerance") {
+                options.tolerance = std::stod(value());
+                if (!(options.tolerance > 0)) throw std::runtime_error("--tolerance must be positive");
+            } else if (arg == "--report") {
+                options.report = value();
+            } else if (arg == "--verbose") {
+                options.verbose = true;
+            } else if (arg == "--help" || arg == "-h") {
+                printUsage(std::cout);
+                std::exit(0);
+            } else {
+                throw std::runtime_error("unknown option " + arg);
+            }
+        }
+        return options;
+    }
+
+    bool isSelected(const SsmtAcceptanceTestCase &testCase, const std::string &filter) {
+        return filter.empty() || testCase.getId().find(filter) != std::string::npos
+               || testCase.getTestName().find(filter) != std::string::npos;
+    }
+
+    double percentile(std::vector<double> values, const double fraction) {
+        if (values.empty()) return 0;
+        std::sort(values.begin(), values.end());
+        return values[static_cast<std::size_t>(fraction * (values.size() - 1) + 0.5)];
+    }
+}
+
+int main(int argc, char *argv[]) {
+    Options options;
+    try {
+        options = parseOptions(argc, argv);
+    } catch (std::exception const &e) {
+        std::cerr << "amo_tools_suite_at: " << e.what() << std::endl;
+        printUsage(std::cerr);
+        return 2;
+    }
+
+    // some steam calculations log to std::cout from the worker threads, which would interleave with the report
+    const SilencedCout silencedCout;
+    std::ostream out(silencedCout.getStandardOutput());
+
+    std::ofstream report;
+    if (!options.report.empty()) {
+        report.open(options.report);
+        if (!report) {
+            std::cerr << "amo_tools_suite_at: cannot write " << options.report << std::endl;
+            return 2;
+        }
+        report << "file,line,id,status,milliseconds,comparedFields,failedFields,error\n";
+        report.precision(6);
+    }
+
+    // only the counts and model times are kept for the summary; each row is printed and dropped in input order
+    std::size_t counts[4] = {0, 0, 0, 0};
+    std::vector<double> times;
+    ResultSequence results(8 * options.threads, [&](const RowResult &result) {
+        counts[static_cast<int>(result.status)]++;
+        if (result.status == Status::PASS || result.status == Status::FAIL) times.push_back(result.milliseconds);
+        if (report.is_open()) {
+            report << escapeCsv(result.fileName) << "," << result.lineNumber << "," << escapeCsv(result.id) << ","
+                   << statusName(result.status) << "," << result.milliseconds << "," << result.comparedFields << ","
+                   << result.diffs.size() << "," << escapeCsv(result.error) << "\n";
+        }
+
+        if (!options.verbose && (result.status == Status::PASS || result.status == Status::SKIP)) return;
+        out << std::left << std::setw(6) << statusName(result.status) << std::right << std::fixed
+            << std::setprecision(2) << std::setw(10) << result.milliseconds << " ms  " << result.fileName << ":"
+            << result.lineNumber << " " << result.identification << "\n";
+        out.unsetf(std::ios::floatfield);
+        if (result.status == Status::ERROR) out << "        " << result.error << "\n";
+        for (auto const &diff : result.diffs) {
+            out << "        " << diff.name << ": actual=" << formatValue(diff.actual, diff.isActualPresent)
+                << ", expected=" << (diff.expected.empty() ? "(none)" : diff.expected)
+                << ", compare result=" << formatValue(diff.compareResult, true)
+                << (diff.message.empty() ? "" : ", " + diff.message) << "\n";
+        }
+    });
+
+    WorkQueue queue(4 * options.threads);
+    std::vector<std::thread> workers;
+    for (std::size_t i = 0; i < options.threads; i++) {
+        workers.emplace_back([&queue, &results, &options] {
+            std::unique_ptr<std::pair<SsmtAcceptanceTestCase, PendingRow *>> work;
+            while (queue.pop(work)) {
+                runTestCase(work->first, work->second->result, options.tolerance);
+                results.complete(*work->second);
+            }
+        });
+    }
+
+    auto const start = std::chrono::steady_clock::now();
+    std::string loadError;
+    try {
+        SsmtAcceptanceTestData::forEachTestCase(options.dataDirectory, [&](SsmtAcceptanceTestCase &&testCase) {
+            if (!isSelected(testCase, options.filter)) return;
+            PendingRow &row = results.add();
+            row.result.fileName = testCase.getFileName();
+            row.result.lineNumber = testCase.getLineNumber();
+            row.result.id = testCase.getId();
+            row.result.identification = testCase.getIdentification();
+            if (testCase.isEnabled()) {
+                queue.push(std::make_pair(std::move(testCase), &row));
+            } else {
+                results.complete(row);
+            }
+        });
+    } catch (std::exception const &e) {
+        loadError = e.what();
+    }
+    queue.close();
+    for (auto &worker : workers) worker.join();
+    auto const end = std::chrono::steady_clock::now();
+
+    if (!loadError.empty()) {
+        std::cerr << "amo_tools_suite_at: " << loadError << std::endl;
+        return 2;
+    }
+
+    const double totalMilliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+    out << "rows: " << counts[0] + counts[1] + counts[2] + counts[3] << ", passed: " << counts[0] << ", failed: "
+        << counts[1] << ", errors: " << counts[2] << ", skipped: " << counts[3] << "\n"
+        << std::fixed << std::setprecision(2)
+        << "model time per row: median " << percentile(times, 0.5) << " ms, p95 " << percentile(times, 0.95)
+        << " ms, max " << percentile(times, 1) << " ms; wall time " << totalMilliseconds << " ms on "
+        << options.threads << " threads, tolerance " << options.tolerance << std::endl;
+
+    return counts[1] + counts[2] == 0 ? 0 : 1;
+}
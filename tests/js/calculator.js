@@ -845,6 +845,25 @@ test('Compressed Air Leak Survey Test All', function (t) {
     t.equal(rnd(res.annualTotalFlowRate), rnd(1179561304.616953));
 });
 
+test('Compressed Air Leak Survey CSV', function (t) {
+    t.plan(6);
+    t.type(bindings.compressedAirLeakSurveyCsv, 'function');
+
+    var fileName = require('path').join(require('os').tmpdir(), 'compressedAirLeakSurvey.csv');
+    require('fs').writeFileSync(fileName,
+        'area,hoursPerYear,utilityType,utilityCost,measurementMethod,units,leakRateEstimate,compressorControlAdjustment,compressorSpecificPower\n' +
+        'north,8640,1,0.12,0,1,0.1,0.40,0.16\n' +
+        'south,8640,1,0.12,0,1,0.1,0.40,0.16\n' +
+        'north,8640,1,0.12,0,1,0.1,0.40,0.16\n');
+
+    var res = bindings.compressedAirLeakSurveyCsv({fileName: fileName});
+    t.equal(res.leaks, 3, 'res.leaks is ' + res.leaks);
+    t.equal(rnd(res.annualTotalElectricity), rnd(3 * 55.296), 'res.annualTotalElectricity is ' + res.annualTotalElectricity);
+    t.equal(res.areas[0].area, 'north', 'res.areas[0].area is ' + res.areas[0].area);
+    t.equal(res.areas[0].leaks, 2, 'res.areas[0].leaks is ' + res.areas[0].leaks);
+    t.equal(res.methods[0].leaks, 3, 'res.methods[0].leaks is ' + res.methods[0].leaks);
+});
+
 test('Compressed Air Pressure Reduction - Baseline', function (t) {
     t.plan(3);
     t.type(bindings.compressedAirPressureReduction, 'function');
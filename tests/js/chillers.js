@@ -82,4 +82,89 @@ test('coolingTowerMakeupWater', function (t) {
     t.equal(rnd(res.wcBaseline), rnd(1980000), 'res.wcBaseline is ' + res.wcBaseline);
     t.equal(rnd(res.wcModification), rnd(1125000), 'res.wcModification is ' + res.wcModification);
     t.equal(rnd(res.waterSavings), rnd(855000), 'res.waterSavings is ' + res.waterSavings);
-});
\ No newline at end of file
+});
+test('coolingTowerHourlySimulation', function (t) {
+    t.plan(9);
+    t.type(bindings.coolingTowerHourlySimulation, 'function');
+
+    // the tower is off in the third hour; the loss correction factor is 0.8 at 70°F and 1.0 at 100°F
+    var inp = {
+        flowRate: 2500,
+        coolingLoad: [10, 10, 0],
+        dryBulbTemperature: [70, 100, 30],
+        evaporationCurve: {
+            dryBulbTemperature: [40, 100],
+            lossCorrectionFactor: [0.6, 1.0]
+        },
+        waterConservationBaselineData: {
+            cyclesOfConcentration: 3,
+            driftLossFactor: 0.002
+        },
+        waterConservationModificationData: {
+            cyclesOfConcentration: 6,
+            driftLossFactor: 0.0001
+        }
+    };
+
+    var res = bindings.coolingTowerHourlySimulation(inp);
+    t.equal(res.operationalHours, 2, 'res.operationalHours is ' + res.operationalHours);
+    t.same(res.baseline.makeupWater.map(rnd), [1740, 2100, 0], 'res.baseline.makeupWater is ' + res.baseline.makeupWater);
+    t.same(res.modification.makeupWater.map(rnd), [1167, 1455, 0], 'res.modification.makeupWater is ' + res.modification.makeupWater);
+    t.equal(rnd(res.baseline.totalMakeupWater), rnd(3840), 'res.baseline.totalMakeupWater is ' + res.baseline.totalMakeupWater);
+    t.equal(rnd(res.modification.totalMakeupWater), rnd(2622), 'res.modification.totalMakeupWater is ' + res.modification.totalMakeupWater);
+    t.equal(rnd(res.waterSavings), rnd(1218), 'res.waterSavings is ' + res.waterSavings);
+
+    // without weather the loss correction factor holds in every hour
+    delete inp.dryBulbTemperature;
+    inp.lossCorrectionFactor = 1.0;
+    res = bindings.coolingTowerHourlySimulation(inp);
+    t.equal(rnd(res.baseline.totalEvaporation), rnd(2400), 'res.baseline.totalEvaporation is ' + res.baseline.totalEvaporation);
+    t.equal(rnd(res.modification.totalBlowDown), rnd(480), 'res.modification.totalBlowDown is ' + res.modification.totalBlowDown);
+});
+
+test('chillerPlantSimulation', function (t) {
+    t.plan(10);
+    t.type(bindings.chillerPlantSimulation, 'function');
+
+    // one chiller with the curves of tests/ChillerPlant.unit.cpp, off in the second hour, without tower fans
+    var inp = {
+        chillers: [{
+            capacity: 500,
+            fullLoadEfficiency: 0.6,
+            partLoadRatio: [0.25, 0.5, 0.75, 1],
+            partLoadPower: [0.19375, 0.375, 0.64375, 1],
+            partLoadCurveDegree: 2,
+            condenserWaterTemperature: [65, 75, 85],
+            condenserWaterPower: [0.8, 0.9, 1],
+            condenserWaterCurveDegree: 1,
+            condenserWaterFlow: 1500,
+            chilledWaterPumpPower: 80,
+            condenserWaterPumpPower: 40
+        }],
+        coolingTower: {
+            approach: 7,
+            condenserWaterSetpoint: 85,
+            condenserWaterReset: false,
+            minimumCondenserWaterTemperature: 65,
+            fanPower: 0,
+            cyclesOfConcentration: 4,
+            driftLossFactor: 0.0005,
+            lossCorrectionFactor: 1
+        },
+        staging: 0,
+        maxPartLoadRatio: 1,
+        coolingLoad: [300, 0, 500],
+        wetBulbTemperature: [60, 50, 70]
+    };
+
+    var res = bindings.chillerPlantSimulation(inp);
+    t.equal(res.operatingHours, 2, 'res.operatingHours is ' + res.operatingHours);
+    t.same(res.chillerRunHours, [2], 'res.chillerRunHours is ' + res.chillerRunHours);
+    t.same(res.hourlyPlantPower.map(rnd), [261.6, 0, 420], 'res.hourlyPlantPower is ' + res.hourlyPlantPower);
+    t.equal(rnd(res.chillerEnergy), rnd(441.6), 'res.chillerEnergy is ' + res.chillerEnergy);
+    t.equal(rnd(res.pumpEnergy), rnd(240), 'res.pumpEnergy is ' + res.pumpEnergy);
+    t.equal(rnd(res.efficiency), rnd(0.852), 'res.efficiency is ' + res.efficiency);
+    t.equal(rnd(res.evaporation), rnd(1332.816123), 'res.evaporation is ' + res.evaporation);
+    t.equal(rnd(res.makeupWater), rnd(1867.088164), 'res.makeupWater is ' + res.makeupWater);
+    t.same(res.hourlyMakeupWater.map(rnd), [698.305444, 0, 1168.78272], 'res.hourlyMakeupWater is ' + res.hourlyMakeupWater);
+});
@@ -236,4 +236,74 @@ test('CompressedAirCentrifugal BlowOff', function (t) {
     compare(bindings.CompressedAir(input), [370.885, 376.788, 0.82, 0.120073, 2133.21, 0.6798]);
     input.adjustForDischargePressure = true;
     compare(bindings.CompressedAir(input), [370.885, 376.79, 0.82, 0.120073, 2133.21, 0.6798]);
-});
\ No newline at end of file
+});
+test('compressedAirSystemSimulation', function (t) {
+    t.plan(8);
+    t.type(bindings.compressedAirSystemSimulation, 'function');
+
+    var input = {
+        compressors: [
+            {controlType: 0, powerAtFullLoad: 452.3, capacityAtFullLoad: 3138, powerAtNoLoad: 71.3},
+            {controlType: 1, powerAtFullLoad: 452.3, capacityAtFullLoad: 3138, powerAtNoLoad: 71.3,
+                capacityAtMaxFullFlow: 3005, powerAtUnload: 411.9, capacityAtUnload: 2731},
+            {controlType: 2, powerAtFullLoad: 452.3, capacityAtFullLoad: 3138, powerAtBlowOff: 370.9, surgeFlow: 2510}
+        ],
+        storageCapacity: 0, pressureBand: 10, timeStep: 1,
+        demand: new Float64Array([753.12, 4000]),
+        power: new Float64Array(6),
+        loadState: new Float64Array(6)
+    };
+
+    var res = bindings.compressedAirSystemSimulation(input);
+    t.equal(rnd(input.power[0]), rnd(162.828), 'power[0] is ' + input.power[0]);
+    t.equal(input.loadState[2], 0, 'loadState[2] is ' + input.loadState[2]);
+    t.equal(input.loadState[3], 2, 'loadState[3] is ' + input.loadState[3]);
+    t.equal(input.loadState[4], 1, 'loadState[4] is ' + input.loadState[4]);
+    t.equal(rnd(res.compressors[0].energy), rnd(162.828 + 452.3), 'res.compressors[0].energy is ' + res.compressors[0].energy);
+    t.equal(rnd(res.energy), rnd(input.power.reduce(function (a, b) { return a + b; }, 0)), 'res.energy is ' + res.energy);
+    t.equal(rnd(res.hours), rnd(2), 'res.hours is ' + res.hours);
+});
+
+test('compressedAirSequencingOptimizer', function (t) {
+    t.plan(5);
+    t.type(bindings.compressedAirSequencingOptimizer, 'function');
+
+    var demand = [];
+    for (var hour = 0; hour < 24; hour++) demand.push(hour >= 7 && hour < 19 ? 4000 : 1500);
+    var input = {
+        compressors: [
+            {controlType: 0, powerAtFullLoad: 452.3, capacityAtFullLoad: 3138, powerAtNoLoad: 71.3},
+            {controlType: 1, powerAtFullLoad: 452.3, capacityAtFullLoad: 3138, powerAtNoLoad: 71.3,
+                capacityAtMaxFullFlow: 3005, powerAtUnload: 411.9, capacityAtUnload: 2731},
+            {controlType: 2, powerAtFullLoad: 452.3, capacityAtFullLoad: 3138, powerAtBlowOff: 370.9, surgeFlow: 2510}
+        ],
+        demand: new Float64Array(demand), timeStep: 1, storageCapacity: 100,
+        electricityCost: 0.1, storageCost: 0.01, pressureBands: [5, 10], storageAdditions: [0, 5000], strategies: 3
+    };
+
+    var res = bindings.compressedAirSequencingOptimizer(input);
+    t.equal(res.candidates, 16, 'res.candidates is ' + res.candidates);
+    t.equal(res.strategies.length, 3, 'res.strategies.length is ' + res.strategies.length);
+    t.equal(res.strategies[0].pressureBand, 5, 'res.strategies[0].pressureBand is ' + res.strategies[0].pressureBand);
+    t.ok(res.strategies[0].totalCost <= res.strategies[1].totalCost, 'strategies are ranked by total cost');
+});
+
+test('compressedAirNetwork', function (t) {
+    t.plan(6);
+    t.type(bindings.compressedAirNetwork, 'function');
+
+    // two equal pipes in parallel from the compressor to one junction
+    var input = {
+        nodes: [{supply: true, pressure: 100}, {demand: 600}],
+        pipes: [{from: 0, to: 1, length: 500, diameter: 1.5}, {from: 1, to: 0, length: 500, diameter: 1.5}]
+    };
+
+    var res = bindings.compressedAirNetwork(input);
+    var drop = res.pressureDrops[0];
+    var harris = 0.1025 * 500 * 300 * 300 / (3600 * (100 - drop / 2 + 14.7) / 14.7 * Math.pow(1.5, 5.31));
+    t.ok(res.converged, 'res.converged is ' + res.converged);
+    t.equal(rnd(res.flows[0]), rnd(300), 'res.flows[0] is ' + res.flows[0]);
+    t.equal(rnd(res.flows[1]), rnd(-300), 'res.flows[1] is ' + res.flows[1]);
+    t.equal(rnd(res.supplies[0]), rnd(600), 'res.supplies[0] is ' + res.supplies[0]);
+    t.equal(rnd(drop), rnd(harris), 'res.pressureDrops[0] is ' + drop);
+});
@@ -21,4 +21,23 @@ test('phast energy Input EAF', function (t) {
     var res = bindings.energyInputEAF(inp);
     t.equal(res.heatDelivered, 167116000.0, 'res.heatDelivered is ' + res.heatDelivered);
     t.equal(rnd(res.totalChemicalEnergyInput), rnd(105700000), 'res.totalChemicalEnergyInput is ' + res.totalChemicalEnergyInput);
-});
\ No newline at end of file
+});
+
+test('phast energy Input EAF batch', function (t) {
+    t.plan(4);
+    t.type(bindings.energyInputEAFBatch, 'function');
+    var inp = {
+        naturalGasHeatInput: new Float64Array([50]),
+        coalCarbonInjection: new Float64Array([3300]),
+        coalHeatingValue: new Float64Array([9000]),
+        electrodeUse: new Float64Array([500]),
+        electrodeHeatingValue: new Float64Array([12000]),
+        otherFuels: new Float64Array([20]),
+        electricityInput: new Float64Array([18000])
+    };
+    var out = { heatDelivered: new Float64Array(1), totalChemicalEnergyInput: new Float64Array(1) };
+    var rows = bindings.energyInputEAFBatch(inp, out);
+    t.equal(rows, 1);
+    t.equal(out.heatDelivered[0], 167116000.0, 'out.heatDelivered[0] is ' + out.heatDelivered[0]);
+    t.equal(rnd(out.totalChemicalEnergyInput[0]), rnd(105700000), 'out.totalChemicalEnergyInput[0] is ' + out.totalChemicalEnergyInput[0]);
+});
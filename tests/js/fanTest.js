@@ -33,6 +33,30 @@ test('fansExisting', function (t) {
     t.equal(rnd(output.fanEnergyIndex), rnd(1.247872));
 });
 
+test('fansExistingBatch', function (t) {
+    t.plan(5);
+    t.type(bindings.fanResultsExistingBatch, 'function');
+
+    var single = {
+        "fanSpeed": 1180, "drive": 0, "lineFrequency": 0, "motorRatedPower": 600, "motorRpm": 1180,
+        "efficiencyClass": 1, "specifiedEfficiency": 100, "motorRatedVoltage": 460, "fullLoadAmps": 683.2505707137,
+        "sizeMargin": 1, "measuredPower": 460, "measuredVoltage": 460, "measuredAmps": 660, "flowRate": 129691,
+        "inletPressure": -16.36, "outletPressure": 1.1, "compressibilityFactor": 0.988, "loadEstimationMethod": 0,
+        "operatingHours": 8760, "unitCost": 0.06, "airDensity": 1.02
+    };
+    var input = {};
+    Object.keys(single).forEach(function (key) {
+        input[key] = new Float64Array([single[key], single[key]]);
+    });
+    var output = { fanEfficiency: new Float64Array(2), annualCost: new Float64Array(2) };
+
+    var rows = bindings.fanResultsExistingBatch(input, output);
+    t.equal(rows, 2);
+    t.equal(rnd(output.fanEfficiency[0]), rnd(59.5398315));
+    t.equal(rnd(output.fanEfficiency[1]), rnd(59.5398315));
+    t.equal(rnd(output.annualCost[1]), rnd(241.776));
+});
+
 test('fansModified', function (t) {
     t.plan(11);
 
@@ -135,4 +135,99 @@ test('humidityRatio', function (t) {
     t.equal(rnd(res.humidityRatioUsingRH), rnd(0.028113628942036617), 'res.humidityRatioUsingRH is ' + res.humidityRatioUsingRH);
     t.equal(rnd(res.humidityRatioUsingWBT), rnd(0.024579434176341366), 'res.humidityRatioUsingWBT is ' + res.humidityRatioUsingWBT);
 
-});
\ No newline at end of file
+});
+test('furnaceHeatBalance', function (t) {
+    t.plan(8);
+    t.type(bindings.furnaceHeatBalance, 'function');
+    t.type(bindings.furnaceHeatBalanceAssessment, 'function');
+
+    var furnace = {
+        walls: [{surfaceArea: 500, ambientTemperature: 80, surfaceTemperature: 225, windVelocity: 10,
+            surfaceEmissivity: 0.9, conditionFactor: 1.394, correctionFactor: 1}],
+        atmospheres: [{inletTemperature: 100, outletTemperature: 1400, flowRate: 1200, correctionFactor: 1,
+            specificHeat: 0.02}],
+        waterCoolings: [{flowRate: 100, initialTemperature: 80, outletTemperature: 120, correctionFactor: 1}],
+        otherLosses: [{heatLoss: 10000}]
+    };
+
+    var res = bindings.furnaceHeatBalance(furnace);
+    t.equal(rnd(res.walls), rnd(404627.551342992), 'res.walls is ' + res.walls);
+    t.equal(rnd(res.totalNetHeatRequired), rnd(2434859.551342992), 'res.totalNetHeatRequired is ' + res.totalNetHeatRequired);
+    t.equal(rnd(res.availableHeat), rnd(100), 'res.availableHeat is ' + res.availableHeat);
+    t.equal(rnd(res.grossHeatInput), rnd(2434859.551342992), 'res.grossHeatInput is ' + res.grossHeatInput);
+
+    var modification = {atmospheres: furnace.atmospheres, waterCoolings: furnace.waterCoolings};
+    res = bindings.furnaceHeatBalanceAssessment([{baseline: furnace, modification: modification}]);
+    t.equal(rnd(res.energySavings), rnd(414627.551342992), 'res.energySavings is ' + res.energySavings);
+    t.equal(rnd(res.furnaces[0].modification.grossHeatInput), rnd(2020232), 'res.furnaces[0].modification.grossHeatInput is ' + res.furnaces[0].modification.grossHeatInput);
+});
+
+test('furnaceEfficiencyOptimization', function (t) {
+    t.plan(7);
+    t.type(bindings.furnaceEfficiencyOptimization, 'function');
+
+    var inp = {
+        flueGasTemp: 1600, o2FlueGas: 5, combAirTemp: 80, o2CombAir: 21, fuelConsumption: 10, operatingHours: 8000,
+        fuelCost: 5, oxygenCost: 4, stoichiometricOxygen: 1980, fuelHeatingValue: 1020, ambientTemp: 80,
+        recuperatorEffectiveness: 0.6,
+        combAirTemps: {minimum: 80, maximum: 1180, step: 100},
+        o2FlueGases: {minimum: 1, maximum: 5, step: 1},
+        o2CombAirs: {minimum: 21, maximum: 35, step: 2}
+    };
+
+    var res = bindings.furnaceEfficiencyOptimization(inp);
+    t.equal(res.candidates, 480, 'res.candidates is ' + res.candidates);
+    t.equal(res.feasibleCandidates, 400, 'res.feasibleCandidates is ' + res.feasibleCandidates);
+    t.equal(res.paretoSet.length, 8, 'res.paretoSet.length is ' + res.paretoSet.length);
+    t.equal(res.paretoSet[0].combAirTemp, 980, 'res.paretoSet[0].combAirTemp is ' + res.paretoSet[0].combAirTemp);
+    t.equal(rnd(res.paretoSet[0].fuelSavings), rnd(34.91394515), 'res.paretoSet[0].fuelSavings is ' + res.paretoSet[0].fuelSavings);
+    t.equal(rnd(res.baseline.totalCost), rnd(400000), 'res.baseline.totalCost is ' + res.baseline.totalCost);
+});
+
+test('multiZoneFurnace', function (t) {
+    t.plan(6);
+    t.type(bindings.multiZoneFurnace, 'function');
+
+    var furnace = {
+        charge: {thermicReactionType: 0, specificHeatSolid: 0.247910198232625, latentHeat: 169,
+            specificHeatLiquid: 0.260090757105326, meltingPoint: 1214.996, chargeFeedRate: 10000,
+            waterContentCharged: 0, waterContentDischarged: 0, initialTemperature: 70,
+            waterVaporDischargeTemperature: 250, chargeMelted: 10, chargeReacted: 0, reactionHeat: 100,
+            additionalHeat: 0},
+        zones: [{grossHeatInput: 247910.198232625}, {grossHeatInput: -247910.198232625 / 2}]
+    };
+
+    var res = bindings.multiZoneFurnace(furnace);
+    t.equal(rnd(res.zones[0].chargeOutletTemperature), rnd(170), 'res.zones[0].chargeOutletTemperature is ' + res.zones[0].chargeOutletTemperature);
+    t.equal(rnd(res.dischargeTemperature), rnd(120), 'res.dischargeTemperature is ' + res.dischargeTemperature);
+    t.equal(rnd(res.efficiency), rnd(100), 'res.efficiency is ' + res.efficiency);
+
+    res = bindings.multiZoneFurnace([furnace, {charge: furnace.charge, zones: [furnace.zones[0]]}]);
+    t.equal(res.length, 2, 'res.length is ' + res.length);
+    t.equal(rnd(res[1].dischargeTemperature), rnd(170), 'res[1].dischargeTemperature is ' + res[1].dischargeTemperature);
+});
+
+test('eafHeatBalance', function (t) {
+    t.plan(6);
+    t.type(bindings.eafHeatBalance, 'function');
+
+    var heat = {
+        tapWeight: 100, coalHeatingValue: 9000, electrodeHeatingValue: 12000,
+        slags: [{weight: 3000, inletTemperature: 500, outletTemperature: 2800, specificHeat: 0.25, correctionFactor: 1}],
+        samples: {
+            duration: new Float64Array([0.5, 0.25]), electricityInput: new Float64Array([18000, 18000]),
+            naturalGasHeatInput: new Float64Array([50, 15]), coalCarbonInjection: new Float64Array([3300, 900]),
+            electrodeUse: new Float64Array([500, 200]), otherFuels: new Float64Array([20, 0]),
+            offGasTemp: new Float64Array([2800, 2800]), CO: new Float64Array([12, 8]), H2: new Float64Array([10, 6]),
+            combustibleGases: new Float64Array([3, 3]), vfr: new Float64Array([8000, 6500]),
+            dustLoading: new Float64Array([0.001, 0.001])
+        }
+    };
+
+    var res = bindings.eafHeatBalance([heat, heat]);
+    t.equal(res.length, 2, 'res.length is ' + res.length);
+    t.equal(rnd(res[0].electricityPerTon), rnd(135), 'res[0].electricityPerTon is ' + res[0].electricityPerTon);
+    t.equal(rnd(res[0].totalEnergyInput), rnd(105287000), 'res[0].totalEnergyInput is ' + res[0].totalEnergyInput);
+    t.equal(rnd(res[0].slagLosses), rnd(1725000), 'res[0].slagLosses is ' + res[0].slagLosses);
+    t.equal(rnd(res[1].energyPerTon), rnd(105287000 / 3412 / 100), 'res[1].energyPerTon is ' + res[1].energyPerTon);
+});
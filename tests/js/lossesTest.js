@@ -18,6 +18,39 @@ test('atmosphere', function (t) {
     t.equal(res, rnd(31200.0), res + " != 31200.0");
 });
 
+test('atmosphereBatch', function (t) {
+    t.plan(4);
+    t.type(bindings.atmosphereBatch, 'function');
+
+    var inp = {
+        inletTemperature: new Float64Array([100.0, 100.0]), outletTemperature: new Float64Array([1400.0, 1400.0]),
+        flowRate: new Float64Array([1200.0, 2400.0]), correctionFactor: new Float64Array([1.0, 1.0]),
+        specificHeat: new Float64Array([0.02, 0.02])
+    };
+    var out = { heatLoss: new Float64Array(2) };
+
+    var rows = bindings.atmosphereBatch(inp, out);
+    t.equal(rows, 2);
+    t.equal(out.heatLoss[0], rnd(31200.0), out.heatLoss[0] + " != 31200.0");
+    t.equal(out.heatLoss[1], rnd(62400.0), out.heatLoss[1] + " != 62400.0");
+});
+
+test('atmosphereSeries', function (t) {
+    t.plan(4);
+    t.type(bindings.atmosphereSeries, 'function');
+
+    var inp = {
+        inletTemperature: 100.0, outletTemperature: 1400.0, flowRate: 1200.0, correctionFactor: 1.0, specificHeat: 0.02
+    };
+    var series = { flowRate: new Float64Array([1200.0, 2400.0]) };
+    var out = { heatLoss: new Float64Array(2) };
+
+    var samples = bindings.atmosphereSeries(inp, series, out);
+    t.equal(samples, 2);
+    t.equal(out.heatLoss[0], rnd(31200.0), out.heatLoss[0] + " != 31200.0");
+    t.equal(out.heatLoss[1], rnd(62400.0), out.heatLoss[1] + " != 62400.0");
+});
+
 test('auxiliaryPower', function (t) {
     t.plan(6);
     t.type(bindings.auxiliaryPowerLoss, 'function');
@@ -83,6 +116,26 @@ test('flueGasByVolume', function (t) {
     t.equal(rnd(res.specificGravity), rnd(0.631783));
 });
 
+test('flueGasLossesByVolumeBatch', function (t) {
+    t.plan(4);
+    t.type(bindings.flueGasLossesByVolumeBatch, 'function');
+
+    var inp = {
+        flueGasTemperature: new Float64Array([700, 700]), excessAirPercentage: new Float64Array([9.0, 9.0]),
+        combustionAirTemperature: new Float64Array([125, 125]), fuelTemperature: new Float64Array([125, 125]),
+        CH4: new Float64Array([94.1, 94.1]), C2H6: new Float64Array([2.4, 2.4]), N2: new Float64Array([1.41, 1.41]),
+        H2: new Float64Array([0.03, 0.03]), C3H8: new Float64Array([0.49, 0.49]),
+        C4H10_CnH2n: new Float64Array([0.29, 0.29]), H2O: new Float64Array([0, 0]), CO: new Float64Array([0.42, 0.42]),
+        CO2: new Float64Array([0.71, 0.71]), SO2: new Float64Array([0, 0]), O2: new Float64Array([0, 0])
+    };
+    var out = { heatLoss: new Float64Array(2) };
+
+    var rows = bindings.flueGasLossesByVolumeBatch(inp, out);
+    t.equal(rows, 2);
+    t.equal(rnd(out.heatLoss[0]), rnd(0.7689954663391211), out.heatLoss[0] + ' != 0.7689954663391211');
+    t.equal(rnd(out.heatLoss[1]), rnd(0.7689954663391211), out.heatLoss[1] + ' != 0.7689954663391211');
+});
+
 test('flueGasByMass', function (t) {
     t.plan(4);
     t.type(bindings.flueGasLossesByMass, 'function');
@@ -106,6 +159,25 @@ test('flueGasByMass', function (t) {
     t.equal(rnd(res), rnd(13877.969543))
 });
 
+test('flueGasLossesByMassBatch', function (t) {
+    t.plan(3);
+    t.type(bindings.flueGasLossesByMassBatch, 'function');
+
+    var inp = {
+        flueGasTemperature: new Float64Array([700]), excessAirPercentage: new Float64Array([9.0]),
+        combustionAirTemperature: new Float64Array([125]), fuelTemperature: new Float64Array([70]),
+        moistureInAirComposition: new Float64Array([1.0]), ashDischargeTemperature: new Float64Array([100]),
+        unburnedCarbonInAsh: new Float64Array([1.5]), carbon: new Float64Array([75.0]),
+        hydrogen: new Float64Array([5.0]), sulphur: new Float64Array([1.0]), inertAsh: new Float64Array([9.0]),
+        o2: new Float64Array([7.0]), moisture: new Float64Array([0.0]), nitrogen: new Float64Array([1.5])
+    };
+    var out = { heatLoss: new Float64Array(1) };
+
+    var rows = bindings.flueGasLossesByMassBatch(inp, out);
+    t.equal(rows, 1);
+    t.equal(rnd(out.heatLoss[0]), rnd(0.8222977480707968), out.heatLoss[0] + ' != 0.8222977480707968');
+});
+
 test('flueGasCalculateExcessAir', function (t) {
     t.plan(4);
     t.type(bindings.flueGasCalculateExcessAir, 'function');
@@ -114,15 +186,15 @@ test('flueGasCalculateExcessAir', function (t) {
     };
 
     var res = bindings.flueGasCalculateExcessAir(inp);
-    t.equal(rnd(res), rnd(2.3172209488353976));
+    t.equal(rnd(res), rnd(2.3475757156341558));
 
     inp.o2InFlueGas = 3;
     res = bindings.flueGasCalculateExcessAir(inp);
-    t.equal(rnd(res), rnd(15.52234414568954));
+    t.equal(rnd(res), rnd(15.8373764696527));
 
     inp.o2InFlueGas = 7;
     res = bindings.flueGasCalculateExcessAir(inp);
-    t.equal(rnd(res), rnd(45.197503654937584));
+    t.equal(rnd(res), rnd(46.134966237685843));
 });
 
 test('flueGasCalculateO2', function (t) {
@@ -154,15 +226,15 @@ test('flueGasByMassCalculateExcessAir', function (t) {
     };
 
     var res = bindings.flueGasByMassCalculateExcessAir(inp);
-    t.equal(rnd(res), rnd(2.29427816716376));
+    t.equal(rnd(res), rnd(2.3241894381856008));
 
     inp.o2InFlueGas = 3.0;
     res = bindings.flueGasByMassCalculateExcessAir(inp);
-    t.equal(rnd(res), rnd(15.368657569989644));
+    t.equal(rnd(res), rnd(15.705185583751272));
 
     inp.o2InFlueGas = 7.0;
     res = bindings.flueGasByMassCalculateExcessAir(inp);
-    t.equal(rnd(res), rnd(44.75000361875009));
+    t.equal(rnd(res), rnd(45.918132188077104));
 });
 
 test('flueGasByMassCalculateO2', function (t) {
@@ -218,6 +290,24 @@ test('gasLoadChargeMaterial', function (t) {
     t.equal(res, rnd(383530.0), res + ' != 383530.0');
 });
 
+test('gasLoadChargeMaterialBatch', function (t) {
+    t.plan(3);
+    t.type(bindings.gasLoadChargeMaterialBatch, 'function');
+
+    var inp = {
+        thermicReactionType: new Float64Array([0]), specificHeatGas: new Float64Array([0.24]),
+        feedRate: new Float64Array([1000]), percentVapor: new Float64Array([15]),
+        initialTemperature: new Float64Array([80]), dischargeTemperature: new Float64Array([1150]),
+        specificHeatVapor: new Float64Array([0.5]), percentReacted: new Float64Array([100]),
+        reactionHeat: new Float64Array([80]), additionalHeat: new Float64Array([5000])
+    };
+    var out = { totalHeat: new Float64Array(1) };
+
+    var rows = bindings.gasLoadChargeMaterialBatch(inp, out);
+    t.equal(rows, 1);
+    t.equal(out.totalHeat[0], rnd(383530.0), out.totalHeat[0] + ' != 383530.0');
+});
+
 test('leakageLosses', function (t) {
     t.plan(2);
     t.type(bindings.leakageLosses, 'function');
@@ -259,6 +349,25 @@ test('liquidLoadChargeMaterial', function (t) {
     t.equal(res, rnd(364100.0), res + ' != 364100.0');
 });
 
+test('liquidLoadChargeMaterialBatch', function (t) {
+    t.plan(3);
+    t.type(bindings.liquidLoadChargeMaterialBatch, 'function');
+
+    var inp = {
+        thermicReactionType: new Float64Array([0]), specificHeatLiquid: new Float64Array([0.48]),
+        vaporizingTemperature: new Float64Array([240]), latentHeat: new Float64Array([250]),
+        specificHeatVapor: new Float64Array([0.25]), chargeFeedRate: new Float64Array([1000]),
+        initialTemperature: new Float64Array([70]), dischargeTemperature: new Float64Array([320]),
+        percentVaporized: new Float64Array([100]), percentReacted: new Float64Array([25]),
+        reactionHeat: new Float64Array([50]), additionalHeat: new Float64Array([0])
+    };
+    var out = { totalHeat: new Float64Array(1) };
+
+    var rows = bindings.liquidLoadChargeMaterialBatch(inp, out);
+    t.equal(rows, 1);
+    t.equal(out.totalHeat[0], rnd(364100.0), out.totalHeat[0] + ' != 364100.0');
+});
+
 test('openingLosses - both circular and quad', function (t) {
     t.plan(3);
     t.type(bindings.openingLossesCircular, 'function');
@@ -355,6 +464,24 @@ test('wallLosses', function (t) {
     t.equal(rnd(res), rnd(404627.551342992), res + ' != 404627.551342992');
 });
 
+test('wallLossesBatch', function (t) {
+    t.plan(4);
+    t.type(bindings.wallLossesBatch, 'function');
+
+    var inp = {
+        surfaceArea: new Float64Array([500, 500]), ambientTemperature: new Float64Array([80, 80]),
+        surfaceTemperature: new Float64Array([225, 225]), windVelocity: new Float64Array([10, 10]),
+        surfaceEmissivity: new Float64Array([0.9, 0.9]), conditionFactor: new Float64Array([1.394, 1.394]),
+        correctionFactor: new Float64Array([1, 0.5])
+    };
+    var out = { heatLoss: new Float64Array(2) };
+
+    var rows = bindings.wallLossesBatch(inp, out);
+    t.equal(rows, 2);
+    t.equal(rnd(out.heatLoss[0]), rnd(404627.551342992), out.heatLoss[0] + ' != 404627.551342992');
+    t.equal(rnd(out.heatLoss[1]), rnd(404627.551342992 * 0.5), out.heatLoss[1] + ' != 202313.775671496');
+});
+
 test('waterCoolingLosses', function (t) {
     t.plan(2);
     t.type(bindings.waterCoolingLosses, 'function');
@@ -379,6 +506,21 @@ test('exhaustGasEAF', function (t) {
     t.equal(rnd(res), rnd(12553119.018404908), res + ' != 12553119.018405');
 });
 
+test('exhaustGasEAFBatch', function (t) {
+    t.plan(3);
+    t.type(bindings.exhaustGasEAFBatch, 'function');
+
+    var inp = {
+        offGasTemp: new Float64Array([2800]), CO: new Float64Array([12]), H2: new Float64Array([10]),
+        combustibleGases: new Float64Array([3]), vfr: new Float64Array([8000]), dustLoading: new Float64Array([0.001])
+    };
+    var out = { totalHeatExhaust: new Float64Array(1) };
+
+    var rows = bindings.exhaustGasEAFBatch(inp, out);
+    t.equal(rows, 1);
+    t.equal(rnd(out.totalHeatExhaust[0]), rnd(12553119.018404908), out.totalHeatExhaust[0] + ' != 12553119.018405');
+});
+
 test('energyInputExhaustGasLosses', function (t) {
     t.plan(4);
     t.type(bindings.energyInputExhaustGasLosses, 'function');
@@ -99,6 +99,25 @@ test('steamProperties', function (t) {
 
 });
 
+test('steamPropertiesBatch', function (t) {
+    t.plan(6);
+    t.type(bindings.steamPropertiesBatch, 'function');
+
+    var inp = {
+        pressure: new Float64Array([10, 10]),
+        thermodynamicQuantity: new Float64Array([1, 1]), //1 is ENTHALPY
+        quantityValue: new Float64Array([2000, 2000])
+    };
+    var out = { temperature: new Float64Array(2), quality: new Float64Array(2) };
+
+    var rows = bindings.steamPropertiesBatch(inp, out);
+    t.equal(rows, 2);
+    t.equal(rnd(out.temperature[0]), rnd(584.1494879985282), 'temperature[0] is ' + out.temperature[0]);
+    t.equal(rnd(out.temperature[1]), rnd(584.1494879985282), 'temperature[1] is ' + out.temperature[1]);
+    t.equal(rnd(out.quality[0]), rnd(0.44940059413065064), 'quality[0] is ' + out.quality[0]);
+    t.equal(rnd(out.quality[1]), rnd(0.44940059413065064), 'quality[1] is ' + out.quality[1]);
+});
+
 test('boiler', function (t) {
     t.plan(8);
     t.type(bindings.boiler, 'function');
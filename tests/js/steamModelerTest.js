@@ -30,6 +30,25 @@ test('steamModeler', function (t) {
     t.end();
 });
 
+test('solverStatistics', function (t) {
+    t.type(bindings.solverStatistics, 'function');
+    t.type(bindings.resetSolverStatistics, 'function');
+
+    bindings.resetSolverStatistics();
+    bindings.steamModeler(makeSteamModelerInput());
+    var stats = bindings.solverStatistics();
+    t.type(stats.enabled, 'boolean');
+
+    var runner = stats.solvers.steamModelRunner;
+    t.equal(runner.calls, stats.enabled ? 1 : 0, 'the model run is counted only when enabled');
+    t.equal(runner.failures, 0);
+    t.equal(runner.histogram.reduce(function (sum, bucket) { return sum + bucket.calls; }, 0), runner.calls);
+
+    bindings.resetSolverStatistics();
+    t.equal(bindings.solverStatistics().solvers.steamModelRunner.calls, 0);
+    t.end();
+});
+
 function makeSteamModelerInput() {
     var boilerInput = {
         fuelType: 1,
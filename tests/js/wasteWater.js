@@ -235,4 +235,65 @@ test('WasteWaterTreatment 3', function (t) {
     console.log("Calculations Table Begin");
     console.log(JSON.stringify(res.calculationsTable));
     console.log("Calculations Table End");
-});
\ No newline at end of file
+});
+
+test('WasteWaterTreatmentBatch', function (t) {
+    t.plan(8);
+    t.type(bindings.WasteWaterTreatmentBatch, 'function');
+
+    var scenarios = [3000, 3300].map(function (MLSSpar) {
+        return {
+            Temperature: 20, So: 200, Volume: 1, FlowRate: 1, InertVSS: 40, OxidizableN: 35, Biomass: 0.85,
+            InfluentTSS: 200, InertInOrgTSS: 20, EffluentTSS: 8, RASTSS: 10000, MLSSpar: MLSSpar, FractionBiomass: 0.1,
+            BiomassYeild: 0.6, HalfSaturation: 60, MicrobialDecay: 0.1, MaxUtilizationRate: 8, MaxDays: 72,
+            TimeIncrement: 2, OperatingDO: 4.5, Alpha: 0.84, Beta: 0.92, SOTR: 2.7, Aeration: 150, Elevation: 200,
+            OperatingTime: 24, TypeAerators: 1, Speed: 100, EnergyCostUnit: 0.09
+        };
+    });
+
+    var res = bindings.WasteWaterTreatmentBatch({scenarios: scenarios});
+
+    t.equal(res.length, 2);
+    t.equal(rnd(res[0].SolidsRetentionTime), rnd(29.00));
+    t.equal(rnd(res[0].MLSS), rnd(3082.50));
+    t.equal(rnd(res[0].EffluentNO3_N), rnd(26.17));
+    t.equal(res[0].calculationsTable, undefined);
+
+    var single = bindings.WasteWaterTreatment(scenarios[1]);
+    t.equal(res[1].SolidsRetentionTime, single.SolidsRetentionTime);
+    t.equal(res[1].TotalOxygenReqWDenit, single.TotalOxygenReqWDenit);
+});
+
+
+test('WasteWaterAerationOptimization', function (t) {
+    t.plan(7);
+    t.type(bindings.WasteWaterAerationOptimization, 'function');
+
+    var inp = {
+        plant: {
+            Temperature: 20, So: 200, Volume: 1, FlowRate: 1, InertVSS: 40, OxidizableN: 35, Biomass: 0.85,
+            InfluentTSS: 200, InertInOrgTSS: 20, EffluentTSS: 8, RASTSS: 10000, MLSSpar: 3000, FractionBiomass: 0.1,
+            BiomassYeild: 0.6, HalfSaturation: 60, MicrobialDecay: 0.1, MaxUtilizationRate: 8, MaxDays: 72,
+            TimeIncrement: 2, OperatingDO: 4.5, Alpha: 0.84, Beta: 0.92, SOTR: 2.7, Aeration: 150, Elevation: 200,
+            OperatingTime: 24, TypeAerators: 1, Speed: 100, EnergyCostUnit: 0.09
+        },
+        speeds: {minimum: 50, maximum: 100, step: 5},
+        operatingTimes: {minimum: 12, maximum: 24, step: 2},
+        operatingDOs: {minimum: 1, maximum: 4.5, step: 0.5},
+        MLSSpars: {minimum: 2000, maximum: 4000, step: 250},
+        maxEffluentCBOD5: 5,
+        maxEffluentAmmonia_N: 1,
+        minMLSS: 1500,
+        maxMLSS: 4500,
+        denitrification: false
+    };
+
+    var res = bindings.WasteWaterAerationOptimization(inp);
+
+    t.equal(res.candidates, 5544);
+    t.equal(rnd(res.baseline.AeCost), rnd(6318));
+    t.ok(res.paretoSet.length > 1);
+    t.ok(res.paretoSet[0].AeCost < res.baseline.AeCost);
+    t.ok(res.paretoSet[0].TotalOxygenSupplied >= res.paretoSet[0].OxygenRequired);
+    t.ok(res.paretoSet[res.paretoSet.length - 1].EffluentAmmonia_N <= 1);
+});
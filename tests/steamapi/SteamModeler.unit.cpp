@@ -1,5 +1,7 @@
 #include "catch.hpp"
 #include <ssmt/api/SteamModeler.h>
+#include <ssmt/api/SteamModelerOutputFlattener.h>
+#include <set>
 
 static const BoilerInput makeBoilerInput() {
     return {1, 1, 85, 2, true, true, 514.2, .1, 0.204747, 10};
@@ -49,3 +51,31 @@ TEST_CASE("steamModeler", "[steam modeler]") {
 
     //TODO add asserts
 }
+
+TEST_CASE("steamModelerOutputFlattener", "[steam modeler]") {
+    const SteamModelerOutput output = SteamModeler().model(makeSteamModelerInput());
+    const auto fields = SteamModelerOutputFlattener::flatten(output);
+
+    // one field per expected data column of tests/at/csv/ssmtTestData.csv
+    CHECK(fields.size() == 536);
+    std::set<std::string> names;
+    for (auto const &field : fields) names.insert(field.name);
+    CHECK(names.size() == fields.size());
+
+    auto const find = [&fields](const std::string &name) {
+        for (auto const &field : fields) if (field.name == name) return field;
+        FAIL("missing field " + name);
+        return fields.front();
+    };
+
+    auto const steamPressure = find("boilerOutput_steamPressure");
+    CHECK(steamPressure.isPresent);
+    CHECK(steamPressure.value == Approx(output.boiler.getSteamProperties().pressure));
+    CHECK(find("operationsOutput_sitePowerDemand").isPresent);
+    CHECK(find("combinedCondensateOutput_volume").isPresent);
+
+    // single header model, so no medium or low pressure header components
+    CHECK_FALSE(find("mediumPressureHeaderSteamOutput_pressure").isPresent);
+    CHECK_FALSE(find("mediumPressureToLowPressurePrvOutput_inletPressure").isPresent);
+    CHECK_FALSE(find("lowPressureProcessSteamUsageOutput_processUsage").isPresent);
+}